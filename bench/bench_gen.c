@@ -0,0 +1,389 @@
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "corpus.h"
+
+// Times `bk` end-to-end and per phase (as reported by `--stats-csv`) over synthetic corpora of different shapes.
+// Every configuration runs twice per repetition: `cold` starts from an empty output directory, `warm` runs again
+// without changing anything so the analysis cache is hit. The median run (by wall time) of each configuration is
+// printed and appended to a CSV file.
+
+#define MAX_SHAPES 32
+#define MAX_JOBS 16
+#define MAX_PHASES 16
+
+/// Phases reported by `bk --stats-csv`, in the order of the CSV columns. They are taken from the first run, so they
+/// always match the `bk` that is benchmarked
+static char phase_names[MAX_PHASES][64];
+static size_t phase_count = 0;
+
+/// Phases printed to the terminal, every `bk` has to report them
+static const char* summary_phases[] = { "read", "analyze", "generate", "write" };
+#define SUMMARY_PHASES (sizeof summary_phases / sizeof *summary_phases)
+static size_t summary_index[SUMMARY_PHASES];
+
+/// The header of the CSV file needs the phase names, so it's written with the first row
+static bool csv_needs_header = false;
+
+typedef struct {
+    double wall_ms;
+    long peak_rss_kib;
+    double phase_ms[MAX_PHASES];
+} Sample;
+
+typedef struct {
+    const char* bk;
+    const char* dir;
+    const char* csv;
+    const char* label;
+    size_t repeat;
+    double scale;
+    unsigned seed;
+    size_t jobs[MAX_JOBS];
+    size_t jobs_len;
+    CorpusShape shapes[MAX_SHAPES];
+    size_t shapes_len;
+    /// Passed to `bk` after the options of the harness (e.g. schema files)
+    char** bk_args;
+    int bk_args_len;
+} Options;
+
+static const char* default_shapes[] = {
+    "small:100:4:8:1:0",
+    "files:2000:4:8:1:0",
+    "wide:200:4:64:1:0",
+    "deep:200:8:8:8:0",
+    "sparse:2000:4:8:1:90",
+};
+
+static void usage(const char* program) {
+    fprintf(stderr,
+        "Usage: %s [options] [-- <bk options>]\n"
+        "  --bk <path>        `bk` executable to benchmark (./build/bk)\n"
+        "  --dir <dir>        Directory for corpora and outputs, `<dir>/<shape>` is replaced (./build/bench)\n"
+        "  --csv <file>       Results are appended to this file (<dir>/results.csv)\n"
+        "  --label <name>     Value of the `label` column, to tell builds or option sets apart (default)\n"
+        "  --repeat <n>       Runs per configuration, the median run is reported (3)\n"
+        "  -j <list>          Comma separated thread counts passed to `bk -j` (1,<processors>)\n"
+        "  --shape <spec>     name:files:structs:fields:depth:nonmatching, can be used multiple times\n"
+        "                     (replaces the default shapes)\n"
+        "  --scale <factor>   Multiplies the number of files of every shape\n"
+        "  --seed <n>         Seed for field types (1)\n",
+        program);
+}
+
+/// Removes `path` and everything inside it, a missing `path` isn't an error
+static bool remove_tree(const char* path) {
+    struct stat st;
+    if (lstat(path, &st) != 0) return errno == ENOENT;
+    if (S_ISDIR(st.st_mode)) {
+        DIR* dir = opendir(path);
+        if (dir == NULL) return false;
+        bool ok = true;
+        struct dirent* entry;
+        while (ok && (entry = readdir(dir)) != NULL) {
+            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+            char child[4096];
+            if (snprintf(child, sizeof child, "%s/%s", path, entry->d_name) >= (int)sizeof child) ok = false;
+            else ok = remove_tree(child);
+        }
+        closedir(dir);
+        return ok && rmdir(path) == 0;
+    }
+    return unlink(path) == 0;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static bool parse_jobs(const char* list, Options* opts) {
+    opts->jobs_len = 0;
+    const char* it = list;
+    while (*it != '\0') {
+        char* end = NULL;
+        unsigned long jobs = strtoul(it, &end, 10);
+        if (end == it || (*end != ',' && *end != '\0') || opts->jobs_len == MAX_JOBS) return false;
+        opts->jobs[opts->jobs_len++] = (size_t)jobs;
+        it = *end == ',' ? end + 1 : end;
+    }
+    return opts->jobs_len > 0;
+}
+
+static bool parse_options(int argc, char** argv, Options* opts) {
+    bool custom_shapes = false;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--") == 0) {
+            opts->bk_args = argv + i + 1;
+            opts->bk_args_len = argc - i - 1;
+            return true;
+        }
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0 || value == NULL) return false;
+        ++i;
+        if (strcmp(arg, "--bk") == 0) opts->bk = value;
+        else if (strcmp(arg, "--dir") == 0) opts->dir = value;
+        else if (strcmp(arg, "--csv") == 0) opts->csv = value;
+        else if (strcmp(arg, "--label") == 0) opts->label = value;
+        else if (strcmp(arg, "--repeat") == 0) opts->repeat = strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--scale") == 0) opts->scale = strtod(value, NULL);
+        else if (strcmp(arg, "--seed") == 0) opts->seed = (unsigned)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "-j") == 0) {
+            if (!parse_jobs(value, opts)) {
+                fprintf(stderr, "ERROR: Invalid thread counts '%s'\n", value);
+                return false;
+            }
+        } else if (strcmp(arg, "--shape") == 0) {
+            if (!custom_shapes) opts->shapes_len = 0;
+            custom_shapes = true;
+            if (opts->shapes_len == MAX_SHAPES || !corpus_parse_shape(value, &opts->shapes[opts->shapes_len])) {
+                fprintf(stderr, "ERROR: Invalid shape '%s'\n", value);
+                return false;
+            }
+            ++opts->shapes_len;
+        } else {
+            fprintf(stderr, "ERROR: Unknown option '%s'\n", arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Picks the phase times out of the `--stats-csv` report. The first report decides which phases there are, every later
+/// one has to contain the same phases in the same order
+static bool parse_stats(char* report, Sample* sample) {
+    bool learn = phase_count == 0;
+    bool header = false;
+    size_t phases = 0;
+    for (char* line = strtok(report, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+        if (strcmp(line, "kind,name,value,count") == 0) header = true;
+        if (!header || strncmp(line, "phase,", 6) != 0) continue;
+        char* name = line + 6;
+        char* value = strchr(name, ',');
+        if (value == NULL) break;
+        *value++ = '\0';
+        if (phases == MAX_PHASES || strlen(name) >= sizeof *phase_names) {
+            fprintf(stderr, "ERROR: Too many or too long phases in the statistics of `bk`\n");
+            return false;
+        }
+        if (learn) {
+            strcpy(phase_names[phases], name);
+        } else if (phases >= phase_count || strcmp(phase_names[phases], name) != 0) {
+            fprintf(stderr, "ERROR: `bk` reported the unexpected phase '%s'\n", name);
+            return false;
+        }
+        sample->phase_ms[phases++] = strtod(value, NULL);
+    }
+    if (phases == 0 || (!learn && phases != phase_count)) {
+        fprintf(stderr, "ERROR: `bk` didn't report %s phases with `--stats-csv`\n", phases == 0 ? "any" : "all");
+        return false;
+    }
+    if (!learn) return true;
+
+    phase_count = phases;
+    for (size_t i = 0; i < SUMMARY_PHASES; ++i) {
+        size_t p = 0;
+        while (p < phase_count && strcmp(phase_names[p], summary_phases[i]) != 0) ++p;
+        if (p == phase_count) {
+            fprintf(stderr, "ERROR: `bk` didn't report the phase '%s'\n", summary_phases[i]);
+            return false;
+        }
+        summary_index[i] = p;
+    }
+    return true;
+}
+
+/// Runs `bk` once and records its wall time, peak RSS and phase times
+static bool run_bk(const Options* opts, const char* src, const char* out, size_t jobs, Sample* sample) {
+    char jobs_str[32];
+    snprintf(jobs_str, sizeof jobs_str, "%zu", jobs);
+    const char* fixed[] = { opts->bk, "-I", src, "-o", out, "-om", "dir", "-j", jobs_str, "--silent", "--stats-csv" };
+    size_t fixed_len = sizeof fixed / sizeof *fixed;
+    char** argv = malloc(sizeof(char*) * (fixed_len + opts->bk_args_len + 1)); // alloc
+    for (size_t i = 0; i < fixed_len; ++i) argv[i] = (char*)fixed[i];
+    for (int i = 0; i < opts->bk_args_len; ++i) argv[fixed_len + i] = opts->bk_args[i];
+    argv[fixed_len + opts->bk_args_len] = NULL;
+
+    int pipe_fds[2];
+    if (pipe(pipe_fds) != 0) {
+        fprintf(stderr, "ERROR: pipe: %s\n", strerror(errno));
+        free(argv);
+        return false;
+    }
+    memset(sample, 0, sizeof *sample);
+    double start = now_ms();
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) dup2(null_fd, STDOUT_FILENO);
+        dup2(pipe_fds[1], STDERR_FILENO);
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+        execv(argv[0], argv);
+        fprintf(stderr, "ERROR: Couldn't run '%s': %s\n", argv[0], strerror(errno));
+        _exit(127);
+    }
+    free(argv);
+    close(pipe_fds[1]);
+    if (pid < 0) {
+        fprintf(stderr, "ERROR: fork: %s\n", strerror(errno));
+        close(pipe_fds[0]);
+        return false;
+    }
+
+    size_t len = 0, cap = 4096;
+    char* report = malloc(cap); // alloc
+    for (;;) {
+        if (len + 1 == cap) report = realloc(report, cap *= 2); // alloc
+        ssize_t n = read(pipe_fds[0], report + len, cap - len - 1);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        len += (size_t)n;
+    }
+    report[len] = '\0';
+    close(pipe_fds[0]);
+
+    int status = 0;
+    struct rusage usage = {0};
+    while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {}
+    sample->wall_ms = now_ms() - start;
+#ifdef __APPLE__
+    sample->peak_rss_kib = usage.ru_maxrss / 1024;
+#else
+    sample->peak_rss_kib = usage.ru_maxrss;
+#endif
+
+    bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (!ok) fprintf(stderr, "ERROR: '%s' failed for '%s':\n%s", opts->bk, src, report);
+    else ok = parse_stats(report, sample);
+    free(report);
+    return ok;
+}
+
+static int compare_samples(const void* a, const void* b) {
+    double wa = ((const Sample*)a)->wall_ms, wb = ((const Sample*)b)->wall_ms;
+    return (wa > wb) - (wa < wb);
+}
+
+static void report(FILE* csv, const Options* opts, const CorpusShape* shape, size_t jobs, const char* cache, Sample* samples) {
+    qsort(samples, opts->repeat, sizeof *samples, compare_samples);
+    const Sample* s = &samples[opts->repeat / 2];
+    double seconds = s->wall_ms / 1e3;
+    double files_per_s = seconds > 0 ? (double)shape->files / seconds : 0;
+    double fields_per_s = seconds > 0 ? (double)corpus_fields(shape) / seconds : 0;
+
+    printf("%-10s %5zu  %-5s %10.2f %12.0f %12.0f %10ld %9.2f %9.2f %9.2f %9.2f\n",
+        shape->name, jobs, cache, s->wall_ms, files_per_s, fields_per_s, s->peak_rss_kib,
+        s->phase_ms[summary_index[0]], s->phase_ms[summary_index[1]], s->phase_ms[summary_index[2]], s->phase_ms[summary_index[3]]);
+
+    if (csv_needs_header) {
+        fprintf(csv, "label,shape,files,structs,fields,depth,nonmatching,jobs,cache,repeat,wall_ms,files_per_s,fields_per_s,peak_rss_kib");
+        for (size_t p = 0; p < phase_count; ++p) {
+            fprintf(csv, ",");
+            for (const char* c = phase_names[p]; *c != '\0'; ++c) fputc(*c == ' ' ? '_' : *c, csv);
+            fprintf(csv, "_ms");
+        }
+        fprintf(csv, "\n");
+        csv_needs_header = false;
+    }
+    fprintf(csv, "%s,%s,%zu,%zu,%zu,%zu,%zu,%zu,%s,%zu,%.3f,%.1f,%.1f,%ld",
+        opts->label, shape->name, shape->files, shape->structs, shape->fields, shape->depth, shape->nonmatching,
+        jobs, cache, opts->repeat, s->wall_ms, files_per_s, fields_per_s, s->peak_rss_kib);
+    for (size_t p = 0; p < phase_count; ++p) fprintf(csv, ",%.3f", s->phase_ms[p]);
+    fprintf(csv, "\n");
+    fflush(csv);
+}
+
+static bool bench_shape(FILE* csv, const Options* opts, CorpusShape shape) {
+    shape.files = (size_t)((double)shape.files * opts->scale + 0.5);
+    if (shape.files == 0) shape.files = 1;
+
+    char src[4096], out[4096];
+    snprintf(src, sizeof src, "%s/%s/src", opts->dir, shape.name);
+    snprintf(out, sizeof out, "%s/%s/out", opts->dir, shape.name);
+    if (!remove_tree(src) || !corpus_write(&shape, src, opts->seed)) {
+        fprintf(stderr, "ERROR: Couldn't generate corpus '%s'\n", src);
+        return false;
+    }
+
+    Sample* cold = calloc(opts->repeat, sizeof *cold); // alloc
+    Sample* warm = calloc(opts->repeat, sizeof *warm); // alloc
+    bool ok = true;
+    for (size_t j = 0; ok && j < opts->jobs_len; ++j) {
+        for (size_t r = 0; ok && r < opts->repeat; ++r) {
+            ok = remove_tree(out) && corpus_mkdirs(out)
+                && run_bk(opts, src, out, opts->jobs[j], &cold[r])
+                && run_bk(opts, src, out, opts->jobs[j], &warm[r]);
+        }
+        if (ok) {
+            report(csv, opts, &shape, opts->jobs[j], "cold", cold);
+            report(csv, opts, &shape, opts->jobs[j], "warm", warm);
+        }
+    }
+    free(cold);
+    free(warm);
+    remove_tree(out);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    Options opts = {
+        .bk = "./build/bk",
+        .dir = "./build/bench",
+        .label = "default",
+        .repeat = 3,
+        .scale = 1.0,
+        .seed = 1,
+    };
+    for (size_t i = 0; i < sizeof default_shapes / sizeof *default_shapes; ++i) {
+        corpus_parse_shape(default_shapes[i], &opts.shapes[opts.shapes_len++]);
+    }
+    opts.jobs[opts.jobs_len++] = 1;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processors > 1) opts.jobs[opts.jobs_len++] = (size_t)processors;
+
+    if (!parse_options(argc, argv, &opts) || opts.repeat == 0 || opts.scale <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (!corpus_mkdirs(opts.dir)) return 1;
+
+    char csv_path[4096];
+    if (opts.csv == NULL) {
+        snprintf(csv_path, sizeof csv_path, "%s/results.csv", opts.dir);
+        opts.csv = csv_path;
+    }
+    FILE* csv = fopen(opts.csv, "a");
+    if (csv == NULL) {
+        fprintf(stderr, "ERROR: Couldn't open file '%s': %s\n", opts.csv, strerror(errno));
+        return 1;
+    }
+    fseek(csv, 0, SEEK_END);
+    csv_needs_header = ftell(csv) == 0;
+
+    printf("%-10s %5s  %-5s %10s %12s %12s %10s %9s %9s %9s %9s\n",
+        "shape", "jobs", "cache", "wall ms", "files/s", "fields/s", "rss KiB", "read", "analyze", "generate", "write");
+    int ret = 0;
+    for (size_t i = 0; i < opts.shapes_len; ++i) {
+        if (!bench_shape(csv, &opts, opts.shapes[i])) {
+            ret = 1;
+            break;
+        }
+    }
+    fclose(csv);
+    if (ret == 0) printf("Results appended to '%s'\n", opts.csv);
+    return ret;
+}
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../gen/bk_ext.h"
+// Generated from `examples/dynamic.schema` with `bk --compile-schema`, defines `dynamic_schema`
+#include "../gen/dynamic_ext.c"
+#include "corpus.h"
+
+// Compares the cost of generating code with a dynamic schema against the static schema `--compile-schema` translates it
+// into. Both run on the same synthetic types: once through the schema alone (the callbacks of the static schema and
+// `gen_dynamic`) and once through `bk_generate`, which adds the guards and macros of a generated file. Their outputs
+// have to contain the same code. Fails if the schema alone is more than `--max-ratio` times slower when it is dynamic.
+
+#define BK_RENAME_MAIN bk_main
+#include "../bk.c"
+
+typedef struct {
+    const char* name;
+    BkContext* bk;
+    /// Generates the code of the compared schema for a single type, without the guards and macros of `bk_generate`
+    void (*gen_type)(BkContext* bk, String* out, CCompound* ty);
+    CCompounds types;
+    String out;
+    /// Median time of generating every type with `gen_type`
+    double schema_ns;
+    /// Median time of a `bk_generate` call
+    double generate_ns;
+    /// Allocations (including reallocations) of generating every type with `gen_type`, after the output buffer was grown
+    size_t schema_allocs;
+    size_t generate_allocs;
+} SchemaRun;
+
+static void gen_static_type(BkContext* bk, String* out, CCompound* ty) {
+    const char* dst = bk->conf.gen_fmt_dst_macro;
+    if (dynamic_schema.gen_prelude != NULL) dynamic_schema.gen_prelude(bk, out);
+    if (dynamic_schema.gen_dump_decl != NULL) dynamic_schema.gen_dump_decl(bk, out, ty, dst);
+    if (dynamic_schema.gen_parse_decl != NULL) dynamic_schema.gen_parse_decl(bk, out, ty);
+    if (dynamic_schema.gen_dump_impl != NULL) dynamic_schema.gen_dump_impl(bk, out, ty, dst, bk->conf.gen_fmt_macro);
+    if (dynamic_schema.gen_parse_impl != NULL) dynamic_schema.gen_parse_impl(bk, out, ty);
+}
+
+static void gen_dynamic_type(BkContext* bk, String* out, CCompound* ty) {
+    gen_dynamic(bk, out, ty, bk->conf.gen_fmt_dst_macro, bk->conf.gen_fmt_macro);
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double da = *(const double*)a, db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static int compare_lines(const void* a, const void* b) {
+    const String_View* la = a;
+    const String_View* lb = b;
+    int cmp = memcmp(la->items, lb->items, la->len < lb->len ? la->len : lb->len);
+    return cmp != 0 ? cmp : (la->len > lb->len) - (la->len < lb->len);
+}
+
+/// Sorted lines of generated code without blank lines and preprocessor directives
+static String_View* code_lines(String* out, size_t* count) {
+    String_View* lines = NULL;
+    *count = 0;
+    size_t cap = 0;
+    for (size_t start = 0, end; start < out->len; start = end + 1) {
+        for (end = start; end < out->len && out->items[end] != '\n'; ++end) {}
+        String_View line = sv_from_parts(out->items + start, end - start);
+        while (line.len > 0 && isspace((unsigned char)*line.items)) {
+            ++line.items;
+            --line.len;
+        }
+        if (line.len == 0 || *line.items == '#') continue;
+        if (*count == cap) lines = realloc(lines, sizeof *lines * (cap = cap == 0 ? 256 : cap * 2)); // alloc
+        lines[(*count)++] = line;
+    }
+    qsort(lines, *count, sizeof *lines, compare_lines);
+    return lines;
+}
+
+/// Static schemas get their guards from `bookkeeper` and generate every declaration before the implementations, so the
+/// outputs are compared without preprocessor directives and regardless of the order of lines
+static bool same_code(String* a, String* b) {
+    size_t a_len, b_len;
+    String_View* a_lines = code_lines(a, &a_len);
+    String_View* b_lines = code_lines(b, &b_len);
+    bool same = a_len == b_len;
+    for (size_t i = 0; same && i < a_len; ++i) same = compare_lines(a_lines + i, b_lines + i) == 0;
+    free(a_lines);
+    free(b_lines);
+    return same;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  --schema <file>     Path of examples/dynamic.schema, gen/dynamic_ext.c has to be compiled from it (./examples/dynamic.schema)\n"
+        "  --types <n>         Number of synthetic types (20000)\n"
+        "  --fields <n>        Fields of every type (8)\n"
+        "  --depth <n>         Length of the chains of nested types (4)\n"
+        "  --repeat <n>        Generations per schema, the median is reported (5)\n"
+        "  --max-ratio <x>     Fails if the dynamic schema takes more than x times as long as the static one (0 disables)\n",
+        program);
+}
+
+/// Runs `gen_type` for every type (or `bk_generate` if `whole` is set) `repeat` times, returns the median time
+static double time_generation(SchemaRun* run, bool whole, size_t repeat, size_t* allocs) {
+    double* times = malloc(sizeof(double) * repeat); // alloc
+    for (size_t r = 0; r < repeat; ++r) {
+        run->out.len = 0;
+        AllocStats before = allocation_stats();
+        unsigned long long start = now_ns();
+        if (whole) {
+            bk_generate(run->bk, &run->types, &run->out);
+        } else {
+            for (size_t i = 0; i < run->types.len; ++i) run->gen_type(run->bk, &run->out, run->types.items + i);
+        }
+        times[r] = (double)(now_ns() - start);
+        AllocStats after = allocation_stats();
+        *allocs = (after.allocs - before.allocs) + (after.reallocs - before.reallocs);
+    }
+    qsort(times, repeat, sizeof *times, compare_doubles);
+    double median = times[repeat / 2];
+    free(times);
+    return median;
+}
+
+static bool schema_run(SchemaRun* run, const char* source, size_t source_len, size_t repeat) {
+    if (!bk_analyze(run->bk, "corpus.h", source, source_len, &run->types)) {
+        fprintf(stderr, "ERROR: No types were found for the %s schema\n", run->name);
+        return false;
+    }
+    // The first generation grows the output buffer, so the following ones only measure the schema
+    if (!bk_generate(run->bk, &run->types, &run->out)) {
+        fprintf(stderr, "ERROR: The %s schema didn't generate any code\n", run->name);
+        return false;
+    }
+    run->schema_ns = time_generation(run, false, repeat, &run->schema_allocs);
+    // Generated last, so `out` holds the whole output for `same_code`
+    run->generate_ns = time_generation(run, true, repeat, &run->generate_allocs);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* schema_file = "./examples/dynamic.schema";
+    CorpusShape shape = { .name = "schema", .files = 1, .structs = 20000, .fields = 8, .depth = 4 };
+    size_t repeat = 5;
+    double max_ratio = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 == argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (strcmp(argv[i - 1], "--schema") == 0) schema_file = value;
+        else if (strcmp(argv[i - 1], "--types") == 0) shape.structs = strtoul(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "--fields") == 0) shape.fields = strtoul(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "--depth") == 0) shape.depth = strtoul(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "--repeat") == 0) repeat = strtoul(value, NULL, 10);
+        else if (strcmp(argv[i - 1], "--max-ratio") == 0) max_ratio = strtod(value, NULL);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (shape.structs == 0 || shape.depth == 0 || repeat == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    track_allocations(true);
+
+    char derive[256];
+    snprintf(derive, sizeof derive, "%s()", dynamic_schema.derive_attr);
+    char* source = NULL;
+    size_t source_len = 0;
+    FILE* f = open_memstream(&source, &source_len);
+    unsigned rng = 1;
+    corpus_write_header(f, &shape, 0, derive, &rng);
+    fclose(f);
+
+    SchemaRun runs[] = {
+        { .name = "static", .bk = bk_create(), .gen_type = gen_static_type },
+        { .name = "dynamic", .bk = bk_create(), .gen_type = gen_dynamic_type },
+    };
+    runs[0].bk->conf.silent = runs[1].bk->conf.silent = true;
+    String schema = {0}; // alloc
+    int ret = 0;
+    if (!read_entire_file(runs[1].bk, schema_file, &schema)
+        || !bk_register_schema(runs[0].bk, &dynamic_schema)
+        || !bk_register_dynamic_schema(runs[1].bk, schema_file, schema.items, schema.len)) {
+        ret = 1;
+    }
+    for (size_t i = 0; ret == 0 && i < 2; ++i) {
+        if (!schema_run(&runs[i], source, source_len, repeat)) ret = 1;
+    }
+    if (ret == 0 && !same_code(&runs[0].out, &runs[1].out)) {
+        fprintf(stderr, "ERROR: The static and dynamic schemas generated different code, regenerate gen/dynamic_ext.c from '%s'\n", schema_file);
+        ret = 1;
+    }
+
+    if (ret == 0) {
+        size_t types = runs[0].types.len;
+        printf("%zu types, %zu fields each, nesting depth %zu, %zu bytes of code per run\n", types, shape.fields, shape.depth, runs[0].out.len);
+        printf("%-8s %14s %14s %14s %14s\n", "schema", "ns/type", "allocs/type", "generate ns", "generate allocs");
+        for (size_t i = 0; i < 2; ++i) {
+            printf("%-8s %14.1f %14.3f %14.1f %14.3f\n", runs[i].name,
+                runs[i].schema_ns / (double)types, (double)runs[i].schema_allocs / (double)types,
+                runs[i].generate_ns / (double)types, (double)runs[i].generate_allocs / (double)types);
+        }
+        double ratio = runs[1].schema_ns / runs[0].schema_ns;
+        printf("dynamic/static: %.2fx (%.2fx with bk_generate)\n", ratio, runs[1].generate_ns / runs[0].generate_ns);
+        if (max_ratio > 0 && ratio > max_ratio) {
+            fprintf(stderr, "ERROR: The dynamic schema is %.2fx slower than the static one, the limit is %.2fx\n", ratio, max_ratio);
+            ret = 1;
+        }
+    }
+
+    for (size_t i = 0; i < 2; ++i) {
+        free(runs[i].out.items);
+        bk_free_types(&runs[i].types);
+        bk_destroy(runs[i].bk);
+    }
+    free(source);
+    free(schema.items);
+    return ret;
+}
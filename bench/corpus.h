@@ -0,0 +1,154 @@
+#ifndef __BK_BENCH_CORPUS_H__
+#define __BK_BENCH_CORPUS_H__
+// Synthetic input trees for benchmarking `bk`, shared by `gen_corpus` and `bench_gen`
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/// Files inside a corpus are spread over subdirectories of this many files, so discovery has to walk a tree
+#define CORPUS_FILES_PER_DIR 100
+
+typedef struct {
+    /// Name of the shape, used for directory names and reports
+    char name[64];
+    /// Number of input files
+    size_t files;
+    /// Number of structs inside every file
+    size_t structs;
+    /// Number of fields inside every struct
+    size_t fields;
+    /// Length of the chains of structs that contain the previous struct of the chain as their first field (1 disables nesting)
+    size_t depth;
+    /// Percentage of files that don't contain any derive attributes, `bk` should skip them without analyzing them
+    size_t nonmatching;
+} CorpusShape;
+
+/// Parses `name:files:structs:fields:depth:nonmatching` (trailing values can be omitted)
+static inline bool corpus_parse_shape(const char* spec, CorpusShape* out) {
+    CorpusShape shape = { .files = 100, .structs = 4, .fields = 8, .depth = 1, .nonmatching = 0 };
+    const char* colon = strchr(spec, ':');
+    size_t name_len = colon == NULL ? strlen(spec) : (size_t)(colon - spec);
+    if (name_len == 0 || name_len >= sizeof shape.name) return false;
+    memcpy(shape.name, spec, name_len);
+    shape.name[name_len] = '\0';
+
+    size_t* values[] = { &shape.files, &shape.structs, &shape.fields, &shape.depth, &shape.nonmatching };
+    for (size_t i = 0; colon != NULL && i < sizeof values / sizeof *values; ++i) {
+        char* end = NULL;
+        errno = 0;
+        unsigned long long value = strtoull(colon + 1, &end, 10);
+        if (errno != 0 || end == colon + 1 || (*end != ':' && *end != '\0')) return false;
+        *values[i] = (size_t)value;
+        colon = *end == ':' ? end : NULL;
+    }
+    if (colon != NULL) return false;
+    if (shape.files == 0 || shape.structs == 0 || shape.depth == 0 || shape.nonmatching > 100) return false;
+    *out = shape;
+    return true;
+}
+
+/// Files with derive attributes are spread evenly over the corpus
+static inline bool corpus_file_matches(const CorpusShape* shape, size_t file) {
+    return (file * shape->nonmatching) / 100 == ((file + 1) * shape->nonmatching) / 100;
+}
+
+static inline size_t corpus_matching_files(const CorpusShape* shape) {
+    return shape->files - (shape->files * shape->nonmatching) / 100;
+}
+
+/// Number of fields `bk` has to analyze, nested structs count as a single field
+static inline size_t corpus_fields(const CorpusShape* shape) {
+    return corpus_matching_files(shape) * shape->structs * shape->fields;
+}
+
+static const char* corpus_field_types[] = {
+    "int", "double", "bool", "const char*", "long", "float", "unsigned int", "size_t",
+};
+
+/// xorshift32, the corpus only depends on the seed and the shape
+static inline unsigned corpus_next(unsigned* state) {
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static inline bool corpus_mkdir(const char* path) {
+    if (mkdir(path, 0755) == 0 || errno == EEXIST) return true;
+    fprintf(stderr, "ERROR: Couldn't create directory '%s': %s\n", path, strerror(errno));
+    return false;
+}
+
+/// Creates `path` and all of its missing parents
+static inline bool corpus_mkdirs(const char* path) {
+    char buf[4096];
+    size_t len = strlen(path);
+    if (len >= sizeof buf) return false;
+    memcpy(buf, path, len + 1);
+    for (size_t i = 1; i < len; ++i) {
+        if (buf[i] != '/') continue;
+        buf[i] = '\0';
+        if (!corpus_mkdir(buf)) return false;
+        buf[i] = '/';
+    }
+    return corpus_mkdir(buf);
+}
+
+static inline void corpus_write_struct(FILE* f, const CorpusShape* shape, size_t file, size_t s, const char* derive, unsigned* rng) {
+    fprintf(f, "typedef struct {\n");
+    size_t field = 0;
+    if (s % shape->depth != 0 && shape->fields > 0) {
+        fprintf(f, "    S%zu_%zu inner; tag(\"Inner\")\n", file, s - 1);
+        ++field;
+    }
+    for (; field < shape->fields; ++field) {
+        const char* type = corpus_field_types[corpus_next(rng) % (sizeof corpus_field_types / sizeof *corpus_field_types)];
+        fprintf(f, "    %s field_%zu;", type, field);
+        if (field % 4 == 3) fprintf(f, " tag(\"Field%zu\")", field);
+        fprintf(f, "\n");
+    }
+    if (derive != NULL) fprintf(f, "} S%zu_%zu %s;\n\n", file, s, derive);
+    else fprintf(f, "} S%zu_%zu;\n\nvoid s%zu_%zu_reset(S%zu_%zu* value);\n\n", file, s, file, s, file, s);
+}
+
+/// Writes the contents of the `file`th header of a corpus, the structs derive `derive` unless it is NULL
+static inline void corpus_write_header(FILE* f, const CorpusShape* shape, size_t file, const char* derive, unsigned* rng) {
+    fprintf(f, "#ifndef F%06zu_H\n#define F%06zu_H\n#include <stdbool.h>\n#include <stddef.h>\n\n", file, file);
+    for (size_t s = 0; s < shape->structs; ++s) {
+        corpus_write_struct(f, shape, file, s, derive, rng);
+    }
+    fprintf(f, "#endif // F%06zu_H\n", file);
+}
+
+/// Writes the corpus described by `shape` into `dir`, which is created if it doesn't exist
+static inline bool corpus_write(const CorpusShape* shape, const char* dir, unsigned seed) {
+    if (!corpus_mkdirs(dir)) return false;
+    unsigned rng = seed == 0 ? 1 : seed;
+    char path[4096];
+    for (size_t file = 0; file < shape->files; ++file) {
+        if (file % CORPUS_FILES_PER_DIR == 0) {
+            if (snprintf(path, sizeof path, "%s/d%04zu", dir, file / CORPUS_FILES_PER_DIR) >= (int)sizeof path) return false;
+            if (!corpus_mkdir(path)) return false;
+        }
+        if (snprintf(path, sizeof path, "%s/d%04zu/f%06zu.h", dir, file / CORPUS_FILES_PER_DIR, file) >= (int)sizeof path) return false;
+        FILE* f = fopen(path, "wb");
+        if (f == NULL) {
+            fprintf(stderr, "ERROR: Couldn't open file '%s': %s\n", path, strerror(errno));
+            return false;
+        }
+        corpus_write_header(f, shape, file, corpus_file_matches(shape, file) ? "derive_all()" : NULL, &rng);
+        if (fclose(f) != 0) {
+            fprintf(stderr, "ERROR: Couldn't write file '%s': %s\n", path, strerror(errno));
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // __BK_BENCH_CORPUS_H__
@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "corpus.h"
+
+static void usage(const char* program) {
+    fprintf(stderr,
+        "Usage: %s <dir> <name:files:structs:fields:depth:nonmatching> [seed]\n"
+        "Writes a synthetic tree of headers for `bk` into <dir>, e.g. `%s /tmp/corpus big:2000:4:8:2:25`\n",
+        program, program);
+}
+
+// Generates a corpus without running any benchmarks, so shapes can be profiled by hand
+int main(int argc, char** argv) {
+    CorpusShape shape;
+    if (argc < 3 || argc > 4 || !corpus_parse_shape(argv[2], &shape)) {
+        usage(argv[0]);
+        return 1;
+    }
+    unsigned seed = argc == 4 ? (unsigned)strtoul(argv[3], NULL, 10) : 1;
+    if (!corpus_write(&shape, argv[1], seed)) return 1;
+    printf("%zu files (%zu with derives), %zu structs, %zu fields\n",
+        shape.files, corpus_matching_files(&shape), shape.files * shape.structs, corpus_fields(&shape));
+    return 0;
+}
@@ -40,13 +40,43 @@ DEALINGS IN THE SOFTWARE.
 #include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <ctype.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <fnmatch.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <errno.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include <sys/stat.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#define BK_WATCH_INOTIFY
+#include <poll.h>
+#include <sys/inotify.h>
+#endif // __linux__
+#if defined(__unix__) || defined(__APPLE__)
+#define BK_DAEMON
+#define BK_PLUGINS
+#include <dlfcn.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif // defined(__unix__) || defined(__APPLE__)
 #define STB_C_LEXER_IMPLEMENTATION
 #include "stb_c_lexer.h"
 
@@ -108,6 +138,30 @@ typedef struct {
     /** @brief Enables the warning that is emitted when no `output_directory` was specified (true by default) */
     bool warn_no_output;
 
+    /**
+     * @brief Enables the persistent analysis cache. (true by default)
+     *
+     * When enabled, `bookkeeper` keeps a manifest file named '.bk.cache' inside `BkConfig::output_dir` that contains
+     * the content hash and the analyzed types of every input file. Input files that didn't change since the last run
+     * aren't analyzed again and their generated files aren't regenerated.
+    */
+    bool cache;
+
+    /**
+     * @brief Enables Make/Ninja style depfiles for generated files. (false by default)
+     *
+     * When enabled, every generated file gets a depfile next to it (with the '.d' extension appended to its name)
+     * that lists the source file it was generated from, every dynamic schema file and the config file.
+    */
+    bool depfiles;
+
+    /**
+     * @brief Path of a single depfile that contains a rule for every generated file. (NULL by default)
+     *
+     * Useful for build systems that expect a single depfile per build step (e.g. Ninja's `depfile` variable).
+    */
+    char* depfile;
+
     /** @brief Disables the generation of "dump" functions during code generation (false by default) */
     bool disable_dump;
 
@@ -136,9 +190,35 @@ typedef struct {
     /**
      * Simple hack to prevent watch mode from hogging resources. The tool waits `BkConfig::watch_delay` seconds before checking
      * if any source files were modified to regenerate code (5 by default)
+     *
+     * Only used on platforms where the event based watch backend (inotify) isn't available.
     */
     long watch_delay;
 
+    /**
+     * @brief The time window (in milliseconds) that watch mode waits for further file events after receiving one
+     *        before regenerating code. (50 by default)
+     *
+     * Editors usually produce a burst of events for a single save, this window coalesces them into a single regeneration.
+     * It is also the latency between a save and the regeneration, set it to 0 to regenerate as soon as the first event
+     * arrives. Only used by the event based watch backend (inotify).
+    */
+    long watch_debounce;
+
+    /**
+     * @brief The number of threads that read, analyze and generate code for input files. (1 by default)
+     *
+     * When set to 0, the number of online processors is used. Generated files don't depend on this setting.
+    */
+    long jobs;
+
+    /**
+     * @brief Files inside include directories that are larger than this many bytes are skipped. (0 by default)
+     *
+     * When set to 0, files of any size are included. Empty files are always skipped.
+    */
+    long max_file_size;
+
     /**
      * @brief The macro that is used inside generated "dump" functions to output into the provided "dst" buffer.
      *        ("BK_FMT" by default)
@@ -198,9 +278,10 @@ typedef struct {
     bool derive_all;
 
     /**
-     * @brief Denotes the directory that will be searched for '.c' or '.h' files to analyze.
+     * @brief Denotes the directories (as a comma seperated list) that will be searched recursively for '.c' or '.h' files to analyze.
      *
-     * Set to NULL if no include directory was specified.
+     * Set to NULL if no include directory was specified. Directories supplied on the command line replace this list,
+     * see `BkContext::include_dirs`.
     */
     char* include_dir;
 
@@ -278,6 +359,7 @@ String_View sv_trim_whitespace_start(String_View sv);
 String_View sv_trim_whitespace_end(String_View sv);
 String_View sv_trim_whitespace(String_View sv);
 String_View sv_find(String_View sv, char c);
+bool sv_contains(String_View sv, String_View needle);
 String_View sv_substr(String_View sv, size_t start, size_t len);
 void sv_loc(String_View file, String_View cursor, int* line, int* offset);
 
@@ -289,6 +371,51 @@ typedef enum {
     CEXTERNAL
 } CType_Kind;
 
+/** @brief A single block of memory of an `Arena`. */
+typedef struct ArenaBlock {
+    /** @brief The next block, blocks after `Arena::current` are free and reused after a reset. */
+    struct ArenaBlock* next;
+    /** @brief Number of bytes in use. */
+    size_t len;
+    /** @brief Number of bytes that fit into `ArenaBlock::data`. */
+    size_t cap;
+    /** @brief Memory of the block. */
+    char data[];
+} ArenaBlock;
+
+/**
+ * @brief Bump allocator, everything that was allocated from it is released at once.
+ *
+ * See @link arena_alloc `arena_alloc`@endlink.
+*/
+typedef struct {
+    /** @brief First block of the arena, NULL if nothing was allocated yet. */
+    ArenaBlock* first;
+    /** @brief Block that allocations are currently served from. */
+    ArenaBlock* current;
+} Arena;
+
+/**
+ * @brief Interned strings, equal strings always get the same id so they can be compared as integers.
+ *
+ * Interned strings are never moved, pointers to them stay valid until the interner is reset or free'd.
+ * See @link intern `intern`@endlink.
+*/
+typedef struct {
+    /** @brief Owns the contents of all interned strings. */
+    Arena arena;
+    /** @brief Every interned string, indexed by id. */
+    struct {
+        const char** items;
+        size_t len;
+        size_t cap;
+    } strings;
+    /** @brief Open addressing hash table that maps strings to their id + 1, `0` marks an empty slot. */
+    unsigned* table;
+    /** @brief Number of slots in `Interner::table`, always a power of two. */
+    size_t table_cap;
+} Interner;
+
 /** @brief Defines different primitive C types. */
 typedef enum {
     CINT = 1,
@@ -315,7 +442,7 @@ typedef struct {
      *
      * %Field of variant @link CType_Kind `CType_Kind::CEXTERNAL`. @endlink
     */
-    char* name;
+    const char* name;
 
     /**
      * @brief Used to identify the primitive type of this type.
@@ -337,7 +464,7 @@ typedef struct {
 */
 typedef struct {
     /** @brief The identifier that was used to declare this field inside the analyzed source file. */
-    char* name;
+    const char* name;
 
     /**
      * @brief Optionally declared inside the source file with the 'tag' attribute.
@@ -346,7 +473,7 @@ typedef struct {
      * a special tag was not declared inside the source file, `Field::tag` is set to NULL and code generation uses the `Field::name`
      * field for serialization.
     */
-    char* tag;
+    const char* tag;
 
     /** @brief The @link CType type@endlink of this field. */
     CType type;
@@ -359,13 +486,38 @@ typedef struct {
     size_t cap;
 } Fields;
 
+/**
+ * @brief Set of schemas, stored as a bitset over their indices.
+ *
+ * Static schemas use their index inside `BkContext::schemas`, dynamic schemas follow right after them,
+ * see @link schema_index `schema_index`@endlink. The set grows as needed, so there is no limit on the amount of schemas.
+*/
+typedef struct {
+    /** @brief Bits of the set, 64 schemas per word. The last word is never zero. */
+    unsigned long long* items;
+    size_t len;
+    size_t cap;
+} DeriveSet;
+
+/**
+ * @brief Evaluates to non-zero if the schema with the provided index is part of `set`.
+ *
+ * @param set Assumed to be of type `DeriveSet`.
+ * @param index Index of the schema, see @link schema_index `schema_index`@endlink.
+*/
+#define derive_set_has(set, index) ((index) / 64 < (set).len && (((set).items[(index) / 64] >> ((index) % 64)) & 1))
+
+/** @brief Value returned by @link derive_set_next `derive_set_next`@endlink when there are no more schemas in a set. */
+#define DERIVE_SET_END ((size_t)-1)
+
 /**
  * @brief Defines a compund C type with fields.
 */
 typedef struct {
-    int derived_schemas; // TODO: this bitfield method puts a (somewhat low) hard limit on the amount of allowed schmeas
+    /** @brief Schemas derived by this type. */
+    DeriveSet derived_schemas;
     Fields fields;
-    char* name;
+    const char* name;
 } CCompound;
 
 /** @brief Dynamic array of `CCompound` */
@@ -373,8 +525,18 @@ typedef struct {
     CCompound* items;
     size_t len;
     size_t cap;
+
+    /**
+     * @brief Owns the fields and all strings of the types, equal names share the same string.
+     *
+     * Fields are allocated from `Interner::arena` once a type is complete, so they can't grow afterwards.
+    */
+    Interner names;
 } CCompounds;
 
+typedef struct BkContext BkContext;
+typedef struct BkStats BkStats;
+
 /** @brief Defines a static schema. */
 typedef struct {
     /**
@@ -387,9 +549,10 @@ typedef struct {
      * The code inside generated inside function is automatically protected by extra header guards
      * to avoid redefinition/redeclaration errors.
      *
+     * @param bk The context that generates code.
      * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
     */
-    void (*gen_prelude)(String* book_buf);
+    void (*gen_prelude)(BkContext* bk, String* book_buf);
 
     /**
      * @brief (Nullable) Pointer to function that will be used to generate the declarations of "dump"
@@ -397,13 +560,14 @@ typedef struct {
      *
      * The convention for the signatures of generated functions here is `void dump_$schema.name$_$type$($type$* item, $dst_type$ dst)`
      *
+     * @param bk The context that generates code.
      * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
      *        macro available to both this source file and extension authors can be used to output into this buffer.
      * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
      * @param dst_type The type of the 'dst' parameter that is meant to be used for generated "dump" functions.
      * @return Should return the total amount of declarations.
     */
-    size_t (*gen_dump_decl)(String* book_buf, CCompound* ty, const char* dst_type);
+    size_t (*gen_dump_decl)(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type);
 
     /**
      * @brief (Nullable) Pointer to function that will be used to generate the declarations of "parse"
@@ -415,12 +579,13 @@ typedef struct {
      * authors make use of such error codes, return value '0' should always mean OK.
      *
      *
+     * @param bk The context that generates code.
      * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
      *        macro available to both this source file and extension authors can be used to output into this buffer.
      * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
      * @return Should return the total amount of declarations.
     */
-    size_t (*gen_parse_decl)(String* book_buf, CCompound* ty);
+    size_t (*gen_parse_decl)(BkContext* bk, String* book_buf, CCompound* ty);
 
     /**
      * @brief (Nullable) Pointer to function that will be used to generate the implementations of "dump"
@@ -428,13 +593,14 @@ typedef struct {
      *
      * The convention for the signatures of generated functions here is `void dump_$schema.name$_$type$($type$* item, $dst_type$ dst)`
      *
+     * @param bk The context that generates code.
      * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
      *        macro available to both this source file and extension authors can be used to output into this buffer.
      * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
      * @param dst_type The type of the 'dst' parameter that is meant to be used for generated "dump" functions.
      * @param fmt_macro The name of the macro that is meant to be used **inside generated code** to output into the 'dst' buffer.
     */
-    void (*gen_dump_impl)(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+    void (*gen_dump_impl)(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
 
     /**
      * @brief (Nullable) Pointer to function that will be used to generate the implementations of "parse"
@@ -445,11 +611,12 @@ typedef struct {
      * Schemas may also define enumerations inside their `StaticSchema::gen_prelude` functions to return error codes. Even if schema
      * authors make use of such error codes, return value '0' should always mean OK.
      *
+     * @param bk The context that generates code.
      * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
      *        macro available to both this source file and extension authors can be used to output into this buffer.
      * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
     */
-    void (*gen_parse_impl)(String* book_buf, CCompound* ty);
+    void (*gen_parse_impl)(BkContext* bk, String* book_buf, CCompound* ty);
 
     /**
      * @brief Defines the name of the 'attribute macro' that will be generated inside 'derives.h'
@@ -470,12 +637,75 @@ typedef struct {
     size_t cap;
 } StaticSchemas;
 
+/** @brief Kind tag for `SchemaOp`, see @link compile_dynamic_schema `compile_dynamic_schema`@endlink. */
+typedef enum {
+    /** @brief Outputs `SchemaOp::text`. */
+    SOP_TEXT,
+    /** @brief Outputs the name of the type, `$ty$`. */
+    SOP_TY,
+    /** @brief Outputs the `fmt_macro` of the generator, `$fmt$`. */
+    SOP_FMT,
+    /** @brief Outputs the `dst_type` of the generator, `$dst$`. */
+    SOP_DST,
+    /** @brief Outputs `BkConfig::offset_type_macro`, `$offset$`. */
+    SOP_OFFSET,
+    SOP_IMPLGUARD,
+    SOP_ENDIMPLGUARD,
+    SOP_DUMPGUARD,
+    SOP_ENDDUMPGUARD,
+    SOP_PARSEGUARD,
+    SOP_ENDPARSEGUARD,
+    /** @brief Runs the `SchemaOp::value` operations that follow it once for every field of the type. */
+    SOP_FOR,
+    /** @brief Outputs a newline and `SchemaOp::text`, the text after the last directive of the schema. */
+    SOP_TAIL,
+    /** @brief Outputs the name of the current field, `$it$`. Only appears inside of loop bodies. */
+    SOP_FIELD,
+    /** @brief Outputs the tag (or name) of the current field, `$tag$`. Only appears inside of loop bodies. */
+    SOP_TAG,
+    /** @brief Outputs the type name of the current `CEXTERNAL` field, `$it.type$`. Only appears inside of loop bodies. */
+    SOP_TYPE,
+    /** @brief Starts an if whose condition is true when the bit of the field's type is set in `SchemaOp::value`. */
+    SOP_IF_TYPE,
+    /** @brief Starts an if whose condition is true when the index of the field is `SchemaOp::value`. */
+    SOP_IF_INDEX_EQ,
+    /** @brief Starts an if whose condition is true when the index of the field isn't `SchemaOp::value`. */
+    SOP_IF_INDEX_NE,
+    SOP_ENDIF,
+} SchemaOpKind;
+
+/** @brief The output of a loop body operation starts a segment that is trimmed once it ends. */
+#define SOP_SEGMENT_START 1
+/** @brief The output of a loop body operation ends a trimmed segment. */
+#define SOP_SEGMENT_END 2
+/** @brief The output of a loop body operation isn't conditional on the current if. */
+#define SOP_ALWAYS 4
+
+/** @brief A single instruction of a compiled dynamic schema. */
+typedef struct {
+    /** @brief Tag that denotes what the instruction does. */
+    SchemaOpKind kind;
+    /** @brief Combination of `SOP_SEGMENT_START`, `SOP_SEGMENT_END` and `SOP_ALWAYS`. */
+    unsigned flags;
+    /** @brief Text of `SOP_TEXT` and `SOP_TAIL`, points into `DynamicSchema::source`. */
+    String_View text;
+    /** @brief Body length of `SOP_FOR`, type mask of `SOP_IF_TYPE` or index of `SOP_IF_INDEX_EQ` and `SOP_IF_INDEX_NE`. */
+    size_t value;
+} SchemaOp;
+
+/** @brief Dynamic array for `SchemaOp`. */
+typedef struct {
+    SchemaOp* items;
+    size_t len;
+    size_t cap;
+} SchemaOps;
+
 /** @brief Defines a dynamic schema object. */
 typedef struct {    
     /**
      * @brief String view that contains a view into the source code of the dynamic schema in the .schema format.
      *
-     * The memory that is pointed to by this view is managed by the global `BkState` instance.
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
     */
     String_View source;
 
@@ -483,16 +713,30 @@ typedef struct {
      * @brief Defines the name of the 'attribute macro' that will be generated inside 'derives.h'
      *        for users to derive functionality for this dynamic schema.
      *
-     * The memory that is pointed to by this view is managed by the global `BkState` instance.
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
     */
     String_View derive_attr;
 
     /**
      * @brief Defines the unique name for this dynamic schema.
      *
-     * The memory that is pointed to by this view is managed by the global `BkState` instance.
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
     */
     String_View name;
+
+    /**
+     * @brief The path that was used to load this dynamic schema. Used for reloading the schema in watch mode.
+     *
+     * This string is owned by the `BkContext` that loaded this schema.
+    */
+    char* file_name;
+
+    /**
+     * @brief The instructions that `DynamicSchema::source` was compiled to when it was loaded.
+     *
+     * Owned by the `BkContext` that loaded this schema.
+    */
+    SchemaOps ops;
 } DynamicSchema;
 
 /** @brief Dynamic array for `DynamicSchema`. */
@@ -502,6 +746,36 @@ typedef struct {
     size_t cap;
 } DynamicSchemas;
 
+/** @brief A shared object that static schemas were loaded from, see @link load_plugin `load_plugin`@endlink. */
+typedef struct {
+    /** @brief Handle returned by `dlopen`, closed after everything else is cleaned up. */
+    void* handle;
+    /** @brief The path that was used to load the plugin. Owned by the `BkContext` that loaded the plugin. */
+    char* file_name;
+} Plugin;
+
+/** @brief Dynamic array for `Plugin`. */
+typedef struct {
+    Plugin* items;
+    size_t len;
+    size_t cap;
+} Plugins;
+
+/** @brief Meaning of an identifier to the analyzer, see @link init_analysis_symbols `init_analysis_symbols`@endlink. */
+typedef struct {
+    /** @brief Primitive type the identifier names when it's used as a field type on its own, `0` if none. */
+    CPrimitive primitive;
+    /** @brief Index + 1 of the schema the identifier derives when it's used as an attribute, `0` if it isn't a derive attribute. */
+    size_t schema;
+} AnalysisSymbol;
+
+/** @brief Dynamic array of `AnalysisSymbol` */
+typedef struct {
+    AnalysisSymbol* items;
+    size_t len;
+    size_t cap;
+} AnalysisSymbols;
+
 /** @brief Enumeration that defines all supported schema types. */
 typedef enum {
     SCHEMA_STATIC,
@@ -539,6 +813,15 @@ typedef struct {
      * whenever this file is analyzed (even if the analysis fails).
     */
     time_t last_analyzed;
+    /** @brief Set whenever a file was generated from this entry during its last analysis. */
+    bool has_output;
+    /**
+     * @brief The index that is used inside the header guard of the file generated from this entry.
+     *
+     * Only valid if `Entry::has_output` is set. Entries keep their index when they are analyzed again (in watch or daemon mode)
+     * so regenerating a file doesn't change it unless its contents changed.
+    */
+    size_t file_idx;
 } Entry;
 
 /** @brief Dynamic array for `Entry`. */
@@ -548,14 +831,30 @@ typedef struct {
     size_t cap;
 } Entries;
 
-/** @brief General state of `bookkeeper`. */
+/** @brief Dynamic array of C strings */
 typedef struct {
+    char** items;
+    size_t len;
+    size_t cap;
+} CStrings;
+
+/**
+ * @brief General state of a single `bookkeeper` instance.
+ *
+ * Everything `bookkeeper` does happens through a context that is passed around explicitly (usually as a parameter named `bk`,
+ * which the logging and formatting macros expect to be in scope), so independent instances can run in the same process.
+ * A context shouldn't be used by multiple threads at the same time unless they only read it and don't use `BkContext::tmp_str`.
+*/
+struct BkContext {
     /** @brief The current configuration for `bookkeeper`. */
     BkConfig conf;
 
     /** @brief Dynamic array of all input files that were discovered or supplied. */
     Entries entries;
 
+    /** @brief Root directories that are searched for input files, without trailing slashes. Owns its strings. */
+    CStrings include_dirs;
+
     /** @brief Dynamic array of all static schemas that were defined. */
     StaticSchemas schemas;
 
@@ -565,30 +864,90 @@ typedef struct {
     /** @brief Dynamic string buffer that is used to store all dynamic schema sources. */
     Strings dynamic_source;
 
-    /** @brief Bitfield that contains all schemas that were derived globally */
-    int derive_schemas;
-} BkState;
+    /** @brief Shared objects that static schemas were loaded from. */
+    Plugins plugins;
+
+    /** @brief Set of all schemas that were derived globally */
+    DeriveSet derive_schemas;
+
+    /** @brief Identifiers the analyzer looks for, interned once after all schemas are loaded. */
+    Interner symbols;
+
+    /** @brief Meaning of every string in `BkContext::symbols`, indexed by id. */
+    AnalysisSymbols symbol_info;
+
+    /** @brief Path of the config file that was loaded, NULL if no config file was loaded. */
+    const char* config_file;
+
+    /** @brief Path of the config file that `main` loads, "./.bk.conf" unless `--config-path` was used. */
+    const char* config_path;
+
+    /** @brief Unix domain socket the context listens on as a daemon (see `--daemon`), NULL if it isn't a daemon. */
+    const char* daemon_socket;
+
+    /** @brief Socket of the daemon that `--client` sends its request to, NULL if the context isn't a client. */
+    const char* client_socket;
+
+    /** @brief Manifest that is run instead of a single config (see `--manifest`), NULL if there is none. */
+    const char* manifest_path;
+
+    /** @brief File that the spans of the run are written to (see `--trace`), NULL if no trace is written. */
+    const char* trace_path;
+
+    /** @brief Prints `BkContext::stats` after the run (see `--stats`). */
+    bool show_stats;
+
+    /** @brief Prints the statistics as CSV instead of a table (see `--stats-csv`). */
+    bool stats_csv;
+
+    /** @brief Statistics of the run (see `--stats` and `--trace`), NULL if they aren't collected. Shared with every copy of the context. */
+    BkStats* stats;
+
+    /** @brief Temporary string buffer of this context, see @link tfmt `tfmt`@endlink. */
+    char tmp_str[4096];
+};
+
+/** @brief Version of the plugin interface, changes whenever the meaning of the types in the extension header changes. */
+#define BK_PLUGIN_ABI_VERSION 1
 
 /**
- * @var bk
- * Global static `BkState` instance. (not thread safe)
+ * @brief Describes the interface a plugin was built against, plugins export it as `bk_plugin_abi`.
+ *
+ * Use @link BK_DEFINE_PLUGIN_ABI `BK_DEFINE_PLUGIN_ABI`@endlink to define it, see @link load_plugin `load_plugin`@endlink.
 */
-static BkState bk = {0};
+typedef struct {
+    /** @brief `BK_PLUGIN_ABI_VERSION` of the extension header the plugin was built with. */
+    unsigned version;
+    /** @brief Size of `BkContext`. */
+    size_t context_size;
+    /** @brief Size of `CCompound`. */
+    size_t compound_size;
+    /** @brief Size of `StaticSchema`. */
+    size_t schema_size;
+} BkPluginAbi;
+
 /**
- * @var tmp_str
- * Global static temporary string buffer. (not thread safe)
+ * @brief Registration function that plugins export as `bk_plugin_register`.
+ *
+ * @param count Out parameter that is assigned to the number of returned schemas.
+ * @return The schemas of the plugin, the memory has to stay valid while the plugin is loaded.
 */
-static char tmp_str[4096];
+typedef const StaticSchema* (*BkPluginRegister)(size_t* count);
+
+/** @brief Defines the `bk_plugin_abi` symbol of a plugin, must be used exactly once in a plugin. */
+#define BK_DEFINE_PLUGIN_ABI \
+const BkPluginAbi bk_plugin_abi = {BK_PLUGIN_ABI_VERSION, sizeof(BkContext), sizeof(CCompound), sizeof(StaticSchema)}
 
 /**
- * @brief Uses the global @link tmp_str `tmp_str`@endlink buffer with `sprintf` to quickly format a string.
+ * @brief Uses the `BkContext::tmp_str` buffer of the `BkContext* bk` in scope with `sprintf` to quickly format a string.
  *
  * The `tmp_str` gets constantly overwritten with every call to this macro or other functions that use the buffer
- * so this macro shouldn't be used to generate strings that are meant to be stored.
+ * so this macro shouldn't be used to generate strings that are meant to be stored. Functions that write files never
+ * use the buffer themselves, so their paths can be formatted with this macro.
  *
- * @return Returns the pointer to the global `tmp_str` buffer so this macro can easily be used inside expressions.
+ * @return Returns the pointer to the `tmp_str` buffer so this macro can easily be used inside expressions.
 */
-#define tfmt(...) (sprintf(tmp_str, __VA_ARGS__), tmp_str)
+#define tfmt(...) (sprintf(bk->tmp_str, __VA_ARGS__), bk->tmp_str)
 
 /**
  * @brief Internally uses the @link tfmt `tfmt`@endlink macro to format a string, but this macro also duplicates that string for safe storage.
@@ -598,7 +957,7 @@ static char tmp_str[4096];
 #define fmt(...) strdup(tfmt(__VA_ARGS__))
 
 /**
- * @brief Logging system of `bookkeeper`.
+ * @brief Logging system of `bookkeeper`. Uses the configuration of the `BkContext* bk` in scope.
  *
  * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
  * @param source The path to the source file name that will be used while logging.
@@ -606,16 +965,16 @@ static char tmp_str[4096];
  * @param ... `printf` style format arguments
 */
 #define bk_log_loc(level, source, line, ...) do {\
-    if (!bk.conf.silent) {\
+    if (!bk->conf.silent) {\
         switch ((level)) {\
         case LOG_INFO: {\
-            if (bk.conf.verbose) {\
+            if (bk->conf.verbose) {\
                 fprintf(stderr, "%s:%d: [INFO] ", (source), (line));\
                 fprintf(stderr, __VA_ARGS__);\
             }\
         } break;\
         case LOG_WARN: {\
-            if (bk.conf.verbose) {\
+            if (bk->conf.verbose) {\
                 fprintf(stderr, "%s:%d: [WARN] ", (source), (line));\
             } else {\
                 fprintf(stderr, "WARNING: ");\
@@ -623,7 +982,7 @@ static char tmp_str[4096];
             fprintf(stderr, __VA_ARGS__);\
         } break;\
         case LOG_ERROR: {\
-            if (bk.conf.verbose) {\
+            if (bk->conf.verbose) {\
                 fprintf(stderr, "%s:%d: [ERROR] ", (source), (line));\
             } else {\
                 fprintf(stderr, "ERROR: ");\
@@ -647,17 +1006,18 @@ static char tmp_str[4096];
  * @brief Diagnostics system of `bookkeeper`.
  *
  * This macro is purely for use in @link analyze_file `analyze_file`@endlink since it implicitly uses
- * the `file_name` and `lex` parameters of the function.
+ * its `file_name` parameter and its `tape` of tokens.
  *
  * See @link bk_diag_loc `bk_diag_loc`@endlink for a generic version that accepts those as parameters.
  *
  * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
+ * @param token_index Index of the token in `tape` that the diagnostic is about.
  * @param ... `printf` style format arguments
 */
-#define bk_diag(level, ...) do {\
-stb_lex_location loc = {0};\
-stb_c_lexer_get_location(&lex, lex.where_firstchar, &loc);\
-bk_diag_loc(level, file_name, loc.line_number, loc.line_offset, __VA_ARGS__);\
+#define bk_diag(level, token_index, ...) do {\
+int diag_line, diag_offset;\
+tape_location(&tape, (token_index), &diag_line, &diag_offset);\
+bk_diag_loc(level, file_name, diag_line, diag_offset, __VA_ARGS__);\
 } while(0)
 
 /**
@@ -672,7 +1032,7 @@ bk_diag_loc(level, file_name, loc.line_number, loc.line_offset, __VA_ARGS__);\
 #define bk_diag_loc(level, source, line, offset, ...) do {\
     switch ((level)) {\
     case LOG_INFO: {\
-        if (bk.conf.verbose) {\
+        if (bk->conf.verbose) {\
             fprintf(stderr, "%s:%d:%d: ", (source), (line), (offset));\
             fprintf(stderr, __VA_ARGS__);\
         }\
@@ -723,305 +1083,602 @@ typedef enum {
 } while(0)
 
 /**
- * @brief Macro that can be used like `fprintf` but with `String`s.
+ * @brief Macro that makes sure `str` has room for `extra` more characters and a null terminator.
+ *
+ * The capacity at least doubles whenever `str` has to grow, so appending to a `String` is amortized linear.
  *
  * @param str Assumed to be of type `String*`.
- * @param ... `printf` style format arguments.
+ * @param extra Number of characters that are about to be appended.
 */
-#define print_string(str, ...) do {                                                 \
-    int len = sprintf(tmp_str, __VA_ARGS__);                                        \
-    if ((str)->cap <= ((unsigned long)len + (str)->len)) {                          \
-        (str)->cap += len + 8 - (len % 8);                                          \
+#define reserve_string(str, extra) do {                                             \
+    size_t needed = (str)->len + (extra) + 1;                                       \
+    if (needed > (str)->cap) {                                                      \
+        (str)->cap = (str)->cap * 2 > needed ? (str)->cap * 2 : needed;             \
         if ((str)->items) {                                                         \
             (str)->items = realloc((str)->items, (str)->cap * sizeof *(str)->items);\
         } else {                                                                    \
             (str)->items = malloc((str)->cap * sizeof *(str)->items);               \
         }                                                                           \
     }                                                                               \
-    memcpy((str)->items + (str)->len, tmp_str, len);                                \
-    (str)->len += len;                                                              \
 } while(0)
-#endif // __BK_GEN_EXT_DEFINITIONS
-
-#define __BK_API static
-
-// General utility functions
-__BK_API bool read_entire_file_loc(const char* file_name, String* dst, const char* source_file, int source_line);
-#define read_entire_file(file_name, dst) read_entire_file_loc(file_name, dst, __FILE__, __LINE__)
-__BK_API bool write_entire_file_loc(const char* file_name, String* src, const char* source_file, int source_line);
-#define write_entire_file(file_name, src) write_entire_file_loc(file_name, src, __FILE__, __LINE__)
-__BK_API unsigned long djb2(const char* s);
-__BK_API bool entry_from_file(const char* file_name, Entry* out);
-__BK_API bool load_dynamic_schema_loc(const char* file_name, const char* source_file, int source_line);
-#define load_dynamic_schema(file_name) load_dynamic_schema_loc(file_name, __FILE__, __LINE__)
 
 /**
- * @brief Function used for obtaining the correct bitfield mask for schema of the specified type in the specified index.
+ * @brief Macro that appends `n` characters starting at `data` to `str` without any formatting.
  *
- * @param schema_type Denotes whether the provided schema is static or dynamic.
- * @param index Index of this schema in its corresponding array.
- * @return Returns the bitfield mask that can be used in `CCompund::derived_schemas`.
-*/
-__BK_API int get_schema_derive(SchemaType schema_type, size_t index);
-
-// Cleanup functions
-/** @brief free's the contents of a `CCompound` */
-__BK_API void free_ccompund(CCompound cc);
-/** @brief free's the contents of a `Field` */
-__BK_API void free_field(Field f);
-/** @brief free's the contents of a `CType` */
-__BK_API void free_ctype(CType ct);
-/** @brief free's the contents of a `Entry` */
-__BK_API void free_entry(Entry e);
-
-/**
- * @defgroup cparse Parsing C code
- * @brief All definitions and declarations related to parsing C code.
- * @addtogroup cparse
- * @{
-*/
-
-/** @brief Kind tag for `Word` */
-typedef enum {
-    WORD_TOK,
-    WORD_ID,
-    WORD_END
-} WordKind;
-
-/**
- * @brief Tagged union that is used to refer to identifiers or tokens in the same type.
+ * Like @link print_string `print_string`@endlink it keeps `str` null terminated.
  *
- * This type is mainly for use in @link peek_c `peek_c`@endlink.
+ * @param str Assumed to be of type `String*`.
+ * @param data Assumed to be of type `const char*`, must not point into `str`.
+ * @param n Number of characters to append.
 */
-typedef struct {
-    WordKind kind;
-    union {
-        int tok;
-        const char* id;
-    };
-} Word;
+#define append_string(str, data, n) do {                                            \
+    size_t append_len = (n);                                                        \
+    reserve_string(str, append_len);                                                \
+    memcpy((str)->items + (str)->len, (data), append_len);                          \
+    (str)->len += append_len;                                                       \
+    (str)->items[(str)->len] = '\0';                                                \
+} while(0)
 
 /**
- * @brief Macro that is used to generate identifier parameters for @link peek_c `peek_c`@endlink.
+ * @brief Fast path of @link print_string `print_string`@endlink for string literals that don't need any formatting.
  *
- * @param s Assumed to be of type `const char*`. This is the string representation of the identifier.
- * @return Expands to a `Word` instance of kind @link WordKind `WordKind::WORD_ID`@endlink.
-*/
-#define ID(s) (Word){.kind = WORD_ID, .id=s}
-
-/**
- * @brief Macro that is used to generate token parameters for @link peek_c `peek_c`@endlink.
+ * The length of the literal is known at compile time, so this is a single `memcpy`.
+ * Unlike with `print_string`, `%` characters are copied as is.
  *
- * @param t Assumed to be of type `int`. This is the integer value of the token.
- * @return Expands to a `Word` instance of kind @link WordKind `WordKind::WORD_TOK`@endlink.
+ * @param str Assumed to be of type `String*`.
+ * @param lit A string literal.
 */
-#define TK(t) (Word){.kind = WORD_TOK, .tok=t}
+#define print_lit(str, lit) append_string(str, "" lit, sizeof(lit) - 1)
 
 /**
- * @brief Macro that is used to generate the terminator for the parameter list of @link peek_c `peek_c`@endlink.
+ * @brief Appends the contents of a `String_View` to `str` without any formatting.
  *
- * @return Expands to a `Word` instance of kind @link WordKind `WordKind::WORD_END`@endlink.
+ * @param str Assumed to be of type `String*`.
+ * @param sv Assumed to be of type `String_View`.
 */
-#define WEND (Word){.kind = WORD_END}
-
-/** @cond */
-__BK_API bool va_get_expect_ids(stb_lexer* lex, va_list args);
-__BK_API bool va_get_expect_tokens(stb_lexer* lex, va_list args);
-__BK_API bool va_get_expect_c(stb_lexer* lex, va_list args);
-/** @endcond */
+#define print_sv(str, sv) do {                                                      \
+    String_View print_sv_view = (sv);                                               \
+    append_string(str, print_sv_view.items, print_sv_view.len);                     \
+} while(0)
 
 /**
- * @brief Variadic function that looks forward to see if the source file matches the provided identifiers.
+ * @brief Macro that can be used like `fprintf` but with `String`s.
  *
- * This macro also returns `false` if it encounters non-identifier tokens.
+ * Formats directly into the spare capacity of `str` and doesn't use any shared buffers, so it can be used by
+ * multiple threads at the same time as long as they write into different strings.
+ * The format arguments are evaluated a second time if `str` has to grow.
+ * Prefer @link print_lit `print_lit`@endlink for literals without format arguments.
  *
- * @param lex Pointer to the stb_lexer instance that contains the tokens.
- * @param ... indetifiers of type `const char*` to check for. These parameters should end with NULL.
- * @return Returns `true` if the source file matched the provided indetifiers, `false` otherwise.
+ * @param str Assumed to be of type `String*`.
+ * @param ... `printf` style format arguments.
 */
-__BK_API bool peek_ids(stb_lexer* lex, ...);
+#define print_string(str, ...) do {                                                 \
+    size_t avail = (str)->cap - (str)->len;                                         \
+    int len = snprintf((str)->items ? (str)->items + (str)->len : NULL, avail, __VA_ARGS__);\
+    if ((size_t)len >= avail) {                                                     \
+        reserve_string(str, (size_t)len);                                           \
+        snprintf((str)->items + (str)->len, len + 1, __VA_ARGS__);                  \
+    }                                                                               \
+    (str)->len += len;                                                              \
+} while(0)
 
 /**
- * @brief Variadic function that looks forward to see if the source file matches the provided tokens.
+ * @defgroup libbk Library API
+ * @brief Functions for generating code in-process, link with 'build/libbk.a' and include the extension header.
  *
- * @param lex Pointer to the stb_lexer instance that contains the tokens.
- * @param ... tokens of type `int` to check for. These parameters should end with -1.
- * @return Returns `true` if the source file matched the provided tokens, `false` otherwise.
+ * None of these functions touch the filesystem. A context can analyze and generate from multiple threads at once
+ * as long as no schemas are registered in the meantime.
+ * @{
 */
-__BK_API bool peek_tokens(stb_lexer* lex, ...);
-
+/** @brief Allocates a context with the default configuration and the built-in static schemas, free it with `bk_destroy`. */
+BkContext* bk_create(void);
+/** @brief free's a context that was created with `bk_create`. */
+void bk_destroy(BkContext* bk);
 /**
- * @brief Variadic function that looks forward to see if the source file matches the provided `Word`s.
+ * @brief Registers a static schema, its strings and functions have to stay valid while the context is used.
  *
- * Used in combination with the @link ID `ID`,@endlink @link TK `TK`,@endlink and @link WEND `WEND`@endlink macros for its parameters.
- *
- * @param lex Pointer to the stb_lexer instance that contains the tokens.
- * @param ... `Word`s to check for. These parameters should end with a `Word` of kind @link WordKind `WordKind::WORD_END` @endlink
- * @return Returns `true` if the source file matched the provided `Word`s, `false` otherwise.
+ * @return Returns `false` if a schema with the same name was already registered.
 */
-__BK_API bool peek_c(stb_lexer* lex, ...);
-
+bool bk_register_schema(BkContext* bk, const StaticSchema* schema);
 /**
- * @brief Variadic function that gets tokens from the source file and compares them against the provided tokens.
+ * @brief Registers a dynamic schema from the `.schema` source inside `source`, which is copied.
  *
- * @param lex Pointer to the stb_lexer instance that contains the tokens.
- * @param ... tokens of type `int` to check for. These parameters should end with -1.
- * @return Returns `true` if the source file matched the provided tokens, `false` otherwise.
+ * @param name Name of the schema source that is used in diagnostics.
+ * @return Returns `false` if the schema has errors.
 */
-__BK_API bool get_expect_tokens(stb_lexer* lex, ...);
-
+bool bk_register_dynamic_schema(BkContext* bk, const char* name, const char* source, size_t len);
 /**
- * @brief Variadic function that gets identifiers from the source file and compares them against the provided identifiers.
+ * @brief Analyzes the C source inside `source` and appends the types it defines to `out`.
  *
- * This macro also returns `false` if it encounters non-identifier tokens.
+ * `out` has to be zero initialized before its first use and free'd with `bk_free_types`.
  *
- * @param lex Pointer to the stb_lexer instance that contains the tokens.
- * @param ... indetifiers of type `const char*` to check for. These parameters should end with NULL.
- * @return Returns `true` if the source file matched the provided indetifiers, `false` otherwise.
+ * @param name Name of the source that is used in diagnostics.
+ * @return Returns `true` if any types were found.
 */
-__BK_API bool get_expect_ids(stb_lexer* lex,...);
-
-/** @cond */
-bool get_expect_c(stb_lexer* lex,...); // Unused for now
-/** @endcond */
-
+bool bk_analyze(BkContext* bk, const char* name, const char* source, size_t len, CCompounds* out);
 /**
- * @brief Parses the provided file and appends all types it could find to the provided `CCompounds` dynamic array.
- *
- * This function doesn't return on errors and instead just logs them and continues to try parsing.
+ * @brief Appends the code that is generated for `types` to `out`, without the header guard of generated files.
  *
- * @param file_name The name of the currently analyzed file. Used for error messages.
- * @param schemas Dynamic array that contains all loaded schemas.
- * @param content Contents of the source file.
- * @param out Dynamic array for appending analyzed types.
- * @param derive_all Whether the `BkConfig::derive_all` option is on or not.
+ * `out` is kept null terminated.
+ * @return Returns `false` if nothing was generated for `types`.
 */
-__BK_API void analyze_file(const char* file_name, String content, CCompounds* out, bool derive_all);
+bool bk_generate(BkContext* bk, CCompounds* types, String* out);
+/** @brief Appends the contents of 'derives.h' for the registered schemas to `out`. */
+void bk_generate_derives(BkContext* bk, String* out);
+/** @brief free's types that were analyzed with `bk_analyze`. */
+void bk_free_types(CCompounds* types);
 /** @} */
+#endif // __BK_GEN_EXT_DEFINITIONS
 
-/**
- * @defgroup commandline Command Line
- * @brief All definitions and declarations related to parsing commandline arguments and executing commands.
-*/
+#define __BK_API static
 
 /**
- * @ingroup commandline
- * @brief Parses a list from the command line.
+ * @defgroup allocs Allocation Tracking
+ * @brief Counts the allocations made by `bookkeeper` itself, see `--stats`.
  *
- * Users are meant to call this function in a loop until its return value equals to NULL.
+ * Every allocation inside this file goes through the wrappers below, which only update the process wide counters after
+ * @link track_allocations `track_allocations`@endlink enabled them. Memory allocated by plugins isn't counted, and the heap size
+ * is only tracked where the size of an allocation can be queried (glibc and macOS). The wrapper macros are removed at
+ * the end of this file, so files that include it keep using libc directly.
  *
- * @param src Array of command line arguments, equal to the `argv` from `main`.
- * @param sep Seperator character for the list.
- * @param entry_len Out parameter that is assigned to the current entry's length.
- * @return NULL when there are no more entries in the list or the list couldn't be parsed.
- *         Otherwise, returns a *sized string*. This string is **not null terminated**.
+ * @addtogroup allocs
+ * @{
 */
-__BK_API char* parse_list(char** src, char sep, size_t* entry_len);
 
-/** @cond */
-#define gen_def_guard(fntype)\
-if (bk.conf.disabled_by_default) {\
-    print_string(book_buf, "\n#if defined(%s"fntype")", bk.conf.enable_macro_prefix);\
-    print_string(book_buf, " || defined(%s%s)", bk.conf.enable_macro_prefix, ty->name);\
-    print_string(book_buf, " || defined(%s%s_"fntype")", bk.conf.enable_macro_prefix, ty->name);\
-} else {\
-    print_string(book_buf, "\n#ifndef %s"fntype"\n", bk.conf.disable_macro_prefix);\
-    print_string(book_buf, "\n#ifndef %s%s\n", bk.conf.disable_macro_prefix, ty->name);\
-    print_string(book_buf, "\n#ifndef %s%s_"fntype, bk.conf.disable_macro_prefix, ty->name);\
-}\
+/** @brief Snapshot of the allocation counters. */
+typedef struct {
+    size_t allocs;
+    /** @brief Reallocations of existing memory, they aren't part of `AllocStats::allocs`. */
+    size_t reallocs;
+    size_t frees;
+    /** @brief Largest number of bytes that were allocated at the same time, 0 if the heap size isn't tracked. */
+    long long peak_heap;
+} AllocStats;
+
+/** @brief Enables the allocation counters, enable them before the first allocation so every `free` has a counted allocation. */
+__BK_API void track_allocations(bool enable);
+
+/** @brief Returns the current values of the allocation counters. */
+__BK_API AllocStats allocation_stats(void);
+
+__BK_API void* bk_malloc(size_t size);
+__BK_API void* bk_calloc(size_t count, size_t size);
+__BK_API void* bk_realloc(void* ptr, size_t size);
+__BK_API char* bk_strdup(const char* s);
+__BK_API void bk_free(void* ptr);
+/** @brief Same as `realpath(path, NULL)`, but the result is counted so releasing it with `free` keeps the counters balanced. */
+__BK_API char* bk_realpath(const char* path);
+
+#define malloc(size) bk_malloc(size)
+#define calloc(count, size) bk_calloc(count, size)
+#define realloc(ptr, size) bk_realloc(ptr, size)
+#define strdup(s) bk_strdup(s)
+#define free(ptr) bk_free(ptr)
+/** @} */
 
-#define gen_endif_guard(fntype)\
-if (bk.conf.disabled_by_default) {\
-    print_string(book_buf, "\n#endif // %s*\n", bk.conf.enable_macro_prefix);\
-} else {\
-    print_string(book_buf, "\n#endif // %s%s_"fntype"\n", bk.conf.disable_macro_prefix, ty->name);\
-    print_string(book_buf, "\n#endif // %s%s\n", bk.conf.disable_macro_prefix, ty->name);\
-    print_string(book_buf, "\n#endif // %s"fntype"\n", bk.conf.disable_macro_prefix);\
-}\
+// General utility functions
+/**
+ * @brief Allocates `size` bytes from `a`, the memory is released by @link free_arena `free_arena`@endlink.
+ *
+ * Returns NULL if `size` is 0.
+*/
+__BK_API void* arena_alloc(Arena* a, size_t size);
+/** @brief Releases everything that was allocated from `a` at once but keeps its blocks around for reuse. */
+__BK_API void arena_reset(Arena* a);
+/** @brief free's all blocks of an `Arena` */
+__BK_API void free_arena(Arena* a);
 
-#define gen_def_type_guard(fntype)\
-if (bk.conf.disabled_by_default) {\
-    gen_def_guard(fntype);\
-    print_string(book_buf, " || defined(%s%s)", bk.conf.enable_macro_prefix, schema->name);\
-    print_string(book_buf, "|| defined(%s%s_"fntype")", bk.conf.enable_macro_prefix, schema->name);\
-    print_string(book_buf, "|| defined(%s%s_%s)", bk.conf.enable_macro_prefix, ty->name, schema->name);\
-    print_string(book_buf, "|| defined(%s%s_%s_"fntype")\n", bk.conf.enable_macro_prefix, ty->name, schema->name);\
-} else {\
-    print_string(book_buf, "\n#ifndef %s%s\n", bk.conf.disable_macro_prefix, schema->name);\
-    print_string(book_buf, "\n#ifndef %s%s_"fntype"\n", bk.conf.disable_macro_prefix, schema->name);\
-    print_string(book_buf, "\n#ifndef %s%s_%s\n", bk.conf.disable_macro_prefix, ty->name, schema->name);\
-    print_string(book_buf, "\n#ifndef %s%s_%s_"fntype"\n", bk.conf.disable_macro_prefix, ty->name, schema->name);\
-}\
+/** @brief Appends the contents of the provided file to `dst`. Files that aren't regular files (like pipes) are read until their end. */
+__BK_API bool read_entire_file_loc(BkContext* bk, const char* file_name, String* dst, const char* source_file, int source_line);
+#define read_entire_file(bk, file_name, dst) read_entire_file_loc(bk, file_name, dst, __FILE__, __LINE__)
 
-#define gen_endif_type_guard(fntype)\
-if (bk.conf.disabled_by_default) {\
-    print_string(book_buf, "\n#endif // %s*\n", bk.conf.enable_macro_prefix);\
-} else {\
-    print_string(book_buf, "\n#endif // %s%s_%s_"fntype"\n", bk.conf.disable_macro_prefix, ty->name, schema->name);\
-    print_string(book_buf, "\n#endif // %s%s_%s\n", bk.conf.disable_macro_prefix, ty->name, schema->name);\
-    print_string(book_buf, "\n#endif // %s%s_"fntype"\n", bk.conf.disable_macro_prefix, schema->name);\
-    print_string(book_buf, "\n#endif // %s%s\n", bk.conf.disable_macro_prefix, schema->name);\
-}
-/** @endcond */
+/** @brief Read only contents of a file, see @link map_entire_file `map_entire_file`@endlink. */
+typedef struct {
+    /** @brief The contents of the file, valid until the file is unmapped. Always followed by a `\0`. */
+    String_View contents;
 
-#define BK_DUMP_UPPER "DUMP"
-#define BK_PARSE_UPPER "PARSE"
-#define BK_DUMP_LOWER "dump"
-#define BK_PARSE_LOWER "parse"
+    /** @brief Start of the mapping, NULL if the contents were read into `MappedFile::buf` instead. */
+    void* map;
+
+    /** @brief Holds the contents of files that can't be mapped, reused between calls. */
+    String buf;
+} MappedFile;
 
 /**
- * @defgroup codegen Code Generation
- * @brief Code generation functions.
+ * @brief Maps the provided file into memory so its contents can be used without copying them.
  *
- * @addtogroup codegen
- * @{
+ * Files that can't be mapped (pipes, special files, empty files or failing `mmap` calls) are read into `MappedFile::buf`
+ * instead, and so are all files in watch and daemon mode and files whose size is a multiple of the page size, since
+ * their mapping couldn't be followed by a `\0`. Any previous contents of `out` are unmapped first.
 */
-/** */
-
+__BK_API bool map_entire_file_loc(BkContext* bk, const char* file_name, MappedFile* out, const char* source_file, int source_line);
+#define map_entire_file(bk, file_name, out) map_entire_file_loc(bk, file_name, out, __FILE__, __LINE__)
+/** @brief Releases the contents of `f` but keeps `MappedFile::buf` around for reuse. */
+__BK_API void unmap_file(MappedFile* f);
+/** @brief Unmaps `f` and free's `MappedFile::buf`. */
+__BK_API void free_mapped_file(MappedFile* f);
 /**
- * @brief Generates 'prelude' code that will be generated once at the top of each generated file.
+ * @brief Writes `src` into the provided file.
  *
- * For more information, see `StaticSchema::gen_prelude`.
+ * If the file already contains exactly the contents of `src`, it is left untouched so its modification time doesn't change
+ * and build systems don't recompile anything that depends on it. Otherwise the contents are written into a temporary file
+ * inside the same directory which then gets `rename`d over the target, so readers never see a partially written file.
+*/
+__BK_API bool write_entire_file_loc(BkContext* bk, const char* file_name, String* src, const char* source_file, int source_line);
+#define write_entire_file(bk, file_name, src) write_entire_file_loc(bk, file_name, src, __FILE__, __LINE__)
+/** @brief Returns `true` if the provided file exists and its contents are equal to `src`. */
+__BK_API bool file_equals(const char* file_name, String* src);
+__BK_API unsigned long djb2(const char* s);
+__BK_API bool entry_from_file(BkContext* bk, const char* file_name, Entry* out);
+__BK_API bool is_source_file_name(const char* file_name);
+/** @brief Creates the entry of the file at `file_name` relative to the include directory `root`. */
+__BK_API void entry_from_include_dir(BkContext* bk, const char* root, const char* file_name, Entry* out);
+/** @brief Creates all missing directories on the path to `file_name`. The string is modified temporarily. */
+__BK_API bool make_parent_dirs(char* file_name);
+__BK_API bool parse_dynamic_schema_loc(BkContext* bk, const char* file_name, DynamicSchema* out, String* source, const char* source_file, int source_line);
+/** @brief Parses the schema inside `source` like `parse_dynamic_schema_loc`, `file_name` is only used for diagnostics. */
+__BK_API bool parse_dynamic_schema_source(BkContext* bk, const char* file_name, DynamicSchema* out, String* source);
+/**
+ * @brief Compiles `DynamicSchema::source` into `DynamicSchema::ops` so types don't have to re-parse the schema.
  *
+ * Syntax errors are reported here with their location in `file_name`, `file` is the whole source of the schema file.
+ *
+ * @return Returns `false` if the schema has an error, `DynamicSchema::ops` is left empty in that case.
 */
-void gen_prelude(String* book_buf, CCompound* ty);
-
+__BK_API bool compile_dynamic_schema(BkContext* bk, const char* file_name, String_View file, DynamicSchema* schema);
 /**
- * @brief Generates the declarations of "dump" functions for the specified type.
+ * @brief Translates a compiled dynamic schema into the C source of an equivalent static schema extension.
  *
- * For more information, see `StaticSchema::gen_dump_decl`.
+ * The code of each dump/parse guard (inside and outside of the implementation guard) becomes the matching `StaticSchema`
+ * callback and the output ends with a `StaticSchema` definition named `<schema>_schema` that can be added with `BK_ADD_SCHEMAS`.
  *
+ * @param out The generated source is appended to this string.
 */
-size_t gen_dump_decl(String* book_buf, CCompound* ty, const char* dst_type);
-
+__BK_API void write_schema_extension(BkContext* bk, DynamicSchema* schema, String* out);
 /**
- * @brief Generates the declarations of "parse" functions for the specified type.
+ * @brief Loads the static schemas of the plugin (shared object) at `file_name` with `dlopen`.
  *
- * For more information, see `StaticSchema::gen_parse_decl`.
+ * The plugin has to export `bk_plugin_abi` (see `BK_DEFINE_PLUGIN_ABI`) and a `bk_plugin_register` function
+ * (see `BkPluginRegister`). Plugins that were built against a different extension header are rejected.
+ * Plugins can only use the types and macros of the extension header since `bk` doesn't export its functions.
  *
+ * @return Returns `false` if the plugin couldn't be loaded, no schemas are added in that case.
 */
-size_t gen_parse_decl(String* book_buf, CCompound* ty);
-
+__BK_API bool load_plugin(BkContext* bk, const char* file_name);
+__BK_API bool load_dynamic_schema_loc(BkContext* bk, const char* file_name, const char* source_file, int source_line);
+#define load_dynamic_schema(bk, file_name) load_dynamic_schema_loc(bk, file_name, __FILE__, __LINE__)
 /**
- * @brief Generates the implementations of "dump" functions for the specified type.
+ * @brief Re-reads the source of an already loaded dynamic schema from `DynamicSchema::file_name`.
  *
- * For more information, see `StaticSchema::gen_dump_impl`.
+ * The schema keeps its previous source if the file can't be read or parsed.
  *
+ * @param index Index of the schema in `BkContext::dynamic_schemas`.
+ * @return Returns `true` if the schema was reloaded, `false` otherwise.
 */
-void gen_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
-
+__BK_API bool reload_dynamic_schema(BkContext* bk, size_t index);
+/** @brief Sets the default configuration of a zero initialized context and adds the built-in static schemas to it. */
+__BK_API void init_context(BkContext* bk);
+/** @brief free's everything the context owns and closes its plugins, the context itself isn't free'd. */
+__BK_API void free_context(BkContext* bk);
+/** @brief Appends the contents of 'derives.h' for the loaded schemas to `book_buf`. */
+__BK_API void gen_derives_header(BkContext* bk, String* book_buf);
+/** @brief Generates 'derives.h' inside `BkConfig::output_dir` using `book_buf` as scratch space. */
+__BK_API bool write_derives_header(BkContext* bk, String* book_buf);
 /**
- * @brief Generates the implementations of "parse" functions for the specified type.
+ * @brief Appends a Make style rule to `dst` that lists every file `target` depends on.
  *
- * For more information, see `StaticSchema::gen_parse_impl`.
+ * The dependencies of a generated file are the provided entries, every dynamic schema file and the loaded config file.
+ * Spaces, '#' and '$' inside paths are escaped.
+*/
+__BK_API void print_depfile_rule(BkContext* bk, String* dst, const char* target, Entry* entries, size_t entries_len);
+/** @brief Writes the depfile of `out_file` ('<out_file>.d') using `buf` as scratch space. */
+__BK_API bool write_depfile(BkContext* bk, const char* out_file, Entry* entries, size_t entries_len, String* buf);
+
+/**
+ * @brief Function used for obtaining the index of the schema of the specified type in the specified index inside a `DeriveSet`.
  *
+ * @param schema_type Denotes whether the provided schema is static or dynamic.
+ * @param index Index of this schema in its corresponding array.
+ * @return Returns the index that can be used with `CCompund::derived_schemas`.
 */
-void gen_parse_impl(String* book_buf, CCompound* ty);
+__BK_API size_t schema_index(BkContext* bk, SchemaType schema_type, size_t index);
 
+/** @brief Adds the schema with the provided index to `set`. */
+__BK_API void derive_set_add(DeriveSet* set, size_t index);
+/** @brief Adds the first `count` schemas to `set`, used by `derive_all`. */
+__BK_API void derive_set_add_all(DeriveSet* set, size_t count);
 /**
- * @brief Interpretes all loaded dynamic schema code for the specified type.
+ * @brief Returns the index of the first schema in `set` that isn't lower than `from`, `DERIVE_SET_END` if there is none.
+ *
+ * Skips 64 schemas at a time, so walking a set is proportional to the schemas in it rather than all loaded schemas:
+ * `for (size_t s = derive_set_next(set, 0); s != DERIVE_SET_END; s = derive_set_next(set, s + 1))`
+*/
+__BK_API size_t derive_set_next(const DeriveSet* set, size_t from);
+/** @brief Returns `true` if `set` doesn't contain any schemas. */
+__BK_API bool derive_set_empty(const DeriveSet* set);
+
+/** @brief Appends a deep copy of `cc` to `dst`, its fields and strings are allocated from `CCompounds::names` of `dst`. */
+__BK_API void copy_ccompound(CCompounds* dst, CCompound* cc);
+
+/**
+ * @brief Appends `cc` to `dst`, copying its fields and derived schemas into `CCompounds::names` of `dst`.
+ *
+ * The arrays of `cc` stay owned by the caller, so they can be used as scratch space for the next type.
+*/
+__BK_API void push_ccompound(CCompounds* dst, CCompound cc);
+
+// Cleanup functions
+/** @brief Drops all types of `types` but keeps their memory around for reuse. */
+__BK_API void reset_ccompounds(CCompounds* types);
+/** @brief free's the contents of a `CCompounds`, including the fields and strings of all of its types */
+__BK_API void free_ccompounds(CCompounds* types);
+/** @brief free's the contents of a `Entry` */
+__BK_API void free_entry(Entry e);
+
+/**
+ * @defgroup cparse Parsing C code
+ * @brief All definitions and declarations related to parsing C code.
+ * @addtogroup cparse
+ * @{
+*/
+
+/** @brief A single token of a `TokenTape`. */
+typedef struct {
+    /** @brief Kind of the token, either a character or one of the `CLEX_*` constants of stb_c_lexer. */
+    int kind;
+    /**
+     * @brief Interned string of the token, see @link tape_string `tape_string`@endlink.
+     *
+     * Only identifiers and string literals have a string of their own. Like stb_c_lexer does with `lexer->string`,
+     * every other token keeps the string of the last identifier or string literal before it.
+    */
+    unsigned string;
+    /** @brief Byte offset of the first character of the token inside `TokenTape::source`. */
+    unsigned offset;
+} Token;
+
+/** @brief Dynamic array of `Token` */
+typedef struct {
+    Token* items;
+    size_t len;
+    size_t cap;
+} Tokens;
+
+/**
+ * @brief Interns `len` bytes starting at `s` and returns their id.
+ *
+ * @param in Interner that owns the interned strings.
+ * @param s The string to intern, doesn't have to be null terminated.
+ * @param len Length of `s` in bytes.
+ * @return The id of the interned string.
+*/
+__BK_API unsigned intern(Interner* in, const char* s, size_t len);
+
+/** @brief Looks up `len` bytes starting at `s` without interning them, returns `false` if they weren't interned before. */
+__BK_API bool find_interned(const Interner* in, const char* s, size_t len, unsigned* id);
+
+/** @brief Returns the null terminated contents of the interned string with the provided id. */
+__BK_API const char* interned_string(const Interner* in, unsigned id);
+
+/** @brief Interns a null terminated string and returns a pointer to the interned copy. */
+__BK_API const char* intern_str(Interner* in, const char* s);
+
+/** @brief Drops all interned strings of `in` but keeps its memory around for reuse. */
+__BK_API void reset_interner(Interner* in);
+
+/** @brief free's the contents of an `Interner` */
+__BK_API void free_interner(Interner* in);
+
+/**
+ * @brief A source file tokenized in a single pass, see @link tokenize `tokenize`@endlink.
+ *
+ * Identifiers and string literals are interned, so matching them against keywords only compares integers.
+ * Strings that are part of `TokenTape::base` keep their id from there, all others get ids after them.
+*/
+typedef struct {
+    /** @brief Tokens of the source in order, always ends with a `CLEX_eof` token. */
+    Tokens tokens;
+    /** @brief The tokenized source, tokens refer to it by offset. */
+    String_View source;
+    /** @brief Shared read only strings, usually `BkContext::symbols`. Can be NULL. */
+    const Interner* base;
+    /** @brief Strings of the source that aren't part of `TokenTape::base`. */
+    Interner strings;
+} TokenTape;
+
+/** @brief Interns a string for use in `tape`, see @link intern `intern`@endlink. */
+__BK_API unsigned tape_intern(TokenTape* tape, const char* s, size_t len);
+
+/** @brief Returns the null terminated contents of the interned string with the provided id. */
+__BK_API const char* tape_string(TokenTape* tape, unsigned string);
+
+/**
+ * @brief Tokenizes `source` with stb_c_lexer and appends every token to `tape`.
+ *
+ * The tape doesn't copy `source`, so it has to outlive the tape.
+ *
+ * @param tape Tape to fill, tokens of a previous source are dropped but interned strings are kept.
+ * @param source Contents of the source file.
+*/
+__BK_API void tokenize(TokenTape* tape, String_View source);
+
+/** @brief Returns the token at index `i`, indices past the end all refer to the final `CLEX_eof` token. */
+__BK_API Token* tape_at(TokenTape* tape, size_t i);
+
+/** @brief Returns `true` if the token at index `i` is of the provided kind. */
+__BK_API bool tape_is(TokenTape* tape, size_t i, int kind);
+
+/** @brief Returns `true` if the token at index `i` is an identifier with the provided interned string. */
+__BK_API bool tape_is_id(TokenTape* tape, size_t i, unsigned string);
+
+/**
+ * @brief Computes the line (starting from 1) and line offset (starting from 0) of the token at index `i`.
+ *
+ * Locations are only needed for diagnostics, so they are computed on demand by scanning the source.
+*/
+__BK_API void tape_location(TokenTape* tape, size_t i, int* line, int* offset);
+
+/** @brief free's the contents of a `TokenTape` */
+__BK_API void free_token_tape(TokenTape* tape);
+
+/**
+ * @brief Parses the provided file and appends all types it could find to the provided `CCompounds` dynamic array.
+ *
+ * This function doesn't return on errors and instead just logs them and continues to try parsing.
+ *
+ * @param file_name The name of the currently analyzed file. Used for error messages.
+ * @param schemas Dynamic array that contains all loaded schemas.
+ * @param content Contents of the source file.
+ * @param content Contents of the source file, has to be followed by a `\0` since the lexer parses numbers with `strtod`.
+ * @param derive_all Whether the `BkConfig::derive_all` option is on or not.
+*/
+__BK_API void analyze_file(BkContext* bk, const char* file_name, String_View content, CCompounds* out, bool derive_all);
+
+/**
+ * @brief (Re)builds `BkContext::symbols` and `BkContext::symbol_info` from the keywords of the analyzer and all loaded schemas.
+ *
+ * Has to be called whenever a schema is loaded or reloaded, before any file is analyzed.
+ * Afterwards resolving an identifier to a primitive type or derive attribute is a single hash lookup.
+*/
+__BK_API void init_analysis_symbols(BkContext* bk);
+
+/** @brief free's `BkContext::symbols` and `BkContext::symbol_info` */
+__BK_API void free_analysis_symbols(BkContext* bk);
+
+/**
+ * @brief Cheap check that runs before a file is tokenized, returns `false` if analyzing `content` can't have any effect.
+ *
+ * Files without a "typedef" never contain types. Types without any derives only matter for 'generics.h', for dynamic
+ * schemas and when schemas are derived globally, otherwise files that don't mention "derive" (or the derive attribute
+ * of a static schema without "derive" in its name) are skipped as well.
+*/
+__BK_API bool may_contain_types(BkContext* bk, String_View content, bool derive_all);
+/** @} */
+
+/**
+ * @defgroup commandline Command Line
+ * @brief All definitions and declarations related to parsing commandline arguments and executing commands.
+*/
+
+/**
+ * @ingroup commandline
+ * @brief Parses a list from the command line.
+ *
+ * Users are meant to call this function in a loop until its return value equals to NULL.
+ *
+ * @param src Array of command line arguments, equal to the `argv` from `main`.
+ * @param sep Seperator character for the list.
+ * @param entry_len Out parameter that is assigned to the current entry's length.
+ * @return NULL when there are no more entries in the list or the list couldn't be parsed.
+ *         Otherwise, returns a *sized string*. This string is **not null terminated**.
+*/
+__BK_API char* parse_list(char** src, char sep, size_t* entry_len);
+
+/** @cond */
+#define gen_def_guard(fntype)\
+if (bk->conf.disabled_by_default) {\
+    print_string(book_buf, "\n#if defined(%s"fntype")", bk->conf.enable_macro_prefix);\
+    print_string(book_buf, " || defined(%s%s)", bk->conf.enable_macro_prefix, ty->name);\
+    print_string(book_buf, " || defined(%s%s_"fntype")", bk->conf.enable_macro_prefix, ty->name);\
+} else {\
+    print_string(book_buf, "\n#ifndef %s"fntype"\n", bk->conf.disable_macro_prefix);\
+    print_string(book_buf, "\n#ifndef %s%s\n", bk->conf.disable_macro_prefix, ty->name);\
+    print_string(book_buf, "\n#ifndef %s%s_"fntype, bk->conf.disable_macro_prefix, ty->name);\
+}\
+
+#define gen_endif_guard(fntype)\
+if (bk->conf.disabled_by_default) {\
+    print_string(book_buf, "\n#endif // %s*\n", bk->conf.enable_macro_prefix);\
+} else {\
+    print_string(book_buf, "\n#endif // %s%s_"fntype"\n", bk->conf.disable_macro_prefix, ty->name);\
+    print_string(book_buf, "\n#endif // %s%s\n", bk->conf.disable_macro_prefix, ty->name);\
+    print_string(book_buf, "\n#endif // %s"fntype"\n", bk->conf.disable_macro_prefix);\
+}\
+
+#define gen_def_type_guard(fntype)\
+if (bk->conf.disabled_by_default) {\
+    gen_def_guard(fntype);\
+    print_string(book_buf, " || defined(%s%s)", bk->conf.enable_macro_prefix, schema->name);\
+    print_string(book_buf, "|| defined(%s%s_"fntype")", bk->conf.enable_macro_prefix, schema->name);\
+    print_string(book_buf, "|| defined(%s%s_%s)", bk->conf.enable_macro_prefix, ty->name, schema->name);\
+    print_string(book_buf, "|| defined(%s%s_%s_"fntype")\n", bk->conf.enable_macro_prefix, ty->name, schema->name);\
+} else {\
+    print_string(book_buf, "\n#ifndef %s%s\n", bk->conf.disable_macro_prefix, schema->name);\
+    print_string(book_buf, "\n#ifndef %s%s_"fntype"\n", bk->conf.disable_macro_prefix, schema->name);\
+    print_string(book_buf, "\n#ifndef %s%s_%s\n", bk->conf.disable_macro_prefix, ty->name, schema->name);\
+    print_string(book_buf, "\n#ifndef %s%s_%s_"fntype"\n", bk->conf.disable_macro_prefix, ty->name, schema->name);\
+}\
+
+#define gen_endif_type_guard(fntype)\
+if (bk->conf.disabled_by_default) {\
+    print_string(book_buf, "\n#endif // %s*\n", bk->conf.enable_macro_prefix);\
+} else {\
+    print_string(book_buf, "\n#endif // %s%s_%s_"fntype"\n", bk->conf.disable_macro_prefix, ty->name, schema->name);\
+    print_string(book_buf, "\n#endif // %s%s_%s\n", bk->conf.disable_macro_prefix, ty->name, schema->name);\
+    print_string(book_buf, "\n#endif // %s%s_"fntype"\n", bk->conf.disable_macro_prefix, schema->name);\
+    print_string(book_buf, "\n#endif // %s%s\n", bk->conf.disable_macro_prefix, schema->name);\
+}
+/** @endcond */
+
+#define BK_DUMP_UPPER "DUMP"
+#define BK_PARSE_UPPER "PARSE"
+#define BK_DUMP_LOWER "dump"
+#define BK_PARSE_LOWER "parse"
+
+/**
+ * @defgroup codegen Code Generation
+ * @brief Code generation functions.
+ *
+ * @addtogroup codegen
+ * @{
+*/
+/** */
+
+/**
+ * @brief Generates 'prelude' code that will be generated once at the top of each generated file.
+ *
+ * For more information, see `StaticSchema::gen_prelude`.
+ *
+*/
+void gen_prelude(BkContext* bk, String* book_buf, CCompound* ty);
+
+/**
+ * @brief Generates the declarations of "dump" functions for the specified type.
+ *
+ * For more information, see `StaticSchema::gen_dump_decl`.
+ *
+*/
+size_t gen_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type);
+
+/**
+ * @brief Generates the declarations of "parse" functions for the specified type.
+ *
+ * For more information, see `StaticSchema::gen_parse_decl`.
+ *
+*/
+size_t gen_parse_decl(BkContext* bk, String* book_buf, CCompound* ty);
+
+/**
+ * @brief Generates the implementations of "dump" functions for the specified type.
+ *
+ * For more information, see `StaticSchema::gen_dump_impl`.
+ *
+*/
+void gen_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+
+/**
+ * @brief Generates the implementations of "parse" functions for the specified type.
+ *
+ * For more information, see `StaticSchema::gen_parse_impl`.
+ *
+*/
+void gen_parse_impl(BkContext* bk, String* book_buf, CCompound* ty);
+
+/**
+ * @brief Runs the compiled code of all loaded dynamic schemas for the specified type.
  *
  * To learn about the dynamic schema syntax, see the 'Dynamic Schema' section of the User Documentation.
+ * The schemas were compiled by @link compile_dynamic_schema `compile_dynamic_schema`@endlink when they were loaded.
  *
  * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
  *        macro available to both this source file and extension authors can be used to output into this buffer.
@@ -1029,7 +1686,16 @@ void gen_parse_impl(String* book_buf, CCompound* ty);
  * @param dst_type The type of the 'dst' parameter that is meant to be used for generated "dump" functions.
  * @param fmt_macro The name of the macro that is meant to be used **inside generated code** to output into the 'dst' buffer.
 */
-void gen_dynamic(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+void gen_dynamic(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+
+/**
+ * @brief Generates everything inside the header guard of the file that is generated from an entry with the provided types.
+ *
+ * Only uses its arguments and reads `BkContext`, so it can be called from multiple threads at the same time.
+ *
+ * @return Returns `false` if no file should be generated for these types, the contents of `book_buf` are meaningless then.
+*/
+bool gen_entry(BkContext* bk, String* book_buf, CCompounds* types);
 /** @} */
 
 /**
@@ -1039,11 +1705,11 @@ void gen_dynamic(String* book_buf, CCompound* ty, const char* dst_type, const ch
  * @{
 */
 
-void gen_json_prelude(String* book_buf);
-size_t gen_json_dump_decl(String* book_buf, CCompound* ty, const char* dst_type);
-size_t gen_json_parse_decl(String* book_buf, CCompound* ty);
-void gen_json_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
-void gen_json_parse_impl(String* book_buf, CCompound* ty);
+void gen_json_prelude(BkContext* bk, String* book_buf);
+size_t gen_json_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type);
+size_t gen_json_parse_decl(BkContext* bk, String* book_buf, CCompound* ty);
+void gen_json_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+void gen_json_parse_impl(BkContext* bk, String* book_buf, CCompound* ty);
 /** @} */
 
 /**
@@ -1052,8 +1718,8 @@ void gen_json_parse_impl(String* book_buf, CCompound* ty);
  * @addtogroup debugcodegen
  * @{
 */
-size_t gen_debug_dump_decl(String* book_buf, CCompound* ty, const char* dst_type);
-void gen_debug_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+size_t gen_debug_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type);
+void gen_debug_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
 /** @} */
 
 /**
@@ -1068,109 +1734,792 @@ void gen_debug_dump_impl(String* book_buf, CCompound* ty, const char* dst_type,
 int parse_bkconf_BkConfig(const char* src, unsigned long len, BkConfig* dst);
 /** @} */
 
-/** @brief Defines different output modes. */
+#ifdef BK_WATCH_INOTIFY
+/**
+ * @defgroup watch Watch Mode
+ * @brief Event based watch backend built on top of inotify.
+ *
+ * Instead of watching individual files (which breaks when editors save by renaming a temporary file),
+ * the watcher watches the directories that contain the watched files and matches events by name.
+ *
+ * @addtogroup watch
+ * @{
+*/
+
+/** @brief Kind tag for `WatchTarget` */
 typedef enum {
-    /** @brief Mirrors the original file structure. Places generated files next to their source files. */
-    O_MIRROR,
+    WATCH_ENTRY,
+    WATCH_SCHEMA,
+    WATCH_INCLUDE_DIR,
+} WatchTargetKind;
 
-    /** @brief Places all generated files inside the provided `output-directory`. */
-    O_DIR,
+/** @brief Defines a file (or directory) that is watched for changes. */
+typedef struct {
+    /** @brief Denotes what kind of object `WatchTarget::index` refers to. */
+    WatchTargetKind kind;
 
-    // O_FILE // TODO: implement optional single-file output
-} OutputMode;
+    /** @brief The inotify watch descriptor of the directory that contains this target. */
+    int wd;
 
-/**
- * @ingroup commandline
- * @brief Defines a command that can be executed from the commandline.
-*/
+    /** @brief The file name of this target inside its directory. NULL for @link WatchTargetKind `WatchTargetKind::WATCH_INCLUDE_DIR`@endlink. */
+    char* base;
+
+    /** @brief Index of the watched object inside `BkContext::entries`, `BkContext::dynamic_schemas` or `BkContext::include_dirs`. */
+    size_t index;
+} WatchTarget;
+
+/** @brief Dynamic array of `WatchTarget` */
 typedef struct {
-    /** @brief The name of this command displayed in help menus. (like 'help') */
-    char* name;
+    WatchTarget* items;
+    size_t len;
+    size_t cap;
+} WatchTargets;
 
-    /** @brief The flag used to invoke this command. (like '-h') */
-    char* flag;
+/** @brief State of the inotify watch backend. */
+typedef struct {
+    /** @brief The inotify instance, -1 if it isn't initialized. */
+    int fd;
 
-    /** @brief The usage text for this command. (like '-h <command (optional)>') */
-    char* usage;
+    /** @brief The watch descriptor of `BkConfig::output_dir`, used to ignore events caused by generated files. */
+    int output_wd;
 
-    /** @brief The explanatory description of this command that is displayed in help menus. */
-    char* desc;
+    /** @brief All watched targets. */
+    WatchTargets targets;
+} Watcher;
 
-    /**
-     * @brief The implementation of this command.
-     *
-     * @param i Pointer to the index counter that is used to iterate over command line arguments.
-     *          `Command`s are expected to increment this counter only if the comamnd accepts argument(s).
-     *          So, a flag like '--silent' _shouldn't_ increment this counter at all.
-     * @param argc The amount of command line arguments, equal to the `argc` from `main`.
-     * @param argv Array of command line arguments, equal to the `argv` from `main`.
-    */
-    bool (*exec_c)(int* i, int argc, char** argv);
-} Command;
+/**
+ * @brief Initializes the inotify instance and starts watching all entries, dynamic schemas and the include directory.
+ *
+ * @return Returns `false` if inotify couldn't be initialized.
+*/
+__BK_API bool watcher_init(BkContext* bk, Watcher* w);
 
-// If only we had closures in C...
-/** @addtogroup commandline
- * The *_cmd functions are assigned to the `Command::exec_c` field of their respecive `Command`s.
- *  @{
+/**
+ * @brief Starts watching the entry at the provided index of `BkContext::entries`.
+*/
+__BK_API bool watcher_add_entry(BkContext* bk, Watcher* w, size_t entry_index);
+
+/**
+ * @brief Blocks until a watched file changes and then marks changed entries for analysis.
+ *
+ * Events are coalesced for `BkConfig::watch_debounce` milliseconds after the first event. Changed entries get their
+ * `Entry::last_analyzed` reset to 0, new '.c' or '.h' files directly inside include directories are appended to `BkContext::entries`
+ * and changed dynamic schemas are reloaded.
+ *
+ * @param schemas_changed Out parameter that is set to `true` if any dynamic schema was reloaded.
+ * @return Returns `false` if reading events failed.
 */
-bool help_cmd(int* i, int argc, char** argv);
-bool config_path_cmd(int* i, int argc, char** argv);
-bool output_mode_cmd(int* i, int argc, char** argv);
-bool gen_ext_cmd(int* i, int argc, char** argv);
-bool generics_cmd(int* i, int argc, char** argv);
-bool watch_cmd(int* i, int argc, char** argv);
-bool watch_delay_cmd(int* i, int argc, char** argv);
-bool include_file_cmd(int* i, int argc, char** argv);
-bool include_directory_cmd(int* i, int argc, char** argv);
-bool output_directory_cmd(int* i, int argc, char** argv);
-bool schemas_cmd(int* i, int argc, char** argv);
-bool include_schema_cmd(int* i, int argc, char** argv);
-bool silent_cmd(int* i, int argc, char** argv);
-bool verbose_cmd(int* i, int argc, char** argv);
-bool enable_warn_cmd(int* i, int argc, char** argv);
-bool disable_warn_cmd(int* i, int argc, char** argv);
-bool derive_all_cmd(int* i, int argc, char** argv);
-bool derive_cmd(int* i, int argc, char** argv);
-bool disable_dump_cmd(int* i, int argc, char** argv);
-bool disable_parse_cmd(int* i, int argc, char** argv);
-bool disabled_cmd(int* i, int argc, char** argv);
-bool gen_impl_cmd(int* i, int argc, char** argv);
-bool gen_fmt_dst_cmd(int* i, int argc, char** argv);
-bool gen_fmt_cmd(int* i, int argc, char** argv);
-bool offset_type_cmd(int* i, int argc, char** argv);
-bool disable_prefix_cmd(int* i, int argc, char** argv);
-bool enable_prefix_cmd(int* i, int argc, char** argv);
+__BK_API bool watcher_wait(BkContext* bk, Watcher* w, bool* schemas_changed);
+
+/** @brief free's the contents of a `Watcher` and closes its inotify instance. */
+__BK_API void free_watcher(Watcher* w);
 /** @} */
+#endif // BK_WATCH_INOTIFY
 
+#ifdef BK_DAEMON
 /**
- * @brief Helper macro that does all necessary checks before executing a command. It also prints a usage message if the comamnd fails.
+ * @defgroup daemon Daemon Mode
+ * @brief Resident `bookkeeper` process that serves regeneration requests over a Unix domain socket.
  *
- * @return Returns `true` if the command succeeded, `false` otherwise.
+ * The daemon keeps its configuration, loaded schemas, analyzed types and the analysis cache in memory between requests.
+ * A request is a list of newline separated absolute paths of entries that should be regenerated (all entries if the list
+ * is empty), sent by the client before it shuts down its writing end. The daemon answers with a single line, "ok" or "error".
+ *
+ * @addtogroup daemon
+ * @{
 */
-#define exec_cmd(cmd)\
-((cmd)->exec_c ? ((cmd)->exec_c(&i, argc, argv) ? true : (bk_printf("Usage of '%s': %s\n", (cmd)->name, (cmd)->usage), false)) : false)
 
-#define WARN_NO_INCLUDE "no-include"
-#define WARN_NO_OUTPUT "no-output"
-#define WARN_UNKNOWN_ATTR "unknown-attr"
-#define WARN_LIST WARN_NO_INCLUDE"|"WARN_NO_OUTPUT"|"WARN_UNKNOWN_ATTR
+/** @brief State of the daemon. */
+typedef struct {
+    /** @brief The listening socket, -1 if it isn't initialized. */
+    int fd;
+
+    /** @brief The connection of the client whose request is being served, -1 if there is none. */
+    int client;
+
+    /** @brief Path of the socket file, removed by @link free_daemon `free_daemon`@endlink. */
+    const char* socket_path;
+
+    /** @brief Resolved paths of all entries, shares indices with `BkContext::entries`. */
+    CStrings real_paths;
+} Daemon;
 
 /**
- * @var commands
- * Global static array that includes all commands.
+ * @brief Creates and starts listening on the socket at `socket_path`. A stale socket file at that path is replaced.
+ *
+ * Also installs `SIGINT` and `SIGTERM` handlers that make @link daemon_wait `daemon_wait`@endlink return.
+ *
+ * @return Returns `false` if the socket couldn't be created.
 */
-static Command commands[] = {
-    {
-        .name = "help",
-        .flag = "-h",
-        .usage = "-h <command (optional)>",
-        .desc = "Prints a list of all commands or information about the provided command",
-        .exec_c = help_cmd
-    },
-    {
-        .name = "config-path",
-        .flag = "--config-path",
-        .usage = "--config-path <file>",
+__BK_API bool daemon_init(BkContext* bk, Daemon* d, const char* socket_path);
+
+/**
+ * @brief Blocks until a client sends a request and marks the requested entries for analysis.
+ *
+ * Requested paths that aren't entries yet are appended to `BkContext::entries`.
+ *
+ * @return Returns `false` if the daemon should stop, either because it received a signal or because of an error.
+*/
+__BK_API bool daemon_wait(BkContext* bk, Daemon* d);
+
+/** @brief Sends the result of the current request to its client and closes the connection. Does nothing without a client. */
+__BK_API void daemon_reply(Daemon* d, bool ok);
+
+/** @brief Returns `true` if the daemon was stopped with a signal. */
+__BK_API bool daemon_stopped(void);
+
+/** @brief Closes the socket of the daemon and removes the socket file. */
+__BK_API void free_daemon(Daemon* d);
+
+/**
+ * @brief Asks the daemon listening on `socket_path` to regenerate all entries inside `BkContext::entries`,
+ *        or every entry it knows about if there are none.
+ *
+ * @return Returns `true` if the daemon regenerated the requested entries successfully.
+*/
+__BK_API bool daemon_request(BkContext* bk, const char* socket_path);
+/** @} */
+#endif // BK_DAEMON
+
+/**
+ * @brief Persistent database of all analyzed types, grouped by the entry they were found in.
+ *
+ * The database lives as long as `bookkeeper` runs (across watch mode iterations) and only the types of entries
+ * that were analyzed again get replaced.
+*/
+typedef struct {
+    /** @brief Types of each entry, shares indices with `BkContext::entries`. */
+    CCompounds* items;
+    size_t len;
+    size_t cap;
+
+    /** @brief Set when the set of type names changed, outputs that aggregate all types need to be regenerated. */
+    bool changed;
+} TypeDatabase;
+
+/**
+ * @brief Replaces the types of the entry at `entry_index` with `types`.
+ *
+ * The database takes ownership of the contents of `types`. In exchange `types` receives the previous
+ * types of the entry, reset so their memory can be reused.
+ * `TypeDatabase::changed` is set if the names of the entry's types changed.
+*/
+__BK_API void type_db_patch(TypeDatabase* db, size_t entry_index, CCompounds* types);
+
+/** @brief free's the contents of a `TypeDatabase` */
+__BK_API void free_type_db(TypeDatabase* db);
+
+/**
+ * @defgroup cache Analysis Cache
+ * @brief Persistent on-disk cache of analysis results, see `BkConfig::cache`.
+ *
+ * The manifest is a line based text file. Strings are stored as `<length>:<bytes>` so they may contain any character.
+ * @code
+ * bkcache <version> <fingerprint>
+ * e <full path> <content hash> <file index> <type count>
+ * t <type name> <derived schemas> <field count>
+ * f <field name> <tag or '-'> <type kind> <primitive type or external type name>
+ * @endcode
+ *
+ * @addtogroup cache
+ * @{
+*/
+
+/** @brief Name of the manifest file inside `BkConfig::output_dir`. */
+#define BK_CACHE_FILE ".bk.cache"
+
+/** @brief Version of the manifest format, bump this whenever the format or the analyzer changes. */
+#define BK_CACHE_VERSION 2
+
+/** @brief Version of the generated code, bump this whenever a built-in schema generates different code. */
+#define BK_CODEGEN_VERSION 1
+
+/** @brief Initial value for @link fnv1a `fnv1a`@endlink. */
+#define FNV1A_INIT 14695981039346656037ULL
+
+/** @brief Cached analysis result of a single `Entry`. */
+typedef struct {
+    /** @brief Equal to `Entry::full` of the entry this result belongs to. */
+    char* full;
+
+    /** @brief Hash of the contents of the entry file at the time it was analyzed. */
+    unsigned long long hash;
+
+    /** @brief The index that was used in the header guard of the generated file, -1 if no file was generated. */
+    long file_idx;
+
+    /** @brief All types that were analyzed inside the entry file. */
+    CCompounds types;
+
+    /** @brief Set when the entry was analyzed or found during this run, entries that weren't seen aren't saved. */
+    bool seen;
+} CacheEntry;
+
+/** @brief The persistent analysis cache. */
+typedef struct {
+    CacheEntry* items;
+    size_t len;
+    size_t cap;
+
+    /** @brief Open addressing hash table that maps `CacheEntry::full` to the index of the entry + 1, `0` marks an empty slot. */
+    size_t* table;
+    /** @brief Number of slots in `AnalysisCache::table`, always a power of two. */
+    size_t table_cap;
+
+    /** @brief Fingerprint of the loaded schemas and `BkConfig`, the whole cache is discarded if this changes. */
+    unsigned long long fingerprint;
+
+    /** @brief Set when the cache was modified and needs to be saved. */
+    bool dirty;
+} AnalysisCache;
+
+/** @brief FNV-1a hash of `len` bytes starting at `data`, chained by passing the previous hash as `hash`. */
+__BK_API unsigned long long fnv1a(const void* data, size_t len, unsigned long long hash);
+
+/** @brief Fingerprint of everything other than the input files that affects generated code. */
+__BK_API unsigned long long config_fingerprint(BkContext* bk);
+
+/**
+ * @brief Loads the manifest file.
+ *
+ * The cache is left empty (and isn't considered an error) if the file doesn't exist, is malformed,
+ * or was created with a different fingerprint.
+*/
+__BK_API void load_cache(BkContext* bk, AnalysisCache* cache, const char* file_name);
+
+/** @brief Saves all entries that were seen during this run into the manifest file. */
+__BK_API bool save_cache(BkContext* bk, AnalysisCache* cache, const char* file_name);
+
+/** @brief Finds the cached result of the entry with the provided `Entry::full`, returns NULL if there is none. */
+__BK_API CacheEntry* find_cache_entry(AnalysisCache* cache, const char* full);
+
+/** @brief Replaces (or adds) the cached result of an entry with a copy of `types`. */
+__BK_API CacheEntry* update_cache_entry(AnalysisCache* cache, const char* full, unsigned long long hash, CCompounds* types);
+
+/** @brief Removes all entries from the cache and assigns it a new fingerprint. */
+__BK_API void reset_cache(AnalysisCache* cache, unsigned long long fingerprint);
+
+/** @brief free's the contents of an `AnalysisCache` */
+__BK_API void free_cache(AnalysisCache* cache);
+/** @} */
+
+/** @brief Defines different output modes. */
+typedef enum {
+    /** @brief Mirrors the original file structure. Places generated files next to their source files. */
+    O_MIRROR,
+
+    /** @brief Places all generated files inside the provided `output-directory`. */
+    O_DIR,
+
+    // O_FILE // TODO: implement optional single-file output
+} OutputMode;
+
+/**
+ * @brief Replaces the contents of `dst` with the path of the file that would be generated from the provided entry.
+ *
+ * @return Returns `dst->items` so the path can be used inside expressions.
+*/
+__BK_API char* output_file_path(BkContext* bk, Entry* e, OutputMode output_mode, String* dst);
+
+/** @brief Parses `BkConfig::output_mode` into `out`, returns `false` (and prints a message) if the mode is unknown. */
+__BK_API bool parse_output_mode(BkContext* bk, OutputMode* out);
+
+/**
+ * @defgroup discovery Include Directory Discovery
+ * @brief Recursive search of `BkContext::include_dirs` for input files.
+ *
+ * Directories are read with `openat`/`fstatat` relative to the file descriptor of their root on multiple threads.
+ * A file only becomes an entry if its name passes @link is_source_file_name `is_source_file_name`@endlink, its size passes
+ * `BkConfig::max_file_size` and it isn't ignored by the `.bkignore` file of its root.
+ *
+ * A `.bkignore` file contains one pattern per line, empty lines and lines starting with '#' are skipped. Patterns are matched
+ * with `fnmatch` against paths relative to the root: patterns without a '/' match the name of a file or directory at any depth,
+ * a leading '/' anchors the pattern to the root and a trailing '/' only matches directories. Ignored directories aren't searched.
+ *
+ * @addtogroup discovery
+ * @{
+*/
+
+/**
+ * @brief Searches all include directories with `threads` threads and appends the found files to `BkContext::entries`.
+ *
+ * Found files are sorted by their root and their path, so the order of entries doesn't depend on the file system or
+ * the number of threads.
+ *
+ * @return Returns `false` if one of the include directories couldn't be opened.
+*/
+__BK_API bool discover_sources(BkContext* bk, size_t threads);
+
+/**
+ * @brief Returns `true` if `file_name` (relative to its root) matches one of `patterns`.
+ *
+ * @param patterns Patterns of a `.bkignore` file.
+ * @param is_dir Set to `true` if `file_name` refers to a directory.
+*/
+__BK_API bool is_ignored_path(CStrings* patterns, const char* file_name, bool is_dir);
+
+/** @brief Reads the patterns of the `.bkignore` file inside the directory `root_fd` into `out`, does nothing if the file doesn't exist. */
+__BK_API void read_ignore_file(int root_fd, CStrings* out);
+/** @} */
+
+/**
+ * @defgroup jobs Parallel Jobs
+ * @brief Reading, analyzing and generating code for input files on multiple threads, see `BkConfig::jobs`.
+ *
+ * Jobs don't touch any shared state other than reading `BkContext` and the analysis cache. Their results are merged
+ * into the `TypeDatabase` on the main thread in the order of `BkContext::entries`, which is also where guard indices
+ * are assigned, so generated files don't depend on the number of threads.
+ *
+ * @addtogroup jobs
+ * @{
+*/
+
+/**
+ * @brief Calls `fn(bk, i, ctx)` for every `i` in [0, `count`) on `threads` threads (including the calling one).
+ *
+ * Each worker thread receives its own shallow copy of `bk`, so `fn` may format with `tfmt` and log, but must not modify
+ * anything the context points to.
+*/
+__BK_API void parallel_for(BkContext* bk, size_t count, size_t threads, void (*fn)(BkContext* bk, size_t i, void* ctx), void* ctx);
+
+/** @brief Analysis and code generation of a single entry. */
+typedef struct {
+    /** @brief Index of the entry inside `BkContext::entries`. */
+    size_t entry_index;
+
+    /** @brief Contents of the entry file, only mapped while the job analyzes the file. */
+    MappedFile input;
+
+    /** @brief Set if the entry file could be read. */
+    bool read_ok;
+
+    /** @brief Hash of the contents of the entry file, see @link fnv1a `fnv1a`@endlink. */
+    unsigned long long hash;
+
+    /**
+     * @brief Set if the entry was analyzed into `EntryJob::types`.
+     *
+     * Entries whose hash matches their cached result aren't analyzed, they are likely to be served from the cache.
+    */
+    bool analyzed;
+
+    /** @brief The analyzed types, ownership is passed to the `TypeDatabase` during the merge. */
+    CCompounds types;
+
+    /** @brief Generated code without the header guard, see @link gen_entry `gen_entry`@endlink. Released once it was written unless the build runs in watch or daemon mode. */
+    String body;
+
+    /** @brief The whole generated file, the buffer is reused between runs of the same job in watch and daemon mode. */
+    String file;
+
+    /** @brief Set if a file is generated from `EntryJob::types`. */
+    bool generated;
+
+    /** @brief Set during the merge if the result of this job has to be written (and cached). */
+    bool write;
+
+    /** @brief The guard index assigned during the merge, only valid if `EntryJob::generated` is set. */
+    size_t out_idx;
+
+    /** @brief Set if the generated file was written successfully (or there was nothing to write). */
+    bool write_ok;
+} EntryJob;
+
+/** @brief Dynamic array of `EntryJob` */
+typedef struct {
+    EntryJob* items;
+    size_t len;
+    size_t cap;
+} EntryJobs;
+
+/** @brief Analysis result of a file that is shared between the jobs of a manifest, see `SharedAnalysis`. */
+typedef struct {
+    /** @brief Equal to `Entry::full` of the analyzed entry. */
+    char* full;
+
+    /** @brief Hash of the contents of the file at the time it was analyzed. */
+    unsigned long long hash;
+
+    /** @brief The @link analysis_fingerprint `analysis_fingerprint`@endlink of the context that analyzed the file. */
+    unsigned long long fingerprint;
+
+    /** @brief All types that were analyzed inside the file. */
+    CCompounds types;
+} SharedResult;
+
+/**
+ * @brief Analysis results that are shared between contexts running at the same time, see @link run_manifest `run_manifest`@endlink.
+ *
+ * A result can be reused by any context with the same analysis fingerprint, even if the code it generates differs.
+ * Access is guarded by `SharedAnalysis::lock`.
+*/
+typedef struct {
+    SharedResult* items;
+    size_t len;
+    size_t cap;
+
+    /** @brief Open addressing hash table that maps the path, hash and fingerprint of a result to its index + 1, `0` marks an empty slot. */
+    size_t* table;
+    /** @brief Number of slots in `SharedAnalysis::table`, always a power of two. */
+    size_t table_cap;
+
+    pthread_mutex_t lock;
+} SharedAnalysis;
+
+/** @brief Fingerprint of everything other than the input file that affects the result of @link analyze_file `analyze_file`@endlink. */
+__BK_API unsigned long long analysis_fingerprint(BkContext* bk);
+
+/**
+ * @brief Copies the shared result for the file `full` into `out`.
+ *
+ * @return Returns `false` if there is no result with a matching `hash` and `fingerprint`.
+*/
+__BK_API bool find_shared_result(SharedAnalysis* shared, const char* full, unsigned long long hash, unsigned long long fingerprint, CCompounds* out);
+
+/** @brief Adds a copy of `types` to the shared results, does nothing if an equal result was added in the meantime. */
+__BK_API void add_shared_result(SharedAnalysis* shared, const char* full, unsigned long long hash, unsigned long long fingerprint, CCompounds* types);
+
+/** @brief free's the contents of a `SharedAnalysis` */
+__BK_API void free_shared_analysis(SharedAnalysis* shared);
+
+/**
+ * @brief Reads, analyzes and generates the code of the first `count` jobs of `jobs` on `threads` threads.
+ *
+ * @param cache The analysis cache that is used to skip the analysis of unchanged entries, can be NULL.
+ * @param shared Analysis results of other contexts that are reused and extended, can be NULL.
+*/
+__BK_API void run_analysis_jobs(BkContext* bk, EntryJobs* jobs, size_t count, size_t threads, AnalysisCache* cache, SharedAnalysis* shared);
+
+/** @brief Writes the generated files (and depfiles) of the first `count` jobs of `jobs` that have `EntryJob::write` set on `threads` threads. */
+__BK_API void run_output_jobs(BkContext* bk, EntryJobs* jobs, size_t count, size_t threads, OutputMode output_mode);
+
+/** @brief free's the contents of an `EntryJobs` array */
+__BK_API void free_entry_jobs(EntryJobs* jobs);
+/** @} */
+
+/**
+ * @brief State of the code generation of a context that is kept across watch mode (and daemon) iterations.
+ *
+ * Zero initialize it except for `BuildState::type_db.changed`, which has to be set so aggregated outputs are generated at least once.
+*/
+typedef struct {
+    /** @brief Where generated files are placed. */
+    OutputMode output_mode;
+
+    /** @brief Number of threads that are used by the parallel jobs. */
+    size_t threads;
+
+    /** @brief Set if `BuildState::cache` is used. */
+    bool use_cache;
+
+    /** @brief Set if modifications of entries are tracked by a watcher or the daemon, otherwise every entry is `stat`'ed. */
+    bool tracked;
+
+    /** @brief Analysis results of other contexts, NULL outside of manifest runs. */
+    SharedAnalysis* shared;
+
+    /** @brief The guard index that is claimed by the next entry that generates a file for the first time. */
+    size_t file_idx;
+
+    /** @brief The time the last entry was analyzed. */
+    time_t current_iter;
+
+    TypeDatabase type_db;
+    CCompounds types;
+    EntryJobs jobs;
+    AnalysisCache cache;
+
+    /** @brief Scratch buffer for outputs that aggregate all entries. */
+    String book_buf;
+
+    /** @brief Scratch buffer for the paths of generated files, see @link output_file_path `output_file_path`@endlink. */
+    String path_buf;
+} BuildState;
+
+/**
+ * @brief Analyzes all new or modified entries and writes their generated files, `generics.h` and the depfile.
+ *
+ * @return Returns `false` if an entry couldn't be read or one of its generated files couldn't be written.
+*/
+__BK_API bool run_build(BkContext* bk, BuildState* b);
+
+/** @brief free's the contents of a `BuildState` */
+__BK_API void free_build_state(BuildState* b);
+
+/**
+ * @brief Turns the lists inside the loaded config (`BkConfig::include_files`, `BkConfig::schema_files` and `BkConfig::include_dir`)
+ *        into entries, dynamic schemas and include directories.
+ *
+ * @param schema_owner The context that loads the dynamic schema files, usually `bk` itself. Otherwise `bk` only borrows
+ *                     the schemas (see @link borrow_dynamic_schema `borrow_dynamic_schema`@endlink).
+ * @return Returns `false` if one of the lists is malformed, or one of its files couldn't be loaded.
+*/
+__BK_API bool load_config_lists(BkContext* bk, BkContext* schema_owner);
+
+/**
+ * @brief Pushes the dynamic schema loaded from `file_name` by `owner` to `BkContext::dynamic_schemas` of `bk`,
+ *        `owner` loads the schema first if it didn't do that yet.
+ *
+ * The borrowed schemas still belong to `owner`, `bk` has to clear its `BkContext::dynamic_schemas` before it is free'd.
+*/
+__BK_API bool borrow_dynamic_schema(BkContext* bk, BkContext* owner, const char* file_name);
+
+/**
+ * @defgroup manifest Batch Manifests
+ * @brief Runs many configurations in a single process, see @link run_manifest `run_manifest`@endlink.
+ *
+ * A manifest lists one config file per line, empty lines and lines starting with '#' are skipped:
+ * @code
+ * # jobs.txt
+ * services/.bk.conf
+ * tools/json.bk.conf
+ * @endcode
+ * Every job gets its own context that starts out with the default configuration and the static schemas of the context
+ * that runs the manifest (including plugins), then loads its config file. Paths inside config files are relative to the
+ * working directory, just like they are for a single run.
+ *
+ * @addtogroup manifest
+ * @{
+*/
+
+/**
+ * @brief Runs the one-shot build of every config listed in `file_name` at the same time.
+ *
+ * Dynamic schema files are only loaded once and borrowed by every job that lists them. Jobs that analyze the same file with the
+ * same analysis fingerprint share the result, so overlapping inputs are only analyzed once. Watch and daemon mode are ignored.
+ * At most one job per online processor runs at a time, each job still uses `BkConfig::jobs` threads for its own entries.
+ *
+ * @param bk The context whose schemas, plugins and output settings (`silent`/`verbose`) are passed to every job,
+ *           it also owns the shared dynamic schemas.
+ * @return Returns `false` if the manifest couldn't be read or one of the jobs failed.
+*/
+__BK_API bool run_manifest(BkContext* bk, const char* file_name);
+/** @} */
+
+/**
+ * @defgroup stats Run Statistics
+ * @brief Phase timings, counters and trace spans of a run, see `--stats` and `--trace`.
+ *
+ * Phases are timed on the thread that runs them, so with multiple threads their times add up to more than the wall time.
+ * Spans are recorded as Chrome trace events ("X" events with timestamps in microseconds since the start of the run),
+ * traces can be opened in `chrome://tracing` or Perfetto.
+ *
+ * @addtogroup stats
+ * @{
+*/
+
+/** @brief Phases of a run, schema phases are part of `PHASE_GENERATE`. */
+typedef enum {
+    PHASE_DISCOVERY,
+    PHASE_READ,
+    PHASE_ANALYZE,
+    PHASE_GENERATE,
+    PHASE_STATIC_SCHEMA,
+    PHASE_DYNAMIC_SCHEMA,
+    PHASE_WRITE,
+    PHASE_COUNT,
+} BkPhase;
+
+/** @brief A span of the trace, strings are ids inside of `BkStats::names`. */
+typedef struct {
+    unsigned name;
+    BkPhase phase;
+    /** @brief The type a schema span generated code for, 0 for other spans. */
+    unsigned type;
+    unsigned tid;
+    unsigned long long start;
+    unsigned long long duration;
+} TraceEvent;
+
+/** @brief Dynamic array of `TraceEvent` */
+typedef struct {
+    TraceEvent* items;
+    size_t len;
+    size_t cap;
+} TraceEvents;
+
+/** @brief Generation time of a single schema, summed over all types. */
+typedef struct {
+    unsigned name;
+    unsigned long long time;
+    size_t calls;
+} SchemaStat;
+
+/** @brief Dynamic array of `SchemaStat` */
+typedef struct {
+    SchemaStat* items;
+    size_t len;
+    size_t cap;
+} SchemaStats;
+
+/** @brief Statistics of a run, every member is guarded by `BkStats::lock`. Times are in nanoseconds. */
+struct BkStats {
+    pthread_mutex_t lock;
+    /** @brief Time the statistics were initialized at, see @link now_ns `now_ns`@endlink. */
+    unsigned long long start;
+    unsigned long long phase_time[PHASE_COUNT];
+    size_t phase_calls[PHASE_COUNT];
+    size_t files_read;
+    size_t bytes_read;
+    size_t files_written;
+    size_t bytes_written;
+    size_t types;
+    size_t fields;
+    SchemaStats schemas;
+    /** @brief Set if spans are recorded into `BkStats::events`. */
+    bool trace;
+    TraceEvents events;
+    /** @brief Names of files, schemas and types, id 0 is the empty string. */
+    Interner names;
+};
+
+/** @brief Monotonic time in nanoseconds. */
+__BK_API unsigned long long now_ns(void);
+
+/** @brief Initializes `stats` and starts its wall clock, free it with `free_stats`. */
+__BK_API void init_stats(BkStats* stats, bool trace);
+
+/** @brief Returns the start time of a span, 0 if `bk` doesn't collect statistics. */
+__BK_API unsigned long long stats_begin(BkContext* bk);
+
+/**
+ * @brief Ends the span that started at `start` and adds it to `phase`.
+ *
+ * @param name Name of the span inside the trace, usually a file name. The phase name is used if it's NULL.
+ * @param bytes Number of bytes that were read or written, only used by `PHASE_READ` and `PHASE_WRITE`.
+*/
+__BK_API void stats_end(BkContext* bk, BkPhase phase, unsigned long long start, const char* name, size_t bytes);
+
+/** @brief Ends the span of a schema that started at `start`, while it generated code for the type named `type_name`. */
+__BK_API void stats_schema(BkContext* bk, BkPhase phase, String_View schema, unsigned long long start, const char* type_name);
+
+/** @brief Adds the number of analyzed types and fields. */
+__BK_API void stats_count_types(BkContext* bk, size_t types, size_t fields);
+
+/** @brief Prints a summary of `stats` and the allocation counters to `f`. */
+__BK_API void print_stats(BkStats* stats, FILE* f);
+
+/**
+ * @brief Prints the same values as @link print_stats `print_stats`@endlink to `f` as CSV with the columns `kind,name,value,count`.
+ *
+ * Phase and schema times are in milliseconds, their `count` is the number of calls. See `docs/usage.md` for every row.
+*/
+__BK_API void print_stats_csv(BkStats* stats, FILE* f);
+
+/** @brief Writes the spans of `stats` to `file_name` in Chrome trace event format. */
+__BK_API bool write_trace(BkContext* bk, BkStats* stats, const char* file_name);
+
+/** @brief free's the contents of `BkStats` */
+__BK_API void free_stats(BkStats* stats);
+/** @} */
+
+/**
+ * @ingroup commandline
+ * @brief Defines a command that can be executed from the commandline.
+*/
+typedef struct {
+    /** @brief The name of this command displayed in help menus. (like 'help') */
+    char* name;
+
+    /** @brief The flag used to invoke this command. (like '-h') */
+    char* flag;
+
+    /** @brief The usage text for this command. (like '-h <command (optional)>') */
+    char* usage;
+
+    /** @brief The explanatory description of this command that is displayed in help menus. */
+    char* desc;
+
+    /**
+     * @brief The implementation of this command.
+     *
+     * @param bk The context that is configured by this command.
+     * @param i Pointer to the index counter that is used to iterate over command line arguments.
+     *          `Command`s are expected to increment this counter only if the comamnd accepts argument(s).
+     *          So, a flag like '--silent' _shouldn't_ increment this counter at all.
+     * @param argc The amount of command line arguments, equal to the `argc` from `main`.
+     * @param argv Array of command line arguments, equal to the `argv` from `main`.
+    */
+    bool (*exec_c)(BkContext* bk, int* i, int argc, char** argv);
+} Command;
+
+// If only we had closures in C...
+/** @addtogroup commandline
+ * The *_cmd functions are assigned to the `Command::exec_c` field of their respecive `Command`s.
+ *  @{
+*/
+bool help_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool config_path_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool output_mode_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool gen_ext_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool compile_schema_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool load_plugin_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool generics_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool watch_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool watch_delay_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool watch_debounce_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool jobs_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool include_file_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool include_directory_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool max_file_size_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool output_directory_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool schemas_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool include_schema_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool silent_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool verbose_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool enable_warn_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool disable_warn_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool derive_all_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool derive_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool no_cache_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool depfiles_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool depfile_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool daemon_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool client_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool manifest_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool stats_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool stats_csv_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool trace_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool disable_dump_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool disable_parse_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool disabled_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool gen_impl_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool gen_fmt_dst_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool gen_fmt_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool offset_type_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool disable_prefix_cmd(BkContext* bk, int* i, int argc, char** argv);
+bool enable_prefix_cmd(BkContext* bk, int* i, int argc, char** argv);
+/** @} */
+
+/**
+ * @brief Helper macro that does all necessary checks before executing a command. It also prints a usage message if the comamnd fails.
+ *
+ * @return Returns `true` if the command succeeded, `false` otherwise.
+*/
+#define exec_cmd(cmd)\
+((cmd)->exec_c ? ((cmd)->exec_c(bk, &i, argc, argv) ? true : (bk_printf("Usage of '%s': %s\n", (cmd)->name, (cmd)->usage), false)) : false)
+
+#define WARN_NO_INCLUDE "no-include"
+#define WARN_NO_OUTPUT "no-output"
+#define WARN_UNKNOWN_ATTR "unknown-attr"
+#define WARN_LIST WARN_NO_INCLUDE"|"WARN_NO_OUTPUT"|"WARN_UNKNOWN_ATTR
+
+/**
+ * @var commands
+ * Global static array that includes all commands.
+*/
+static Command commands[] = {
+    {
+        .name = "help",
+        .flag = "-h",
+        .usage = "-h <command (optional)>",
+        .desc = "Prints a list of all commands or information about the provided command",
+        .exec_c = help_cmd
+    },
+    {
+        .name = "config-path",
+        .flag = "--config-path",
+        .usage = "--config-path <file>",
         .desc = "Changes the path that will be used to load the configuration file (default value is './bk.conf')",
         .exec_c = config_path_cmd
     },
@@ -1188,6 +2537,20 @@ static Command commands[] = {
         .desc = "Generates the extension header from `bk-source` (bk.c) that contains the definitions that should be included inside static schema extensions.",
         .exec_c = gen_ext_cmd
     },
+    {
+        .name = "compile-schema",
+        .flag = "--compile-schema",
+        .usage = "--compile-schema <schema-file> <out-file>",
+        .desc = "Translates a dynamic schema into the C source of a static schema extension that can be added with `BK_ADD_SCHEMAS`. The output includes the extension header as \"bk_ext.h\".",
+        .exec_c = compile_schema_cmd
+    },
+    {
+        .name = "load-plugin",
+        .flag = "--load-plugin",
+        .usage = "--load-plugin <shared-object>",
+        .desc = "Loads the static schemas of a plugin built against the extension header (see `gen-ext`). Has to come before any `derive` command that names one of its schemas.",
+        .exec_c = load_plugin_cmd
+    },
     {
         .name = "generics",
         .flag = "--generics",
@@ -1199,7 +2562,7 @@ static Command commands[] = {
         .name = "watch",
         .flag = "-w",
         .usage = "-w",
-        .desc = "Enables watch mode that constantly analyzes recently modified files with a `watch-delay` second delay. (Exit with `CTRL-C`)",
+        .desc = "Enables watch mode that waits for file events (inotify) and regenerates code for modified files and schemas. On platforms without inotify, files are checked every `watch-delay` seconds instead. (Exit with `CTRL-C`)",
         .exec_c = watch_cmd
     },
     {
@@ -1209,6 +2572,20 @@ static Command commands[] = {
         .desc = "Sets `watch-delay` option, for more information see `watch`.",
         .exec_c = watch_delay_cmd
     },
+    {
+        .name = "watch-debounce",
+        .flag = "--watch-debounce",
+        .usage = "--watch-debounce <milliseconds>",
+        .desc = "Sets how long watch mode waits for further file events before regenerating code, so bursts of events are coalesced (50 by default)",
+        .exec_c = watch_debounce_cmd
+    },
+    {
+        .name = "jobs",
+        .flag = "-j",
+        .usage = "-j <threads>",
+        .desc = "Sets the number of threads that read, analyze and generate code for input files, 0 uses all processors (1 by default)",
+        .exec_c = jobs_cmd
+    },
     {
         .name = "include-file",
         .flag = "-i",
@@ -1220,9 +2597,16 @@ static Command commands[] = {
         .name = "include-directory",
         .flag = "-I",
         .usage = "-I <dir>",
-        .desc = "The provided directory will be searched for '.c' or '.h' files to analyze",
+        .desc = "The provided directory (and its subdirectories) will be searched for '.c' or '.h' files to analyze, can be used multiple times",
         .exec_c = include_directory_cmd
     },
+    {
+        .name = "max-file-size",
+        .flag = "--max-file-size",
+        .usage = "--max-file-size <bytes>",
+        .desc = "Files inside include directories that are larger than the provided size are skipped, 0 disables the limit (0 by default)",
+        .exec_c = max_file_size_cmd
+    },
     // {
     //     .name = "output-file",
     //     .flag = "-of",
@@ -1293,6 +2677,69 @@ static Command commands[] = {
         .desc = "Derives the provided schema for all analyzed structs",
         .exec_c = derive_cmd
     },
+    {
+        .name = "no-cache",
+        .flag = "--no-cache",
+        .usage = "--no-cache",
+        .desc = "Disables the persistent analysis cache (`output-directory/.bk.cache`), all input files are analyzed and regenerated",
+        .exec_c = no_cache_cmd
+    },
+    {
+        .name = "depfiles",
+        .flag = "-MD",
+        .usage = "-MD",
+        .desc = "Writes a Make/Ninja depfile (`<generated-file>.d`) next to every generated file",
+        .exec_c = depfiles_cmd
+    },
+    {
+        .name = "depfile",
+        .flag = "-MF",
+        .usage = "-MF <file>",
+        .desc = "Writes a single Make/Ninja depfile that contains a rule for every generated file",
+        .exec_c = depfile_cmd
+    },
+    {
+        .name = "daemon",
+        .flag = "--daemon",
+        .usage = "--daemon <socket>",
+        .desc = "Keeps `bk` running and regenerates code whenever a client sends a request to the Unix domain socket `socket`",
+        .exec_c = daemon_cmd
+    },
+    {
+        .name = "client",
+        .flag = "--client",
+        .usage = "--client <socket>",
+        .desc = "Asks the daemon listening on `socket` to regenerate the files included with `-i` (or all files it knows about if there are none) and exits",
+        .exec_c = client_cmd
+    },
+    {
+        .name = "manifest",
+        .flag = "--manifest",
+        .usage = "--manifest <file>",
+        .desc = "Runs every config file listed in `file` (one per line) at the same time in this process. Dynamic schemas and analysis results are shared between the configs, watch and daemon mode are ignored",
+        .exec_c = manifest_cmd
+    },
+    {
+        .name = "stats",
+        .flag = "--stats",
+        .usage = "--stats",
+        .desc = "Prints the time spent in each phase, the number of bytes read and written, analyzed types and fields, allocations and the peak heap size after the run",
+        .exec_c = stats_cmd
+    },
+    {
+        .name = "stats-csv",
+        .flag = "--stats-csv",
+        .usage = "--stats-csv",
+        .desc = "Same as `--stats` but prints the statistics as CSV (`kind,name,value,count`) for scripts",
+        .exec_c = stats_csv_cmd
+    },
+    {
+        .name = "trace",
+        .flag = "--trace",
+        .usage = "--trace <file>",
+        .desc = "Writes a span for every read, analyzed, generated and written file and every schema that generated code into `file` in Chrome trace event format",
+        .exec_c = trace_cmd
+    },
     {
         .name = "disable-dump",
         .flag = "--disable-dump",
@@ -1350,1495 +2797,4111 @@ static Command commands[] = {
         .exec_c = disable_prefix_cmd
     },
     {
-        .name = "enable-prefix",
-        .flag = "--enable-prefix",
-        .usage = "--enable-prefix <name>",
-        .desc = "Sets the prefix of the generated macros that enable specific stuff, like `$prefix$$type$_$schema$` (`BK_ENABLE_`)",
-        .exec_c = enable_prefix_cmd
-    },
-};
-static const size_t commands_count = sizeof commands / sizeof *commands;
+        .name = "enable-prefix",
+        .flag = "--enable-prefix",
+        .usage = "--enable-prefix <name>",
+        .desc = "Sets the prefix of the generated macros that enable specific stuff, like `$prefix$$type$_$schema$` (`BK_ENABLE_`)",
+        .exec_c = enable_prefix_cmd
+    },
+};
+static const size_t commands_count = sizeof commands / sizeof *commands;
+
+#define bk_printf(...) (bk->conf.silent ? 0 : printf(__VA_ARGS__))
+
+#define BK_FILE_EXT ".bk.h"
+#define BK_FILE_EXT_LEN 5
+
+/** @brief Macro that goto's to the cleanup label before returning inside `main` */
+#define ret_clean(i)\
+do {\
+    ret_val = i;\
+    goto __bk_cleanup;\
+} while(0)
+
+#ifdef BK_RENAME_MAIN
+#define __BK_DEFINE_FN(name) int name(int argc, char** argv)
+__BK_DEFINE_FN(BK_RENAME_MAIN) {
+#undef __BK_DEFINE_FN
+#else
+int main(int argc, char** argv) {
+#endif // BK_RENAME_MAIN
+
+    // Declaring resources that will be cleaned up here before declaring
+    // `ret_val` to avoid situations where we try to cleanup these resources
+    // before they were *declared* by goto'ing to `__bk_cleanup` inside `ret_clean`
+    BkContext context = {0};
+    BkContext* bk = &context;
+    BuildState build = {.type_db = {.changed = true}};
+    BkStats stats = {0};
+    #ifdef BK_WATCH_INOTIFY
+    Watcher watcher = {.fd = -1, .output_wd = -1};
+    #endif // BK_WATCH_INOTIFY
+    #ifdef BK_DAEMON
+    Daemon daemon = {.fd = -1, .client = -1};
+    #endif // BK_DAEMON
+    
+    int ret_val = 0;
+
+    // Allocations are counted from the very start, so every counted `free` belongs to a counted allocation
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--stats") == 0 || strcmp(argv[i], "--stats-csv") == 0) track_allocations(true);
+    }
+
+    init_context(bk);
+
+    #ifdef DEBUG
+    bk->conf.silent = true;
+    #endif // DEBUG
+
+    int config_cmd_index = -1;
+    for (size_t i = 0; i < commands_count; ++i) {
+        if (strcmp(commands[i].name, "config-path") == 0) {
+            config_cmd_index = (int)i;
+        }
+    }
+    if (config_cmd_index < 0) abort();
+
+    bool custom_config = false;
+    // NOTE: Assumes that `argv` lives long enough
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(commands[config_cmd_index].flag, argv[i]) == 0) {
+            if (!exec_cmd(&commands[config_cmd_index])) return 1;
+            custom_config = true;
+            break;
+        }
+    }
+
+    bool found_config = false;
+    {
+        FILE* conf_file = fopen(bk->config_path, "rb");
+        if (conf_file) {
+            fclose(conf_file);
+            String conf_contents = {0};
+            if (read_entire_file(bk, bk->config_path, &conf_contents)) {
+                found_config = true;
+                bk->config_file = bk->config_path;
+                parse_bkconf_BkConfig(conf_contents.items, conf_contents.len, &bk->conf);
+            }
+        } else if (custom_config) {
+            bk_log(LOG_ERROR, "Couldn't open file '%s': %s\n", bk->config_path, strerror(errno));
+            ret_clean(1);
+        }
+    }
+
+    if (argc <= 1 && !found_config) {
+        bk_printf("Basic usage: %s -I <include-directory> -o <output-directory>\n", argv[0]);
+        bk_printf("Use `-h` to print all available commands, `-h <command-name>` to see that command's usage.\n");
+        ret_clean(0);
+    }
+
+    // NOTE: Assumes that `argv` lives long enough
+    for (int i = 1; i < argc; ++i) {
+        for (size_t j = 0; j < commands_count; ++j) {
+            if (strcmp(commands[j].flag, argv[i]) == 0) {
+                if (!exec_cmd(&commands[j])) {
+                    ret_clean(1);
+                }
+            }
+        }
+    }
+
+    if (bk->show_stats || bk->trace_path != NULL) {
+        init_stats(&stats, bk->trace_path != NULL);
+        bk->stats = &stats;
+    }
+
+    // The client only forwards the files that were included with `-i` to the daemon
+    if (bk->client_socket != NULL) {
+        #ifdef BK_DAEMON
+        ret_clean(daemon_request(bk, bk->client_socket) ? 0 : 1);
+        #else
+        bk_log(LOG_ERROR, "Daemon mode isn't supported on this platform.\n");
+        ret_clean(1);
+        #endif // BK_DAEMON
+    }
+   
+    if (bk->manifest_path != NULL) ret_clean(run_manifest(bk, bk->manifest_path) ? 0 : 1);
+
+    if (!load_config_lists(bk, bk)) ret_clean(1);
+    if (!parse_output_mode(bk, &build.output_mode)) ret_clean(1);
+
+    init_analysis_symbols(bk);
+    write_derives_header(bk, &build.book_buf);
+
+    build.threads = bk->conf.jobs > 0 ? (size_t)bk->conf.jobs : (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+    if (build.threads < 1) build.threads = 1;
+    if (!discover_sources(bk, build.threads)) ret_clean(1);
+
+    // The daemon can be started without entries, clients may request new ones
+    if ((bk->entries.len <= 0 && bk->daemon_socket == NULL) || (build.output_mode == O_DIR && bk->conf.output_dir == NULL)) ret_clean(0);
+
+    build.book_buf.len = 0;
+    time_t t = 0;
+    bool use_watcher = false;
+    #ifdef BK_WATCH_INOTIFY
+    if (bk->conf.watch_mode && bk->daemon_socket == NULL) {
+        use_watcher = watcher_init(bk, &watcher);
+        if (!use_watcher) bk_log(LOG_WARN, "Couldn't initialize inotify, falling back to polling every %ld second(s).\n", bk->conf.watch_delay);
+    }
+    #endif // BK_WATCH_INOTIFY
+    bool use_daemon = false;
+    if (bk->daemon_socket != NULL) {
+        #ifdef BK_DAEMON
+        if (!daemon_init(bk, &daemon, bk->daemon_socket)) ret_clean(1);
+        use_daemon = true;
+        #else
+        bk_log(LOG_ERROR, "Daemon mode isn't supported on this platform.\n");
+        ret_clean(1);
+        #endif // BK_DAEMON
+    }
+    // The daemon keeps the cache in memory even if there is no output directory to store it in
+    build.use_cache = bk->conf.cache && (bk->conf.output_dir != NULL || use_daemon);
+    if (build.use_cache && bk->conf.output_dir != NULL) {
+        build.cache.fingerprint = config_fingerprint(bk);
+        load_cache(bk, &build.cache, tfmt("%s/"BK_CACHE_FILE, bk->conf.output_dir));
+        build.cache.dirty = false;
+    }
+    // The watcher and the daemon keep track of modified files themselves, no need to `stat` every single entry
+    build.tracked = use_watcher || use_daemon;
+    bool first_iter = true;
+    do {
+        if (!first_iter) {
+            if (use_daemon) {
+                #ifdef BK_DAEMON
+                if (!daemon_wait(bk, &daemon)) ret_clean(daemon_stopped() ? 0 : 1);
+                #endif // BK_DAEMON
+            } else if (use_watcher) {
+                #ifdef BK_WATCH_INOTIFY
+                bool schemas_changed = false;
+                if (!watcher_wait(bk, &watcher, &schemas_changed)) ret_clean(1);
+                if (schemas_changed) {
+                    init_analysis_symbols(bk);
+                    build.type_db.changed = true;
+                    write_derives_header(bk, &build.book_buf);
+                    if (build.use_cache) reset_cache(&build.cache, config_fingerprint(bk));
+                }
+                #endif // BK_WATCH_INOTIFY
+            } else {
+                t = time(NULL);
+                if (t - build.current_iter < (time_t)bk->conf.watch_delay) {
+                    struct timespec delay = {.tv_sec = (time_t)bk->conf.watch_delay - (t - build.current_iter)};
+                    nanosleep(&delay, NULL);
+                    continue;
+                }
+            }
+        }
+        first_iter = false;
+        bool iter_ok = run_build(bk, &build);
+        #ifdef BK_DAEMON
+        daemon_reply(&daemon, iter_ok);
+        #endif // BK_DAEMON
+        if (!iter_ok && !bk->conf.watch_mode && !use_daemon) ret_val = 1;
+    } while(bk->conf.watch_mode || use_daemon);
+
+    __bk_cleanup:
+    #ifdef BK_DAEMON
+    free_daemon(&daemon);
+    #endif // BK_DAEMON
+    #ifdef BK_WATCH_INOTIFY
+    free_watcher(&watcher);
+    #endif // BK_WATCH_INOTIFY
+    if (bk->stats != NULL) {
+        // Writing the trace isn't part of it
+        bk->stats = NULL;
+        if (bk->trace_path != NULL && !write_trace(bk, &stats, bk->trace_path)) ret_val = 1;
+        if (bk->show_stats && bk->stats_csv) print_stats_csv(&stats, stderr);
+        else if (bk->show_stats) print_stats(&stats, stderr);
+        free_stats(&stats);
+    }
+    free_build_state(&build);
+    free_context(bk);
+
+    return ret_val;
+}
+
+__BK_API bool load_config_lists(BkContext* bk, BkContext* schema_owner) {
+    const char* conf_name = bk->config_file != NULL ? bk->config_file : bk->config_path;
+    if (bk->conf.include_files != NULL) {
+        size_t list_len = strlen(bk->conf.include_files);
+        if (list_len == 0) {
+            bk_log(LOG_ERROR, "Include file list in '%s' is empty.\n", conf_name);
+            return false;
+        }
+        if (bk->conf.include_files[0] == ',') {
+            bk_log(LOG_ERROR, "Include file list in '%s' starts with comma (',')\n", conf_name);
+            return false;
+        }
+        char* cursor = bk->conf.include_files;
+        size_t entry_len = 0;
+
+        for (char* ent; (ent = parse_list(&cursor, ',', &entry_len));) {
+            Entry e = {0};
+            if (!entry_from_file(bk, tfmt("%.*s", (int)entry_len, ent), &e)) {
+                return false;
+            }
+            push_da(&bk->entries, e);
+        }
+    }
+
+    if (bk->conf.schema_files != NULL) {
+        size_t list_len = strlen(bk->conf.schema_files);
+        if (list_len == 0) {
+            bk_log(LOG_ERROR, "Schema file list in '%s' is empty.\n", conf_name);
+            return false;
+        }
+        if (bk->conf.schema_files[0] == ',') {
+            bk_log(LOG_ERROR, "Schema file list in '%s' starts with comma (',')\n", conf_name);
+            return false;
+        }
+        char* cursor = bk->conf.schema_files;
+        size_t entry_len = 0;
+
+        for (char* ent; (ent = parse_list(&cursor, ',', &entry_len));) {
+            const char* file_name = tfmt("%.*s", (int)entry_len, ent);
+            bool loaded = schema_owner == bk ? load_dynamic_schema(bk, file_name) : borrow_dynamic_schema(bk, schema_owner, file_name);
+            if (!loaded) {
+                return false;
+            }
+        }
+    }
+
+    // Include directories supplied on the command line replace the ones inside the config file
+    if (bk->include_dirs.len == 0 && bk->conf.include_dir != NULL) {
+        if (bk->conf.include_dir[0] == ',') {
+            bk_log(LOG_ERROR, "Include directory list in '%s' starts with comma (',')\n", conf_name);
+            return false;
+        }
+        char* cursor = bk->conf.include_dir;
+        size_t entry_len = 0;
+
+        for (char* ent; (ent = parse_list(&cursor, ',', &entry_len));) {
+            push_da(&bk->include_dirs, fmt("%.*s", (int)entry_len, ent)); // alloc
+        }
+    }
+
+    if (bk->include_dirs.len == 0 && bk->entries.len == 0) {
+        if (bk->conf.warn_no_include) bk_log(LOG_WARN, "No files were included. [-W "WARN_NO_INCLUDE"]\n");
+    }
+    if (bk->conf.output_dir == NULL) {
+        if (bk->conf.warn_no_output) bk_log(LOG_WARN, "No output path set. [-W "WARN_NO_OUTPUT"]\n");
+    }
+    
+    for (size_t i = 0; i < bk->include_dirs.len; ++i) {
+        size_t in_len = strlen(bk->include_dirs.items[i]);
+        if (in_len > 1 && bk->include_dirs.items[i][in_len - 1] == '/') bk->include_dirs.items[i][in_len - 1] = 0;
+    }
+    if (bk->conf.output_dir != NULL) {
+        size_t out_len = strlen(bk->conf.output_dir);
+        if (bk->conf.output_dir[out_len - 1] == '/') bk->conf.output_dir[out_len - 1] = 0;
+    }
+
+    return true;
+}
+
+__BK_API bool parse_output_mode(BkContext* bk, OutputMode* out) {
+    if (strcmp(bk->conf.output_mode, "mirror") == 0) {
+        *out = O_MIRROR;
+    } else if (strcmp(bk->conf.output_mode, "dir") == 0) {
+        *out = O_DIR;
+    } else {
+        bk_printf("Unknown output mode '%s', exiting...\n", bk->conf.output_mode);
+        return false;
+    }
+    return true;
+}
+
+/// Files with the same path relative to different include directories would generate the same file in `O_DIR` mode
+static bool check_output_collisions(BkContext* bk, OutputMode output_mode) {
+    if (output_mode != O_DIR) return true;
+    Interner names = {0};
+    // Maps the id of an interned name to the entry that claimed it first
+    size_t* owners = malloc(sizeof *owners * (bk->entries.len + 1)); // alloc
+    String path = {0}; // alloc
+    bool ok = true;
+    for (size_t e_i = 0; e_i < bk->entries.len; ++e_i) {
+        Entry* e = bk->entries.items + e_i;
+        unsigned id;
+        if (find_interned(&names, e->name, strlen(e->name), &id)) {
+            bk_log(
+                LOG_ERROR, "Files '%s' and '%s' would both generate '%s', rename one of them or use `-om mirror`\n",
+                bk->entries.items[owners[id]].full, e->full, output_file_path(bk, e, output_mode, &path)
+            );
+            ok = false;
+            continue;
+        }
+        owners[intern(&names, e->name, strlen(e->name))] = e_i;
+    }
+    free(owners);
+    if (path.items != NULL) free(path.items);
+    free_interner(&names);
+    return ok;
+}
+
+__BK_API bool run_build(BkContext* bk, BuildState* b) {
+    b->current_iter = time(NULL);
+    // Nothing is generated, otherwise one of the files silently overwrites the other (or both race on it with `-j`)
+    if (!check_output_collisions(bk, b->output_mode)) return false;
+    bool iter_ok = true;
+    size_t jobs_count = 0;
+    for (size_t e_i = 0; e_i < bk->entries.len; ++e_i) {
+        Entry* in_file = bk->entries.items + e_i;
+        if (!b->tracked) {
+            struct stat s = {0};
+            stat(in_file->full, &s);
+            #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
+            in_file->sys_modif = s.st_mtimespec.tv_sec;
+            #else
+            in_file->sys_modif = s.st_mtim.tv_sec;
+            #endif
+        }
+        if (in_file->last_analyzed == 0 || in_file->sys_modif > in_file->last_analyzed) {
+            if (jobs_count == b->jobs.len) push_da(&b->jobs, (EntryJob){0});
+            b->jobs.items[jobs_count++].entry_index = e_i;
+        }
+    }
+    // Reading, analyzing and generating code is independent, the results are merged in order of the entries below
+    run_analysis_jobs(bk, &b->jobs, jobs_count, b->threads, b->use_cache ? &b->cache : NULL, b->shared);
+    for (size_t j_i = 0; j_i < jobs_count; ++j_i) {
+        EntryJob* job = b->jobs.items + j_i;
+        size_t e_i = job->entry_index;
+        Entry* in_file = bk->entries.items + e_i;
+        job->write = false;
+        if (!job->read_ok) {
+            // The file is gone (or unreadable), so are its types
+            reset_ccompounds(&b->types);
+            type_db_patch(&b->type_db, e_i, &b->types);
+            in_file->has_output = false;
+            iter_ok = false;
+            continue;
+        }
+
+        // Entries that already generated a file keep their index, others claim the next one
+        size_t out_idx = in_file->has_output ? in_file->file_idx : b->file_idx;
+        CacheEntry* cached = b->use_cache ? find_cache_entry(&b->cache, in_file->full) : NULL;
+        if (cached != NULL && cached->hash == job->hash) {
+            // The guard index has to match too, otherwise the cached output differs from what we would generate now
+            bool output_valid = cached->file_idx < 0;
+            if (cached->file_idx == (long)out_idx) {
+                struct stat s = {0};
+                output_valid = stat(output_file_path(bk, in_file, b->output_mode, &b->path_buf), &s) == 0;
+            }
+            if (output_valid) {
+                bk_log(LOG_INFO, "Using cached analysis for file: %s\n", in_file->name);
+                cached->seen = true;
+                reset_ccompounds(&b->types);
+                for (size_t i = 0; i < cached->types.len; ++i) copy_ccompound(&b->types, cached->types.items + i);
+                type_db_patch(&b->type_db, e_i, &b->types);
+                in_file->has_output = cached->file_idx >= 0;
+                if (in_file->has_output) {
+                    in_file->file_idx = out_idx;
+                    if (out_idx == b->file_idx) b->file_idx += 1;
+                    if (bk->conf.depfiles) write_depfile(bk, output_file_path(bk, in_file, b->output_mode, &b->path_buf), in_file, 1, &b->book_buf);
+                }
+                b->current_iter = time(NULL);
+                in_file->last_analyzed = b->current_iter;
+                continue;
+            }
+        }
+
+        if (!job->analyzed) {
+            // The cached result couldn't be used after all
+            // The job doesn't keep its input around, so it has to be read again
+            bk_log(LOG_INFO, "Analyzing file: %s\n", in_file->name);
+            if (!map_entire_file(bk, in_file->full, &job->input)) {
+                iter_ok = false;
+                continue;
+            }
+            analyze_file(bk, in_file->name, job->input.contents, &job->types, bk->conf.derive_all);
+            unmap_file(&job->input);
+            job->body.len = 0;
+            unsigned long long start = stats_begin(bk);
+            job->generated = gen_entry(bk, &job->body, &job->types);
+            stats_end(bk, PHASE_GENERATE, start, in_file->name, 0);
+        }
+        bk_log(LOG_INFO, "Analayzed %lu type(s).\n", job->types.len);
+        type_db_patch(&b->type_db, e_i, &job->types);
+        b->current_iter = time(NULL);
+        in_file->last_analyzed = b->current_iter;
+        in_file->has_output = false;
+        job->write = true;
+        if (job->generated) {
+            // The index is claimed even if writing the file fails just to be safe
+            job->out_idx = out_idx;
+            in_file->has_output = true;
+            in_file->file_idx = out_idx;
+            if (out_idx == b->file_idx) b->file_idx += 1;
+        }
+    }
+    // Guard indices are known now, generated files can be written independently as well
+    run_output_jobs(bk, &b->jobs, jobs_count, b->threads, b->output_mode);
+    for (size_t j_i = 0; j_i < jobs_count; ++j_i) {
+        EntryJob* job = b->jobs.items + j_i;
+        if (!job->write) continue;
+        if (!job->write_ok) {
+            iter_ok = false;
+            continue;
+        }
+        // Only the files that were generated successfully are cached
+        if (b->use_cache) {
+            CacheEntry* ce = update_cache_entry(&b->cache, bk->entries.items[job->entry_index].full, job->hash, b->type_db.items + job->entry_index);
+            ce->file_idx = job->generated ? (long)job->out_idx : -1;
+        }
+    }
+    if (b->use_cache && b->cache.dirty && bk->conf.output_dir != NULL) save_cache(bk, &b->cache, tfmt("%s/"BK_CACHE_FILE, bk->conf.output_dir));
+    if (bk->conf.generics && b->type_db.changed) {
+        b->type_db.changed = false;
+        b->book_buf.len = 0;
+        // print_string(&b->book_buf, "#ifndef __GENERICS_H__\n");
+        // print_lit(&b->book_buf, "#define __GENERICS_H__\n");
+        for (size_t e_i = 0; e_i < b->type_db.len; ++e_i) for (size_t i = 0; i < b->type_db.items[e_i].len; ++i) {
+            const char* t_name = b->type_db.items[e_i].items[i].name;
+            print_string(&b->book_buf, "#ifdef ___BK_IF_TYPE_%s\n", t_name);
+            print_string(&b->book_buf, "#undef ___BK_IF_TYPE_%s\n", t_name);
+            print_string(&b->book_buf, "#endif // ___BK_IF_TYPE_%s\n", t_name);
+            print_string(&b->book_buf, "#ifdef ___BK_INCLUDE_TYPE_%s\n", t_name);
+            print_string(&b->book_buf, "#define ___BK_IF_TYPE_%s(x) x,\n", t_name);
+            print_string(&b->book_buf, "#else // ___BK_INCLUDE_TYPE_%s\n", t_name);
+            print_string(&b->book_buf, "#define ___BK_IF_TYPE_%s(x)\n", t_name);
+            print_string(&b->book_buf, "#endif // ___BK_INCLUDE_TYPE_%s\n", t_name);
+        }
+        for (size_t i = 0; i < bk->schemas.len; ++i) {
+            const char* s_name = bk->schemas.items[i].name;
+
+            // dump guard start
+            if (bk->conf.disabled_by_default) {
+                print_string(&b->book_buf, "#if defined(%s"BK_DUMP_UPPER") || defined(%s%s) || defined(%s%s_"BK_DUMP_UPPER")\n",
+                             bk->conf.enable_macro_prefix,
+                             bk->conf.enable_macro_prefix,
+                             s_name,
+                             bk->conf.enable_macro_prefix,
+                             s_name
+                );
+            } else {
+                print_string(&b->book_buf, "#ifndef %s"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix);
+                print_string(&b->book_buf, "#ifndef %s%s\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#ifndef %s%s_"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix, s_name);
+            }
+
+            // dump code
+            print_string(&b->book_buf, "#ifdef ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#undef ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#endif // ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#define ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\\\n", s_name);
+            for (size_t e_i = 0; e_i < b->type_db.len; ++e_i) for (size_t j = 0; j < b->type_db.items[e_i].len; ++j) {
+                const char* t_name = b->type_db.items[e_i].items[j].name;
+                print_string(&b->book_buf, "    ___BK_IF_TYPE_%s(%s*: "BK_DUMP_LOWER"_%s_%s)\\\n", t_name, t_name, s_name, t_name);
+            }
+            print_string(&b->book_buf, "\n#ifdef "BK_DUMP_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#undef "BK_DUMP_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#endif // "BK_DUMP_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#define "BK_DUMP_LOWER"_%s(item, dst)\\\n", s_name);
+            print_string(&b->book_buf, "_Generic((item), ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES default: NULL)((item), (dst))\n", s_name);
+
+            // dump guard end
+            if (bk->conf.disabled_by_default) {
+                print_string(&b->book_buf, "#endif // defined(%s"BK_DUMP_UPPER") || defined(%s%s) || defined(%s%s_"BK_DUMP_UPPER")\n",
+                             bk->conf.enable_macro_prefix,
+                             bk->conf.enable_macro_prefix,
+                             s_name,
+                             bk->conf.enable_macro_prefix,
+                             s_name
+                );
+            } else {
+                print_string(&b->book_buf, "#endif // %s%s_"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#endif // %s%s\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#endif // %s"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix);
+            }
+
+            // parse guard start
+            if (bk->conf.disabled_by_default) {
+                print_string(&b->book_buf, "#if defined(%s"BK_PARSE_UPPER") || defined(%s%s) || defined(%s%s_"BK_PARSE_UPPER")\n",
+                             bk->conf.enable_macro_prefix,
+                             bk->conf.enable_macro_prefix,
+                             s_name,
+                             bk->conf.enable_macro_prefix,
+                             s_name
+                );
+            } else {
+                print_string(&b->book_buf, "#ifndef %s"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix);
+                print_string(&b->book_buf, "#ifndef %s%s\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#ifndef %s%s_"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix, s_name);
+            }
+
+            // parse code
+            print_string(&b->book_buf, "#ifdef ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#undef ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#endif // ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
+            print_string(&b->book_buf, "#define ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\\\n", s_name);
+            for (size_t e_i = 0; e_i < b->type_db.len; ++e_i) for (size_t j = 0; j < b->type_db.items[e_i].len; ++j) {
+                const char* t_name = b->type_db.items[e_i].items[j].name;
+                print_string(&b->book_buf, "    ___BK_IF_TYPE_%s(%s*: "BK_PARSE_LOWER"_%s_%s)\\\n", t_name, t_name, s_name, t_name);
+            }
+            print_string(&b->book_buf, "\n#ifdef "BK_PARSE_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#undef "BK_PARSE_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#endif // "BK_PARSE_LOWER"_%s\n", s_name);
+            print_string(&b->book_buf, "\n#define "BK_PARSE_LOWER"_%s(src, len, dst)\\\n", s_name);
+            print_string(&b->book_buf, "_Generic((dst), ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES default: NULL)((src), (len), (dst))\n", s_name);
+
+            // parse guard end
+            if (bk->conf.disabled_by_default) {
+                print_string(&b->book_buf, "#endif // defined(%s"BK_PARSE_UPPER") || defined(%s%s) || defined(%s%s_"BK_PARSE_UPPER")\n",
+                             bk->conf.enable_macro_prefix,
+                             bk->conf.enable_macro_prefix,
+                             s_name,
+                             bk->conf.enable_macro_prefix,
+                             s_name
+                );
+            } else {
+                print_string(&b->book_buf, "#endif // %s%s_"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#endif // %s%s\n", bk->conf.disable_macro_prefix, s_name);
+                print_string(&b->book_buf, "#endif // %s"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix);
+            }
+
+        }
+        // print_string(&b->book_buf, "#endif // __GENERICS_H__\n");
+        char* out_file = tfmt("%s/generics.h", bk->conf.output_dir);
+        if (write_entire_file(bk, out_file, &b->book_buf) && bk->conf.depfiles) {
+            write_depfile(bk, out_file, bk->entries.items, bk->entries.len, &b->book_buf);
+        }
+    }
+    if (bk->conf.depfile != NULL) {
+        b->book_buf.len = 0;
+        for (size_t e_i = 0; e_i < bk->entries.len; ++e_i) {
+            Entry* e = bk->entries.items + e_i;
+            if (e->has_output) print_depfile_rule(bk, &b->book_buf, output_file_path(bk, e, b->output_mode, &b->path_buf), e, 1);
+        }
+        if (bk->conf.output_dir != NULL) {
+            print_depfile_rule(bk, &b->book_buf, tfmt("%s/derives.h", bk->conf.output_dir), NULL, 0);
+            if (bk->conf.generics) {
+                print_depfile_rule(bk, &b->book_buf, tfmt("%s/generics.h", bk->conf.output_dir), bk->entries.items, bk->entries.len);
+            }
+        }
+        write_entire_file(bk, bk->conf.depfile, &b->book_buf);
+    }
+    return iter_ok;
+}
+
+__BK_API void free_build_state(BuildState* b) {
+    free_cache(&b->cache);
+    free_type_db(&b->type_db);
+    free_ccompounds(&b->types);
+    free_entry_jobs(&b->jobs);
+    if (b->book_buf.items != NULL) free(b->book_buf.items);
+    if (b->path_buf.items != NULL) free(b->path_buf.items);
+}
+
+/// A single config of a manifest, see `run_manifest`
+typedef struct {
+    char* config_file;
+    BkContext* bk;
+    BuildState build;
+    // Set once the context of the job was set up successfully
+    bool ready;
+    bool ok;
+} ManifestJob;
+
+typedef struct {
+    ManifestJob* items;
+    size_t len;
+    size_t cap;
+} ManifestJobs;
+
+typedef struct {
+    ManifestJobs* jobs;
+    SharedAnalysis shared;
+} ManifestCtx;
+
+/// Sets up the context of a manifest job, schemas and plugins are borrowed from `owner`
+static bool prepare_manifest_job(BkContext* owner, ManifestJob* job) {
+    BkContext* bk = calloc(1, sizeof *bk); // alloc
+    job->bk = bk;
+    init_context(bk);
+    // Both contexts start out with the same built-in schemas, everything after them was loaded from plugins
+    for (size_t i = bk->schemas.len; i < owner->schemas.len; ++i) push_da(&bk->schemas, owner->schemas.items[i]);
+    bk->plugins = owner->plugins;
+    bk->stats = owner->stats;
+
+    String conf_contents = {0}; // alloc
+    if (!read_entire_file(bk, job->config_file, &conf_contents)) return false;
+    parse_bkconf_BkConfig(conf_contents.items, conf_contents.len, &bk->conf);
+    free(conf_contents.items);
+    bk->config_file = job->config_file;
+    if (owner->conf.silent) bk->conf.silent = true;
+    if (owner->conf.verbose) bk->conf.verbose = true;
+    bk->conf.watch_mode = false;
+
+    if (!load_config_lists(bk, owner)) return false;
+    if (!parse_output_mode(bk, &job->build.output_mode)) return false;
+    init_analysis_symbols(bk);
+    return true;
+}
+
+/// free's the context of a manifest job, the schemas and plugins borrowed from the owner stay alive
+static void free_manifest_job(ManifestJob* job) {
+    if (job->bk == NULL) return;
+    free_build_state(&job->build);
+    job->build = (BuildState){0};
+    job->bk->dynamic_schemas.len = 0;
+    job->bk->plugins = (Plugins){0};
+    free_context(job->bk);
+    free(job->bk);
+    job->bk = NULL;
+}
+
+static bool build_manifest_job(ManifestCtx* c, ManifestJob* job) {
+    BkContext* bk = job->bk;
+    BuildState* b = &job->build;
+    bk_log(LOG_INFO, "Running manifest job: %s\n", job->config_file);
+
+    bool ok = write_derives_header(bk, &b->book_buf);
+    b->threads = bk->conf.jobs > 0 ? (size_t)bk->conf.jobs : (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+    if (b->threads < 1) b->threads = 1;
+    if (!discover_sources(bk, b->threads)) return false;
+    if (bk->entries.len <= 0 || (b->output_mode == O_DIR && bk->conf.output_dir == NULL)) return ok;
+
+    b->use_cache = bk->conf.cache && bk->conf.output_dir != NULL;
+    if (b->use_cache) {
+        b->cache.fingerprint = config_fingerprint(bk);
+        load_cache(bk, &b->cache, tfmt("%s/"BK_CACHE_FILE, bk->conf.output_dir));
+        b->cache.dirty = false;
+    }
+    b->shared = &c->shared;
+    return run_build(bk, b) && ok;
+}
+
+static void run_manifest_job(BkContext* owner, size_t i, void* ctx) {
+    (void)owner;
+    ManifestCtx* c = ctx;
+    ManifestJob* job = c->jobs->items + i;
+    if (!job->ready) return;
+    job->ok = build_manifest_job(c, job);
+    // Every config has its own copy of the analyzed types and generated code, so they are released as soon as the job
+    // is done instead of piling up until all jobs of the manifest are
+    free_manifest_job(job);
+}
+
+__BK_API bool run_manifest(BkContext* bk, const char* file_name) {
+    String manifest = {0}; // alloc
+    if (!read_entire_file(bk, file_name, &manifest)) return false;
+
+    ManifestJobs jobs = {0};
+    String_View cursor = sv_from_str(&manifest);
+    while (cursor.len > 0) {
+        String_View rest = sv_find(cursor, '\n');
+        String_View line = sv_trim_whitespace(sv_substr(cursor, 0, cursor.len - rest.len));
+        cursor = sv_chop(rest, 1);
+        if (line.len == 0 || line.items[0] == '#') continue;
+        ManifestJob job = {.config_file = sv_to_cstr(line), .build = {.type_db = {.changed = true}}}; // alloc
+        push_da(&jobs, job);
+    }
+    free(manifest.items);
+
+    bool ok = true;
+    // Jobs are set up one after another, so dynamic schemas are loaded into `bk` only once
+    for (size_t i = 0; i < jobs.len; ++i) {
+        ManifestJob* job = jobs.items + i;
+        job->ready = prepare_manifest_job(bk, job);
+        if (!job->ready) {
+            bk_log(LOG_ERROR, "Couldn't set up manifest job '%s'\n", job->config_file);
+            ok = false;
+        }
+        job->ok = job->ready;
+    }
+
+    ManifestCtx ctx = {.jobs = &jobs};
+    pthread_mutex_init(&ctx.shared.lock, NULL);
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    parallel_for(bk, jobs.len, processors > 0 ? (size_t)processors : 1, run_manifest_job, &ctx);
+    pthread_mutex_destroy(&ctx.shared.lock);
+    free_shared_analysis(&ctx.shared);
+
+    for (size_t i = 0; i < jobs.len; ++i) {
+        ManifestJob* job = jobs.items + i;
+        if (!job->ok) ok = false;
+        // Only jobs that couldn't be set up are left
+        free_manifest_job(job);
+        free(job->config_file);
+    }
+    if (jobs.items != NULL) free(jobs.items);
+    return ok;
+}
+
+__BK_API void init_context(BkContext* bk) {
+    StaticSchema json = {
+        .gen_prelude = gen_json_prelude,
+        .gen_dump_decl = gen_json_dump_decl, 
+        .gen_parse_decl = gen_json_parse_decl, 
+        .gen_dump_impl = gen_json_dump_impl, 
+        .gen_parse_impl = gen_json_parse_impl, 
+        .derive_attr = "derive_json",
+        .name = "json"
+    };
+    StaticSchema debug = {
+        .gen_prelude = NULL,
+        .gen_dump_decl = gen_debug_dump_decl, 
+        .gen_parse_decl = NULL, 
+        .gen_dump_impl = gen_debug_dump_impl, 
+        .gen_parse_impl = NULL, 
+        .derive_attr = "derive_debug",
+        .name = "debug"
+    };
+    push_da(&bk->schemas, json);
+    push_da(&bk->schemas, debug);
+
+    // For static schema extensions
+    #ifdef BK_ADD_SCHEMAS
+    do {
+        BK_ADD_SCHEMAS((bk->schemas))
+    } while(0);
+    #endif
+
+    bk->config_path = "./.bk.conf";
+
+    bk->conf.output_mode = "mirror";
+    bk->conf.gen_fmt_macro = "BK_FMT";
+    bk->conf.gen_implementation_macro = "BK_IMPLEMENTATION";
+    bk->conf.gen_fmt_dst_macro = "BK_FMT_DST_t";
+    // bk->conf.disable_dump_macro = "BK_DISABLE_DUMP";
+    // bk->conf.disable_parse_macro = "BK_DISABLE_PARSE";
+    bk->conf.offset_type_macro = "BK_OFFSET_t";
+    bk->conf.disable_macro_prefix = "BK_DISABLE_";
+    bk->conf.enable_macro_prefix = "BK_ENABLE_";
+
+    bk->conf.generics = false;
+    bk->conf.silent = false;
+    bk->conf.verbose = false;
+    bk->conf.warn_no_include = false;
+    bk->conf.warn_no_output = true;
+    bk->conf.warn_unknown_attr = true;
+    bk->conf.derive_all = false;
+    bk->conf.cache = true;
+    bk->conf.watch_mode = false;
+    bk->conf.watch_delay = 5;
+    bk->conf.watch_debounce = 50;
+    bk->conf.jobs = 1;
+    bk->conf.max_file_size = 0;
+    bk->conf.include_dir = NULL;
+    bk->conf.output_dir = NULL;
+}
+
+__BK_API void free_context(BkContext* bk) {
+    if (bk->schemas.items != NULL) free(bk->schemas.items);
+
+    if (bk->entries.items != NULL) {
+        for (size_t i = 0; i < bk->entries.len; ++i) free_entry(bk->entries.items[i]);
+        free(bk->entries.items);
+    }
+
+    for (size_t i = 0; i < bk->include_dirs.len; ++i) free(bk->include_dirs.items[i]);
+    if (bk->include_dirs.items != NULL) free(bk->include_dirs.items);
+
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        free(bk->dynamic_schemas.items[i].file_name);
+        if (bk->dynamic_schemas.items[i].ops.items != NULL) free(bk->dynamic_schemas.items[i].ops.items);
+    }
+    if (bk->dynamic_schemas.items != NULL) free(bk->dynamic_schemas.items);
+
+    for (size_t i = 0; i < bk->dynamic_source.len; ++i) free(bk->dynamic_source.items[i].items);
+    if (bk->dynamic_source.items != NULL) free(bk->dynamic_source.items);
+
+    free_analysis_symbols(bk);
+    if (bk->derive_schemas.items != NULL) free(bk->derive_schemas.items);
+
+    // Plugins are closed last since the schemas point into their memory
+    for (size_t i = 0; i < bk->plugins.len; ++i) {
+        #ifdef BK_PLUGINS
+        dlclose(bk->plugins.items[i].handle);
+        #endif // BK_PLUGINS
+        free(bk->plugins.items[i].file_name);
+    }
+    if (bk->plugins.items != NULL) free(bk->plugins.items);
+}
+
+BkContext* bk_create(void) {
+    BkContext* bk = calloc(1, sizeof *bk); // alloc
+    init_context(bk);
+    init_analysis_symbols(bk);
+    return bk;
+}
+
+void bk_destroy(BkContext* bk) {
+    free_context(bk);
+    free(bk);
+}
+
+bool bk_register_schema(BkContext* bk, const StaticSchema* schema) {
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        if (strcmp(bk->schemas.items[i].name, schema->name) == 0) {
+            bk_log(LOG_ERROR, "A schema named '%s' was already registered\n", schema->name);
+            return false;
+        }
+    }
+    push_da(&bk->schemas, *schema);
+    init_analysis_symbols(bk);
+    return true;
+}
+
+bool bk_register_dynamic_schema(BkContext* bk, const char* name, const char* source, size_t len) {
+    String s_source = {0}; // alloc
+    append_string(&s_source, source, len);
+    DynamicSchema s = {0};
+    if (!parse_dynamic_schema_source(bk, name, &s, &s_source)) {
+        free(s_source.items);
+        return false;
+    }
+    s.file_name = strdup(name); // alloc
+    push_da(&bk->dynamic_schemas, s);
+    push_da(&bk->dynamic_source, s_source);
+    init_analysis_symbols(bk);
+    return true;
+}
+
+bool bk_analyze(BkContext* bk, const char* name, const char* source, size_t len, CCompounds* out) {
+    size_t before = out->len;
+    // `source` doesn't have to be null terminated, but the lexer needs a terminator after the last number
+    String copy = {0}; // alloc
+    append_string(&copy, source, len);
+    reserve_string(&copy, 0);
+    copy.items[copy.len] = '\0';
+    analyze_file(bk, name, sv_from_parts(copy.items, copy.len), out, bk->conf.derive_all);
+    free(copy.items);
+    return out->len > before;
+}
+
+bool bk_generate(BkContext* bk, CCompounds* types, String* out) {
+    size_t len = out->len;
+    bool generated = gen_entry(bk, out, types);
+    // `gen_entry` may have printed the macro definitions before it found out that there is nothing to generate
+    if (!generated) out->len = len;
+    if (out->items != NULL) out->items[out->len] = '\0';
+    return generated;
+}
+
+void bk_generate_derives(BkContext* bk, String* out) {
+    gen_derives_header(bk, out);
+    if (out->items != NULL) out->items[out->len] = '\0';
+}
+
+void bk_free_types(CCompounds* types) {
+    free_ccompounds(types);
+}
+
+String_View sv(const char* cstr) {
+    return (String_View) {
+        .items = cstr,
+        .len = strlen(cstr),
+    };
+}
+
+String_View sv_from_parts(const char* items, size_t len) {
+    return (String_View) {
+        .items = items,
+        .len = len,
+    };
+}
+
+String_View sv_from_str(String* str) {
+    return (String_View) {
+        .items = str->items,
+        .len = str->len,
+    };
+}
+
+char* sv_to_cstr(String_View sv) {
+    char* res = malloc(sv.len + 1);
+    memset(res, 0, sv.len + 1);
+    sprintf(res, SV_FMT, SV_ARG(sv));
+    return res;
+}
+
+bool sv_starts_with(String_View sv, String_View prefix) {
+    if (sv.len < prefix.len) return false;
+
+    if (strncmp(sv.items, prefix.items, prefix.len) == 0) return true;
+    
+    return false;
+}
+
+String_View sv_chop(String_View sv, size_t n) {
+    sv_chop2(&sv, n);
+    return sv;
+}
+
+bool sv_chop_if_prefix(String_View* sv, String_View prefix) {
+    if (sv_starts_with(*sv, prefix)) {
+        sv_chop2(sv, prefix.len);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+String_View sv_chop_line(String_View sv, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        sv = sv_find(sv, '\n');
+        sv = sv_chop(sv, 1);
+    }
+    return sv;
+}
+
+void sv_chop2(String_View* sv, size_t n) {
+    size_t cn = n <= sv->len ? n : sv->len;
+
+    sv->items += cn;
+    sv->len -= cn;
+}
+
+String_View sv_trim_start(String_View sv, char c) {
+    String_View res = sv;
+    for (size_t i = 0; i < sv.len; ++i) {
+        if (sv.items[i] == c) {
+            sv_chop2(&res, 1);
+        } else {
+            break;
+        }
+    }
+    return res;
+}
+
+String_View sv_trim2_start(String_View sv, String_View cs) {
+    String_View res = sv;
+    for (size_t i = 0; i < sv.len; ++i) {
+        bool found = false;
+        for (size_t j = 0; j < cs.len; ++j) {
+            if (sv.items[i] == cs.items[j]) {
+                found = true;
+                break;
+            }
+        }
+        if (found) {
+            sv_chop2(&res, 1);
+        } else {
+            break;
+        }
+    }
+    return res;
+}
+
+String_View sv_trim_whitespace_start(String_View sv_) {
+    return sv_trim2_start(sv_, sv(" \t\n"));
+}
+
+String_View sv_trim_whitespace_end(String_View sv) {
+    if (sv.len == 0) return sv;
+    for (;;) {
+        char c = sv.items[sv.len - 1];
+        if (
+        (c == ' ') ||
+        (c == '\n') ||
+        (c == '\t')
+        ) {
+            --sv.len;
+        } else {
+            break;
+        }
+    }
+    return sv;
+}
+
+String_View sv_trim_whitespace(String_View sv) {
+    return sv_trim_whitespace_end(sv_trim_whitespace_start(sv));
+}
+
+String_View sv_find(String_View sv, char c) {
+    String_View res = sv;
+    for (size_t i = 0; i < sv.len; ++i) {
+        if (sv.items[i] != c) {
+            sv_chop2(&res, 1);
+        } else {
+            break;
+        }
+    }
+    return res;
+}
+
+bool sv_contains(String_View sv, String_View needle) {
+    if (needle.len == 0) return true;
+    if (needle.len > sv.len) return false;
+    const char* items = sv.items;
+    size_t last = needle.len - 1;
+    size_t i = 0;
+    // Compare the first and the last byte of the needle at every position of a block at once,
+    // only the positions where both match are compared in full
+    #if defined(__AVX2__)
+    __m256i first_v = _mm256_set1_epi8(needle.items[0]);
+    __m256i last_v = _mm256_set1_epi8(needle.items[last]);
+    for (; i + last + 32 <= sv.len; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(items + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(items + i + last));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first_v), _mm256_cmpeq_epi8(b, last_v)));
+        for (; mask != 0; mask &= mask - 1) {
+            if (memcmp(items + i + __builtin_ctz(mask), needle.items, needle.len) == 0) return true;
+        }
+    }
+    #elif defined(__SSE2__)
+    __m128i first_v = _mm_set1_epi8(needle.items[0]);
+    __m128i last_v = _mm_set1_epi8(needle.items[last]);
+    for (; i + last + 16 <= sv.len; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(items + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(items + i + last));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first_v), _mm_cmpeq_epi8(b, last_v)));
+        for (; mask != 0; mask &= mask - 1) {
+            if (memcmp(items + i + __builtin_ctz(mask), needle.items, needle.len) == 0) return true;
+        }
+    }
+    #endif
+    while (i + last < sv.len) {
+        const char* found = memchr(items + i, needle.items[0], sv.len - last - i);
+        if (found == NULL) return false;
+        if (memcmp(found, needle.items, needle.len) == 0) return true;
+        i = (size_t)(found - items) + 1;
+    }
+    return false;
+}
+
+String_View sv_substr(String_View sv, size_t start, size_t len) {
+    // TODO: bounds checks
+    return (String_View) {
+        .items = sv.items + start,
+        .len = len
+    };
+}
+
+void sv_loc(String_View file, String_View cursor, int* line, int* offset) {
+    *line = 1;
+    *offset = 1;
+    for (size_t i = 0; i < (file.len - cursor.len); ++i) {
+        if (file.items[i] == '\n') {
+            *line += 1;
+            *offset = 1;
+        } else {
+            *offset += 1;
+        }
+    }
+}
+
+/// Appends everything that can be read from `fd` to `dst`, `size_hint` is the expected amount of bytes
+static bool read_fd(int fd, String* dst, size_t size_hint) {
+    for (;;) {
+        // One extra byte so reading the whole file and then hitting its end doesn't need another allocation
+        if (dst->len + size_hint + 1 > dst->cap) {
+            size_t cap = dst->cap * 2;
+            if (cap < dst->len + size_hint + 1) cap = dst->len + size_hint + 1;
+            if (cap < 4096) cap = 4096;
+            dst->items = realloc(dst->items, cap);
+            dst->cap = cap;
+        }
+        ssize_t n = read(fd, dst->items + dst->len, dst->cap - dst->len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (n == 0) return true;
+        dst->len += (size_t)n;
+        size_hint = 0;
+    }
+}
+
+__BK_API bool read_entire_file_loc(BkContext* bk, const char* file_name, String* dst, const char* source_file, int source_line) {
+    int fd = open(file_name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't open file '%s': %s\n", file_name, strerror(errno));
+        return false;
+    }
+    unsigned long long start = stats_begin(bk);
+    size_t len = dst->len;
+    struct stat s = {0};
+    size_t size_hint = fstat(fd, &s) == 0 && S_ISREG(s.st_mode) ? (size_t)s.st_size : 0;
+    bool ok = read_fd(fd, dst, size_hint);
+    if (!ok) bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't read from file '%s': %s\n", file_name, strerror(errno));
+    close(fd);
+    stats_end(bk, PHASE_READ, start, file_name, dst->len - len);
+    return ok;
+}
+
+__BK_API bool map_entire_file_loc(BkContext* bk, const char* file_name, MappedFile* out, const char* source_file, int source_line) {
+    unmap_file(out);
+    int fd = open(file_name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't open file '%s': %s\n", file_name, strerror(errno));
+        return false;
+    }
+    unsigned long long start = stats_begin(bk);
+    struct stat s = {0};
+    bool regular = fstat(fd, &s) == 0 && S_ISREG(s.st_mode);
+    // Files that are truncated while they are mapped raise SIGBUS once a page past their new end is read. Editors and
+    // generators rewrite files in place while watch and daemon mode run, so those don't map their inputs.
+    bool long_running = bk != NULL && (bk->conf.watch_mode || bk->daemon_socket != NULL);
+    // The lexer parses numbers with `strtod`/`strtol`, which read past the contents unless a `\0` follows them. The
+    // rest of the last page of a mapping is zero filled, so only files that end exactly at a page boundary lack one.
+    bool page_end = regular && s.st_size % sysconf(_SC_PAGESIZE) == 0;
+    if (regular && s.st_size > 0 && !long_running && !page_end) {
+        void* map = mmap(NULL, (size_t)s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            close(fd);
+            out->map = map;
+            out->contents = sv_from_parts(map, (size_t)s.st_size);
+            // The pages are only read once the file is analyzed, so this mostly measures `open` and `mmap`
+            stats_end(bk, PHASE_READ, start, file_name, out->contents.len);
+            return true;
+        }
+    }
+
+    out->buf.len = 0;
+    bool ok = read_fd(fd, &out->buf, regular ? (size_t)s.st_size : 0);
+    if (!ok) bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't read from file '%s': %s\n", file_name, strerror(errno));
+    close(fd);
+    reserve_string(&out->buf, 0);
+    out->buf.items[out->buf.len] = '\0';
+    out->contents = sv_from_parts(out->buf.items, out->buf.len);
+    stats_end(bk, PHASE_READ, start, file_name, out->buf.len);
+    return ok;
+}
+
+__BK_API void unmap_file(MappedFile* f) {
+    if (f->map != NULL) munmap(f->map, f->contents.len);
+    f->map = NULL;
+    f->contents = sv_from_parts(NULL, 0);
+}
+
+__BK_API void free_mapped_file(MappedFile* f) {
+    unmap_file(f);
+    if (f->buf.items != NULL) free(f->buf.items);
+    f->buf = (String){0};
+}
+
+__BK_API bool file_equals(const char* file_name, String* src) {
+    struct stat s = {0};
+    if (stat(file_name, &s) != 0 || (size_t)s.st_size != src->len) return false;
+    FILE* f = fopen(file_name, "rb");
+    if (f == NULL) return false;
+    char chunk[4096];
+    size_t offset = 0;
+    bool equal = true;
+    while (equal && offset < src->len) {
+        size_t n = fread(chunk, 1, sizeof chunk, f);
+        if (n == 0 || offset + n > src->len) {
+            equal = false;
+            break;
+        }
+        equal = memcmp(chunk, src->items + offset, n) == 0;
+        offset += n;
+    }
+    // The file might have grown since the call to `stat`
+    if (equal && fgetc(f) != EOF) equal = false;
+    fclose(f);
+    return equal;
+}
+
+/// Numbers the temporary files of `replace_file`, so threads that write the same file never share a temporary file
+static atomic_uint tmp_file_seq;
+
+/// Writes `src` to a temporary file that replaces `file_name` once it was written completely
+static bool replace_file(BkContext* bk, const char* file_name, String* src, const char* source_file, int source_line) {
+    size_t tmp_len = strlen(file_name) + 48;
+    char* tmp_name = malloc(tmp_len); // alloc
+    snprintf(tmp_name, tmp_len, "%s.tmp%ld.%u", file_name, (long)getpid(), atomic_fetch_add(&tmp_file_seq, 1));
+    FILE* f = fopen(tmp_name, "wx");
+    if (f == NULL) {
+        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't open file '%s': %s\n", tmp_name, strerror(errno));
+        free(tmp_name);
+        return false;
+    }
+    if (fwrite(src->items, sizeof *src->items, src->len, f) < src->len || fflush(f) != 0) {
+        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't write to file '%s': %s\n", tmp_name, strerror(errno));
+        fclose(f);
+        remove(tmp_name);
+        free(tmp_name);
+        return false;
+    }
+    fclose(f);
+    if (rename(tmp_name, file_name) != 0) {
+        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't rename '%s' to '%s': %s\n", tmp_name, file_name, strerror(errno));
+        remove(tmp_name);
+        free(tmp_name);
+        return false;
+    }
+    free(tmp_name);
+    bk_log_loc(LOG_INFO, source_file, source_line, "Generated file: %s\n", file_name);
+    return true;
+}
+
+__BK_API bool write_entire_file_loc(BkContext* bk, const char* file_name, String* src, const char* source_file, int source_line) {
+    unsigned long long start = stats_begin(bk);
+    bool written = false;
+    bool ok = true;
+    if (file_equals(file_name, src)) {
+        bk_log_loc(LOG_INFO, source_file, source_line, "Unchanged file: %s\n", file_name);
+    } else {
+        ok = written = replace_file(bk, file_name, src, source_file, source_line);
+    }
+    stats_end(bk, PHASE_WRITE, start, file_name, written ? src->len : 0);
+    return ok;
+}
+
+__BK_API unsigned long djb2(const char* s) {
+    unsigned long hash = 5381;
+    for (char c; (c = *s++);) hash = ((hash << 5) + hash) + (unsigned long) c;
+    return hash;
+}
+
+__BK_API bool entry_from_file(BkContext* bk, const char* file_name, Entry* out) {
+    char* real = bk_realpath(file_name); // alloc
+    if (real == NULL) {
+        bk_log(LOG_ERROR, "File '%s' doesn't exist: %s\n", file_name, strerror(errno));
+        return false;
+    }
+    struct stat s = {0};
+    stat(real, &s);
+    out->full = real;
+    out->name = strdup(file_name); // alloc
+    #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
+    out->sys_modif = s.st_mtimespec.tv_sec;
+    #else
+    out->sys_modif = s.st_mtim.tv_sec;
+    #endif
+    out->last_analyzed = 0;
 
-#define bk_printf(...) (bk.conf.silent ? 0 : printf(__VA_ARGS__))
+    return true;
+}
 
-static char* config_path = "./.bk.conf";
-#define BK_FILE_EXT ".bk.h"
-#define BK_FILE_EXT_LEN 5
+__BK_API bool is_source_file_name(const char* file_name) {
+    size_t name_len = strlen(file_name);
+    if (name_len > BK_FILE_EXT_LEN && strcmp(file_name + name_len - BK_FILE_EXT_LEN, BK_FILE_EXT) == 0) return false;
+    if (name_len < 2) return false;
+    return strcmp(file_name + name_len - 2, ".c") == 0 || strcmp(file_name + name_len - 2, ".h") == 0;
+}
 
-/** @brief Macro that goto's to the cleanup label before returning inside `main` */
-#define ret_clean(i)\
-do {\
-    ret_val = i;\
-    goto __bk_cleanup;\
-} while(0)
+__BK_API void entry_from_include_dir(BkContext* bk, const char* root, const char* file_name, Entry* out) {
+    char* in_file = fmt("%s/%s", root, file_name); // alloc
+    struct stat s = {0};
+    stat(in_file, &s);
+    out->full = in_file;
+    out->name = strdup(file_name); // alloc
+    #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
+    out->sys_modif = s.st_mtimespec.tv_sec;
+    #else
+    out->sys_modif = s.st_mtim.tv_sec;
+    #endif
+    out->last_analyzed = 0;
+}
 
-#ifdef BK_RENAME_MAIN
-#define __BK_DEFINE_FN(name) int name(int argc, char** argv)
-__BK_DEFINE_FN(BK_RENAME_MAIN) {
-#undef __BK_DEFINE_FN
-#else
-int main(int argc, char** argv) {
-#endif // BK_RENAME_MAIN
+__BK_API bool make_parent_dirs(char* file_name) {
+    for (char* p = strchr(file_name + 1, '/'); p != NULL; p = strchr(p + 1, '/')) {
+        *p = 0;
+        bool ok = mkdir(file_name, 0777) == 0 || errno == EEXIST;
+        *p = '/';
+        if (!ok) return false;
+    }
+    return true;
+}
 
-    // Declaring resources that will be cleaned up here before declaring
-    // `ret_val` to avoid situations where we try to cleanup these resources
-    // before they were *declared* by goto'ing to `__bk_cleanup` inside `ret_clean`
-    CCompounds all_types = {0};
-    CCompounds types = {0};
-    String file_buf = {0};
-    
-    int ret_val = 0;
+__BK_API bool is_ignored_path(CStrings* patterns, const char* file_name, bool is_dir) {
+    const char* base = strrchr(file_name, '/');
+    base = base != NULL ? base + 1 : file_name;
+    char dir_pattern[PATH_MAX];
+    for (size_t i = 0; i < patterns->len; ++i) {
+        const char* pattern = patterns->items[i];
+        size_t len = strlen(pattern);
+        if (pattern[len - 1] == '/') {
+            if (!is_dir || len >= sizeof dir_pattern) continue;
+            memcpy(dir_pattern, pattern, len - 1);
+            dir_pattern[len - 1] = 0;
+            pattern = dir_pattern;
+        }
+        bool anchored = strchr(pattern, '/') != NULL;
+        if (pattern[0] == '/') pattern++;
+        if (pattern[0] == 0) continue;
+        if (fnmatch(pattern, anchored ? file_name : base, anchored ? FNM_PATHNAME : 0) == 0) return true;
+    }
+    return false;
+}
 
-    StaticSchema json = {
-        .gen_prelude = gen_json_prelude,
-        .gen_dump_decl = gen_json_dump_decl, 
-        .gen_parse_decl = gen_json_parse_decl, 
-        .gen_dump_impl = gen_json_dump_impl, 
-        .gen_parse_impl = gen_json_parse_impl, 
-        .derive_attr = "derive_json",
-        .name = "json"
-    };
-    StaticSchema debug = {
-        .gen_prelude = NULL,
-        .gen_dump_decl = gen_debug_dump_decl, 
-        .gen_parse_decl = NULL, 
-        .gen_dump_impl = gen_debug_dump_impl, 
-        .gen_parse_impl = NULL, 
-        .derive_attr = "derive_debug",
-        .name = "debug"
-    };
-    push_da(&bk.schemas, json);
-    push_da(&bk.schemas, debug);
+__BK_API void read_ignore_file(int root_fd, CStrings* out) {
+    int fd = openat(root_fd, ".bkignore", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+    String contents = {0};
+    char buf[4096];
+    for (ssize_t n; (n = read(fd, buf, sizeof buf)) > 0;) {
+        for (ssize_t i = 0; i < n; ++i) push_da(&contents, buf[i]);
+    }
+    close(fd);
+
+    for (size_t start = 0, end = 0; start < contents.len; start = end + 1) {
+        end = start;
+        while (end < contents.len && contents.items[end] != '\n') end++;
+        size_t line_end = end;
+        while (line_end > start && isspace((unsigned char)contents.items[line_end - 1])) line_end--;
+        while (start < line_end && isspace((unsigned char)contents.items[start])) start++;
+        if (start == line_end || contents.items[start] == '#') continue;
+        char* pattern = malloc(line_end - start + 1); // alloc
+        memcpy(pattern, contents.items + start, line_end - start);
+        pattern[line_end - start] = 0;
+        push_da(out, pattern);
+    }
+    if (contents.items != NULL) free(contents.items);
+}
 
-    // For static schema extensions
-    #ifdef BK_ADD_SCHEMAS
-    do {
-        BK_ADD_SCHEMAS((bk.schemas))
-    } while(0);
-    #endif
+/// A directory that is waiting to be searched, `name` is relative to its root ("" for the root itself)
+typedef struct {
+    size_t root;
+    char* name;
+} PendingDir;
+
+typedef struct {
+    PendingDir* items;
+    size_t len;
+    size_t cap;
+} PendingDirs;
+
+/// A file that passed the prefilter, `name` is relative to its root
+typedef struct {
+    size_t root;
+    char* name;
+    time_t sys_modif;
+} FoundSource;
+
+typedef struct {
+    FoundSource* items;
+    size_t len;
+    size_t cap;
+} FoundSources;
+
+/// Shared state of the threads running `discover_sources`
+typedef struct {
+    BkContext* bk;
+    int* root_fds;
+    CStrings* ignores;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    PendingDirs pending;
+    size_t busy;
+    FoundSources found;
+} Discovery;
+
+/// Reads a single directory, new subdirectories are appended to `subdirs` and files that pass the prefilter to `found`
+static void discover_dir(Discovery* ds, PendingDir dir, FoundSources* found, PendingDirs* subdirs) {
+    BkContext* bk = ds->bk;
+    int fd = openat(ds->root_fds[dir.root], dir.name[0] ? dir.name : ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        bk_log(LOG_WARN, "Couldn't open directory '%s/%s': %s\n", bk->include_dirs.items[dir.root], dir.name, strerror(errno));
+        return;
+    }
+    DIR* d = fdopendir(fd);
+    if (d == NULL) {
+        close(fd);
+        return;
+    }
+
+    char path[PATH_MAX];
+    size_t prefix = dir.name[0] ? (size_t)snprintf(path, sizeof path, "%s/", dir.name) : 0;
+    for (struct dirent* ent = readdir(d); ent; ent = readdir(d)) {
+        const char* name = ent->d_name;
+        if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0))) continue;
+        unsigned char type = ent->d_type;
+        // Everything that can't become an entry is rejected by name before any allocations or system calls
+        bool source_name = is_source_file_name(name);
+        if (type != DT_DIR && type != DT_UNKNOWN && !(type == DT_REG && source_name)) continue;
+        size_t name_len = strlen(name);
+        if (prefix + name_len >= sizeof path) continue;
+        memcpy(path + prefix, name, name_len + 1);
+
+        struct stat s;
+        if (type == DT_UNKNOWN) {
+            if (fstatat(dirfd(d), name, &s, AT_SYMLINK_NOFOLLOW) != 0) continue;
+            type = S_ISDIR(s.st_mode) ? DT_DIR : S_ISREG(s.st_mode) ? DT_REG : DT_UNKNOWN;
+            if (type == DT_REG && !source_name) continue;
+        } else if (type == DT_REG && is_ignored_path(ds->ignores + dir.root, path, false)) {
+            continue;
+        } else if (type == DT_REG && fstatat(dirfd(d), name, &s, 0) != 0) {
+            continue;
+        }
+
+        if (type == DT_DIR) {
+            if (is_ignored_path(ds->ignores + dir.root, path, true)) continue;
+            PendingDir sub = {.root = dir.root, .name = strdup(path)}; // alloc
+            push_da(subdirs, sub);
+        } else if (type == DT_REG) {
+            if (s.st_size == 0 || (bk->conf.max_file_size > 0 && s.st_size > bk->conf.max_file_size)) continue;
+            if (ent->d_type == DT_UNKNOWN && is_ignored_path(ds->ignores + dir.root, path, false)) continue;
+            FoundSource f = {
+                .root = dir.root,
+                .name = strdup(path), // alloc
+                #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
+                .sys_modif = s.st_mtimespec.tv_sec,
+                #else
+                .sys_modif = s.st_mtim.tv_sec,
+                #endif
+            };
+            push_da(found, f);
+        }
+    }
+    closedir(d);
+}
+
+static void* discovery_worker(void* arg) {
+    Discovery* ds = arg;
+    FoundSources found = {0};
+    PendingDirs subdirs = {0};
+    pthread_mutex_lock(&ds->lock);
+    for (;;) {
+        // Directories that are being searched may still add more work
+        while (ds->pending.len == 0 && ds->busy > 0) pthread_cond_wait(&ds->cond, &ds->lock);
+        if (ds->pending.len == 0) break;
+        PendingDir dir = ds->pending.items[--ds->pending.len];
+        ds->busy++;
+        pthread_mutex_unlock(&ds->lock);
+
+        discover_dir(ds, dir, &found, &subdirs);
+        free(dir.name);
+
+        pthread_mutex_lock(&ds->lock);
+        ds->busy--;
+        for (size_t i = 0; i < subdirs.len; ++i) push_da(&ds->pending, subdirs.items[i]);
+        subdirs.len = 0;
+        pthread_cond_broadcast(&ds->cond);
+    }
+    for (size_t i = 0; i < found.len; ++i) push_da(&ds->found, found.items[i]);
+    pthread_mutex_unlock(&ds->lock);
+    if (found.items != NULL) free(found.items);
+    if (subdirs.items != NULL) free(subdirs.items);
+    return NULL;
+}
+
+static int compare_found_sources(const void* a, const void* b) {
+    const FoundSource* x = a;
+    const FoundSource* y = b;
+    if (x->root != y->root) return x->root < y->root ? -1 : 1;
+    return strcmp(x->name, y->name);
+}
+
+__BK_API bool discover_sources(BkContext* bk, size_t threads) {
+    size_t roots = bk->include_dirs.len;
+    if (roots == 0) return true;
+    unsigned long long start = stats_begin(bk);
+
+    Discovery ds = {.bk = bk};
+    ds.root_fds = malloc(roots * sizeof *ds.root_fds); // alloc
+    ds.ignores = calloc(roots, sizeof *ds.ignores); // alloc
+    bool ok = true;
+    for (size_t i = 0; i < roots; ++i) {
+        ds.root_fds[i] = open(bk->include_dirs.items[i], O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (ds.root_fds[i] < 0) {
+            bk_log(LOG_ERROR, "Couldn't open directory '%s': %s\n", bk->include_dirs.items[i], strerror(errno));
+            ok = false;
+            continue;
+        }
+        read_ignore_file(ds.root_fds[i], ds.ignores + i);
+        PendingDir root = {.root = i, .name = strdup("")}; // alloc
+        push_da(&ds.pending, root);
+    }
+
+    if (ok) {
+        pthread_mutex_init(&ds.lock, NULL);
+        pthread_cond_init(&ds.cond, NULL);
+        pthread_t* workers = threads > 1 ? malloc((threads - 1) * sizeof *workers) : NULL; // alloc
+        size_t started = 0;
+        for (; started + 1 < threads; ++started) {
+            if (pthread_create(workers + started, NULL, discovery_worker, &ds) != 0) break;
+        }
+        discovery_worker(&ds);
+        for (size_t i = 0; i < started; ++i) pthread_join(workers[i], NULL);
+        if (workers != NULL) free(workers);
+        pthread_cond_destroy(&ds.cond);
+        pthread_mutex_destroy(&ds.lock);
+
+        qsort(ds.found.items, ds.found.len, sizeof *ds.found.items, compare_found_sources);
+        for (size_t i = 0; i < ds.found.len; ++i) {
+            FoundSource* f = ds.found.items + i;
+            const char* root = bk->include_dirs.items[f->root];
+            size_t full_len = strlen(root) + strlen(f->name) + 2;
+            Entry e = {
+                .full = malloc(full_len), // alloc
+                .name = f->name,
+                .sys_modif = f->sys_modif,
+            };
+            snprintf(e.full, full_len, "%s/%s", root, f->name);
+            push_da(&bk->entries, e);
+        }
+    }
+
+    for (size_t i = 0; i < ds.pending.len; ++i) free(ds.pending.items[i].name);
+    if (ds.pending.items != NULL) free(ds.pending.items);
+    if (ds.found.items != NULL) free(ds.found.items);
+    for (size_t i = 0; i < roots; ++i) {
+        if (ds.root_fds[i] >= 0) close(ds.root_fds[i]);
+        for (size_t j = 0; j < ds.ignores[i].len; ++j) free(ds.ignores[i].items[j]);
+        if (ds.ignores[i].items != NULL) free(ds.ignores[i].items);
+    }
+    free(ds.root_fds);
+    free(ds.ignores);
+    stats_end(bk, PHASE_DISCOVERY, start, NULL, 0);
+    return ok;
+}
+
+/// Names of the type conditions of dynamic schema ifs, the index of a name is its bit in `SOP_IF_TYPE` masks
+static const char* schema_type_conds[] = {"CEXTERNAL", "CINT", "CUINT", "CLONG", "CULONG", "CCHAR", "CFLOAT", "CBOOL", "CSTRING"};
+
+/// Returns the bit of `type` in `SOP_IF_TYPE` masks
+static size_t schema_type_bit(CType type) {
+    return type.kind == CEXTERNAL ? 1 : (size_t)1 << type.type;
+}
+
+static bool schema_op_is_text(SchemaOpKind kind) {
+    return kind == SOP_TEXT || kind == SOP_TY || kind == SOP_FMT || kind == SOP_DST || kind == SOP_OFFSET;
+}
+
+static size_t schema_index_value(String_View value_v) {
+    char* value_c = sv_to_cstr(value_v); // alloc
+    size_t value = (size_t)(atoi(value_c));
+    free(value_c);
+    return value;
+}
+
+/// Marks the runs of text between the directives of a loop body as segments and trims them, then appends the body to `ops`
+static void push_schema_body(SchemaOps* ops, SchemaOps* body) {
+    size_t len = 0;
+    for (size_t start = 0; start < body->len;) {
+        size_t end = start;
+        while (end < body->len && schema_op_is_text(body->items[end].kind)) ++end;
+        if (end == start) {
+            body->items[len++] = body->items[start++];
+            continue;
+        }
+        // Text after the last directive is output even if the current if is false
+        unsigned always = end == body->len ? SOP_ALWAYS : 0;
+        if (end - start == 1 && body->items[start].kind == SOP_TEXT) {
+            String_View text = sv_trim_whitespace(body->items[start].text);
+            if (text.len > 0) {
+                body->items[start].text = text;
+                body->items[start].flags = always;
+                body->items[len++] = body->items[start];
+            }
+        } else {
+            body->items[start].flags |= SOP_SEGMENT_START;
+            body->items[end - 1].flags |= SOP_SEGMENT_END;
+            for (size_t i = start; i < end; ++i) {
+                body->items[i].flags |= always;
+                body->items[len++] = body->items[i];
+            }
+        }
+        start = end;
+    }
+    push_da(ops, ((SchemaOp){.kind = SOP_FOR, .value = len}));
+    for (size_t i = 0; i < len; ++i) push_da(ops, body->items[i]);
+    body->len = 0;
+}
+
+__BK_API bool compile_dynamic_schema(BkContext* bk, const char* file_name, String_View file, DynamicSchema* schema) {
+    SchemaOps* ops = &schema->ops;
+    SchemaOps body = {0}; // alloc
+    String_View cursor = sv_trim_whitespace_start(schema->source);
+    String_View special_start = cursor;
+    String_View normal_start = cursor;
+    bool in_special = false;
+    bool in_loop = false;
+    bool in_if = false;
+    // Mask of the last type if of the body that wasn't closed, `$it.type$` is only allowed inside of `CEXTERNAL` ifs
+    size_t body_if_mask = 0;
+    int line, offset;
+    ops->len = 0;
+    while (cursor.len > 0) {
+        if (cursor.items[0] != '$') {
+            cursor = sv_chop(cursor, 1);
+            continue;
+        }
+        if (!in_special) {
+            in_special = true;
+            String_View text = sv_substr(normal_start, 0, normal_start.len - cursor.len);
+            if (cursor.len > 1 && text.len > 0) {
+                push_da(in_loop ? &body : ops, ((SchemaOp){.kind = SOP_TEXT, .text = text}));
+            }
+            cursor = sv_chop(cursor, 1);
+            special_start = cursor;
+            continue;
+        }
+        in_special = false;
+        String_View special = sv_substr(special_start, 0, special_start.len - cursor.len);
+        special = sv_trim_whitespace_start(special);
+        SchemaOps* dst = in_loop ? &body : ops;
+        if (sv_chop_if_prefix(&special, sv("ty"))) {
+            push_da(dst, ((SchemaOp){.kind = SOP_TY}));
+        } else if (sv_chop_if_prefix(&special, sv("implguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_IMPLGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("endimplguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_ENDIMPLGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("dumpguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_DUMPGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("enddumpguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_ENDDUMPGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("parseguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_PARSEGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("endparseguard"))) {
+            push_da(ops, ((SchemaOp){.kind = SOP_ENDPARSEGUARD}));
+        } else if (sv_chop_if_prefix(&special, sv("fmt"))) {
+            push_da(dst, ((SchemaOp){.kind = SOP_FMT}));
+        } else if (sv_chop_if_prefix(&special, sv("dst"))) {
+            push_da(dst, ((SchemaOp){.kind = SOP_DST}));
+        } else if (sv_chop_if_prefix(&special, sv("offset"))) {
+            push_da(dst, ((SchemaOp){.kind = SOP_OFFSET}));
+        } else if (sv_chop_if_prefix(&special, sv("it"))) {
+            if (!in_loop) {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "'it' directives can't be used outside of for loops\n");
+                goto error;
+            }
+            if (sv_chop_if_prefix(&special, sv(".type"))) {
+                if (body_if_mask != 0 && (body_if_mask & 1) == 0) {
+                    sv_loc(file, special_start, &line, &offset);
+                    bk_diag_loc(LOG_ERROR, file_name, line, offset, "$it.type$ can only be used in CEXTERNAL fields\n");
+                    goto error;
+                }
+                push_da(&body, ((SchemaOp){.kind = SOP_TYPE}));
+            } else {
+                push_da(&body, ((SchemaOp){.kind = SOP_FIELD}));
+            }
+        } else if (sv_chop_if_prefix(&special, sv("tag"))) {
+            if (!in_loop) {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "'tag' directive can't be used outside of for loops\n");
+                goto error;
+            }
+            push_da(&body, ((SchemaOp){.kind = SOP_TAG}));
+        } else if (sv_chop_if_prefix(&special, sv("for"))) {
+            if (in_loop) {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "Nested for loops aren't supported\n");
+                goto error;
+            }
+            if (sv_find(special, '{').len == 0) {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected '{' in for loop\n");
+                goto error;
+            }
+            in_loop = true;
+        } else if (sv_chop_if_prefix(&special, sv("if"))) {
+            if (sv_find(special, '{').len == 0) {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected '{' in if cond\n");
+                goto error;
+            }
+            in_if = true;
+            special = sv_trim_whitespace_start(special);
+            String_View cond = sv_substr(special, 0, special.len - sv_find(special, ' ').len);
+            SchemaOp op = {.kind = SOP_IF_TYPE};
+            if (sv_starts_with(cond, sv("index")) && in_loop) {
+                cond = sv_trim_whitespace_start(sv_chop(special, 5));
+                String_View op_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
+                cond = sv_trim_whitespace_start(sv_find(cond, ' '));
+                String_View value_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
+                if (sv_starts_with(op_v, sv("=="))) {
+                    op.kind = SOP_IF_INDEX_EQ;
+                } else if (sv_starts_with(op_v, sv("!="))) {
+                    op.kind = SOP_IF_INDEX_NE;
+                } else {
+                    sv_loc(file, special_start, &line, &offset);
+                    bk_diag_loc(LOG_ERROR, file_name, line, offset, "Unknown binary op '"SV_FMT"' in if cond\n", SV_ARG(op_v));
+                    goto error;
+                }
+                op.value = schema_index_value(value_v);
+            } else if (sv_chop_if_prefix(&cond, sv("=="))) {
+                op.kind = SOP_IF_INDEX_EQ;
+                op.value = schema_index_value(cond);
+            } else if (sv_chop_if_prefix(&cond, sv("!="))) {
+                op.kind = SOP_IF_INDEX_NE;
+                op.value = schema_index_value(cond);
+            } else {
+                for (size_t i = 0; i < sizeof schema_type_conds / sizeof *schema_type_conds; ++i) {
+                    if (sv_starts_with(cond, sv(schema_type_conds[i]))) op.value |= (size_t)1 << i;
+                }
+            }
+            body_if_mask = op.kind == SOP_IF_TYPE ? op.value : 0;
+            push_da(&body, op);
+        } else if (sv_chop_if_prefix(&special, sv("}"))) {
+            if (in_if) {
+                in_if = false;
+                body_if_mask = 0;
+                push_da(&body, ((SchemaOp){.kind = SOP_ENDIF}));
+            } else if (in_loop) {
+                in_loop = false;
+                body_if_mask = 0;
+                push_schema_body(ops, &body);
+            } else {
+                sv_loc(file, special_start, &line, &offset);
+                bk_diag_loc(LOG_ERROR, file_name, line, offset, "Mismatched '}'\n");
+                goto error;
+            }
+        } else {
+            sv_loc(file, special_start, &line, &offset);
+            bk_diag_loc(LOG_ERROR, file_name, line, offset, "Unknown special directive '"SV_FMT"'\n", SV_ARG(special));
+            goto error;
+        }
+        cursor = sv_chop(cursor, 1);
+        normal_start = cursor;
+    }
+    push_da(ops, ((SchemaOp){.kind = SOP_TAIL, .text = sv_trim_whitespace(normal_start)}));
+    if (body.items != NULL) free(body.items);
+    return true;
+error:
+    if (body.items != NULL) free(body.items);
+    if (ops->items != NULL) free(ops->items);
+    *ops = (SchemaOps){0};
+    return false;
+}
+
+__BK_API bool parse_dynamic_schema_loc(BkContext* bk, const char* file_name, DynamicSchema* out, String* source, const char* source_file, int source_line) {
+    if (!read_entire_file_loc(bk, file_name, source, source_file, source_line)) return false;
+    return parse_dynamic_schema_source(bk, file_name, out, source);
+}
+
+__BK_API bool parse_dynamic_schema_source(BkContext* bk, const char* file_name, DynamicSchema* out, String* source) {
+    String_View schema_source = sv_from_str(source);
+    String_View cursor = sv_trim_whitespace_start(schema_source);
+
+    String_View name_prefix = sv("name:");
+    String_View derive_prefix = sv("derive:");
+    if (sv_starts_with(cursor, name_prefix)) {
+        cursor = sv_find(cursor, '"');
+        cursor = sv_chop(cursor, 1);
+        String_View name_end = sv_find(cursor, '"');
+        String_View name = sv_substr(cursor, 0, cursor.len - name_end.len);
+        cursor = name_end;
+        cursor = sv_chop(cursor, 1);
+        if (cursor.items[0] != ',') {
+            int line, offset;
+            sv_loc(schema_source, cursor, &line, &offset);
+            bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected comma (',')\n");
+            return false;
+        }
+        cursor = sv_chop(cursor, 1);
+        cursor = sv_trim_whitespace_start(cursor);
+        if (!sv_starts_with(cursor, derive_prefix)) {
+            int line, offset;
+            sv_loc(schema_source, cursor, &line, &offset);
+            bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected `derive` field\n");
+            return false;
+        }
+        cursor = sv_chop(cursor, derive_prefix.len);
+        cursor = sv_find(cursor, '"');
+        cursor = sv_chop(cursor, 1);
+        String_View derive_end = sv_find(cursor, '"');
+        String_View derive_attr = sv_substr(cursor, 0, cursor.len - derive_end.len);
+        cursor = derive_end;
+        cursor = sv_chop(cursor, 1);
+        cursor = sv_trim_whitespace_start(cursor);
+        bk_log(LOG_INFO, "Loading dynamic schema '"SV_FMT"' with derive attribute '"SV_FMT"'\n", SV_ARG(name), SV_ARG(derive_attr));
+        out->name = name;
+        out->derive_attr = derive_attr;
+        out->source = cursor;
+        if (!compile_dynamic_schema(bk, file_name, schema_source, out)) return false;
+    } else {
+        int line, offset;
+        sv_loc(schema_source, cursor, &line, &offset);
+        bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected `name` field\n");
+        return false;
+    }
+    return true;
+}
+
+__BK_API bool load_dynamic_schema_loc(BkContext* bk, const char* file_name, const char* source_file, int source_line) {
+    String source = {0}; // alloc
+    DynamicSchema s = {0};
+    if (!parse_dynamic_schema_loc(bk, file_name, &s, &source, source_file, source_line)) {
+        if (source.items != NULL) free(source.items);
+        return false;
+    }
+    s.file_name = strdup(file_name); // alloc
+    push_da(&bk->dynamic_schemas, s);
+    push_da(&bk->dynamic_source, source);
+    return true;    
+}
+
+__BK_API bool reload_dynamic_schema(BkContext* bk, size_t index) {
+    DynamicSchema* schema = bk->dynamic_schemas.items + index;
+    String source = {0}; // alloc
+    DynamicSchema s = {0};
+    if (!parse_dynamic_schema_loc(bk, schema->file_name, &s, &source, __FILE__, __LINE__)) {
+        if (source.items != NULL) free(source.items);
+        return false;
+    }
+    s.file_name = schema->file_name;
+    if (schema->ops.items != NULL) free(schema->ops.items);
+    *schema = s;
+    // `bk->dynamic_source` and `bk->dynamic_schemas` are pushed together so they share indices
+    free(bk->dynamic_source.items[index].items);
+    bk->dynamic_source.items[index] = source;
+    return true;
+}
+
+__BK_API bool borrow_dynamic_schema(BkContext* bk, BkContext* owner, const char* file_name) {
+    size_t index = 0;
+    while (index < owner->dynamic_schemas.len && strcmp(owner->dynamic_schemas.items[index].file_name, file_name) != 0) index += 1;
+    if (index == owner->dynamic_schemas.len && !load_dynamic_schema(owner, file_name)) return false;
+    push_da(&bk->dynamic_schemas, owner->dynamic_schemas.items[index]);
+    return true;
+}
+
+__BK_API bool load_plugin(BkContext* bk, const char* file_name) {
+    #ifdef BK_PLUGINS
+    void* handle = dlopen(file_name, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL) {
+        bk_log(LOG_ERROR, "Couldn't load plugin '%s': %s\n", file_name, dlerror());
+        return false;
+    }
+    const BkPluginAbi* abi = dlsym(handle, "bk_plugin_abi");
+    BkPluginRegister register_fn = (BkPluginRegister)dlsym(handle, "bk_plugin_register");
+    if (abi == NULL || register_fn == NULL) {
+        bk_log(LOG_ERROR, "'%s' isn't a bookkeeper plugin, it doesn't export `bk_plugin_abi` and `bk_plugin_register`\n", file_name);
+        dlclose(handle);
+        return false;
+    }
+    if (abi->version != BK_PLUGIN_ABI_VERSION || abi->context_size != sizeof(BkContext) || abi->compound_size != sizeof(CCompound) || abi->schema_size != sizeof(StaticSchema)) {
+        bk_log(LOG_ERROR, "Plugin '%s' was built against a different extension header (plugin ABI version %u, expected %u), rebuild it with the output of `--gen-ext`\n", file_name, abi->version, BK_PLUGIN_ABI_VERSION);
+        dlclose(handle);
+        return false;
+    }
+    size_t count = 0;
+    const StaticSchema* schemas = register_fn(&count);
+    for (size_t i = 0; i < count; ++i) {
+        bool valid = schemas[i].name != NULL && schemas[i].derive_attr != NULL;
+        for (size_t j = 0; valid && j < bk->schemas.len; ++j) {
+            if (strcmp(schemas[i].name, bk->schemas.items[j].name) == 0) valid = false;
+        }
+        for (size_t j = 0; valid && j < i; ++j) {
+            if (strcmp(schemas[i].name, schemas[j].name) == 0) valid = false;
+        }
+        if (!valid) {
+            bk_log(LOG_ERROR, "Plugin '%s' defines a schema without a name or derive attribute, or with the name of an existing schema ('%s')\n", file_name, schemas[i].name ? schemas[i].name : "");
+            dlclose(handle);
+            return false;
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        bk_log(LOG_INFO, "Loading static schema '%s' with derive attribute '%s' from plugin '%s'\n", schemas[i].name, schemas[i].derive_attr, file_name);
+        push_da(&bk->schemas, schemas[i]);
+    }
+    Plugin plugin = {.handle = handle, .file_name = strdup(file_name)}; // alloc
+    push_da(&bk->plugins, plugin);
+    return true;
+    #else
+    bk_log(LOG_ERROR, "Plugins aren't supported on this platform, couldn't load '%s'.\n", file_name);
+    return false;
+    #endif // BK_PLUGINS
+}
+
+__BK_API void gen_derives_header(BkContext* bk, String* book_buf) {
+    print_lit(book_buf, "#ifndef __DERIVES_H__\n");
+    print_lit(book_buf, "#define __DERIVES_H__\n");
+    print_lit(book_buf, "#define tag(s)\n");
+    print_lit(book_buf, "#define derive_all(...)\n");
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        print_string(book_buf, "#define %s(...)\n", bk->schemas.items[i].derive_attr);
+    }
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        print_string(book_buf, "#define "SV_FMT"(...)\n", SV_ARG(bk->dynamic_schemas.items[i].derive_attr));
+    }
+    print_lit(book_buf, "#endif // __DERIVES_H__\n");
+}
+
+__BK_API bool write_derives_header(BkContext* bk, String* book_buf) {
+    if (bk->conf.output_dir == NULL) return true;
+    book_buf->len = 0;
+    gen_derives_header(bk, book_buf);
+    char* out_file = tfmt("%s/derives.h", bk->conf.output_dir);
+    if (!write_entire_file(bk, out_file, book_buf)) return false;
+    if (bk->conf.depfiles) return write_depfile(bk, out_file, NULL, 0, book_buf);
+    return true;
+}
+
+/// Appends `path` to `dst`, escaped for Make and Ninja depfiles
+static void print_depfile_path(String* dst, const char* path) {
+    for (const char* c = path; *c; ++c) {
+        if (*c == ' ' || *c == '#') push_da(dst, '\\');
+        else if (*c == '$') push_da(dst, '$');
+        push_da(dst, *c);
+    }
+}
+
+__BK_API void print_depfile_rule(BkContext* bk, String* dst, const char* target, Entry* entries, size_t entries_len) {
+    print_depfile_path(dst, target);
+    push_da(dst, ':');
+    for (size_t i = 0; i < entries_len; ++i) {
+        push_da(dst, ' ');
+        print_depfile_path(dst, entries[i].full);
+    }
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        push_da(dst, ' ');
+        print_depfile_path(dst, bk->dynamic_schemas.items[i].file_name);
+    }
+    for (size_t i = 0; i < bk->plugins.len; ++i) {
+        push_da(dst, ' ');
+        print_depfile_path(dst, bk->plugins.items[i].file_name);
+    }
+    if (bk->config_file != NULL) {
+        push_da(dst, ' ');
+        print_depfile_path(dst, bk->config_file);
+    }
+    push_da(dst, '\n');
+}
+
+__BK_API bool write_depfile(BkContext* bk, const char* out_file, Entry* entries, size_t entries_len, String* buf) {
+    size_t len = strlen(out_file);
+    char* dep_name = malloc(len + 3); // alloc
+    memcpy(dep_name, out_file, len);
+    memcpy(dep_name + len, ".d", 3);
+    buf->len = 0;
+    print_depfile_rule(bk, buf, out_file, entries, entries_len);
+    bool ok = write_entire_file(bk, dep_name, buf);
+    free(dep_name);
+    return ok;
+}
 
-    bk.conf.output_mode = "mirror";
-    bk.conf.gen_fmt_macro = "BK_FMT";
-    bk.conf.gen_implementation_macro = "BK_IMPLEMENTATION";
-    bk.conf.gen_fmt_dst_macro = "BK_FMT_DST_t";
-    // bk.conf.disable_dump_macro = "BK_DISABLE_DUMP";
-    // bk.conf.disable_parse_macro = "BK_DISABLE_PARSE";
-    bk.conf.offset_type_macro = "BK_OFFSET_t";
-    bk.conf.disable_macro_prefix = "BK_DISABLE_";
-    bk.conf.enable_macro_prefix = "BK_ENABLE_";
-
-    bk.conf.generics = false;
-    bk.conf.silent = false;
-    bk.conf.verbose = false;
-    bk.conf.warn_no_include = false;
-    bk.conf.warn_no_output = true;
-    bk.conf.warn_unknown_attr = true;
-    bk.conf.derive_all = false;
-    bk.conf.watch_mode = false;
-    bk.conf.watch_delay = 5;
-    bk.conf.include_dir = NULL;
-    bk.conf.output_dir = NULL;
+#ifdef BK_WATCH_INOTIFY
+#define BK_WATCH_MASK (IN_CLOSE_WRITE | IN_MOVED_TO)
+
+/// Adds a watch for the directory that contains `file_name`, `base` is set to the last part of `file_name`
+static int watcher_add_parent(BkContext* bk, Watcher* w, const char* file_name, const char** base) {
+    const char* slash = strrchr(file_name, '/');
+    int wd = -1;
+    if (slash == NULL) {
+        wd = inotify_add_watch(w->fd, ".", BK_WATCH_MASK);
+        *base = file_name;
+    } else if (slash == file_name) {
+        wd = inotify_add_watch(w->fd, "/", BK_WATCH_MASK);
+        *base = slash + 1;
+    } else {
+        wd = inotify_add_watch(w->fd, tfmt("%.*s", (int)(slash - file_name), file_name), BK_WATCH_MASK);
+        *base = slash + 1;
+    }
+    if (wd < 0) bk_log(LOG_ERROR, "Couldn't watch the directory of '%s': %s\n", file_name, strerror(errno));
+    return wd;
+}
 
-    #ifdef DEBUG
-    bk.conf.silent = true;
-    #endif // DEBUG
+__BK_API bool watcher_add_entry(BkContext* bk, Watcher* w, size_t entry_index) {
+    const char* base = NULL;
+    int wd = watcher_add_parent(bk, w, bk->entries.items[entry_index].full, &base);
+    if (wd < 0) return false;
+    WatchTarget target = {
+        .kind = WATCH_ENTRY,
+        .wd = wd,
+        .base = strdup(base), // alloc
+        .index = entry_index,
+    };
+    push_da(&w->targets, target);
+    return true;
+}
 
-    int config_cmd_index = -1;
-    for (size_t i = 0; i < commands_count; ++i) {
-        if (strcmp(commands[i].name, "config-path") == 0) {
-            config_cmd_index = (int)i;
+__BK_API bool watcher_init(BkContext* bk, Watcher* w) {
+    w->fd = inotify_init1(IN_CLOEXEC);
+    if (w->fd < 0) return false;
+
+    for (size_t i = 0; i < bk->entries.len; ++i) watcher_add_entry(bk, w, i);
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        const char* base = NULL;
+        int wd = watcher_add_parent(bk, w, bk->dynamic_schemas.items[i].file_name, &base);
+        if (wd < 0) continue;
+        WatchTarget target = {
+            .kind = WATCH_SCHEMA,
+            .wd = wd,
+            .base = strdup(base), // alloc
+            .index = i,
+        };
+        push_da(&w->targets, target);
+    }
+    for (size_t i = 0; i < bk->include_dirs.len; ++i) {
+        int wd = inotify_add_watch(w->fd, bk->include_dirs.items[i], BK_WATCH_MASK);
+        if (wd >= 0) {
+            WatchTarget target = {
+                .kind = WATCH_INCLUDE_DIR,
+                .wd = wd,
+                .base = NULL,
+                .index = i,
+            };
+            push_da(&w->targets, target);
+        } else {
+            bk_log(LOG_ERROR, "Couldn't watch directory '%s': %s\n", bk->include_dirs.items[i], strerror(errno));
         }
     }
-    if (config_cmd_index < 0) abort();
+    // inotify returns the same watch descriptor for the same directory, so this is also how we
+    // recognize generated files that are placed inside a watched directory
+    if (bk->conf.output_dir != NULL) w->output_wd = inotify_add_watch(w->fd, bk->conf.output_dir, BK_WATCH_MASK);
+    return true;
+}
 
-    bool custom_config = false;
-    // NOTE: Assumes that `argv` lives long enough
-    for (int i = 1; i < argc; ++i) {
-        if (strcmp(commands[config_cmd_index].flag, argv[i]) == 0) {
-            if (!exec_cmd(&commands[config_cmd_index])) return 1;
-            custom_config = true;
+/// Applies a single inotify event to the watched entries and schemas
+static void watcher_handle_event(BkContext* bk, Watcher* w, const struct inotify_event* ev, bool* schemas_changed) {
+    if (ev->mask & IN_Q_OVERFLOW) {
+        // We lost track of events, just consider everything modified
+        for (size_t i = 0; i < bk->entries.len; ++i) bk->entries.items[i].last_analyzed = 0;
+        return;
+    }
+    if (ev->len == 0) return;
+    if (ev->wd == w->output_wd && (strcmp(ev->name, "derives.h") == 0 || strcmp(ev->name, "generics.h") == 0)) return;
+
+    bool matched = false;
+    for (size_t i = 0; i < w->targets.len; ++i) {
+        WatchTarget* target = w->targets.items + i;
+        if (target->wd != ev->wd || target->base == NULL || strcmp(target->base, ev->name) != 0) continue;
+        matched = true;
+        switch (target->kind) {
+        case WATCH_ENTRY: {
+            Entry* e = bk->entries.items + target->index;
+            e->sys_modif = time(NULL);
+            e->last_analyzed = 0;
+        } break;
+        case WATCH_SCHEMA: {
+            bk_log(LOG_INFO, "Reloading dynamic schema: %s\n", bk->dynamic_schemas.items[target->index].file_name);
+            if (reload_dynamic_schema(bk, target->index)) *schemas_changed = true;
+        } break;
+        case WATCH_INCLUDE_DIR: break;
+        }
+    }
+    if (matched) return;
+
+    for (size_t i = 0; i < w->targets.len; ++i) {
+        WatchTarget* target = w->targets.items + i;
+        if (target->kind == WATCH_INCLUDE_DIR && target->wd == ev->wd && is_source_file_name(ev->name)) {
+            Entry e = {0};
+            entry_from_include_dir(bk, bk->include_dirs.items[target->index], ev->name, &e); // alloc
+            bk_log(LOG_INFO, "Found new file: %s\n", e.full);
+            push_da(&bk->entries, e);
+            watcher_add_entry(bk, w, bk->entries.len - 1);
             break;
         }
     }
+}
 
-    bool found_config = false;
-    {
-        FILE* conf_file = fopen(config_path, "rb");
-        if (conf_file) {
-            fclose(conf_file);
-            String conf_contents = {0};
-            if (read_entire_file(config_path, &conf_contents)) {
-                found_config = true;
-                parse_bkconf_BkConfig(conf_contents.items, conf_contents.len, &bk.conf);
-            }
-        } else if (custom_config) {
-            bk_log(LOG_ERROR, "Couldn't open file '%s': %s\n", config_path, strerror(errno));
-            ret_clean(1);
+__BK_API bool watcher_wait(BkContext* bk, Watcher* w, bool* schemas_changed) {
+    _Alignas(struct inotify_event) char buf[4096];
+    // Block indefinitely until the first event, then keep reading until the debounce window passes without any events
+    int timeout = -1;
+    for (;;) {
+        struct pollfd pfd = {.fd = w->fd, .events = POLLIN};
+        int ready = poll(&pfd, 1, timeout);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            bk_log(LOG_ERROR, "Couldn't wait for file events: %s\n", strerror(errno));
+            return false;
+        }
+        if (ready == 0) break;
+
+        ssize_t n = read(w->fd, buf, sizeof buf);
+        if (n < 0) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            bk_log(LOG_ERROR, "Couldn't read file events: %s\n", strerror(errno));
+            return false;
         }
+        for (char* p = buf; p < buf + n;) {
+            const struct inotify_event* ev = (const struct inotify_event*)p;
+            watcher_handle_event(bk, w, ev, schemas_changed);
+            p += sizeof(struct inotify_event) + ev->len;
+        }
+        timeout = (int)bk->conf.watch_debounce;
+    }
+    if (*schemas_changed) {
+        // Any type might derive a reloaded schema
+        for (size_t i = 0; i < bk->entries.len; ++i) bk->entries.items[i].last_analyzed = 0;
     }
+    return true;
+}
 
-    if (argc <= 1 && !found_config) {
-        bk_printf("Basic usage: %s -I <include-directory> -o <output-directory>\n", argv[0]);
-        bk_printf("Use `-h` to print all available commands, `-h <command-name>` to see that command's usage.\n");
-        ret_clean(0);
+__BK_API void free_watcher(Watcher* w) {
+    for (size_t i = 0; i < w->targets.len; ++i) free(w->targets.items[i].base);
+    if (w->targets.items != NULL) free(w->targets.items);
+    if (w->fd >= 0) close(w->fd);
+}
+#endif // BK_WATCH_INOTIFY
+
+#ifdef BK_DAEMON
+static volatile sig_atomic_t daemon_stop_requested = 0;
+
+static void daemon_handle_signal(int sig) {
+    (void)sig;
+    daemon_stop_requested = 1;
+}
+
+static bool write_all(int fd, const char* data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        len -= (size_t)n;
     }
+    return true;
+}
 
-    // NOTE: Assumes that `argv` lives long enough
-    for (int i = 1; i < argc; ++i) {
-        for (size_t j = 0; j < commands_count; ++j) {
-            if (strcmp(commands[j].flag, argv[i]) == 0) {
-                if (!exec_cmd(&commands[j])) {
-                    ret_clean(1);
-                }
-            }
+/// Fills `addr` with `socket_path`, fails if the path doesn't fit
+static bool daemon_address(BkContext* bk, const char* socket_path, struct sockaddr_un* addr) {
+    memset(addr, 0, sizeof *addr);
+    addr->sun_family = AF_UNIX;
+    size_t len = strlen(socket_path);
+    if (len >= sizeof addr->sun_path) {
+        bk_log(LOG_ERROR, "Socket path '%s' is too long.\n", socket_path);
+        return false;
+    }
+    memcpy(addr->sun_path, socket_path, len + 1);
+    return true;
+}
+
+__BK_API bool daemon_init(BkContext* bk, Daemon* d, const char* socket_path) {
+    struct sockaddr_un addr;
+    if (!daemon_address(bk, socket_path, &addr)) return false;
+
+    d->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (d->fd < 0) {
+        bk_log(LOG_ERROR, "Couldn't create socket: %s\n", strerror(errno));
+        return false;
+    }
+    // Only a socket left behind by an earlier daemon is removed, any other file at `socket_path` is kept
+    struct stat st = {0};
+    if (lstat(socket_path, &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            bk_log(LOG_ERROR, "Couldn't listen on socket '%s': The file exists and isn't a socket\n", socket_path);
+            close(d->fd);
+            d->fd = -1;
+            return false;
         }
+        unlink(socket_path);
     }
-   
-    if (bk.conf.include_files != NULL) {
-        size_t list_len = strlen(bk.conf.include_files);
-        if (list_len == 0) {
-            bk_log(LOG_ERROR, "Include file list in '%s' is empty.\n", config_path);
-            ret_clean(1);
+    if (bind(d->fd, (struct sockaddr*)&addr, sizeof addr) < 0 || listen(d->fd, SOMAXCONN) < 0) {
+        bk_log(LOG_ERROR, "Couldn't listen on socket '%s': %s\n", socket_path, strerror(errno));
+        close(d->fd);
+        d->fd = -1;
+        return false;
+    }
+    d->socket_path = socket_path;
+
+    // No SA_RESTART, `accept` has to return when a signal arrives
+    struct sigaction sa = {0};
+    sa.sa_handler = daemon_handle_signal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    // Clients that disconnect early shouldn't kill the daemon
+    signal(SIGPIPE, SIG_IGN);
+    return true;
+}
+
+/// Marks the entry with the resolved path `real` for analysis, appending a new entry if needed
+static bool daemon_mark_entry(BkContext* bk, Daemon* d, const char* real) {
+    while (d->real_paths.len < bk->entries.len) {
+        const char* full = bk->entries.items[d->real_paths.len].full;
+        char* resolved = bk_realpath(full); // alloc
+        push_da(&d->real_paths, resolved ? resolved : strdup(full));
+    }
+    for (size_t i = 0; i < d->real_paths.len; ++i) {
+        if (strcmp(d->real_paths.items[i], real) == 0) {
+            bk->entries.items[i].last_analyzed = 0;
+            return true;
         }
-        if (bk.conf.include_files[0] == ',') {
-            bk_log(LOG_ERROR, "Include file list in '%s' starts with comma (',')\n", config_path);
-            ret_clean(1);
+    }
+    Entry e = {0};
+    // New files inside include directories are named the same way discovered files are
+    bool found = false;
+    const char* slash = strrchr(real, '/');
+    for (size_t i = 0; i < bk->include_dirs.len && !found && slash != NULL && is_source_file_name(slash + 1); ++i) {
+        char* include_dir = bk_realpath(bk->include_dirs.items[i]); // alloc
+        if (include_dir == NULL) continue;
+        size_t dir_len = strlen(include_dir);
+        if (strncmp(real, include_dir, dir_len) == 0 && real[dir_len] == '/') {
+            entry_from_include_dir(bk, bk->include_dirs.items[i], real + dir_len + 1, &e); // alloc
+            found = true;
         }
-        char* cursor = bk.conf.include_files;
-        size_t entry_len = 0;
+        free(include_dir);
+    }
+    if (!found && !entry_from_file(bk, real, &e)) return false; // alloc
+    push_da(&bk->entries, e);
+    push_da(&d->real_paths, strdup(real));
+    return true;
+}
 
-        for (char* ent; (ent = parse_list(&cursor, ',', &entry_len));) {
-            Entry e = {0};
-            if (!entry_from_file(tfmt("%.*s", (int)entry_len, ent), &e)) {
-                ret_clean(1);
-            }
-            push_da(&bk.entries, e);
+__BK_API bool daemon_wait(BkContext* bk, Daemon* d) {
+    String request = {0};
+    bool ok = false;
+    while (!daemon_stop_requested) {
+        d->client = accept(d->fd, NULL, NULL);
+        if (d->client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            bk_log(LOG_ERROR, "Couldn't accept connection: %s\n", strerror(errno));
+            break;
         }
-    }
 
-    if (bk.conf.schema_files != NULL) {
-        size_t list_len = strlen(bk.conf.schema_files);
-        if (list_len == 0) {
-            bk_log(LOG_ERROR, "Schema file list in '%s' is empty.\n", config_path);
-            ret_clean(1);
+        request.len = 0;
+        char buf[4096];
+        ssize_t n = 0;
+        while ((n = read(d->client, buf, sizeof buf)) != 0) {
+            if (n < 0) {
+                if (errno == EINTR && !daemon_stop_requested) continue;
+                break;
+            }
+            for (ssize_t i = 0; i < n; ++i) push_da(&request, buf[i]);
         }
-        if (bk.conf.schema_files[0] == ',') {
-            bk_log(LOG_ERROR, "Schema file list in '%s' starts with comma (',')\n", config_path);
-            ret_clean(1);
+        if (n < 0) {
+            bk_log(LOG_ERROR, "Couldn't read request: %s\n", strerror(errno));
+            close(d->client);
+            d->client = -1;
+            continue;
         }
-        char* cursor = bk.conf.schema_files;
-        size_t entry_len = 0;
+        push_da(&request, '\0');
 
-        for (char* ent; (ent = parse_list(&cursor, ',', &entry_len));) {
-            if (!load_dynamic_schema(tfmt("%.*s", (int)entry_len, ent))) {
-                ret_clean(1);
+        ok = true;
+        if (request.len <= 1) {
+            for (size_t i = 0; i < bk->entries.len; ++i) bk->entries.items[i].last_analyzed = 0;
+        } else {
+            for (char* path = request.items; *path;) {
+                char* end = strchr(path, '\n');
+                if (end != NULL) *end = '\0';
+                if (*path && !daemon_mark_entry(bk, d, path)) ok = false;
+                if (end == NULL) break;
+                path = end + 1;
             }
         }
+        if (ok) break;
+        daemon_reply(d, false);
+    }
+    if (request.items != NULL) free(request.items);
+    return ok && !daemon_stop_requested;
+}
+
+__BK_API void daemon_reply(Daemon* d, bool ok) {
+    if (d->client < 0) return;
+    const char* reply = ok ? "ok\n" : "error\n";
+    write_all(d->client, reply, strlen(reply));
+    close(d->client);
+    d->client = -1;
+}
+
+__BK_API bool daemon_stopped(void) {
+    return daemon_stop_requested != 0;
+}
+
+__BK_API void free_daemon(Daemon* d) {
+    if (d->client >= 0) close(d->client);
+    if (d->fd >= 0) {
+        close(d->fd);
+        if (d->socket_path != NULL) unlink(d->socket_path);
     }
+    for (size_t i = 0; i < d->real_paths.len; ++i) free(d->real_paths.items[i]);
+    if (d->real_paths.items != NULL) free(d->real_paths.items);
+}
 
+__BK_API bool daemon_request(BkContext* bk, const char* socket_path) {
+    struct sockaddr_un addr;
+    if (!daemon_address(bk, socket_path, &addr)) return false;
 
-    if (bk.conf.include_dir == NULL && bk.entries.len == 0) {
-        if (bk.conf.warn_no_include) bk_log(LOG_WARN, "No files were included. [-W "WARN_NO_INCLUDE"]\n");
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof addr) < 0) {
+        bk_log(LOG_ERROR, "Couldn't connect to daemon at '%s': %s\n", socket_path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return false;
     }
-    if (bk.conf.output_dir == NULL) {
-        if (bk.conf.warn_no_output) bk_log(LOG_WARN, "No output path set. [-W "WARN_NO_OUTPUT"]\n");
+    bool ok = true;
+    for (size_t i = 0; ok && i < bk->entries.len; ++i) {
+        const char* full = bk->entries.items[i].full;
+        ok = write_all(fd, full, strlen(full)) && write_all(fd, "\n", 1);
     }
-    
-    {
-        if (bk.conf.include_dir != NULL) {
-            size_t in_len = strlen(bk.conf.include_dir);
-            if (bk.conf.include_dir[in_len - 1] == '/') bk.conf.include_dir[in_len - 1] = 0;
-        }
-        if (bk.conf.output_dir != NULL) {
-            size_t out_len = strlen(bk.conf.output_dir);
-            if (bk.conf.output_dir[out_len - 1] == '/') bk.conf.output_dir[out_len - 1] = 0;
-        }
+    shutdown(fd, SHUT_WR);
+
+    char reply[16] = {0};
+    size_t reply_len = 0;
+    while (ok && reply_len < sizeof reply - 1) {
+        ssize_t n = read(fd, reply + reply_len, sizeof reply - 1 - reply_len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        reply_len += (size_t)n;
+    }
+    close(fd);
+    if (!ok || strncmp(reply, "ok\n", 3) != 0) {
+        bk_log(LOG_ERROR, "Daemon at '%s' failed to regenerate the requested files.\n", socket_path);
+        return false;
     }
+    return true;
+}
+#endif // BK_DAEMON
 
-    OutputMode output_mode;
-    if (strcmp(bk.conf.output_mode, "mirror") == 0) {
-        output_mode = O_MIRROR;
-    } else if (strcmp(bk.conf.output_mode, "dir") == 0) {
-        output_mode = O_DIR;
-    } else {
-        bk_printf("Unknown output mode '%s', exiting...\n", bk.conf.output_mode);
-        ret_clean(1);
+__BK_API char* output_file_path(BkContext* bk, Entry* e, OutputMode output_mode, String* dst) {
+    dst->len = 0;
+    switch (output_mode) {
+    case O_MIRROR: print_string(dst, "%s"BK_FILE_EXT, e->full); break;
+    case O_DIR: print_string(dst, "%s/%s"BK_FILE_EXT, bk->conf.output_dir, e->name); break;
     }
+    return dst->items;
+}
 
-    String book_buf = {0};
-    if (bk.conf.output_dir != NULL) {
-        print_string(&book_buf, "#ifndef __DERIVES_H__\n");
-        print_string(&book_buf, "#define __DERIVES_H__\n");
-        print_string(&book_buf, "#define tag(s)\n");
-        print_string(&book_buf, "#define derive_all(...)\n");
-        for (size_t i = 0; i < bk.schemas.len; ++i) {
-            print_string(&book_buf, "#define %s(...)\n", bk.schemas.items[i].derive_attr);
-        }
-        for (size_t i = 0; i < bk.dynamic_schemas.len; ++i) {
-            print_string(&book_buf, "#define "SV_FMT"(...)\n", SV_ARG(bk.dynamic_schemas.items[i].derive_attr));
-        }
-        print_string(&book_buf, "#endif // __DERIVES_H__\n");
-        write_entire_file(tfmt("%s/derives.h", bk.conf.output_dir), &book_buf);
+__BK_API void type_db_patch(TypeDatabase* db, size_t entry_index, CCompounds* types) {
+    while (db->len <= entry_index) {
+        CCompounds empty = {0};
+        push_da(db, empty);
     }
+    CCompounds* old = db->items + entry_index;
+    bool same_names = old->len == types->len;
+    for (size_t i = 0; same_names && i < types->len; ++i) {
+        same_names = strcmp(old->items[i].name, types->items[i].name) == 0;
+    }
+    if (!same_names) db->changed = true;
 
-    if (bk.conf.include_dir != NULL) {
-        DIR* input_dir = opendir(bk.conf.include_dir); // TODO: this is our main POSIX-dependent piece of code, perhaps write a cross-platform wrapper 
-        if (!input_dir) {
-            bk_log(LOG_ERROR, "Couldn't open directory '%s': %s\n", bk.conf.include_dir, strerror(errno));
-            ret_clean(1);
+    CCompounds prev = *old;
+    *old = *types;
+    *types = prev;
+    reset_ccompounds(types);
+}
+
+__BK_API void free_type_db(TypeDatabase* db) {
+    for (size_t i = 0; i < db->len; ++i) free_ccompounds(db->items + i);
+    if (db->items != NULL) free(db->items);
+}
+
+__BK_API unsigned long long fnv1a(const void* data, size_t len, unsigned long long hash) {
+    const unsigned char* bytes = data;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/// Hashes a (nullable) C string including its null terminator so consecutive strings can't run into each other
+static unsigned long long fnv1a_cstr(const char* s, unsigned long long hash) {
+    if (s == NULL) return fnv1a("", 1, hash);
+    return fnv1a(s, strlen(s) + 1, hash);
+}
+
+/// Hashes the identity of the running executable. Static schemas are compiled into it, so upgrading `bk` or rebuilding an
+/// executable with extensions changes the hash even if the names of its schemas stay the same.
+static unsigned long long executable_fingerprint(unsigned long long h) {
+    const char* exe = NULL;
+    #if defined(__linux__)
+    exe = "/proc/self/exe";
+    #elif defined(BK_PLUGINS)
+    Dl_info info = {0};
+    if (dladdr((void*)executable_fingerprint, &info) != 0) exe = info.dli_fname;
+    #endif
+    struct stat st = {0};
+    if (exe != NULL && stat(exe, &st) == 0) {
+        h = fnv1a(&st.st_ino, sizeof st.st_ino, h);
+        h = fnv1a(&st.st_mtime, sizeof st.st_mtime, h);
+        h = fnv1a(&st.st_size, sizeof st.st_size, h);
+    }
+    return h;
+}
+
+__BK_API unsigned long long config_fingerprint(BkContext* bk) {
+    unsigned long long h = FNV1A_INIT;
+    long version[] = {BK_CACHE_VERSION, BK_CODEGEN_VERSION};
+    h = fnv1a(version, sizeof version, h);
+    h = executable_fingerprint(h);
+    h = fnv1a_cstr(bk->conf.output_mode, h);
+    h = fnv1a_cstr(bk->conf.output_dir, h);
+    h = fnv1a_cstr(bk->conf.gen_fmt_macro, h);
+    h = fnv1a_cstr(bk->conf.gen_implementation_macro, h);
+    h = fnv1a_cstr(bk->conf.gen_fmt_dst_macro, h);
+    h = fnv1a_cstr(bk->conf.offset_type_macro, h);
+    h = fnv1a_cstr(bk->conf.disable_macro_prefix, h);
+    h = fnv1a_cstr(bk->conf.enable_macro_prefix, h);
+    bool flags[] = {bk->conf.disable_dump, bk->conf.disable_parse, bk->conf.disabled_by_default, bk->conf.derive_all, bk->conf.generics};
+    h = fnv1a(flags, sizeof flags, h);
+    h = fnv1a(bk->derive_schemas.items, bk->derive_schemas.len * sizeof *bk->derive_schemas.items, h);
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        h = fnv1a_cstr(bk->schemas.items[i].name, h);
+        h = fnv1a_cstr(bk->schemas.items[i].derive_attr, h);
+    }
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        DynamicSchema* schema = bk->dynamic_schemas.items + i;
+        h = fnv1a(schema->name.items, schema->name.len, h);
+        h = fnv1a(schema->derive_attr.items, schema->derive_attr.len, h);
+        h = fnv1a(schema->source.items, schema->source.len, h);
+    }
+    // The code of a plugin can change without any change to its schema names
+    for (size_t i = 0; i < bk->plugins.len; ++i) {
+        struct stat st = {0};
+        h = fnv1a_cstr(bk->plugins.items[i].file_name, h);
+        if (stat(bk->plugins.items[i].file_name, &st) == 0) {
+            h = fnv1a(&st.st_mtime, sizeof st.st_mtime, h);
+            h = fnv1a(&st.st_size, sizeof st.st_size, h);
         }
-        for (struct dirent* ent = readdir(input_dir); ent; ent = readdir(input_dir)) {
-            if (ent->d_type == DT_REG) {
-                size_t name_len = strlen(ent->d_name);
-                if (name_len > BK_FILE_EXT_LEN && strcmp(ent->d_name + name_len - BK_FILE_EXT_LEN, BK_FILE_EXT) == 0) continue;
-                if (name_len < 2) continue;
-                if (
-                    strcmp(ent->d_name + name_len - 2, ".c") == 0 ||
-                    strcmp(ent->d_name + name_len - 2, ".h") == 0
-                ) {
-                    char* in_file = fmt("%s/%s", bk.conf.include_dir, ent->d_name); // alloc
-                    struct stat s = {0};
-                    stat(in_file, &s);
-
-                    Entry e = {
-                        .full = in_file,
-                        .name = strdup(ent->d_name), // alloc
-                        #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
-                        .sys_modif = s.st_mtimespec.tv_sec,
-                        #else
-                        .sys_modif = s.st_mtim.tv_sec,
-                        #endif
-                        .last_analyzed = 0
-                    };
-                    push_da(&bk.entries, e);
-                }
-            }
+    }
+    return h;
+}
+
+/// Adds the last entry of the cache to its hash table, replacing an older entry with the same `full`
+static void index_cache_entry(AnalysisCache* cache) {
+    if (cache->len*2 > cache->table_cap) {
+        size_t cap = cache->table_cap ? cache->table_cap*2 : 256;
+        while (cache->len*2 > cap) cap *= 2;
+        size_t* table = calloc(cap, sizeof *table); // alloc
+        for (size_t i = 0; i < cache->table_cap; ++i) {
+            if (cache->table[i] == 0) continue;
+            size_t slot = fnv1a_cstr(cache->items[cache->table[i] - 1].full, FNV1A_INIT) & (cap - 1);
+            while (table[slot] != 0) slot = (slot + 1) & (cap - 1);
+            table[slot] = cache->table[i];
         }
-        closedir(input_dir);
+        free(cache->table);
+        cache->table = table;
+        cache->table_cap = cap;
+    }
+    const char* full = cache->items[cache->len - 1].full;
+    size_t slot = fnv1a_cstr(full, FNV1A_INIT) & (cache->table_cap - 1);
+    for (; cache->table[slot] != 0; slot = (slot + 1) & (cache->table_cap - 1)) {
+        if (strcmp(cache->items[cache->table[slot] - 1].full, full) == 0) break;
     }
+    cache->table[slot] = cache->len;
+}
 
-    if (bk.entries.len <= 0 || (output_mode == O_DIR && bk.conf.output_dir == NULL)) ret_clean(0);
+/// Reads a `<length>:<bytes>` string from the manifest, returns NULL on malformed input
+static bool cache_read_sv(String_View* cursor, String_View* out) {
+    *cursor = sv_trim_whitespace_start(*cursor);
+    char* end = NULL;
+    // The manifest buffer is always null terminated by `load_cache` so `strtoul` can't run off the end
+    unsigned long len = strtoul(cursor->items, &end, 10);
+    if (end == cursor->items || *end != ':') return false;
+    sv_chop2(cursor, (size_t)(end - cursor->items) + 1);
+    if (len > cursor->len) return false;
+    *out = sv_substr(*cursor, 0, len);
+    sv_chop2(cursor, len);
+    return true;
+}
 
-    size_t file_idx = 0;
-    book_buf.len = 0;
-    time_t current_iter = 0;
-    time_t t = 0;
-    // TODO: This is a very basic implementation of a watch mode and causes CPUs to spin for no reason
-    // might want to use something like `poll` to detect file events?
-    do {
-        t = time(NULL);
-        if (t - current_iter < (time_t)bk.conf.watch_delay) continue;
-        current_iter = t;
-        for (size_t i = 0; i < all_types.len; ++i) free_ccompund(all_types.items[i]);
-        all_types.len = 0;
-        for (size_t e_i = 0; e_i < bk.entries.len; ++e_i) {
-            Entry* in_file = bk.entries.items + e_i;
-            {
-                struct stat s = {0};
-                stat(in_file->full, &s);
-                #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
-                in_file->sys_modif = s.st_mtimespec.tv_sec;
-                #else
-                in_file->sys_modif = s.st_mtim.tv_sec;
-                #endif
+static char* cache_read_str(String_View* cursor) {
+    String_View s;
+    if (!cache_read_sv(cursor, &s)) return NULL;
+    return sv_to_cstr(s); // alloc
+}
+
+/// Reads a length prefixed string from the manifest and interns it into `names`
+static const char* cache_read_name(String_View* cursor, Interner* names) {
+    String_View s;
+    if (!cache_read_sv(cursor, &s)) return NULL;
+    unsigned id = intern(names, s.items, s.len);
+    return interned_string(names, id);
+}
+
+/// Reads an integer from the manifest, returns false on malformed input
+static bool cache_read_int(String_View* cursor, int base, unsigned long long* out) {
+    *cursor = sv_trim_whitespace_start(*cursor);
+    char* end = NULL;
+    bool negative = cursor->len > 0 && cursor->items[0] == '-';
+    if (negative) sv_chop2(cursor, 1);
+    *out = strtoull(cursor->items, &end, base);
+    if (end == cursor->items) return false;
+    if (negative) *out = -*out;
+    sv_chop2(cursor, (size_t)(end - cursor->items));
+    return true;
+}
+
+static bool cache_expect(String_View* cursor, const char* word) {
+    *cursor = sv_trim_whitespace_start(*cursor);
+    return sv_chop_if_prefix(cursor, sv(word));
+}
+
+__BK_API void load_cache(BkContext* bk, AnalysisCache* cache, const char* file_name) {
+    FILE* f = fopen(file_name, "rb");
+    if (f == NULL) return;
+    fclose(f);
+
+    String contents = {0}; // alloc
+    if (!read_entire_file(bk, file_name, &contents)) return;
+    push_da(&contents, 0);
+    String_View cursor = sv_from_parts(contents.items, contents.len - 1);
+
+    unsigned long long version = 0;
+    unsigned long long fingerprint = 0;
+    if (
+        !cache_expect(&cursor, "bkcache") ||
+        !cache_read_int(&cursor, 10, &version) ||
+        !cache_read_int(&cursor, 16, &fingerprint) ||
+        version != BK_CACHE_VERSION ||
+        fingerprint != cache->fingerprint
+    ) {
+        bk_log(LOG_INFO, "Ignoring outdated cache '%s'\n", file_name);
+        free(contents.items);
+        return;
+    }
+
+    // Fields and schemas of a type are collected here before they are copied into the arena of the cache entry
+    Fields fields = {0};
+    DeriveSet derived = {0};
+    while (cache_expect(&cursor, "e")) {
+        CacheEntry ce = {0};
+        unsigned long long file_idx, types_len;
+        ce.full = cache_read_str(&cursor); // alloc
+        if (
+            ce.full == NULL ||
+            !cache_read_int(&cursor, 16, &ce.hash) ||
+            !cache_read_int(&cursor, 10, &file_idx) ||
+            !cache_read_int(&cursor, 10, &types_len)
+        ) goto __malformed;
+        ce.file_idx = (long)file_idx;
+        for (size_t i = 0; i < types_len; ++i) {
+            CCompound cc = {0};
+            unsigned long long words_len, fields_len;
+            if (!cache_expect(&cursor, "t") || (cc.name = cache_read_name(&cursor, &ce.types.names)) == NULL) goto __malformed;
+            if (!cache_read_int(&cursor, 10, &words_len)) goto __malformed;
+            derived.len = 0;
+            for (size_t j = 0; j < words_len; ++j) {
+                unsigned long long word;
+                if (!cache_read_int(&cursor, 16, &word)) goto __malformed;
+                push_da(&derived, word);
             }
-            if (in_file->sys_modif > in_file->last_analyzed) {
-                unsigned long in_hash = djb2(in_file->full);
-                bk_log(LOG_INFO, "Analyzing file: %s\n", in_file->name);
-                file_buf.len = 0;
-                if (!read_entire_file(in_file->full, &file_buf)) continue;
-
-                types.len = 0;
-                analyze_file(in_file->name, file_buf, &types, bk.conf.derive_all);
-                bk_log(LOG_INFO, "Analayzed %lu type(s).\n", types.len);
-                for (size_t i = 0; i < types.len; ++i) {
-                    push_da(&all_types, types.items[i]);
-                };
-                book_buf.len = 0;
-                current_iter = time(NULL);
-                in_file->last_analyzed = current_iter;
-                if (types.len > 0) {
-                    print_string(&book_buf, "#ifndef __BK_%lu_%lu_H__ // Generated from: %s\n", in_hash, file_idx, in_file->full);
-                    print_string(&book_buf, "#define __BK_%lu_%lu_H__\n", in_hash, file_idx);
-                    print_string(&book_buf, "#ifndef %s\n", bk.conf.gen_fmt_dst_macro);
-                    print_string(&book_buf, "#define %s FILE*\n", bk.conf.gen_fmt_dst_macro);
-                    print_string(&book_buf, "#endif // %s\n", bk.conf.gen_fmt_dst_macro);
-                    print_string(&book_buf, "#ifndef %s\n", bk.conf.gen_fmt_macro);
-                    print_string(&book_buf, "#define %s(...) offset += fprintf(dst, __VA_ARGS__)\n", bk.conf.gen_fmt_macro);
-                    print_string(&book_buf, "#endif // %s\n", bk.conf.gen_fmt_macro);
-                    print_string(&book_buf, "#ifndef %s\n", bk.conf.offset_type_macro);
-                    print_string(&book_buf, "#define %s size_t\n", bk.conf.offset_type_macro);
-                    print_string(&book_buf, "#endif // %s\n", bk.conf.offset_type_macro);
-                    size_t num_decls = 0;
-                    size_t len_before_decls = book_buf.len;
-                    for (size_t i = 0; i < types.len; ++i) {
-                        gen_prelude(&book_buf, types.items + i);
-                        if (!bk.conf.disable_dump) {
-                            num_decls += gen_dump_decl(&book_buf, types.items + i, bk.conf.gen_fmt_dst_macro);
-                        }
-                        if (!bk.conf.disable_parse) {
-                            num_decls += gen_parse_decl(&book_buf, types.items + i);
-                        }
-                    }
-                    if (num_decls > 0 || bk.dynamic_schemas.len > 0) {
-                        if (num_decls > 0) {
-                            print_string(&book_buf, "\n#ifdef %s\n", bk.conf.gen_implementation_macro);
-                            for (size_t i = 0; i < types.len; ++i) {
-                                if (!bk.conf.disable_dump) {
-                                    gen_dump_impl(&book_buf, types.items + i, bk.conf.gen_fmt_dst_macro, bk.conf.gen_fmt_macro);
-                                }
-                                if (!bk.conf.disable_parse) {
-                                    gen_parse_impl(&book_buf, types.items + i);
-                                }
-                                print_string(&book_buf, "\n#define ___BK_INCLUDE_TYPE_%s\n", types.items[i].name);
-                            }
-                            print_string(&book_buf, "\n#endif // %s\n", bk.conf.gen_implementation_macro);
-                        } else {
-                            book_buf.len = len_before_decls;
-                        }
-                        for (size_t i = 0; i < types.len; ++i) {
-                            gen_dynamic(&book_buf, types.items + i, bk.conf.gen_fmt_dst_macro, bk.conf.gen_fmt_macro);
-                        }
-
-                        push_da(&book_buf, '\n');
-                        print_string(&book_buf, "#endif // __BK_%lu_%lu_H__\n", in_hash, file_idx);
-                        char* out_file = NULL;
-                        switch (output_mode) {
-                        case O_MIRROR: {
-                            out_file = tfmt("%s"BK_FILE_EXT, in_file->full);
-                        } break;
-                        case O_DIR: {
-                            out_file = tfmt("%s/%s"BK_FILE_EXT, bk.conf.output_dir, in_file->name);
-                        } break;
-                        }
-                        if (out_file) write_entire_file(out_file, &book_buf);
-                        file_idx += 1; // increment index counter even if write_entire_file errors just to be safe
-                    }
+            if (!cache_read_int(&cursor, 10, &fields_len)) goto __malformed;
+            fields.len = 0;
+            for (size_t j = 0; j < fields_len; ++j) {
+                Field field = {0};
+                unsigned long long kind, prim = 0;
+                if (!cache_expect(&cursor, "f") || (field.name = cache_read_name(&cursor, &ce.types.names)) == NULL) goto __malformed;
+                if (cache_expect(&cursor, "-")) {
+                    field.tag = NULL;
+                } else if ((field.tag = cache_read_name(&cursor, &ce.types.names)) == NULL) {
+                    goto __malformed;
                 }
-            }
-        }
-        if (bk.conf.generics) {
-            book_buf.len = 0;
-            // print_string(&book_buf, "#ifndef __GENERICS_H__\n");
-            // print_string(&book_buf, "#define __GENERICS_H__\n");
-            for (size_t i = 0; i < all_types.len; ++i) {
-                const char* t_name = all_types.items[i].name;
-                print_string(&book_buf, "#ifdef ___BK_IF_TYPE_%s\n", t_name);
-                print_string(&book_buf, "#undef ___BK_IF_TYPE_%s\n", t_name);
-                print_string(&book_buf, "#endif // ___BK_IF_TYPE_%s\n", t_name);
-                print_string(&book_buf, "#ifdef ___BK_INCLUDE_TYPE_%s\n", t_name);
-                print_string(&book_buf, "#define ___BK_IF_TYPE_%s(x) x,\n", t_name);
-                print_string(&book_buf, "#else // ___BK_INCLUDE_TYPE_%s\n", t_name);
-                print_string(&book_buf, "#define ___BK_IF_TYPE_%s(x)\n", t_name);
-                print_string(&book_buf, "#endif // ___BK_INCLUDE_TYPE_%s\n", t_name);
-            }
-            for (size_t i = 0; i < bk.schemas.len; ++i) {
-                const char* s_name = bk.schemas.items[i].name;
-
-                // dump guard start
-                if (bk.conf.disabled_by_default) {
-                    print_string(&book_buf, "#if defined(%s"BK_DUMP_UPPER") || defined(%s%s) || defined(%s%s_"BK_DUMP_UPPER")\n",
-                                 bk.conf.enable_macro_prefix,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name
-                    );
+                if (!cache_read_int(&cursor, 10, &kind)) goto __malformed;
+                field.type.kind = (CType_Kind)kind;
+                if (field.type.kind == CEXTERNAL) {
+                    if ((field.type.name = cache_read_name(&cursor, &ce.types.names)) == NULL) goto __malformed;
+                } else if (cache_read_int(&cursor, 10, &prim)) {
+                    field.type.type = (CPrimitive)prim;
                 } else {
-                    print_string(&book_buf, "#ifndef %s"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix);
-                    print_string(&book_buf, "#ifndef %s%s\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#ifndef %s%s_"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix, s_name);
+                    goto __malformed;
                 }
+                push_da(&fields, field);
+            }
+            cc.fields = fields;
+            cc.derived_schemas = derived;
+            push_ccompound(&ce.types, cc);
+        }
+        push_da(cache, ce);
+        index_cache_entry(cache);
+        continue;
+
+        __malformed:
+        bk_log(LOG_WARN, "Cache file '%s' is malformed, ignoring it.\n", file_name);
+        free(ce.full);
+        free_ccompounds(&ce.types);
+        reset_cache(cache, cache->fingerprint);
+        break;
+    }
+    if (fields.items != NULL) free(fields.items);
+    if (derived.items != NULL) free(derived.items);
+    free(contents.items);
+}
 
-                // dump code
-                print_string(&book_buf, "#ifdef ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#undef ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#endif // ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#define ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES\\\n", s_name);
-                for (size_t j = 0; j < all_types.len; ++j) {
-                    const char* t_name = all_types.items[j].name;
-                    print_string(&book_buf, "    ___BK_IF_TYPE_%s(%s*: "BK_DUMP_LOWER"_%s_%s)\\\n", t_name, t_name, s_name, t_name);
-                }
-                print_string(&book_buf, "\n#ifdef "BK_DUMP_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#undef "BK_DUMP_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#endif // "BK_DUMP_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#define "BK_DUMP_LOWER"_%s(item, dst)\\\n", s_name);
-                print_string(&book_buf, "_Generic((item), ___BK_GENERIC_"BK_DUMP_UPPER"_%s_CASES default: NULL)((item), (dst))\n", s_name);
-
-                // dump guard end
-                if (bk.conf.disabled_by_default) {
-                    print_string(&book_buf, "#endif // defined(%s"BK_DUMP_UPPER") || defined(%s%s) || defined(%s%s_"BK_DUMP_UPPER")\n",
-                                 bk.conf.enable_macro_prefix,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name
-                    );
-                } else {
-                    print_string(&book_buf, "#endif // %s%s_"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#endif // %s%s\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#endif // %s"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix);
-                }
+static void cache_write_str(String* out, const char* s) {
+    print_string(out, " %zu:%s", strlen(s), s);
+}
 
-                // parse guard start
-                if (bk.conf.disabled_by_default) {
-                    print_string(&book_buf, "#if defined(%s"BK_PARSE_UPPER") || defined(%s%s) || defined(%s%s_"BK_PARSE_UPPER")\n",
-                                 bk.conf.enable_macro_prefix,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name
-                    );
+__BK_API bool save_cache(BkContext* bk, AnalysisCache* cache, const char* file_name) {
+    // Written through a temporary file, so an interrupted run can't leave a truncated cache behind
+    String out = {0}; // alloc
+    print_string(&out, "bkcache %d %llx\n", BK_CACHE_VERSION, cache->fingerprint);
+    for (size_t i = 0; i < cache->len; ++i) {
+        CacheEntry* ce = cache->items + i;
+        if (!ce->seen) continue;
+        print_string(&out, "e");
+        cache_write_str(&out, ce->full);
+        print_string(&out, " %llx %ld %zu\n", ce->hash, ce->file_idx, ce->types.len);
+        for (size_t j = 0; j < ce->types.len; ++j) {
+            CCompound* ty = ce->types.items + j;
+            print_string(&out, "t");
+            cache_write_str(&out, ty->name);
+            print_string(&out, " %zu", ty->derived_schemas.len);
+            for (size_t k = 0; k < ty->derived_schemas.len; ++k) print_string(&out, " %llx", ty->derived_schemas.items[k]);
+            print_string(&out, " %zu\n", ty->fields.len);
+            for (size_t k = 0; k < ty->fields.len; ++k) {
+                Field* field = ty->fields.items + k;
+                print_string(&out, "f");
+                cache_write_str(&out, field->name);
+                if (field->tag) {
+                    cache_write_str(&out, field->tag);
                 } else {
-                    print_string(&book_buf, "#ifndef %s"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix);
-                    print_string(&book_buf, "#ifndef %s%s\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#ifndef %s%s_"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix, s_name);
-                }
-
-                // parse code
-                print_string(&book_buf, "#ifdef ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#undef ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#endif // ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\n", s_name);
-                print_string(&book_buf, "#define ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES\\\n", s_name);
-                for (size_t j = 0; j < all_types.len; ++j) {
-                    const char* t_name = all_types.items[j].name;
-                    print_string(&book_buf, "    ___BK_IF_TYPE_%s(%s*: "BK_PARSE_LOWER"_%s_%s)\\\n", t_name, t_name, s_name, t_name);
+                    print_string(&out, " -");
                 }
-                print_string(&book_buf, "\n#ifdef "BK_PARSE_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#undef "BK_PARSE_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#endif // "BK_PARSE_LOWER"_%s\n", s_name);
-                print_string(&book_buf, "\n#define "BK_PARSE_LOWER"_%s(src, len, dst)\\\n", s_name);
-                print_string(&book_buf, "_Generic((dst), ___BK_GENERIC_"BK_PARSE_UPPER"_%s_CASES default: NULL)((src), (len), (dst))\n", s_name);
-
-                // parse guard end
-                if (bk.conf.disabled_by_default) {
-                    print_string(&book_buf, "#endif // defined(%s"BK_PARSE_UPPER") || defined(%s%s) || defined(%s%s_"BK_PARSE_UPPER")\n",
-                                 bk.conf.enable_macro_prefix,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name,
-                                 bk.conf.enable_macro_prefix,
-                                 s_name
-                    );
+                print_string(&out, " %d", (int)field->type.kind);
+                if (field->type.kind == CEXTERNAL) {
+                    cache_write_str(&out, field->type.name);
                 } else {
-                    print_string(&book_buf, "#endif // %s%s_"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#endif // %s%s\n", bk.conf.disable_macro_prefix, s_name);
-                    print_string(&book_buf, "#endif // %s"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix);
+                    print_string(&out, " %d", (int)field->type.type);
                 }
-
+                print_string(&out, "\n");
             }
-            // print_string(&book_buf, "#endif // __GENERICS_H__\n");
-            write_entire_file(tfmt("%s/generics.h", bk.conf.output_dir), &book_buf);
         }
-    } while(bk.conf.watch_mode);
+    }
+    bool ok = write_entire_file(bk, file_name, &out);
+    free(out.items);
+    cache->dirty = false;
+    return ok;
+}
+
+__BK_API CacheEntry* find_cache_entry(AnalysisCache* cache, const char* full) {
+    if (cache->table_cap == 0) return NULL;
+    size_t slot = fnv1a_cstr(full, FNV1A_INIT) & (cache->table_cap - 1);
+    for (; cache->table[slot] != 0; slot = (slot + 1) & (cache->table_cap - 1)) {
+        CacheEntry* ce = cache->items + cache->table[slot] - 1;
+        if (strcmp(ce->full, full) == 0) return ce;
+    }
+    return NULL;
+}
+
+__BK_API CacheEntry* update_cache_entry(AnalysisCache* cache, const char* full, unsigned long long hash, CCompounds* types) {
+    CacheEntry* ce = find_cache_entry(cache, full);
+    if (ce == NULL) {
+        CacheEntry new_ce = {.full = strdup(full)}; // alloc
+        push_da(cache, new_ce);
+        index_cache_entry(cache);
+        ce = cache->items + cache->len - 1;
+    } else {
+        reset_ccompounds(&ce->types);
+    }
+    ce->hash = hash;
+    ce->file_idx = -1;
+    ce->seen = true;
+    for (size_t i = 0; i < types->len; ++i) copy_ccompound(&ce->types, types->items + i);
+    cache->dirty = true;
+    return ce;
+}
+
+__BK_API void reset_cache(AnalysisCache* cache, unsigned long long fingerprint) {
+    for (size_t i = 0; i < cache->len; ++i) {
+        CacheEntry* ce = cache->items + i;
+        free(ce->full);
+        free_ccompounds(&ce->types);
+    }
+    cache->len = 0;
+    if (cache->table != NULL) memset(cache->table, 0, cache->table_cap * sizeof *cache->table);
+    cache->fingerprint = fingerprint;
+    cache->dirty = true;
+}
+
+__BK_API void free_cache(AnalysisCache* cache) {
+    reset_cache(cache, 0);
+    if (cache->items != NULL) free(cache->items);
+    if (cache->table != NULL) free(cache->table);
+}
+
+__BK_API unsigned long long analysis_fingerprint(BkContext* bk) {
+    unsigned long long h = FNV1A_INIT;
+    // Mirrors the condition that keeps `may_contain_types` from skipping files without derive attributes
+    bool keep_all = bk->conf.derive_all || !derive_set_empty(&bk->derive_schemas) || bk->conf.generics || bk->dynamic_schemas.len > 0;
+    bool flags[] = {bk->conf.derive_all, keep_all};
+    h = fnv1a(flags, sizeof flags, h);
+    // Derive attributes are resolved to schema indices, so their order matters as well
+    for (size_t i = 0; i < bk->schemas.len; ++i) h = fnv1a_cstr(bk->schemas.items[i].derive_attr, h);
+    h = fnv1a("", 1, h);
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        String_View derive_attr = bk->dynamic_schemas.items[i].derive_attr;
+        h = fnv1a(derive_attr.items, derive_attr.len, h);
+        h = fnv1a("", 1, h);
+    }
+    return h;
+}
+
+/// Hash of the key of a shared result, results of the same file with other contents or fingerprints get different slots
+static unsigned long long shared_result_key(const char* full, unsigned long long hash, unsigned long long fingerprint) {
+    unsigned long long h = fnv1a_cstr(full, FNV1A_INIT);
+    h = fnv1a(&hash, sizeof hash, h);
+    return fnv1a(&fingerprint, sizeof fingerprint, h);
+}
+
+static SharedResult* find_shared_result_locked(SharedAnalysis* shared, const char* full, unsigned long long hash, unsigned long long fingerprint) {
+    if (shared->table_cap == 0) return NULL;
+    size_t slot = shared_result_key(full, hash, fingerprint) & (shared->table_cap - 1);
+    for (; shared->table[slot] != 0; slot = (slot + 1) & (shared->table_cap - 1)) {
+        SharedResult* r = shared->items + shared->table[slot] - 1;
+        if (r->hash == hash && r->fingerprint == fingerprint && strcmp(r->full, full) == 0) return r;
+    }
+    return NULL;
+}
+
+/// Adds the last result to the hash table, results are only added if `find_shared_result_locked` didn't find them
+static void index_shared_result(SharedAnalysis* shared) {
+    if (shared->len*2 > shared->table_cap) {
+        size_t cap = shared->table_cap ? shared->table_cap*2 : 256;
+        size_t* table = calloc(cap, sizeof *table); // alloc
+        for (size_t i = 0; i < shared->table_cap; ++i) {
+            if (shared->table[i] == 0) continue;
+            SharedResult* r = shared->items + shared->table[i] - 1;
+            size_t slot = shared_result_key(r->full, r->hash, r->fingerprint) & (cap - 1);
+            while (table[slot] != 0) slot = (slot + 1) & (cap - 1);
+            table[slot] = shared->table[i];
+        }
+        free(shared->table);
+        shared->table = table;
+        shared->table_cap = cap;
+    }
+    SharedResult* r = shared->items + shared->len - 1;
+    size_t slot = shared_result_key(r->full, r->hash, r->fingerprint) & (shared->table_cap - 1);
+    while (shared->table[slot] != 0) slot = (slot + 1) & (shared->table_cap - 1);
+    shared->table[slot] = shared->len;
+}
+
+__BK_API bool find_shared_result(SharedAnalysis* shared, const char* full, unsigned long long hash, unsigned long long fingerprint, CCompounds* out) {
+    pthread_mutex_lock(&shared->lock);
+    SharedResult* r = find_shared_result_locked(shared, full, hash, fingerprint);
+    if (r != NULL) {
+        for (size_t i = 0; i < r->types.len; ++i) copy_ccompound(out, r->types.items + i);
+    }
+    pthread_mutex_unlock(&shared->lock);
+    return r != NULL;
+}
+
+__BK_API void add_shared_result(SharedAnalysis* shared, const char* full, unsigned long long hash, unsigned long long fingerprint, CCompounds* types) {
+    pthread_mutex_lock(&shared->lock);
+    // Two jobs may analyze the same file at the same time, the first result wins
+    if (find_shared_result_locked(shared, full, hash, fingerprint) == NULL) {
+        SharedResult r = {.full = strdup(full), .hash = hash, .fingerprint = fingerprint}; // alloc
+        for (size_t i = 0; i < types->len; ++i) copy_ccompound(&r.types, types->items + i);
+        push_da(shared, r);
+        index_shared_result(shared);
+    }
+    pthread_mutex_unlock(&shared->lock);
+}
+
+__BK_API void free_shared_analysis(SharedAnalysis* shared) {
+    for (size_t i = 0; i < shared->len; ++i) {
+        free(shared->items[i].full);
+        free_ccompounds(&shared->items[i].types);
+    }
+    if (shared->items != NULL) free(shared->items);
+    if (shared->table != NULL) free(shared->table);
+}
+
+/// Shared state of the threads running `parallel_for`
+typedef struct {
+    size_t count;
+    size_t next;
+    pthread_mutex_t lock;
+    BkContext* bk;
+    void (*fn)(BkContext* bk, size_t i, void* ctx);
+    void* ctx;
+} ParallelQueue;
+
+static void* parallel_worker(void* arg) {
+    ParallelQueue* q = arg;
+    // Every worker formats into its own scratch buffer, the rest of the context is only read
+    BkContext local = *q->bk;
+    for (;;) {
+        pthread_mutex_lock(&q->lock);
+        size_t i = q->next++;
+        pthread_mutex_unlock(&q->lock);
+        if (i >= q->count) break;
+        q->fn(&local, i, q->ctx);
+    }
+    return NULL;
+}
+
+__BK_API void parallel_for(BkContext* bk, size_t count, size_t threads, void (*fn)(BkContext* bk, size_t i, void* ctx), void* ctx) {
+    if (threads > count) threads = count;
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) fn(bk, i, ctx);
+        return;
+    }
+
+    ParallelQueue q = {.count = count, .bk = bk, .fn = fn, .ctx = ctx};
+    pthread_mutex_init(&q.lock, NULL);
+    pthread_t* workers = malloc((threads - 1) * sizeof *workers); // alloc
+    size_t started = 0;
+    for (; started < threads - 1; ++started) {
+        if (pthread_create(workers + started, NULL, parallel_worker, &q) != 0) break;
+    }
+    parallel_worker(&q);
+    for (size_t i = 0; i < started; ++i) pthread_join(workers[i], NULL);
+    free(workers);
+    pthread_mutex_destroy(&q.lock);
+}
+
+typedef struct {
+    EntryJobs* jobs;
+    AnalysisCache* cache;
+    SharedAnalysis* shared;
+    unsigned long long fingerprint;
+    OutputMode output_mode;
+    /// Set in watch and daemon mode, where the next run reuses the buffers of the jobs
+    bool keep_buffers;
+} EntryJobsCtx;
+
+static void run_analysis_job(BkContext* bk, size_t i, void* ctx) {
+    EntryJobsCtx* c = ctx;
+    EntryJob* job = c->jobs->items + i;
+    Entry* e = bk->entries.items + job->entry_index;
+    reset_ccompounds(&job->types);
+    job->analyzed = false;
+    job->generated = false;
+    job->read_ok = map_entire_file(bk, e->full, &job->input);
+    if (!job->read_ok) return;
+    job->hash = fnv1a(job->input.contents.items, job->input.contents.len, FNV1A_INIT);
+    CacheEntry* cached = c->cache ? find_cache_entry(c->cache, e->full) : NULL;
+    if (cached == NULL || cached->hash != job->hash) {
+        if (c->shared != NULL && find_shared_result(c->shared, e->full, job->hash, c->fingerprint, &job->types)) {
+            bk_log(LOG_INFO, "Using shared analysis for file: %s\n", e->name);
+        } else {
+            bk_log(LOG_INFO, "Analyzing file: %s\n", e->name);
+            analyze_file(bk, e->name, job->input.contents, &job->types, bk->conf.derive_all);
+            if (c->shared != NULL) add_shared_result(c->shared, e->full, job->hash, c->fingerprint, &job->types);
+        }
+        job->analyzed = true;
+    }
+    // Types own their strings, so the input isn't needed anymore
+    unmap_file(&job->input);
+    if (!job->analyzed) return;
+    job->body.len = 0;
+    unsigned long long start = stats_begin(bk);
+    job->generated = gen_entry(bk, &job->body, &job->types);
+    stats_end(bk, PHASE_GENERATE, start, e->name, 0);
+}
+
+__BK_API void run_analysis_jobs(BkContext* bk, EntryJobs* jobs, size_t count, size_t threads, AnalysisCache* cache, SharedAnalysis* shared) {
+    EntryJobsCtx ctx = {.jobs = jobs, .cache = cache, .shared = shared};
+    if (shared != NULL) ctx.fingerprint = analysis_fingerprint(bk);
+    parallel_for(bk, count, threads, run_analysis_job, &ctx);
+}
+
+static bool write_job_output(BkContext* bk, EntryJobsCtx* c, EntryJob* job) {
+    Entry* e = bk->entries.items + job->entry_index;
+    unsigned long in_hash = djb2(e->full);
+    String* file = &job->file;
+    file->len = 0;
+    print_string(file, "#ifndef __BK_%lu_%lu_H__ // Generated from: %s\n", in_hash, job->out_idx, e->full);
+    print_string(file, "#define __BK_%lu_%lu_H__\n", in_hash, job->out_idx);
+    append_string(file, job->body.items, job->body.len);
+    print_string(file, "#endif // __BK_%lu_%lu_H__\n", in_hash, job->out_idx);
+    // Jobs run on multiple threads, so the path can't live in a buffer of the context
+    String path = {0}; // alloc
+    char* out_file = output_file_path(bk, e, c->output_mode, &path);
+    bool ok = true;
+    // Files found in subdirectories of include directories keep their relative path inside the output directory
+    if (c->output_mode == O_DIR && strchr(e->name, '/') != NULL && !make_parent_dirs(out_file)) {
+        bk_log(LOG_ERROR, "Couldn't create the directories of '%s': %s\n", out_file, strerror(errno));
+        ok = false;
+    }
+    ok = ok && write_entire_file(bk, out_file, file);
+    if (ok && bk->conf.depfiles) write_depfile(bk, out_file, e, 1, &job->body);
+    free(path.items);
+    return ok;
+}
 
-    __bk_cleanup:
-    if (all_types.items != NULL) {
-        for (size_t i = 0; i < all_types.len; ++i) free_ccompund(all_types.items[i]);
-        free(all_types.items);
+static void run_output_job(BkContext* bk, size_t i, void* ctx) {
+    EntryJobsCtx* c = ctx;
+    EntryJob* job = c->jobs->items + i;
+    job->write_ok = !job->write || !job->generated || write_job_output(bk, c, job);
+    // Generated code isn't needed after it was written, so it doesn't pile up until the end of the build
+    if (!c->keep_buffers && job->write_ok) {
+        if (job->body.items != NULL) free(job->body.items);
+        if (job->file.items != NULL) free(job->file.items);
+        job->body = (String){0};
+        job->file = (String){0};
     }
+}
 
-    if (file_buf.items != NULL) free(file_buf.items);
-    if (bk.schemas.items != NULL) free(bk.schemas.items);
+__BK_API void run_output_jobs(BkContext* bk, EntryJobs* jobs, size_t count, size_t threads, OutputMode output_mode) {
+    EntryJobsCtx ctx = {.jobs = jobs, .output_mode = output_mode, .keep_buffers = bk->conf.watch_mode || bk->daemon_socket != NULL};
+    parallel_for(bk, count, threads, run_output_job, &ctx);
+}
 
-    if (bk.entries.items != NULL) {
-        for (size_t i = 0; i < bk.entries.len; ++i) free_entry(bk.entries.items[i]);
-        free(bk.entries.items);
+__BK_API void free_entry_jobs(EntryJobs* jobs) {
+    for (size_t i = 0; i < jobs->len; ++i) {
+        free_mapped_file(&jobs->items[i].input);
+        if (jobs->items[i].file.items != NULL) free(jobs->items[i].file.items);
+        if (jobs->items[i].body.items != NULL) free(jobs->items[i].body.items);
+        free_ccompounds(&jobs->items[i].types);
     }
+    if (jobs->items != NULL) free(jobs->items);
+}
 
-    if (bk.dynamic_schemas.items != NULL) free(bk.dynamic_schemas.items);
+static bool allocs_tracked = false;
+static atomic_size_t alloc_count;
+static atomic_size_t realloc_count;
+static atomic_size_t free_count;
+static atomic_llong heap_size;
+static atomic_llong heap_peak;
+
+#if defined(__GLIBC__)
+#define BK_ALLOC_SIZE(ptr) ((long long)malloc_usable_size(ptr))
+#elif defined(__APPLE__)
+#define BK_ALLOC_SIZE(ptr) ((long long)malloc_size(ptr))
+#else
+#define BK_ALLOC_SIZE(ptr) 0LL
+#endif
 
-    for (size_t i = 0; i < bk.dynamic_source.len; ++i) free(bk.dynamic_source.items[i].items);
-    if (bk.dynamic_source.items != NULL) free(bk.dynamic_source.items);
-    
-    return ret_val;
+static void track_heap(long long delta) {
+    long long size = atomic_fetch_add(&heap_size, delta) + delta;
+    long long peak = atomic_load(&heap_peak);
+    while (size > peak && !atomic_compare_exchange_weak(&heap_peak, &peak, size));
 }
 
-String_View sv(const char* cstr) {
-    return (String_View) {
-        .items = cstr,
-        .len = strlen(cstr),
-    };
+__BK_API void track_allocations(bool enable) {
+    allocs_tracked = enable;
 }
 
-String_View sv_from_parts(const char* items, size_t len) {
-    return (String_View) {
-        .items = items,
-        .len = len,
+__BK_API AllocStats allocation_stats(void) {
+    return (AllocStats) {
+        .allocs = atomic_load(&alloc_count),
+        .reallocs = atomic_load(&realloc_count),
+        .frees = atomic_load(&free_count),
+        .peak_heap = atomic_load(&heap_peak),
     };
 }
 
-String_View sv_from_str(String* str) {
-    return (String_View) {
-        .items = str->items,
-        .len = str->len,
-    };
+// The names of the wrapped functions are parenthesized so they aren't replaced by the wrapper macros
+__BK_API void* bk_malloc(size_t size) {
+    void* ptr = (malloc)(size);
+    if (allocs_tracked && ptr != NULL) {
+        atomic_fetch_add(&alloc_count, 1);
+        track_heap(BK_ALLOC_SIZE(ptr));
+    }
+    return ptr;
 }
 
-char* sv_to_cstr(String_View sv) {
-    char* res = malloc(sv.len + 1);
-    memset(res, 0, sv.len + 1);
-    sprintf(res, SV_FMT, SV_ARG(sv));
-    return res;
+__BK_API void* bk_calloc(size_t count, size_t size) {
+    void* ptr = (calloc)(count, size);
+    if (allocs_tracked && ptr != NULL) {
+        atomic_fetch_add(&alloc_count, 1);
+        track_heap(BK_ALLOC_SIZE(ptr));
+    }
+    return ptr;
 }
 
-bool sv_starts_with(String_View sv, String_View prefix) {
-    if (sv.len < prefix.len) return false;
-
-    if (strncmp(sv.items, prefix.items, prefix.len) == 0) return true;
-    
-    return false;
+__BK_API void* bk_realloc(void* ptr, size_t size) {
+    if (!allocs_tracked) return (realloc)(ptr, size);
+    long long before = ptr != NULL ? BK_ALLOC_SIZE(ptr) : 0;
+    void* res = (realloc)(ptr, size);
+    if (res == NULL) return res;
+    atomic_fetch_add(ptr != NULL ? &realloc_count : &alloc_count, 1);
+    track_heap(BK_ALLOC_SIZE(res) - before);
+    return res;
 }
 
-String_View sv_chop(String_View sv, size_t n) {
-    sv_chop2(&sv, n);
-    return sv;
+__BK_API char* bk_strdup(const char* s) {
+    char* res = (strdup)(s);
+    if (allocs_tracked && res != NULL) {
+        atomic_fetch_add(&alloc_count, 1);
+        track_heap(BK_ALLOC_SIZE(res));
+    }
+    return res;
 }
 
-bool sv_chop_if_prefix(String_View* sv, String_View prefix) {
-    if (sv_starts_with(*sv, prefix)) {
-        sv_chop2(sv, prefix.len);
-        return true;
-    } else {
-        return false;
+__BK_API void bk_free(void* ptr) {
+    if (allocs_tracked && ptr != NULL) {
+        atomic_fetch_add(&free_count, 1);
+        track_heap(-BK_ALLOC_SIZE(ptr));
     }
+    (free)(ptr);
 }
 
-String_View sv_chop_line(String_View sv, size_t n) {
-    for (size_t i = 0; i < n; ++i) {
-        sv = sv_find(sv, '\n');
-        sv = sv_chop(sv, 1);
+__BK_API char* bk_realpath(const char* path) {
+    char* res = realpath(path, NULL);
+    if (allocs_tracked && res != NULL) {
+        atomic_fetch_add(&alloc_count, 1);
+        track_heap(BK_ALLOC_SIZE(res));
     }
-    return sv;
+    return res;
 }
 
-void sv_chop2(String_View* sv, size_t n) {
-    size_t cn = n <= sv->len ? n : sv->len;
+static const char* phase_names[PHASE_COUNT] = {"discovery", "read", "analyze", "generate", "static schemas", "dynamic schemas", "write"};
 
-    sv->items += cn;
-    sv->len -= cn;
+/// Small ids for trace events, assigned to threads in the order they record their first span
+static _Thread_local unsigned trace_tid = 0;
+static atomic_uint trace_next_tid = 1;
+
+__BK_API unsigned long long now_ns(void) {
+    struct timespec ts = {0};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
 }
 
-String_View sv_trim_start(String_View sv, char c) {
-    String_View res = sv;
-    for (size_t i = 0; i < sv.len; ++i) {
-        if (sv.items[i] == c) {
-            sv_chop2(&res, 1);
-        } else {
-            break;
-        }
-    }
-    return res;
+__BK_API void init_stats(BkStats* stats, bool trace) {
+    *stats = (BkStats){.trace = trace};
+    pthread_mutex_init(&stats->lock, NULL);
+    intern(&stats->names, "", 0);
+    stats->start = now_ns();
 }
 
-String_View sv_trim2_start(String_View sv, String_View cs) {
-    String_View res = sv;
-    for (size_t i = 0; i < sv.len; ++i) {
-        bool found = false;
-        for (size_t j = 0; j < cs.len; ++j) {
-            if (sv.items[i] == cs.items[j]) {
-                found = true;
-                break;
-            }
-        }
-        if (found) {
-            sv_chop2(&res, 1);
-        } else {
-            break;
-        }
-    }
-    return res;
+__BK_API unsigned long long stats_begin(BkContext* bk) {
+    return bk->stats != NULL ? now_ns() : 0;
 }
 
-String_View sv_trim_whitespace_start(String_View sv_) {
-    return sv_trim2_start(sv_, sv(" \t\n"));
+/// Adds a span to `phase`, expects `stats->lock` to be held
+static void stats_add_span(BkStats* stats, BkPhase phase, unsigned name, unsigned type, unsigned long long start, unsigned long long end) {
+    stats->phase_time[phase] += end - start;
+    stats->phase_calls[phase] += 1;
+    if (!stats->trace) return;
+    if (trace_tid == 0) trace_tid = atomic_fetch_add(&trace_next_tid, 1);
+    TraceEvent ev = {.name = name, .phase = phase, .type = type, .tid = trace_tid, .start = start, .duration = end - start};
+    push_da(&stats->events, ev);
 }
 
-String_View sv_trim_whitespace_end(String_View sv) {
-    if (sv.len == 0) return sv;
-    for (;;) {
-        char c = sv.items[sv.len - 1];
-        if (
-        (c == ' ') ||
-        (c == '\n') ||
-        (c == '\t')
-        ) {
-            --sv.len;
-        } else {
-            break;
-        }
+__BK_API void stats_end(BkContext* bk, BkPhase phase, unsigned long long start, const char* name, size_t bytes) {
+    BkStats* stats = bk->stats;
+    if (stats == NULL || start == 0) return;
+    unsigned long long end = now_ns();
+    if (name == NULL) name = phase_names[phase];
+    pthread_mutex_lock(&stats->lock);
+    unsigned name_id = stats->trace ? intern(&stats->names, name, strlen(name)) : 0;
+    stats_add_span(stats, phase, name_id, 0, start, end);
+    if (phase == PHASE_READ) {
+        stats->files_read += 1;
+        stats->bytes_read += bytes;
+    } else if (phase == PHASE_WRITE && bytes > 0) {
+        stats->files_written += 1;
+        stats->bytes_written += bytes;
     }
-    return sv;
+    pthread_mutex_unlock(&stats->lock);
 }
 
-String_View sv_trim_whitespace(String_View sv) {
-    return sv_trim_whitespace_end(sv_trim_whitespace_start(sv));
+__BK_API void stats_schema(BkContext* bk, BkPhase phase, String_View schema, unsigned long long start, const char* type_name) {
+    BkStats* stats = bk->stats;
+    if (stats == NULL || start == 0) return;
+    unsigned long long end = now_ns();
+    pthread_mutex_lock(&stats->lock);
+    unsigned name_id = intern(&stats->names, schema.items, schema.len);
+    unsigned type_id = stats->trace ? intern(&stats->names, type_name, strlen(type_name)) : 0;
+    stats_add_span(stats, phase, name_id, type_id, start, end);
+    SchemaStat* s = NULL;
+    for (size_t i = 0; i < stats->schemas.len && s == NULL; ++i) {
+        if (stats->schemas.items[i].name == name_id) s = stats->schemas.items + i;
+    }
+    if (s == NULL) {
+        push_da(&stats->schemas, (SchemaStat){.name = name_id});
+        s = stats->schemas.items + stats->schemas.len - 1;
+    }
+    s->time += end - start;
+    s->calls += 1;
+    pthread_mutex_unlock(&stats->lock);
 }
 
-String_View sv_find(String_View sv, char c) {
-    String_View res = sv;
-    for (size_t i = 0; i < sv.len; ++i) {
-        if (sv.items[i] != c) {
-            sv_chop2(&res, 1);
-        } else {
-            break;
-        }
+__BK_API void stats_count_types(BkContext* bk, size_t types, size_t fields) {
+    BkStats* stats = bk->stats;
+    if (stats == NULL) return;
+    pthread_mutex_lock(&stats->lock);
+    stats->types += types;
+    stats->fields += fields;
+    pthread_mutex_unlock(&stats->lock);
+}
+
+__BK_API void print_stats(BkStats* stats, FILE* f) {
+    pthread_mutex_lock(&stats->lock);
+    fprintf(f, "Statistics:\n");
+    fprintf(f, "  %-24s %12.2f ms\n", "wall time", (double)(now_ns() - stats->start) / 1e6);
+    fprintf(f, "  %-24s %15s %10s\n", "phase (all threads)", "time", "calls");
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        // Schema phases are part of the generate phase
+        bool nested = i == PHASE_STATIC_SCHEMA || i == PHASE_DYNAMIC_SCHEMA;
+        fprintf(f, "  %s%-*s %12.2f ms %10zu\n", nested ? "  " : "", nested ? 22 : 24, phase_names[i], (double)stats->phase_time[i] / 1e6, stats->phase_calls[i]);
     }
-    return res;
+    fprintf(f, "  %-24s %15zu (%zu files)\n", "bytes read", stats->bytes_read, stats->files_read);
+    fprintf(f, "  %-24s %15zu (%zu files)\n", "bytes written", stats->bytes_written, stats->files_written);
+    fprintf(f, "  %-24s %15zu (%zu fields)\n", "types analyzed", stats->types, stats->fields);
+    AllocStats allocs = allocation_stats();
+    fprintf(f, "  %-24s %15zu (%zu reallocs, %zu frees)\n", "allocations", allocs.allocs, allocs.reallocs, allocs.frees);
+    if (allocs.peak_heap > 0) fprintf(f, "  %-24s %12.2f KiB\n", "peak heap", (double)allocs.peak_heap / 1024.0);
+    if (stats->schemas.len > 0) fprintf(f, "  %-24s %15s %10s\n", "schema", "time", "calls");
+    for (size_t i = 0; i < stats->schemas.len; ++i) {
+        SchemaStat* s = stats->schemas.items + i;
+        fprintf(f, "  %-24s %12.2f ms %10zu\n", interned_string(&stats->names, s->name), (double)s->time / 1e6, s->calls);
+    }
+    pthread_mutex_unlock(&stats->lock);
 }
 
-String_View sv_substr(String_View sv, size_t start, size_t len) {
-    // TODO: bounds checks
-    return (String_View) {
-        .items = sv.items + start,
-        .len = len
-    };
+__BK_API void print_stats_csv(BkStats* stats, FILE* f) {
+    pthread_mutex_lock(&stats->lock);
+    fprintf(f, "kind,name,value,count\n");
+    fprintf(f, "time,wall,%.3f,1\n", (double)(now_ns() - stats->start) / 1e6);
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+        fprintf(f, "phase,%s,%.3f,%zu\n", phase_names[i], (double)stats->phase_time[i] / 1e6, stats->phase_calls[i]);
+    }
+    fprintf(f, "bytes,read,%zu,%zu\n", stats->bytes_read, stats->files_read);
+    fprintf(f, "bytes,written,%zu,%zu\n", stats->bytes_written, stats->files_written);
+    fprintf(f, "types,analyzed,%zu,%zu\n", stats->types, stats->fields);
+    AllocStats allocs = allocation_stats();
+    fprintf(f, "allocations,allocs,%zu,0\n", allocs.allocs);
+    fprintf(f, "allocations,reallocs,%zu,0\n", allocs.reallocs);
+    fprintf(f, "allocations,frees,%zu,0\n", allocs.frees);
+    fprintf(f, "allocations,peak_heap,%lld,0\n", allocs.peak_heap);
+    for (size_t i = 0; i < stats->schemas.len; ++i) {
+        SchemaStat* s = stats->schemas.items + i;
+        fprintf(f, "schema,%s,%.3f,%zu\n", interned_string(&stats->names, s->name), (double)s->time / 1e6, s->calls);
+    }
+    pthread_mutex_unlock(&stats->lock);
 }
 
-void sv_loc(String_View file, String_View cursor, int* line, int* offset) {
-    *line = 1;
-    *offset = 1;
-    for (size_t i = 0; i < (file.len - cursor.len); ++i) {
-        if (file.items[i] == '\n') {
-            *line += 1;
-            *offset = 1;
+/// Appends `s` as a JSON string
+static void print_json_string(String* dst, const char* s) {
+    push_da(dst, '"');
+    for (const char* c = s; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            push_da(dst, '\\');
+            push_da(dst, *c);
+        } else if ((unsigned char)*c < 0x20) {
+            print_string(dst, "\\u%04x", (unsigned)(unsigned char)*c);
         } else {
-            *offset += 1;
+            push_da(dst, *c);
         }
     }
+    push_da(dst, '"');
 }
 
-__BK_API bool read_entire_file_loc(const char* file_name, String* dst, const char* source_file, int source_line) {
-    struct stat s = {0};
-    stat(file_name, &s);
-    size_t f_len = s.st_size / sizeof(char);
-    FILE* f = fopen(file_name, "rb");
-    if (f == NULL) {
-        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't open file '%s': %s\n", file_name, strerror(errno));
-        return false;
-    }
-    if (f_len >= (dst->cap - dst->len)) {
-        dst->cap += f_len; // allocate extra space beacuse why not ram is cheap
-        if (dst->items) {
-            dst->items = realloc(dst->items, dst->cap);
-        } else {
-            dst->items = malloc(dst->cap);
+__BK_API bool write_trace(BkContext* bk, BkStats* stats, const char* file_name) {
+    String out = {0}; // alloc
+    pthread_mutex_lock(&stats->lock);
+    print_lit(&out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < stats->events.len; ++i) {
+        TraceEvent* ev = stats->events.items + i;
+        print_lit(&out, "{\"name\":");
+        print_json_string(&out, interned_string(&stats->names, ev->name));
+        print_string(&out, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                     phase_names[ev->phase], ev->tid, (double)(ev->start - stats->start) / 1e3, (double)ev->duration / 1e3);
+        if (ev->type != 0) {
+            print_lit(&out, ",\"args\":{\"type\":");
+            print_json_string(&out, interned_string(&stats->names, ev->type));
+            push_da(&out, '}');
         }
+        print_string(&out, "}%s\n", i + 1 < stats->events.len ? "," : "");
     }
-    size_t bytes_read = fread(dst->items + dst->len, sizeof(char), f_len, f) / sizeof(char);
-    if (bytes_read <= 0) {
-        if (ferror(f)) {
-            bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't read from file '%s': %s\n", file_name, strerror(errno));
-            fclose(f);
-            return false;
+    print_lit(&out, "]}\n");
+    pthread_mutex_unlock(&stats->lock);
+    bool ok = write_entire_file(bk, file_name, &out);
+    free(out.items);
+    return ok;
+}
+
+__BK_API void free_stats(BkStats* stats) {
+    if (stats->events.items != NULL) free(stats->events.items);
+    if (stats->schemas.items != NULL) free(stats->schemas.items);
+    free_interner(&stats->names);
+    pthread_mutex_destroy(&stats->lock);
+}
+
+/// Size of the first block of an arena
+#define ARENA_MIN_BLOCK 256
+
+__BK_API void* arena_alloc(Arena* a, size_t size) {
+    if (size == 0) return NULL;
+    // Everything stored in arenas only needs pointer alignment
+    size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+    while (a->current == NULL || a->current->len + size > a->current->cap) {
+        if (a->current != NULL && a->current->next != NULL) {
+            a->current = a->current->next;
+            a->current->len = 0;
+            continue;
+        }
+        // Most arenas belong to a single file or type list, so the first block starts small and later ones double
+        size_t cap = a->current ? a->current->cap*2 : ARENA_MIN_BLOCK;
+        if (cap < size) cap = size;
+        ArenaBlock* block = malloc(sizeof *block + cap); // alloc
+        block->next = NULL;
+        block->len = 0;
+        block->cap = cap;
+        if (a->current != NULL) {
+            a->current->next = block;
+        } else {
+            a->first = block;
         }
+        a->current = block;
     }
-    dst->len += bytes_read; 
-    fclose(f);
-    return true;
+    void* res = a->current->data + a->current->len;
+    a->current->len += size;
+    return res;
 }
 
-__BK_API bool write_entire_file_loc(const char* file_name, String* src, const char* source_file, int source_line) {
-    FILE* f = fopen(file_name, "w");
-    if (f == NULL) {
-        bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't open file '%s': %s\n", file_name, strerror(errno));
-        return false;
-    }
-    if (fwrite(src->items, sizeof *src->items, src->len, f) <= 0) {
-        if (ferror(f)) {
-            bk_log_loc(LOG_ERROR, source_file, source_line, "Couldn't write to file '%s': %s\n", file_name, strerror(errno));
-            fclose(f);
-            return false;
-        }
-    } 
-    fclose(f);
-    bk_log_loc(LOG_INFO, source_file, source_line, "Generated file: %s\n", file_name);
-    return true;
+__BK_API void arena_reset(Arena* a) {
+    a->current = a->first;
+    if (a->current != NULL) a->current->len = 0;
 }
 
-__BK_API unsigned long djb2(const char* s) {
-    unsigned long hash = 5381;
-    for (char c; (c = *s++);) hash = ((hash << 5) + hash) + (unsigned long) c;
-    return hash;
+__BK_API void free_arena(Arena* a) {
+    for (ArenaBlock* block = a->first; block != NULL;) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    *a = (Arena){0};
 }
 
-__BK_API bool entry_from_file(const char* file_name, Entry* out) {
-    char* real = realpath(file_name, NULL); // alloc
-    if (real == NULL) {
-        bk_log(LOG_ERROR, "File '%s' doesn't exist: %s\n", file_name, strerror(errno));
-        return false;
+// Cleanup functions
+__BK_API void copy_ccompound(CCompounds* dst, CCompound* cc) {
+    size_t words_size = cc->derived_schemas.len * sizeof *cc->derived_schemas.items;
+    CCompound res = {
+        .derived_schemas = {
+            .items = arena_alloc(&dst->names.arena, words_size),
+            .len = cc->derived_schemas.len,
+            .cap = cc->derived_schemas.len,
+        },
+        .name = cc->name ? intern_str(&dst->names, cc->name) : NULL,
+        .fields = {
+            .items = arena_alloc(&dst->names.arena, cc->fields.len * sizeof *cc->fields.items),
+            .len = cc->fields.len,
+            .cap = cc->fields.len,
+        },
+    };
+    for (size_t i = 0; i < cc->fields.len; ++i) {
+        Field* f = cc->fields.items + i;
+        Field* copy = res.fields.items + i;
+        *copy = (Field){
+            .name = f->name ? intern_str(&dst->names, f->name) : NULL,
+            .tag = f->tag ? intern_str(&dst->names, f->tag) : NULL,
+            .type = f->type,
+        };
+        if (f->type.kind == CEXTERNAL) copy->type.name = intern_str(&dst->names, f->type.name);
     }
-    struct stat s = {0};
-    stat(real, &s);
-    out->full = real;
-    out->name = strdup(file_name); // alloc
-    #if !defined(_POSIX_C_SOURCE) || defined(_DARWIN_C_SOURCE)
-    out->sys_modif = s.st_mtimespec.tv_sec;
-    #else
-    out->sys_modif = s.st_mtim.tv_sec;
-    #endif
-    out->last_analyzed = 0;
+    if (words_size > 0) memcpy(res.derived_schemas.items, cc->derived_schemas.items, words_size);
+    push_da(dst, res);
+}
 
-    return true;
+__BK_API void push_ccompound(CCompounds* dst, CCompound cc) {
+    size_t fields_size = cc.fields.len * sizeof *cc.fields.items;
+    Field* fields = arena_alloc(&dst->names.arena, fields_size);
+    if (fields_size > 0) memcpy(fields, cc.fields.items, fields_size);
+    cc.fields = (Fields){.items = fields, .len = cc.fields.len, .cap = cc.fields.len};
+
+    size_t words_size = cc.derived_schemas.len * sizeof *cc.derived_schemas.items;
+    unsigned long long* words = arena_alloc(&dst->names.arena, words_size);
+    if (words_size > 0) memcpy(words, cc.derived_schemas.items, words_size);
+    cc.derived_schemas = (DeriveSet){.items = words, .len = cc.derived_schemas.len, .cap = cc.derived_schemas.len};
+    push_da(dst, cc);
 }
 
-__BK_API bool load_dynamic_schema_loc(const char* file_name, const char* source_file, int source_line) {
-    String source = {0}; // alloc
-    if (!read_entire_file_loc(file_name, &source, source_file, source_line)) return false;
+__BK_API void reset_ccompounds(CCompounds* types) {
+    types->len = 0;
+    reset_interner(&types->names);
+}
 
-    String_View schema_source = sv_from_str(&source);
-    String_View cursor = sv_trim_whitespace_start(schema_source);
+__BK_API void free_ccompounds(CCompounds* types) {
+    if (types->items != NULL) free(types->items);
+    free_interner(&types->names);
+    *types = (CCompounds){0};
+}
 
-    String_View name_prefix = sv("name:");
-    String_View derive_prefix = sv("derive:");
-    if (sv_starts_with(cursor, name_prefix)) {
-        cursor = sv_find(cursor, '"');
-        cursor = sv_chop(cursor, 1);
-        String_View name_end = sv_find(cursor, '"');
-        String_View name = sv_substr(cursor, 0, cursor.len - name_end.len);
-        cursor = name_end;
-        cursor = sv_chop(cursor, 1);
-        if (cursor.items[0] != ',') {
-            int line, offset;
-            sv_loc(schema_source, cursor, &line, &offset);
-            bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected comma (',')\n");
-            free(source.items);
-            return false;
-        }
-        cursor = sv_chop(cursor, 1);
-        cursor = sv_trim_whitespace_start(cursor);
-        if (!sv_starts_with(cursor, derive_prefix)) {
-            int line, offset;
-            sv_loc(schema_source, cursor, &line, &offset);
-            bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected `derive` field\n");
-            free(source.items);
-            return false;
+__BK_API void free_entry(Entry e) {
+    free(e.full);
+    free(e.name);
+}
+
+__BK_API unsigned intern(Interner* in, const char* s, size_t len) {
+    if ((in->strings.len + 1)*2 > in->table_cap) {
+        size_t cap = in->table_cap ? in->table_cap*2 : 16;
+        unsigned* table = calloc(cap, sizeof *table); // alloc
+        for (size_t i = 0; i < in->table_cap; ++i) {
+            if (in->table[i] == 0) continue;
+            const char* str = in->strings.items[in->table[i] - 1];
+            size_t slot = fnv1a(str, strlen(str), FNV1A_INIT) & (cap - 1);
+            while (table[slot] != 0) slot = (slot + 1) & (cap - 1);
+            table[slot] = in->table[i];
         }
-        cursor = sv_chop(cursor, derive_prefix.len);
-        cursor = sv_find(cursor, '"');
-        cursor = sv_chop(cursor, 1);
-        String_View derive_end = sv_find(cursor, '"');
-        String_View derive_attr = sv_substr(cursor, 0, cursor.len - derive_end.len);
-        cursor = derive_end;
-        cursor = sv_chop(cursor, 1);
-        cursor = sv_trim_whitespace_start(cursor);
-        bk_log(LOG_INFO, "Loading dynamic schema '"SV_FMT"' with derive attribute '"SV_FMT"'\n", SV_ARG(name), SV_ARG(derive_attr));
-        DynamicSchema s = {
-            .name = name,
-            .derive_attr = derive_attr,
-            .source = cursor,
-        };
-        push_da(&bk.dynamic_schemas, s);
-        push_da(&bk.dynamic_source, source);
-    } else {
-        int line, offset;
-        sv_loc(schema_source, cursor, &line, &offset);
-        bk_diag_loc(LOG_ERROR, file_name, line, offset, "Expected `name` field\n");
-        free(source.items);
-        return false;
+        free(in->table);
+        in->table = table;
+        in->table_cap = cap;
     }
-    return true;    
+    size_t slot = fnv1a(s, len, FNV1A_INIT) & (in->table_cap - 1);
+    for (; in->table[slot] != 0; slot = (slot + 1) & (in->table_cap - 1)) {
+        const char* str = in->strings.items[in->table[slot] - 1];
+        if (strncmp(str, s, len) == 0 && str[len] == '\0') return in->table[slot] - 1;
+    }
+    char* str = arena_alloc(&in->arena, len + 1);
+    memcpy(str, s, len);
+    str[len] = '\0';
+    unsigned id = (unsigned)in->strings.len;
+    push_da(&in->strings, str);
+    in->table[slot] = id + 1;
+    return id;
 }
 
-// Cleanup functions
-__BK_API void free_ccompund(CCompound cc) {        
-    for (size_t i = 0; i < cc.fields.len; ++i) {
-        free_field(cc.fields.items[i]);
+__BK_API bool find_interned(const Interner* in, const char* s, size_t len, unsigned* id) {
+    if (in->table_cap == 0) return false;
+    size_t slot = fnv1a(s, len, FNV1A_INIT) & (in->table_cap - 1);
+    for (; in->table[slot] != 0; slot = (slot + 1) & (in->table_cap - 1)) {
+        const char* str = in->strings.items[in->table[slot] - 1];
+        if (strncmp(str, s, len) == 0 && str[len] == '\0') {
+            *id = in->table[slot] - 1;
+            return true;
+        }
     }
+    return false;
 }
 
-__BK_API void free_field(Field f) {
-    free(f.name);
-    free(f.tag);
-    free_ctype(f.type);
+__BK_API const char* interned_string(const Interner* in, unsigned id) {
+    return in->strings.items[id];
 }
 
-__BK_API void free_ctype(CType ct) {
-    if (ct.kind == CEXTERNAL) free(ct.name);
+__BK_API const char* intern_str(Interner* in, const char* s) {
+    unsigned id = intern(in, s, strlen(s));
+    return in->strings.items[id];
 }
 
-__BK_API void free_entry(Entry e) {
-    free(e.full);
-    free(e.name);
+__BK_API void reset_interner(Interner* in) {
+    arena_reset(&in->arena);
+    in->strings.len = 0;
+    if (in->table != NULL) memset(in->table, 0, in->table_cap * sizeof *in->table);
 }
 
-__BK_API bool va_get_expect_ids(stb_lexer* lex, va_list args) {
-    const char* expected = va_arg(args, const char*);
-    for (; expected != NULL; expected = va_arg(args, const char*)) {
-        stb_c_lexer_get_token(lex);
-        if (lex->token != CLEX_id)              return false;
-        if (strcmp(lex->string, expected) != 0) return false;
-    }
-    return true;
+__BK_API void free_interner(Interner* in) {
+    free_arena(&in->arena);
+    free(in->strings.items);
+    free(in->table);
+    *in = (Interner){0};
+}
+
+__BK_API unsigned tape_intern(TokenTape* tape, const char* s, size_t len) {
+    if (tape->base == NULL) return intern(&tape->strings, s, len);
+    unsigned id;
+    if (find_interned(tape->base, s, len, &id)) return id;
+    return (unsigned)tape->base->strings.len + intern(&tape->strings, s, len);
+}
+
+__BK_API const char* tape_string(TokenTape* tape, unsigned string) {
+    size_t base_len = tape->base ? tape->base->strings.len : 0;
+    if (string < base_len) return interned_string(tape->base, string);
+    return interned_string(&tape->strings, string - (unsigned)base_len);
 }
 
-__BK_API bool va_get_expect_tokens(stb_lexer* lex, va_list args) {
-    int expected = va_arg(args, int);
-    for (; expected > -1 ; expected = va_arg(args, int)) {
-        stb_c_lexer_get_token(lex);
-        if (lex->token != expected) return false;
+__BK_API void tokenize(TokenTape* tape, String_View source) {
+    tape->tokens.len = 0;
+    tape->source = source;
+    unsigned last_string = tape_intern(tape, "", 0);
+    // Not static so multiple files can be tokenized at the same time
+    char string_store[4096];
+    stb_lexer lex = {0};
+    stb_c_lexer_init(&lex, source.items, source.items + source.len, string_store, sizeof string_store);
+    while (stb_c_lexer_get_token(&lex)) {
+        if (lex.token == CLEX_id || lex.token == CLEX_dqstring) last_string = tape_intern(tape, lex.string, (size_t)lex.string_len);
+        Token token = {.kind = (int)lex.token, .string = last_string, .offset = (unsigned)(lex.where_firstchar - source.items)};
+        push_da(&tape->tokens, token);
     }
-    return true;
+    Token eof = {.kind = CLEX_eof, .string = last_string, .offset = (unsigned)source.len};
+    push_da(&tape->tokens, eof);
 }
 
-__BK_API bool va_get_expect_c(stb_lexer* lex, va_list args) {
-    Word expected = va_arg(args, Word);
-    for(; expected.kind != WORD_END; expected = va_arg(args, Word)) {
-        stb_c_lexer_get_token(lex);
-        switch (expected.kind) {
-        case WORD_TOK: {
-            if (lex->token != expected.tok) return false;
-        } break;
-        case WORD_ID: {
-            if (lex->token != CLEX_id) return false;
-            if (strcmp(lex->string, expected.id) != 0) return false;
-        } break;
-        case WORD_END: {
-            abort(); // unreachable
-        } break;
+__BK_API Token* tape_at(TokenTape* tape, size_t i) {
+    return tape->tokens.items + (i < tape->tokens.len ? i : tape->tokens.len - 1);
+}
+
+__BK_API bool tape_is(TokenTape* tape, size_t i, int kind) {
+    return tape_at(tape, i)->kind == kind;
+}
+
+__BK_API bool tape_is_id(TokenTape* tape, size_t i, unsigned string) {
+    Token* token = tape_at(tape, i);
+    return token->kind == CLEX_id && token->string == string;
+}
+
+__BK_API void tape_location(TokenTape* tape, size_t i, int* line, int* offset) {
+    const char* p = tape->source.items;
+    const char* where = p + tape_at(tape, i)->offset;
+    *line = 1;
+    *offset = 0;
+    while (p < where) {
+        if (*p == '\n' || *p == '\r') {
+            p += (p + 1 < where && p[0] + p[1] == '\r' + '\n') ? 2 : 1;
+            *line += 1;
+            *offset = 0;
+        } else {
+            ++p;
+            *offset += 1;
         }
     }
-    return true;    
-}
-
-/// Arguments should be of type `const char*` and end with NULL
-__BK_API bool peek_ids(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    char* pp = lex->parse_point;
-    bool res = va_get_expect_ids(lex, args);
-    lex->parse_point = pp;
-    va_end(args);
-    return res;
 }
 
-/// Arguments should be of type `int` and end with -1
-__BK_API bool peek_tokens(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    char* pp = lex->parse_point;
-    bool res = va_get_expect_tokens(lex, args);
-    lex->parse_point = pp;
-    va_end(args);
-    return res;
+__BK_API void free_token_tape(TokenTape* tape) {
+    free(tape->tokens.items);
+    free_interner(&tape->strings);
 }
 
-/// Arguments should be of type `Word` and end with WEND
-__BK_API bool peek_c(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    char* pp = lex->parse_point;
-    bool res = va_get_expect_c(lex, args);
-    lex->parse_point = pp;
-    va_end(args);
-    return res;
+__BK_API bool may_contain_types(BkContext* bk, String_View content, bool derive_all) {
+    if (!sv_contains(content, sv("typedef"))) return false;
+    if (derive_all || !derive_set_empty(&bk->derive_schemas) || bk->conf.generics || bk->dynamic_schemas.len > 0) return true;
+    // Also matches misspelled attributes, so they are still reported
+    if (sv_contains(content, sv("derive"))) return true;
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        const char* derive_attr = bk->schemas.items[i].derive_attr;
+        if (strstr(derive_attr, "derive") == NULL && sv_contains(content, sv(derive_attr))) return true;
+    }
+    return false;
 }
 
-/// Arguments should be of type `int` and end with -1
-__BK_API bool get_expect_tokens(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    bool res = va_get_expect_tokens(lex, args);
-    va_end(args);
-    return res;
-}
+/// Identifiers `analyze_file` looks for, interned in this order right after the empty string so their ids are constants
+static const char* analysis_keywords[] = {
+    "typedef", "struct", "const", "char", "unsigned", "int", "long", "size_t", "double", "float", "bool", "tag", "derive_all",
+};
+enum {
+    KW_TYPEDEF = 1, KW_STRUCT, KW_CONST, KW_CHAR, KW_UNSIGNED, KW_INT, KW_LONG, KW_SIZE_T, KW_DOUBLE, KW_FLOAT, KW_BOOL, KW_TAG,
+    KW_DERIVE_ALL,
+};
 
-/// Arguments should be of type `const char*` and end with NULL
-__BK_API bool get_expect_ids(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    bool res = va_get_expect_ids(lex, args);
-    va_end(args);
-    return res;
+__BK_API void init_analysis_symbols(BkContext* bk) {
+    free_analysis_symbols(bk);
+    intern(&bk->symbols, "", 0);
+    for (size_t i = 0; i < sizeof analysis_keywords / sizeof *analysis_keywords; ++i) {
+        intern(&bk->symbols, analysis_keywords[i], strlen(analysis_keywords[i]));
+    }
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        intern(&bk->symbols, bk->schemas.items[i].derive_attr, strlen(bk->schemas.items[i].derive_attr));
+    }
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        intern(&bk->symbols, bk->dynamic_schemas.items[i].derive_attr.items, bk->dynamic_schemas.items[i].derive_attr.len);
+    }
+    while (bk->symbol_info.len < bk->symbols.strings.len) push_da(&bk->symbol_info, (AnalysisSymbol){0});
+
+    AnalysisSymbol* info = bk->symbol_info.items;
+    info[KW_INT].primitive = CINT;
+    info[KW_LONG].primitive = CLONG;
+    info[KW_SIZE_T].primitive = CULONG;
+    info[KW_DOUBLE].primitive = CFLOAT;
+    info[KW_FLOAT].primitive = CFLOAT;
+    info[KW_CHAR].primitive = CCHAR;
+    info[KW_BOOL].primitive = CBOOL;
+    // The first schema with a given attribute wins, `derive_all` wins over all of them
+    unsigned id;
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
+        find_interned(&bk->symbols, bk->schemas.items[i].derive_attr, strlen(bk->schemas.items[i].derive_attr), &id);
+        if (id != KW_DERIVE_ALL && info[id].schema == 0) info[id].schema = schema_index(bk, SCHEMA_STATIC, i) + 1;
+    }
+    for (size_t i = 0; i < bk->dynamic_schemas.len; ++i) {
+        find_interned(&bk->symbols, bk->dynamic_schemas.items[i].derive_attr.items, bk->dynamic_schemas.items[i].derive_attr.len, &id);
+        if (id != KW_DERIVE_ALL && info[id].schema == 0) info[id].schema = schema_index(bk, SCHEMA_DYNAMIC, i) + 1;
+    }
 }
 
-/// Arguments should be of type `Word` and end with WEND
-bool get_expect_c(stb_lexer* lex, ...) {
-    va_list args;
-    va_start(args, lex);
-    bool res = va_get_expect_c(lex, args);
-    va_end(args);
-    return res;
+__BK_API void free_analysis_symbols(BkContext* bk) {
+    free_interner(&bk->symbols);
+    free(bk->symbol_info.items);
+    bk->symbol_info = (AnalysisSymbols){0};
 }
 
-__BK_API void analyze_file(const char* file_name, String content, CCompounds* out, bool derive_all) {
-    static char string_store[4096];
-    stb_lexer lex = {0};
-    stb_c_lexer_init(&lex, content.items, content.items + content.len, string_store, sizeof string_store);
-    for (;;) {
-        char* pp = lex.parse_point;
-        stb_c_lexer_get_token(&lex);
-        if (!lex.token || lex.token == CLEX_eof) break;
-        lex.parse_point = pp;
+__BK_API void analyze_file(BkContext* bk, const char* file_name, String_View content, CCompounds* out, bool derive_all) {
+    unsigned long long start = stats_begin(bk);
+    if (!may_contain_types(bk, content, derive_all)) {
+        stats_end(bk, PHASE_ANALYZE, start, file_name, 0);
+        return;
+    }
+    size_t types_before = out->len;
+    size_t field_count = 0;
+    TokenTape tape = {.base = &bk->symbols};
+    tokenize(&tape, content);
+    // Fields and schemas are collected here and copied into the arena of `out` once their type is complete
+    Fields fields = {0};
+    DeriveSet derived = {0};
+    size_t schema_count = bk->schemas.len + bk->dynamic_schemas.len;
+
+    size_t i = 0;
+    while (!tape_is(&tape, i, CLEX_eof) && !tape_is(&tape, i, 0)) {
         // NOTE: this tool can only understand typedef struct {} Name; style definitions
-        if (get_expect_ids(&lex, "typedef", "struct", NULL)) {
-            if (!(get_expect_tokens(&lex, '{', -1))) continue;
-            CCompound strct = {0};
-            if (derive_all) strct.derived_schemas |= UINT_MAX;
-            for (;;) {
-                if (peek_tokens(&lex, '}', -1)) break;
-                Field field = {0};
-                if (peek_c(&lex, ID("const"), ID("char"), TK('*'), TK(CLEX_id), WEND)) { 
-                    stb_c_lexer_get_token(&lex); // const
-                    stb_c_lexer_get_token(&lex); // char
-                    stb_c_lexer_get_token(&lex); // *
-                    field.type.kind = CPRIMITIVE;
-                    field.type.type = CSTRING;
-                } else if (peek_c(&lex, ID("char"), TK('*'), TK(CLEX_id), WEND)) {
-                    stb_c_lexer_get_token(&lex); // char
-                    stb_c_lexer_get_token(&lex); // *
-                    field.type.kind = CPRIMITIVE;
-                    field.type.type = CSTRING;
-                } else if (peek_tokens(&lex, CLEX_id, CLEX_id, CLEX_id, -1)) {
-                    bool is_known_primitive = true;
-                    if (peek_ids(&lex, "unsigned", "int", NULL)) {
-                        field.type.type = CUINT;
-                    } else if (peek_ids(&lex, "unsigned", "long", NULL)) {
-                        field.type.type = CULONG;
-                    } else {
-                        is_known_primitive = false;
-                    }
-                    if (is_known_primitive) {
-                        field.type.kind = CPRIMITIVE;
-                        stb_c_lexer_get_token(&lex); // type name 1
-                        stb_c_lexer_get_token(&lex); // type name 2
-                    } else {
-                        bk_diag(LOG_INFO, "Unknown type while parsing sruct, skipping...\n");
-                        break;
-                    }
-                    
-                } else if (peek_tokens(&lex, CLEX_id, CLEX_id, -1)) {
-                    bool is_known_primitive = true;
-                    if (peek_ids(&lex, "int", NULL)) {
-                        field.type.type = CINT;
-                    } else if (peek_ids(&lex, "long", NULL)) {
-                        field.type.type = CLONG;
-                    } else if (peek_ids(&lex, "size_t", NULL)) {
-                        field.type.type = CULONG;
-                    } else if (peek_ids(&lex, "double", NULL) || peek_ids(&lex, "float", NULL)) {
-                        field.type.type = CFLOAT;
-                    } else if (peek_ids(&lex, "char", NULL)) {
-                        field.type.type = CCHAR;
-                    } else if (peek_ids(&lex, "double", NULL) || peek_ids(&lex, "float", NULL)) {
-                        field.type.type = CFLOAT;
-                    } else if (peek_ids(&lex, "bool", NULL)) {
-                        field.type.type = CBOOL;
-                    } else {
-                        is_known_primitive = false;
-                    }
-                    stb_c_lexer_get_token(&lex); // type name
-                    if (!is_known_primitive) {
-                        field.type.kind = CEXTERNAL;
-                        field.type.name = strdup(lex.string); // alloc
-                    } else {
-                        field.type.kind = CPRIMITIVE;
-                    }
+        if (!tape_is_id(&tape, i, KW_TYPEDEF) || !tape_is_id(&tape, i + 1, KW_STRUCT)) {
+            i += 1;
+            continue;
+        }
+        i += 2;
+        if (!tape_is(&tape, i++, '{')) continue;
+        CCompound strct = {0};
+        fields.len = 0;
+        derived.len = 0;
+        if (derive_all) derive_set_add_all(&derived, schema_count);
+        for (;;) {
+            if (tape_is(&tape, i, '}')) break;
+            Field field = {0};
+            if (tape_is_id(&tape, i, KW_CONST) && tape_is_id(&tape, i + 1, KW_CHAR) && tape_is(&tape, i + 2, '*') && tape_is(&tape, i + 3, CLEX_id)) {
+                i += 3; // const char *
+                field.type.kind = CPRIMITIVE;
+                field.type.type = CSTRING;
+            } else if (tape_is_id(&tape, i, KW_CHAR) && tape_is(&tape, i + 1, '*') && tape_is(&tape, i + 2, CLEX_id)) {
+                i += 2; // char *
+                field.type.kind = CPRIMITIVE;
+                field.type.type = CSTRING;
+            } else if (tape_is(&tape, i, CLEX_id) && tape_is(&tape, i + 1, CLEX_id) && tape_is(&tape, i + 2, CLEX_id)) {
+                if (tape_is_id(&tape, i, KW_UNSIGNED) && tape_is_id(&tape, i + 1, KW_INT)) {
+                    field.type.type = CUINT;
+                } else if (tape_is_id(&tape, i, KW_UNSIGNED) && tape_is_id(&tape, i + 1, KW_LONG)) {
+                    field.type.type = CULONG;
                 } else {
-                    bk_diag(LOG_INFO, "Couldn't parse field in struct, skipping...\n");
-                }
-                stb_c_lexer_get_token(&lex); // name
-                field.name = strdup(lex.string); // alloc
-                if (!get_expect_tokens(&lex, ';', -1)) {
-                    // At this point we don't know if we are looking at the right kind of field. So it doesn't make sense to report this.
-                    // bk_diag(LOG_ERROR, "Expected ';'.\n");
-                    free_field(field);
+                    bk_diag(LOG_INFO, i, "Unknown type while parsing sruct, skipping...\n");
                     break;
                 }
-                if (peek_c(&lex, ID("tag"), TK('('), TK(CLEX_dqstring), TK(')'), WEND)) {
-                    stb_c_lexer_get_token(&lex); // tag
-                    stb_c_lexer_get_token(&lex); // (
-                    stb_c_lexer_get_token(&lex); // name
-                    field.tag = strdup(lex.string); // alloc
-                    stb_c_lexer_get_token(&lex); // )
+                field.type.kind = CPRIMITIVE;
+                i += 2; // type names
+            } else if (tape_is(&tape, i, CLEX_id) && tape_is(&tape, i + 1, CLEX_id)) {
+                unsigned type_name = tape_at(&tape, i)->string;
+                CPrimitive primitive = type_name < bk->symbol_info.len ? bk->symbol_info.items[type_name].primitive : 0;
+                if (primitive != 0) {
+                    field.type.kind = CPRIMITIVE;
+                    field.type.type = primitive;
                 } else {
-                    field.tag = NULL;
+                    field.type.kind = CEXTERNAL;
+                    field.type.name = intern_str(&out->names, tape_string(&tape, type_name));
                 }
-                push_da(&strct.fields, field);
+                i += 1; // type name
+            } else {
+                bk_diag(LOG_INFO, i, "Couldn't parse field in struct, skipping...\n");
             }
-
-            if (!get_expect_tokens(&lex, '}', CLEX_id, -1)) {
-                free_ccompund(strct);
-                continue;
+            field.name = intern_str(&out->names, tape_string(&tape, tape_at(&tape, i++)->string));
+            if (!tape_is(&tape, i++, ';')) {
+                // At this point we don't know if we are looking at the right kind of field. So it doesn't make sense to report this.
+                break;
             }
-            strct.name = strdup(lex.string); // alloc
-            while (peek_tokens(&lex, CLEX_id, '(', ')', -1)) {
-                bool matched = false;
-
-                // Special attribute(s)
-                if (peek_ids(&lex, "derive_all", NULL)) {
-                    strct.derived_schemas |= UINT_MAX;
-                    matched = true;
-                } else {
-                    for (size_t i = 0; i < bk.schemas.len; ++i) {
-                        StaticSchema* schema = bk.schemas.items + i;
-                        if (peek_ids(&lex, schema->derive_attr, NULL)) {
-                            strct.derived_schemas |= get_schema_derive(SCHEMA_STATIC, i);
-                            matched = true;
-                            break;
-                        }
-                    }
-                    if (!matched) {
-                        for (size_t i = 0; i < bk.dynamic_schemas.len; ++i) {
-                            DynamicSchema* schema = bk.dynamic_schemas.items + i;
-                            char* derive_attr = sv_to_cstr(schema->derive_attr);
-                            if (peek_ids(&lex, derive_attr, NULL)) {
-                                strct.derived_schemas |= get_schema_derive(SCHEMA_DYNAMIC, i);
-                                matched = true;
-                                free(derive_attr);
-                                break;
-                            } else {
-                                free(derive_attr);
-                            }
-                        }
-                    }
-                }
+            if (tape_is_id(&tape, i, KW_TAG) && tape_is(&tape, i + 1, '(') && tape_is(&tape, i + 2, CLEX_dqstring) && tape_is(&tape, i + 3, ')')) {
+                field.tag = intern_str(&out->names, tape_string(&tape, tape_at(&tape, i + 2)->string));
+                i += 4;
+            } else {
+                field.tag = NULL;
+            }
+            push_da(&fields, field);
+        }
 
-                stb_c_lexer_get_token(&lex); // derive_schema
-                if (!matched) {
-                    if (bk.conf.warn_unknown_attr) bk_diag(LOG_WARN, "Found unknown attribute '%s' while parsing type '%s'. [-W "WARN_UNKNOWN_ATTR"]\n", lex.string, strct.name);
-                }
-                stb_c_lexer_get_token(&lex); // (
-                stb_c_lexer_get_token(&lex); // )
-                
+        if (!tape_is(&tape, i++, '}') || !tape_is(&tape, i++, CLEX_id)) continue;
+        strct.name = intern_str(&out->names, tape_string(&tape, tape_at(&tape, i - 1)->string));
+        while (tape_is(&tape, i, CLEX_id) && tape_is(&tape, i + 1, '(') && tape_is(&tape, i + 2, ')')) {
+            unsigned attr = tape_at(&tape, i)->string;
+            // Special attribute(s)
+            if (attr == KW_DERIVE_ALL) {
+                derive_set_add_all(&derived, schema_count);
+            } else if (attr < bk->symbol_info.len && bk->symbol_info.items[attr].schema != 0) {
+                derive_set_add(&derived, bk->symbol_info.items[attr].schema - 1);
+            } else if (bk->conf.warn_unknown_attr) {
+                bk_diag(LOG_WARN, i, "Found unknown attribute '%s' while parsing type '%s'. [-W "WARN_UNKNOWN_ATTR"]\n", tape_string(&tape, attr), strct.name);
             }
-            push_da(out, strct);
-        } else {
-            lex.parse_point = pp;
-            stb_c_lexer_get_token(&lex);
+            i += 3; // derive_schema ( )
         }
+        strct.fields = fields;
+        strct.derived_schemas = derived;
+        push_ccompound(out, strct);
+        field_count += fields.len;
     }
+    if (fields.items != NULL) free(fields.items);
+    if (derived.items != NULL) free(derived.items);
+    free_token_tape(&tape);
+    stats_count_types(bk, out->len - types_before, field_count);
+    stats_end(bk, PHASE_ANALYZE, start, file_name, 0);
 }
 
-__BK_API int get_schema_derive(SchemaType schema_type, size_t index) {
-    switch (schema_type) {
-    case SCHEMA_STATIC: {
-        return (1 << index);
-    } break;
-    case SCHEMA_DYNAMIC: {
-        return (1 << (index + bk.schemas.len));
-    } break;
+__BK_API size_t schema_index(BkContext* bk, SchemaType schema_type, size_t index) {
+    return schema_type == SCHEMA_DYNAMIC ? bk->schemas.len + index : index;
+}
+
+__BK_API void derive_set_add(DeriveSet* set, size_t index) {
+    while (set->len <= index / 64) push_da(set, 0ULL);
+    set->items[index / 64] |= 1ULL << (index % 64);
+}
+
+__BK_API void derive_set_add_all(DeriveSet* set, size_t count) {
+    if (count == 0) return;
+    while (set->len < (count + 63) / 64) push_da(set, 0ULL);
+    for (size_t i = 0; i < count / 64; ++i) set->items[i] = ~0ULL;
+    if (count % 64 != 0) set->items[count / 64] |= (1ULL << (count % 64)) - 1;
+}
+
+__BK_API size_t derive_set_next(const DeriveSet* set, size_t from) {
+    for (size_t w = from / 64; w < set->len; ++w) {
+        unsigned long long word = set->items[w];
+        if (w == from / 64) word &= ~0ULL << (from % 64);
+        if (word != 0) return w * 64 + (size_t)__builtin_ctzll(word);
     }
+    return DERIVE_SET_END;
+}
+
+__BK_API bool derive_set_empty(const DeriveSet* set) {
+    return set->len == 0;
 }
 
-void gen_prelude(String* book_buf, CCompound* ty) {
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
-        StaticSchema* s = bk.schemas.items + i;
-        if (ty->derived_schemas & get_schema_derive(SCHEMA_STATIC, i)) {
-            print_string(book_buf, "#ifndef ___BK_PRELUDE_%s___\n", s->name);
-            print_string(book_buf, "#define ___BK_PRELUDE_%s___\n", s->name);
-            if (s->gen_prelude != NULL) s->gen_prelude(book_buf);
-            print_string(book_buf, "#endif // ___BK_PRELUDE_%s___\n", s->name);
+bool gen_entry(BkContext* bk, String* book_buf, CCompounds* types) {
+    if (types->len == 0) return false;
+    print_string(book_buf, "#ifndef %s\n", bk->conf.gen_fmt_dst_macro);
+    print_string(book_buf, "#define %s FILE*\n", bk->conf.gen_fmt_dst_macro);
+    print_string(book_buf, "#endif // %s\n", bk->conf.gen_fmt_dst_macro);
+    print_string(book_buf, "#ifndef %s\n", bk->conf.gen_fmt_macro);
+    print_string(book_buf, "#define %s(...) offset += fprintf(dst, __VA_ARGS__)\n", bk->conf.gen_fmt_macro);
+    print_string(book_buf, "#endif // %s\n", bk->conf.gen_fmt_macro);
+    print_string(book_buf, "#ifndef %s\n", bk->conf.offset_type_macro);
+    print_string(book_buf, "#define %s size_t\n", bk->conf.offset_type_macro);
+    print_string(book_buf, "#endif // %s\n", bk->conf.offset_type_macro);
+    size_t num_decls = 0;
+    size_t len_before_decls = book_buf->len;
+    for (size_t i = 0; i < types->len; ++i) {
+        gen_prelude(bk, book_buf, types->items + i);
+        if (!bk->conf.disable_dump) {
+            num_decls += gen_dump_decl(bk, book_buf, types->items + i, bk->conf.gen_fmt_dst_macro);
+        }
+        if (!bk->conf.disable_parse) {
+            num_decls += gen_parse_decl(bk, book_buf, types->items + i);
+        }
+    }
+    if (num_decls == 0 && bk->dynamic_schemas.len == 0) return false;
+
+    if (num_decls > 0) {
+        print_string(book_buf, "\n#ifdef %s\n", bk->conf.gen_implementation_macro);
+        for (size_t i = 0; i < types->len; ++i) {
+            if (!bk->conf.disable_dump) {
+                gen_dump_impl(bk, book_buf, types->items + i, bk->conf.gen_fmt_dst_macro, bk->conf.gen_fmt_macro);
+            }
+            if (!bk->conf.disable_parse) {
+                gen_parse_impl(bk, book_buf, types->items + i);
+            }
+            print_string(book_buf, "\n#define ___BK_INCLUDE_TYPE_%s\n", types->items[i].name);
         }
+        print_string(book_buf, "\n#endif // %s\n", bk->conf.gen_implementation_macro);
+    } else {
+        book_buf->len = len_before_decls;
+    }
+    for (size_t i = 0; i < types->len; ++i) {
+        gen_dynamic(bk, book_buf, types->items + i, bk->conf.gen_fmt_dst_macro, bk->conf.gen_fmt_macro);
+    }
+    push_da(book_buf, '\n');
+    return true;
+}
+
+void gen_prelude(BkContext* bk, String* book_buf, CCompound* ty) {
+    for (size_t i = derive_set_next(&ty->derived_schemas, 0); i < bk->schemas.len; i = derive_set_next(&ty->derived_schemas, i + 1)) {
+        StaticSchema* s = bk->schemas.items + i;
+        print_string(book_buf, "#ifndef ___BK_PRELUDE_%s___\n", s->name);
+        print_string(book_buf, "#define ___BK_PRELUDE_%s___\n", s->name);
+        if (s->gen_prelude != NULL) s->gen_prelude(bk, book_buf);
+        print_string(book_buf, "#endif // ___BK_PRELUDE_%s___\n", s->name);
     }
 }
 
-size_t gen_dump_decl(String* book_buf, CCompound* ty, const char* dst_type) {
+size_t gen_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {
     size_t count = 0;
-    if (ty->derived_schemas == 0) return count;
+    if (derive_set_empty(&ty->derived_schemas)) return count;
     gen_def_guard(BK_DUMP_UPPER);
-    print_string(book_buf, "\n");
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
-        StaticSchema* schema = bk.schemas.items + i;
-        if (ty->derived_schemas & get_schema_derive(SCHEMA_STATIC, i)) {
-            if (schema->gen_dump_decl != NULL) {
-                gen_def_type_guard(BK_DUMP_UPPER);
-                count += schema->gen_dump_decl(book_buf, ty, dst_type);
-                gen_endif_type_guard(BK_DUMP_UPPER);
-            }
+    print_lit(book_buf, "\n");
+    for (size_t i = derive_set_next(&ty->derived_schemas, 0); i < bk->schemas.len; i = derive_set_next(&ty->derived_schemas, i + 1)) {
+        StaticSchema* schema = bk->schemas.items + i;
+        if (schema->gen_dump_decl != NULL) {
+            gen_def_type_guard(BK_DUMP_UPPER);
+            count += schema->gen_dump_decl(bk, book_buf, ty, dst_type);
+            gen_endif_type_guard(BK_DUMP_UPPER);
         }
     }
     gen_endif_guard(BK_DUMP_UPPER);
     return count;
 }
 
-size_t gen_parse_decl(String* book_buf, CCompound* ty) {
+size_t gen_parse_decl(BkContext* bk, String* book_buf, CCompound* ty) {
     size_t count = 0;
-    if (ty->derived_schemas == 0) return count;
+    if (derive_set_empty(&ty->derived_schemas)) return count;
     gen_def_guard(BK_PARSE_UPPER);
-    print_string(book_buf, "\n");
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
-        StaticSchema* schema = bk.schemas.items + i;
-        if (ty->derived_schemas & get_schema_derive(SCHEMA_STATIC, i)) {
-            if (schema->gen_parse_decl != NULL) {
-                gen_def_type_guard(BK_PARSE_UPPER);
-                count += schema->gen_parse_decl(book_buf, ty);
-                gen_endif_type_guard(BK_PARSE_UPPER);
-            }
+    print_lit(book_buf, "\n");
+    for (size_t i = derive_set_next(&ty->derived_schemas, 0); i < bk->schemas.len; i = derive_set_next(&ty->derived_schemas, i + 1)) {
+        StaticSchema* schema = bk->schemas.items + i;
+        if (schema->gen_parse_decl != NULL) {
+            gen_def_type_guard(BK_PARSE_UPPER);
+            count += schema->gen_parse_decl(bk, book_buf, ty);
+            gen_endif_type_guard(BK_PARSE_UPPER);
         }
     }
     gen_endif_guard(BK_PARSE_UPPER);
     return count;
 }
 
-void gen_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
-    if (ty->derived_schemas == 0) return;
+void gen_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    if (derive_set_empty(&ty->derived_schemas)) return;
     gen_def_guard(BK_DUMP_UPPER);
-    print_string(book_buf, "\n");
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
-        StaticSchema* schema = bk.schemas.items + i;
-        if (ty->derived_schemas & get_schema_derive(SCHEMA_STATIC, i)) {
-            if (schema->gen_dump_impl != NULL) {
-                gen_def_type_guard(BK_DUMP_UPPER);
-                schema->gen_dump_impl(book_buf, ty, dst_type, fmt_macro);
-                gen_endif_type_guard(BK_DUMP_UPPER);
-            }
+    print_lit(book_buf, "\n");
+    for (size_t i = derive_set_next(&ty->derived_schemas, 0); i < bk->schemas.len; i = derive_set_next(&ty->derived_schemas, i + 1)) {
+        StaticSchema* schema = bk->schemas.items + i;
+        if (schema->gen_dump_impl != NULL) {
+            gen_def_type_guard(BK_DUMP_UPPER);
+            unsigned long long start = stats_begin(bk);
+            schema->gen_dump_impl(bk, book_buf, ty, dst_type, fmt_macro);
+            stats_schema(bk, PHASE_STATIC_SCHEMA, sv(schema->name), start, ty->name);
+            gen_endif_type_guard(BK_DUMP_UPPER);
         }
     }
     gen_endif_guard(BK_DUMP_UPPER);
 }
 
-void gen_parse_impl(String* book_buf, CCompound* ty) {
-    if (ty->derived_schemas == 0) return;
+void gen_parse_impl(BkContext* bk, String* book_buf, CCompound* ty) {
+    if (derive_set_empty(&ty->derived_schemas)) return;
     gen_def_guard(BK_PARSE_UPPER);
-    print_string(book_buf, "\n");
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
-        StaticSchema* schema = bk.schemas.items + i;
-        if (ty->derived_schemas & get_schema_derive(SCHEMA_STATIC, i)) {
-            if (schema->gen_parse_impl != NULL) {
-                gen_def_type_guard(BK_PARSE_UPPER);
-                schema->gen_parse_impl(book_buf, ty);
-                gen_endif_type_guard(BK_PARSE_UPPER);
-            }
+    print_lit(book_buf, "\n");
+    for (size_t i = derive_set_next(&ty->derived_schemas, 0); i < bk->schemas.len; i = derive_set_next(&ty->derived_schemas, i + 1)) {
+        StaticSchema* schema = bk->schemas.items + i;
+        if (schema->gen_parse_impl != NULL) {
+            gen_def_type_guard(BK_PARSE_UPPER);
+            unsigned long long start = stats_begin(bk);
+            schema->gen_parse_impl(bk, book_buf, ty);
+            stats_schema(bk, PHASE_STATIC_SCHEMA, sv(schema->name), start, ty->name);
+            gen_endif_type_guard(BK_PARSE_UPPER);
         }
     }
     gen_endif_guard(BK_PARSE_UPPER);
 }
 
-void gen_dynamic(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
-    // Honestly the current implementation of this is a mess, this function should be cleaned up.
-    if (ty->derived_schemas == 0) return;
-    print_string(book_buf, "\n#ifndef %s%s\n", bk.conf.disable_macro_prefix, ty->name);
-    for (size_t schema_i = 0; schema_i < bk.dynamic_schemas.len; ++schema_i) {
-        String impl = {0}; // alloc
-        DynamicSchema* schema = bk.dynamic_schemas.items + schema_i;
-        print_string(book_buf, "\n#ifndef %s"SV_FMT"\n", bk.conf.disable_macro_prefix, SV_ARG(schema->name));
-        String_View cursor = sv_trim_whitespace_start(schema->source);
-        bool in_special = false;
-        bool in_loop = false;
-        bool in_if = false;
-        String_View current_type_name = {0};
-        String_View special_start = cursor;
-        String_View normal_start = cursor;
-        String_View special_prefix = sv("$");
-        while (cursor.len > 0) {
-            if (sv_starts_with(cursor, special_prefix)) {
-                if (in_special) {
-                    in_special = false;
-                    String_View special = sv_substr(special_start, 0, special_start.len - cursor.len);
-                    special = sv_trim_whitespace_start(special);
-                    if (sv_chop_if_prefix(&special, sv("ty"))) {
-                        if (in_loop) {
-                            print_string(&impl, "%s", ty->name);
-                        } else {
-                            print_string(book_buf, "%s", ty->name);
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("implguard"))) {
-                        print_string(book_buf, "\n#ifdef %s\n", bk.conf.gen_implementation_macro);
-                    } else if (sv_chop_if_prefix(&special, sv("endimplguard"))) {
-                        print_string(book_buf, "\n#endif // %s\n", bk.conf.gen_implementation_macro);
-                    } else if (sv_chop_if_prefix(&special, sv("dumpguard"))) {
-                        print_string(book_buf, "\n#ifndef %s"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix);
-                        print_string(book_buf, "\n#ifndef %s%s_"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix, ty->name);
-                    } else if (sv_chop_if_prefix(&special, sv("enddumpguard"))) {
-                        print_string(book_buf, "\n#endif // %s%s_"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix, ty->name);
-                        print_string(book_buf, "\n#endif // %s"BK_DUMP_UPPER"\n", bk.conf.disable_macro_prefix);
-                    } else if (sv_chop_if_prefix(&special, sv("parseguard"))) {
-                        print_string(book_buf, "\n#ifndef %s"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix);
-                        print_string(book_buf, "\n#ifndef %s%s_"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix, ty->name);
-                    } else if (sv_chop_if_prefix(&special, sv("endparseguard"))) {
-                        print_string(book_buf, "\n#endif // %s%s_"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix, ty->name);
-                        print_string(book_buf, "\n#endif // %s"BK_PARSE_UPPER"\n", bk.conf.disable_macro_prefix);
-                    } else if (sv_chop_if_prefix(&special, sv("fmt"))) {
-                        if (in_loop) {
-                            print_string(&impl, "%s", fmt_macro);
-                        } else {
-                            print_string(book_buf, "%s", fmt_macro);
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("dst"))) {
-                        if (in_loop) {
-                            print_string(&impl, "%s", dst_type);
-                        } else {
-                            print_string(book_buf, "%s", dst_type);
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("offset"))) {
-                        if (in_loop) {
-                            print_string(&impl, "%s", bk.conf.offset_type_macro);
-                        } else {
-                            print_string(book_buf, "%s", bk.conf.offset_type_macro);
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("it"))) {
-                        if (in_loop) {
-                            if (sv_chop_if_prefix(&special, sv(".type"))) {
-                                print_string(&impl, SV_FMT"type"SV_FMT, SV_ARG(special_prefix), SV_ARG(special_prefix));
-                            } else {
-                                print_string(&impl, SV_FMT"field"SV_FMT, SV_ARG(special_prefix), SV_ARG(special_prefix));
-                            }
-                        } else {
-                            bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': 'it' directives can't be used outside of for loops\n", SV_ARG(schema->name));
-                            goto __continue_free;
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("tag"))) {
-                        if (in_loop) {
-                            print_string(&impl, SV_FMT"tag"SV_FMT, SV_ARG(special_prefix), SV_ARG(special_prefix));
-                        } else {
-                            bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': 'tag' directive can't be used outside of for loops\n", SV_ARG(schema->name));
-                            goto __continue_free;
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("for"))) {
-                        if (in_loop) {
-                            bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Nested for loops aren't supported\n", SV_ARG(schema->name));
-                            goto __continue_free;
-                        } else {
-                            if (sv_find(special, '{').items[0] != '{') {
-                                bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Expected '{' in for loop\n", SV_ARG(schema->name));
-                                goto __continue_free;
-                            } else {
-                                in_loop = true;
-                            }
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("if"))) {
-                        if (sv_find(special, '{').items[0] != '{') {
-                            bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Expected '{' in if cond\n", SV_ARG(schema->name));
-                            goto __continue_free;
-                        } else {
-                            in_if = true;
-                        }
-                        special = sv_trim_whitespace_start(special);
-                        String_View cond = sv_substr(special, 0, special.len - sv_find(special, ' ').len);
-                        if (sv_starts_with(cond, sv("index")) && in_loop) {
-                            cond = special;
-                            cond = sv_chop(cond, 5);
-                            cond = sv_trim_whitespace_start(cond);
-                            String_View op_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
-                            cond = sv_find(cond, ' ');
-                            cond = sv_trim_whitespace_start(cond);
-                            String_View value_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
-                            if (sv_starts_with(op_v, sv("=="))) {
-                                print_string(&impl, "$if == "SV_FMT" {$", SV_ARG(value_v));
-                            } else if (sv_starts_with(op_v, sv("!="))) {
-                                print_string(&impl, "$if != "SV_FMT" {$", SV_ARG(value_v));
-                            } else {
-                                bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Unknown binary op '"SV_FMT"' in if cond\n", SV_ARG(schema->name), SV_ARG(op_v));
-                                goto __continue_free;
-                            }
-
-                        } else {
-                            current_type_name = cond;
-                            print_string(&impl, "$if "SV_FMT" {$", SV_ARG(current_type_name));
-                        }
-                    } else if (sv_chop_if_prefix(&special, sv("}"))) {
-                        if (in_if) {
-                            in_if = false;
-                            print_string(&impl, "$}$");
-                        } else {
-                            if (in_loop) {
-                                in_loop = false;
-                                for (size_t field_i = 0; field_i < ty->fields.len; ++field_i) {
-                                    Field* field = ty->fields.items + field_i;
-                                    String_View cursor = sv_from_str(&impl);
-                                    String_View special_start = cursor;
-                                    String_View normal_start = cursor;
-                                    bool in_special = false;
-                                    bool in_if = false;
-                                    bool in_if_cond_true = false;
-                                    bool in_correct_type = false;
-                                    // Not doing syntax error checks error since this is generated intermediate code
-                                    while (cursor.len > 0) {
-                                        if (sv_starts_with(cursor, special_prefix)) {
-                                            if (in_special) {
-                                                in_special = false;
-                                                String_View special = sv_substr(special_start, 0, special_start.len - cursor.len);
-                                                special = sv_trim_whitespace_start(special);
-                                                if (sv_chop_if_prefix(&special, sv("if"))) {
-                                                    in_if = true;
-                                                    in_if_cond_true = false;
-                                                    in_correct_type = false;
-                                                    special = sv_trim_whitespace_start(special);
-                                                    String_View cond = sv_substr(special, 0, special.len - sv_find(special, ' ').len);
-                                                    if (sv_chop_if_prefix(&cond, sv("=="))) {
-                                                        String_View value_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
-                                                        char* value_c = sv_to_cstr(value_v); // alloc
-                                                        size_t value = (size_t)(atoi(value_c));
-                                                        if (value == field_i) in_if_cond_true = true;
-                                                        free(value_c);
-                                                    } else if (sv_chop_if_prefix(&cond, sv("!="))) {
-                                                        String_View value_v = sv_substr(cond, 0, cond.len - sv_find(cond, ' ').len);
-                                                        char* value_c = sv_to_cstr(value_v); // alloc
-                                                        size_t value = (size_t)(atoi(value_c));
-                                                        if (value != field_i) in_if_cond_true = true;
-                                                        free(value_c);
-                                                    } else {
-                                                        String_View type_name = cond;
-                                                        switch (field->type.kind) {
-                                                        case CPRIMITIVE: {
-                                                        switch (field->type.type) {
-                                                        case CINT: {
-                                                            if (sv_starts_with(type_name, sv("CINT"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CUINT: {
-                                                            if (sv_starts_with(type_name, sv("CUINT"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CLONG: {
-                                                            if (sv_starts_with(type_name, sv("CLONG"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CULONG: {
-                                                            if (sv_starts_with(type_name, sv("CULONG"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CCHAR: {
-                                                            if (sv_starts_with(type_name, sv("CCHAR"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CFLOAT: {
-                                                            if (sv_starts_with(type_name, sv("CFLOAT"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CBOOL: {
-                                                            if (sv_starts_with(type_name, sv("CBOOL"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        case CSTRING: {
-                                                            if (sv_starts_with(type_name, sv("CSTRING"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        }
-                                                        } break;
-                                                        case CEXTERNAL: {
-                                                            if (sv_starts_with(type_name, sv("CEXTERNAL"))) {
-                                                                in_if_cond_true = true;
-                                                                in_correct_type = true;
-                                                            }
-                                                        } break;
-                                                        }
-                                                    }
-                                                } else if (sv_chop_if_prefix(&special, sv("}"))) {
-                                                    in_if_cond_true = false;
-                                                    in_correct_type = false;
-                                                    in_if = false;
-                                                } else if (sv_chop_if_prefix(&special, sv("type"))) {
-                                                    if (field->type.kind == CEXTERNAL && in_correct_type) {
-                                                        if ((in_if && in_correct_type) || !in_if)
-                                                            print_string(book_buf, "%s", field->type.name);
-                                                    } else if (in_correct_type) {
-                                                        bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': $it.type$ can only be used in CEXTERNAL fields.\n", SV_ARG(schema->name));
-                                                        goto __continue_free;
-                                                    }
-                                                } else if (sv_chop_if_prefix(&special, sv("tag"))) {
-                                                    if ((in_if && in_if_cond_true) || !in_if)
-                                                        print_string(book_buf, "%s", field->tag ? field->tag : field->name);
-                                                } else if (sv_chop_if_prefix(&special, sv("field"))) {
-                                                    if ((in_if && in_if_cond_true) || !in_if)
-                                                        print_string(book_buf, "%s", field->name);
-                                                } else {
-                                                    bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': '"SV_FMT"': INTERNAL ERROR REPORT AS BUG IF ENCOUNTERED\n", SV_ARG(schema->name), SV_ARG(special));
-                                                    break;
-                                                }
-                                                cursor = sv_chop(cursor, special_prefix.len);
-                                                normal_start = cursor;
-                                            } else {
-                                                in_special = true;
-                                                if (cursor.len > 1) {
-                                                    if ((in_if && in_if_cond_true) || !in_if) {
-                                                        String_View v = sv_substr(normal_start, 0, normal_start.len - cursor.len);
-                                                        print_string(book_buf, SV_FMT, SV_ARG(sv_trim_whitespace(v)));
-                                                    }
-                                                }
-                                                cursor = sv_chop(cursor, special_prefix.len);
-                                                special_start = cursor;
-                                            }
-                                        } else {
-                                            cursor = sv_chop(cursor, 1);
-                                        }
-                                    }
-                                    String_View v = sv_substr(normal_start, 0, normal_start.len - cursor.len);
-                                    print_string(book_buf, SV_FMT, SV_ARG(sv_trim_whitespace(v)));
-                                }
-                                impl.len = 0;                                
-                            } else {
-                                bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Mismatched '}'\n", SV_ARG(schema->name));
-                                goto __continue_free;
-                            }
-                        }
-                    } else {
-                        bk_log(LOG_ERROR, "In dynamic schema '"SV_FMT"': Unknown special directive '"SV_FMT"'\n", SV_ARG(schema->name), SV_ARG(special));
-                        goto __continue_free;
-                    }
-                    cursor = sv_chop(cursor, special_prefix.len);
-                    normal_start = cursor;
-                } else {
-                    in_special = true;
-                    if (cursor.len > 1) {
-                        if (in_loop) {
-                            print_string(&impl, SV_FMT, SV_ARG_N(normal_start, normal_start.len - cursor.len));
-                        } else {
-                            String_View v = sv_substr(normal_start, 0, normal_start.len - cursor.len);
-                            print_string(book_buf, SV_FMT, SV_ARG(v));
-                        }
-                    }
-                    cursor = sv_chop(cursor, special_prefix.len);
-                    special_start = cursor;
-                }
+/// Runs the operations of a compiled dynamic schema, `field` is the current field inside of loop bodies
+static void run_schema_ops(BkContext* bk, String* book_buf, CCompound* ty, const SchemaOp* ops, size_t len, Field* field, size_t field_i, const char* dst_type, const char* fmt_macro) {
+    bool in_if = false;
+    bool in_if_cond_true = false;
+    bool in_correct_type = false;
+    size_t segment_start = 0;
+    for (size_t i = 0; i < len; ++i) {
+        const SchemaOp* op = ops + i;
+        switch (op->kind) {
+        case SOP_TEXT:
+        case SOP_TY:
+        case SOP_FMT:
+        case SOP_DST:
+        case SOP_OFFSET: {
+            if (in_if && !in_if_cond_true && !(op->flags & SOP_ALWAYS)) break;
+            if (op->flags & SOP_SEGMENT_START) segment_start = book_buf->len;
+            if (op->kind == SOP_TEXT) {
+                print_sv(book_buf, op->text);
             } else {
-                cursor = sv_chop(cursor, 1);
+                const char* value = bk->conf.offset_type_macro;
+                if (op->kind == SOP_TY) value = ty->name;
+                else if (op->kind == SOP_FMT) value = fmt_macro;
+                else if (op->kind == SOP_DST) value = dst_type;
+                append_string(book_buf, value, strlen(value));
+            }
+            if (op->flags & SOP_SEGMENT_END) {
+                String_View segment = sv_trim_whitespace(sv_substr(sv_from_str(book_buf), segment_start, book_buf->len - segment_start));
+                memmove(book_buf->items + segment_start, segment.items, segment.len);
+                book_buf->len = segment_start + segment.len;
+                book_buf->items[book_buf->len] = '\0';
+            }
+        } break;
+        case SOP_IMPLGUARD: {
+            print_string(book_buf, "\n#ifdef %s\n", bk->conf.gen_implementation_macro);
+        } break;
+        case SOP_ENDIMPLGUARD: {
+            print_string(book_buf, "\n#endif // %s\n", bk->conf.gen_implementation_macro);
+        } break;
+        case SOP_DUMPGUARD: {
+            print_string(book_buf, "\n#ifndef %s"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix);
+            print_string(book_buf, "\n#ifndef %s%s_"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix, ty->name);
+        } break;
+        case SOP_ENDDUMPGUARD: {
+            print_string(book_buf, "\n#endif // %s%s_"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix, ty->name);
+            print_string(book_buf, "\n#endif // %s"BK_DUMP_UPPER"\n", bk->conf.disable_macro_prefix);
+        } break;
+        case SOP_PARSEGUARD: {
+            print_string(book_buf, "\n#ifndef %s"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix);
+            print_string(book_buf, "\n#ifndef %s%s_"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix, ty->name);
+        } break;
+        case SOP_ENDPARSEGUARD: {
+            print_string(book_buf, "\n#endif // %s%s_"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix, ty->name);
+            print_string(book_buf, "\n#endif // %s"BK_PARSE_UPPER"\n", bk->conf.disable_macro_prefix);
+        } break;
+        case SOP_FOR: {
+            for (size_t j = 0; j < ty->fields.len; ++j) {
+                run_schema_ops(bk, book_buf, ty, op + 1, op->value, ty->fields.items + j, j, dst_type, fmt_macro);
+            }
+            i += op->value;
+        } break;
+        case SOP_TAIL: {
+            print_lit(book_buf, "\n");
+            print_sv(book_buf, op->text);
+        } break;
+        case SOP_FIELD: {
+            if (!in_if || in_if_cond_true) append_string(book_buf, field->name, strlen(field->name));
+        } break;
+        case SOP_TAG: {
+            const char* tag = field->tag ? field->tag : field->name;
+            if (!in_if || in_if_cond_true) append_string(book_buf, tag, strlen(tag));
+        } break;
+        case SOP_TYPE: {
+            if (in_correct_type && field->type.kind == CEXTERNAL) append_string(book_buf, field->type.name, strlen(field->type.name));
+        } break;
+        case SOP_IF_TYPE: {
+            in_if = true;
+            in_if_cond_true = (op->value & schema_type_bit(field->type)) != 0;
+            in_correct_type = in_if_cond_true;
+        } break;
+        case SOP_IF_INDEX_EQ:
+        case SOP_IF_INDEX_NE: {
+            in_if = true;
+            in_if_cond_true = (field_i == op->value) == (op->kind == SOP_IF_INDEX_EQ);
+            in_correct_type = false;
+        } break;
+        case SOP_ENDIF: {
+            in_if = false;
+            in_if_cond_true = false;
+            in_correct_type = false;
+        } break;
+        }
+    }
+}
+
+void gen_dynamic(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    if (derive_set_empty(&ty->derived_schemas)) return;
+    print_string(book_buf, "\n#ifndef %s%s\n", bk->conf.disable_macro_prefix, ty->name);
+    // Every dynamic schema is generated for every derived type, their templates may refer to the functions of nested types
+    for (size_t schema_i = 0; schema_i < bk->dynamic_schemas.len; ++schema_i) {
+        DynamicSchema* schema = bk->dynamic_schemas.items + schema_i;
+        print_string(book_buf, "\n#ifndef %s"SV_FMT"\n", bk->conf.disable_macro_prefix, SV_ARG(schema->name));
+        unsigned long long start = stats_begin(bk);
+        run_schema_ops(bk, book_buf, ty, schema->ops.items, schema->ops.len, NULL, 0, dst_type, fmt_macro);
+        stats_schema(bk, PHASE_DYNAMIC_SCHEMA, schema->name, start, ty->name);
+        print_string(book_buf, "\n#endif // %s"SV_FMT"\n", bk->conf.disable_macro_prefix, SV_ARG(schema->name));
+    }
+    print_string(book_buf, "\n#endif // %s%s\n", bk->conf.disable_macro_prefix, ty->name);
+}
+
+/// Sections of a compiled schema extension, one `StaticSchema` callback each
+enum {
+    SCHEMA_EXT_DUMP_DECL,
+    SCHEMA_EXT_DUMP_IMPL,
+    SCHEMA_EXT_PARSE_DECL,
+    SCHEMA_EXT_PARSE_IMPL,
+    SCHEMA_EXT_SECTIONS,
+};
+
+/// Appends `text` as a C string literal, newlines inside of `text` continue the literal on the next line
+static void print_c_literal(String* dst, String_View text, int indent) {
+    print_lit(dst, "\"");
+    for (size_t i = 0; i < text.len; ++i) {
+        char c = text.items[i];
+        switch (c) {
+        case '"': print_lit(dst, "\\\""); break;
+        case '\\': print_lit(dst, "\\\\"); break;
+        case '\t': print_lit(dst, "\\t"); break;
+        case '\r': print_lit(dst, "\\r"); break;
+        case '\n': {
+            print_lit(dst, "\\n\"");
+            if (i + 1 < text.len) print_string(dst, "\n%*s\"", indent + 4, "");
+            else return;
+        } break;
+        default: {
+            if ((unsigned char)c < ' ') print_string(dst, "\\%03o", (unsigned char)c);
+            else push_da(dst, c);
+        }
+        }
+    }
+    print_lit(dst, "\"");
+}
+
+/// Appends the statement that outputs the string of the C expression `value`
+static void print_schema_ext_value(String* dst, const char* value, int indent) {
+    print_string(dst, "%*sappend_string(book_buf, %s, strlen(%s));\n", indent, "", value, value);
+}
+
+/// Appends the statement that outputs a single text operation of a schema inside of the `section` callback
+static void print_schema_ext_text(String* dst, const SchemaOp* op, String_View text, int section, int indent) {
+    bool dump = section == SCHEMA_EXT_DUMP_DECL || section == SCHEMA_EXT_DUMP_IMPL;
+    switch (op->kind) {
+    case SOP_TEXT: {
+        if (text.len == 0) return;
+        print_string(dst, "%*sprint_lit(book_buf, ", indent, "");
+        print_c_literal(dst, text, indent);
+        print_lit(dst, ");\n");
+    } break;
+    case SOP_TY: {
+        print_schema_ext_value(dst, "ty->name", indent);
+    } break;
+    case SOP_FMT: {
+        print_schema_ext_value(dst, section == SCHEMA_EXT_DUMP_IMPL ? "fmt_macro" : "bk->conf.gen_fmt_macro", indent);
+    } break;
+    case SOP_DST: {
+        print_schema_ext_value(dst, dump ? "dst_type" : "bk->conf.gen_fmt_dst_macro", indent);
+    } break;
+    case SOP_OFFSET: {
+        print_schema_ext_value(dst, "bk->conf.offset_type_macro", indent);
+    } break;
+    default: break;
+    }
+}
+
+/// Appends the condition of an if operation inside of a loop body
+static void print_schema_ext_cond(String* dst, const SchemaOp* op) {
+    if (op->kind == SOP_IF_INDEX_EQ) {
+        print_string(dst, "i == %zu", op->value);
+        return;
+    }
+    if (op->kind == SOP_IF_INDEX_NE) {
+        print_string(dst, "i != %zu", op->value);
+        return;
+    }
+    if (op->value == 0) {
+        print_lit(dst, "false");
+        return;
+    }
+    bool first = true;
+    for (size_t i = 0; i < sizeof schema_type_conds / sizeof *schema_type_conds; ++i) {
+        if ((op->value & ((size_t)1 << i)) == 0) continue;
+        if (!first) print_lit(dst, " || ");
+        first = false;
+        if (i == 0) print_lit(dst, "field->type.kind == CEXTERNAL");
+        else print_string(dst, "(field->type.kind == CPRIMITIVE && field->type.type == %s)", schema_type_conds[i]);
+    }
+}
+
+/// Appends the loop that runs the `len` operations of a loop body for every field
+static void print_schema_ext_loop(String* dst, const SchemaOp* ops, size_t len, int section) {
+    print_lit(dst, "    for (size_t i = 0; i < ty->fields.len; ++i) {\n");
+    print_lit(dst, "        Field* field = ty->fields.items + i;\n");
+    print_lit(dst, "        (void)field;\n");
+    const SchemaOp* cond = NULL;
+    for (size_t i = 0; i < len; ++i) {
+        const SchemaOp* op = ops + i;
+        if ((op->flags & SOP_ALWAYS) && cond != NULL) {
+            print_lit(dst, "        }\n");
+            cond = NULL;
+        }
+        int indent = cond != NULL ? 12 : 8;
+        switch (op->kind) {
+        case SOP_FIELD: {
+            print_schema_ext_value(dst, "field->name", indent);
+        } break;
+        case SOP_TAG: {
+            print_schema_ext_value(dst, "field->tag ? field->tag : field->name", indent);
+        } break;
+        case SOP_TYPE: {
+            // The type name is only output inside of ifs that select `CEXTERNAL` fields
+            if (cond != NULL && cond->kind == SOP_IF_TYPE && (cond->value & 1)) {
+                print_schema_ext_value(dst, "field->type.name", indent);
+            }
+        } break;
+        case SOP_IF_TYPE:
+        case SOP_IF_INDEX_EQ:
+        case SOP_IF_INDEX_NE: {
+            if (cond != NULL) print_lit(dst, "        }\n");
+            print_lit(dst, "        if (");
+            print_schema_ext_cond(dst, op);
+            print_lit(dst, ") {\n");
+            cond = op;
+        } break;
+        case SOP_ENDIF: {
+            if (cond != NULL) print_lit(dst, "        }\n");
+            cond = NULL;
+        } break;
+        default: {
+            if (!(op->flags & SOP_SEGMENT_START)) {
+                print_schema_ext_text(dst, op, op->text, section, indent);
+                break;
             }
+            // Segments are trimmed at runtime, the values they contain are names that never start or end with whitespace
+            size_t end = i;
+            while (!(ops[end].flags & SOP_SEGMENT_END)) ++end;
+            size_t first = i;
+            size_t last = end;
+            String_View first_text = ops[first].text;
+            String_View last_text = ops[last].text;
+            while (first <= last && ops[first].kind == SOP_TEXT && (first_text = sv_trim_whitespace_start(ops[first].text)).len == 0) ++first;
+            while (last >= first && ops[last].kind == SOP_TEXT && (last_text = sv_trim_whitespace_end(ops[last].text)).len == 0) --last;
+            if (first == last && ops[first].kind == SOP_TEXT) first_text = sv_trim_whitespace(first_text);
+            for (size_t j = first; j <= last && j <= end; ++j) {
+                String_View text = ops[j].text;
+                if (j == first) text = first_text;
+                else if (j == last) text = last_text;
+                print_schema_ext_text(dst, ops + j, text, section, indent);
+            }
+            i = end;
+        }
         }
-        String_View post_loop = sv_substr(normal_start, 0, normal_start.len - cursor.len);
+    }
+    if (cond != NULL) print_lit(dst, "        }\n");
+    print_lit(dst, "    }\n");
+}
 
+__BK_API void write_schema_extension(BkContext* bk, DynamicSchema* schema, String* out) {
+    String sections[SCHEMA_EXT_SECTIONS] = {0}; // alloc
+    const char* section_names[SCHEMA_EXT_SECTIONS] = {"dump_decl", "dump_impl", "parse_decl", "parse_impl"};
+    bool warned = false;
+    int guard = -1;
+    bool impl = false;
+    const SchemaOp* ops = schema->ops.items;
+    for (size_t i = 0; i < schema->ops.len; ++i) {
+        const SchemaOp* op = ops + i;
+        switch (op->kind) {
+        case SOP_IMPLGUARD: impl = true; continue;
+        case SOP_ENDIMPLGUARD: impl = false; continue;
+        case SOP_DUMPGUARD: guard = SCHEMA_EXT_DUMP_DECL; continue;
+        case SOP_PARSEGUARD: guard = SCHEMA_EXT_PARSE_DECL; continue;
+        case SOP_ENDDUMPGUARD:
+        case SOP_ENDPARSEGUARD: guard = -1; continue;
+        default: break;
+        }
+        // Static schemas are wrapped in dump and parse guards by `bookkeeper`, so whitespace between the guards is dropped
+        String_View text = op->text;
+        if (op->kind == SOP_TAIL) text = sv_trim_whitespace(text);
+        if (guard < 0 && (op->kind == SOP_TEXT || op->kind == SOP_TAIL) && sv_trim_whitespace(text).len == 0) continue;
+        if (guard < 0 && !warned) {
+            bk_log(LOG_WARN, "In dynamic schema '"SV_FMT"': Code outside of dump and parse guards is generated with the dump functions\n", SV_ARG(schema->name));
+            warned = true;
+        }
+        int section = (guard < 0 ? SCHEMA_EXT_DUMP_DECL : guard) + (impl ? 1 : 0);
+        if (op->kind == SOP_FOR) {
+            print_schema_ext_loop(sections + section, op + 1, op->value, section);
+            i += op->value;
+        } else if (op->kind == SOP_TAIL) {
+            print_schema_ext_text(sections + section, &(SchemaOp){.kind = SOP_TEXT}, text, section, 4);
+        } else {
+            print_schema_ext_text(sections + section, op, text, section, 4);
+        }
+    }
 
-        print_string(book_buf, "\n"SV_FMT, SV_ARG(sv_trim_whitespace(post_loop)));
+    String id = {0}; // alloc
+    for (size_t i = 0; i < schema->name.len; ++i) {
+        char c = schema->name.items[i];
+        push_da(&id, isalnum((unsigned char)c) ? c : '_');
+    }
+    push_da(&id, '\0');
+
+    print_string(out, "// Generated by `bk --compile-schema` from '%s', do not edit.\n", schema->file_name);
+    print_lit(out, "// Add the schema to `bookkeeper` by including this file and defining\n");
+    print_string(out, "// `#define BK_ADD_SCHEMAS(s) push_da(&s, %s_schema);` before including \"bk.c\".\n", id.items);
+    print_lit(out, "#include <stdio.h>\n");
+    print_lit(out, "#include <stdlib.h>\n");
+    print_lit(out, "#include <string.h>\n");
+    print_lit(out, "#include <stdbool.h>\n");
+    print_lit(out, "\n");
+    print_lit(out, "#include \"bk_ext.h\"\n");
+    for (int i = 0; i < SCHEMA_EXT_SECTIONS; ++i) {
+        if (sections[i].len == 0) continue;
+        bool decl = i == SCHEMA_EXT_DUMP_DECL || i == SCHEMA_EXT_PARSE_DECL;
+        print_string(out, "\nstatic %s gen_%s_%s(BkContext* bk, String* book_buf, CCompound* ty", decl ? "size_t" : "void", id.items, section_names[i]);
+        if (i == SCHEMA_EXT_DUMP_DECL || i == SCHEMA_EXT_DUMP_IMPL) print_lit(out, ", const char* dst_type");
+        if (i == SCHEMA_EXT_DUMP_IMPL) print_lit(out, ", const char* fmt_macro");
+        print_lit(out, ") {\n");
+        print_lit(out, "    (void)bk;\n");
+        if (i == SCHEMA_EXT_DUMP_DECL || i == SCHEMA_EXT_DUMP_IMPL) print_lit(out, "    (void)dst_type;\n");
+        if (i == SCHEMA_EXT_DUMP_IMPL) print_lit(out, "    (void)fmt_macro;\n");
+        print_sv(out, sv_from_str(sections + i));
+        if (decl) print_lit(out, "    return 1;\n");
+        print_lit(out, "}\n");
+    }
+    print_string(out, "\nstatic StaticSchema %s_schema = {\n", id.items);
+    print_lit(out, "    .gen_prelude = NULL,\n");
+    for (int i = 0; i < SCHEMA_EXT_SECTIONS; ++i) {
+        if (sections[i].len == 0) print_string(out, "    .gen_%s = NULL,\n", section_names[i]);
+        else print_string(out, "    .gen_%s = gen_%s_%s,\n", section_names[i], id.items, section_names[i]);
+    }
+    print_string(out, "    .derive_attr = \""SV_FMT"\",\n", SV_ARG(schema->derive_attr));
+    print_string(out, "    .name = \""SV_FMT"\"\n", SV_ARG(schema->name));
+    print_lit(out, "};\n");
 
-        print_string(book_buf, "\n#endif // %s"SV_FMT"\n", bk.conf.disable_macro_prefix, SV_ARG(schema->name));
-        __continue_free:
-        free(impl.items);
+    for (int i = 0; i < SCHEMA_EXT_SECTIONS; ++i) {
+        if (sections[i].items != NULL) free(sections[i].items);
     }
-    print_string(book_buf, "\n#endif // %s%s\n", bk.conf.disable_macro_prefix, ty->name);
+    free(id.items);
 }
 
 // JSON generation
-void gen_json_prelude(String* book_buf) {
-    print_string(book_buf, "typedef enum {\n");
-    print_string(book_buf, "    BKJSON_OK = 0,\n");
-    print_string(book_buf, "    BKJSON_cJSON_ERROR,\n");
-    print_string(book_buf, "    BKJSON_FIELD_NOT_FOUND,\n");
-    print_string(book_buf, "    BKJSON_MISMATCHED_FIELD_TYPE,\n");
-    print_string(book_buf, "} BkJSON_Result;\n");
-}
-size_t gen_json_dump_decl(String* book_buf, CCompound* ty, const char* dst_type) {
+void gen_json_prelude(BkContext* bk, String* book_buf) {
+    (void)bk;
+    print_lit(book_buf, "typedef enum {\n");
+    print_lit(book_buf, "    BKJSON_OK = 0,\n");
+    print_lit(book_buf, "    BKJSON_cJSON_ERROR,\n");
+    print_lit(book_buf, "    BKJSON_FIELD_NOT_FOUND,\n");
+    print_lit(book_buf, "    BKJSON_MISMATCHED_FIELD_TYPE,\n");
+    print_lit(book_buf, "} BkJSON_Result;\n");
+}
+size_t gen_json_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {
+    (void)bk;
     print_string(book_buf, "void dump_json_%s(%s* item, %s dst);\n", ty->name, ty->name, dst_type);
     return 1;
 }
-size_t gen_json_parse_decl(String* book_buf, CCompound* ty) {
+size_t gen_json_parse_decl(BkContext* bk, String* book_buf, CCompound* ty) {
+    (void)bk;
     print_string(book_buf, "BkJSON_Result parse_cjson_%s(cJSON* src, %s* dst);\n\n", ty->name, ty->name);
-    print_string(book_buf, "/// WARN: Immediately returns on error, so `dst` might be partially filled.\n");
+    print_lit(book_buf, "/// WARN: Immediately returns on error, so `dst` might be partially filled.\n");
     print_string(book_buf, "BkJSON_Result parse_json_%s(const char* src, unsigned long len, %s* dst);\n", ty->name, ty->name);
     return 2;
 }
-void gen_json_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+void gen_json_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    (void)bk;
     print_string(book_buf, "void dump_json_%s(%s* item, %s dst) {\n", ty->name, ty->name, dst_type);
-    print_string(book_buf, "    BK_OFFSET_t offset = {0};\n");
-    print_string(book_buf, "    (void)offset; // suppress warnings\n");
+    print_lit(book_buf, "    BK_OFFSET_t offset = {0};\n");
+    print_lit(book_buf, "    (void)offset; // suppress warnings\n");
     print_string(book_buf, "    %s(\"{\");\n", fmt_macro);
     for (size_t j = 0; j < ty->fields.len; ++j) {
         Field* f = ty->fields.items + j;
-        char* tag = f->tag ? f->tag : f->name;
+        const char* tag = f->tag ? f->tag : f->name;
         switch (f->type.kind) {
         case CPRIMITIVE: {
             switch (f->type.type) {
@@ -2879,91 +6942,94 @@ void gen_json_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, c
         if (j < ty->fields.len - 1) print_string(book_buf, "    %s(\",\");\n", fmt_macro);
     }
     print_string(book_buf, "    %s(\"}\");\n", fmt_macro);
-    print_string(book_buf, "}\n");
+    print_lit(book_buf, "}\n");
 }
-void gen_json_parse_impl(String* book_buf, CCompound* ty) {
+void gen_json_parse_impl(BkContext* bk, String* book_buf, CCompound* ty) {
+    (void)bk;
     print_string(book_buf, "BkJSON_Result parse_cjson_%s(cJSON* src, %s* dst) {\n", ty->name, ty->name);
-    print_string(book_buf, "    BkJSON_Result _res = 0; (void)_res;\n");
+    print_lit(book_buf, "    BkJSON_Result _res = 0; (void)_res;\n");
     for (size_t i = 0; i < ty->fields.len; ++i) {
         Field* f = ty->fields.items + i;
-        char* tag = f->tag ? f->tag : f->name;
+        const char* tag = f->tag ? f->tag : f->name;
         print_string(book_buf, "    cJSON* %s_%s = cJSON_GetObjectItemCaseSensitive(src, \"%s\");\n", ty->name, f->name, tag);
         print_string(book_buf, "    if (!%s_%s) return BKJSON_FIELD_NOT_FOUND;\n", ty->name, f->name);
         if (f->type.kind == CEXTERNAL) {
             print_string(book_buf, "    _res = parse_cjson_%s(%s_%s, &dst->%s);\n", f->type.name, ty->name, f->name, f->name);
-            print_string(book_buf, "    if (_res) return _res;\n");
+            print_lit(book_buf, "    if (_res) return _res;\n");
         } else if (f->type.kind == CPRIMITIVE) {
             switch (f->type.type) {
             case CINT: case CUINT: {
                 print_string(book_buf, "    if (cJSON_IsNumber(%s_%s)) {\n", ty->name, f->name);
                 print_string(book_buf, "        dst->%s = %s_%s->valueint;\n", f->name, ty->name, f->name);
-                print_string(book_buf, "    } else {\n");
-                print_string(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
-                print_string(book_buf, "    }\n");
+                print_lit(book_buf, "    } else {\n");
+                print_lit(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
+                print_lit(book_buf, "    }\n");
             } break;
             case CLONG: case CULONG: case CFLOAT: {
                 print_string(book_buf, "    if (cJSON_IsNumber(%s_%s)) {\n", ty->name, f->name);
                 print_string(book_buf, "        dst->%s = %s_%s->valuedouble;\n", f->name, ty->name, f->name);
-                print_string(book_buf, "    } else {\n");
-                print_string(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
-                print_string(book_buf, "    }\n");
+                print_lit(book_buf, "    } else {\n");
+                print_lit(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
+                print_lit(book_buf, "    }\n");
             } break;
             case CCHAR: {
                 print_string(book_buf, "    if (cJSON_IsString(%s_%s)) {\n", ty->name, f->name);
                 print_string(book_buf, "        if (!%s_%s->valuestring) { return 1; };\n", ty->name, f->name);
                 print_string(book_buf, "        dst->%s = *%s_%s->valuestring;\n", f->name, ty->name, f->name);
-                print_string(book_buf, "    } else {\n");
-                print_string(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
-                print_string(book_buf, "    }\n");
+                print_lit(book_buf, "    } else {\n");
+                print_lit(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
+                print_lit(book_buf, "    }\n");
                     
             } break;
             case CBOOL: {
                 print_string(book_buf, "    if (cJSON_IsBool(%s_%s)) {\n", ty->name, f->name);
                 print_string(book_buf, "        dst->%s = %s_%s->valueint;\n", f->name, ty->name, f->name);
-                print_string(book_buf, "    } else {\n");
-                print_string(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
-                print_string(book_buf, "    }\n");
+                print_lit(book_buf, "    } else {\n");
+                print_lit(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
+                print_lit(book_buf, "    }\n");
                     
             } break;
             case CSTRING: {
                 print_string(book_buf, "    if (cJSON_IsString(%s_%s)) {\n", ty->name, f->name);
                 print_string(book_buf, "        if (!%s_%s->valuestring) { return 1; };\n", ty->name, f->name);
                 print_string(book_buf, "        dst->%s = strdup(%s_%s->valuestring);\n", f->name, ty->name, f->name);
-                print_string(book_buf, "    } else {\n");
-                print_string(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
-                print_string(book_buf, "    }\n");
+                print_lit(book_buf, "    } else {\n");
+                print_lit(book_buf, "        return BKJSON_MISMATCHED_FIELD_TYPE;\n");
+                print_lit(book_buf, "    }\n");
             } break;
             }
         } else {
             abort();
         }
     }
-    print_string(book_buf, "    return BKJSON_OK;\n");
-    print_string(book_buf, "}\n");
-    print_string(book_buf, "/// WARN: Immediately returns on error, so `dst` might be partially filled.\n");
+    print_lit(book_buf, "    return BKJSON_OK;\n");
+    print_lit(book_buf, "}\n");
+    print_lit(book_buf, "/// WARN: Immediately returns on error, so `dst` might be partially filled.\n");
     print_string(book_buf, "BkJSON_Result parse_json_%s(const char* src, unsigned long len, %s* dst) {\n", ty->name, ty->name);
-    print_string(book_buf, "    cJSON* json = cJSON_ParseWithLength(src, len);\n");
-    print_string(book_buf, "    if (!json) return BKJSON_cJSON_ERROR;\n");
+    print_lit(book_buf, "    cJSON* json = cJSON_ParseWithLength(src, len);\n");
+    print_lit(book_buf, "    if (!json) return BKJSON_cJSON_ERROR;\n");
     print_string(book_buf, "    BkJSON_Result res = parse_cjson_%s(json, dst);\n", ty->name);
-    print_string(book_buf, "    cJSON_Delete(json);\n");
-    print_string(book_buf, "    return res;\n");
-    print_string(book_buf, "}\n");
+    print_lit(book_buf, "    cJSON_Delete(json);\n");
+    print_lit(book_buf, "    return res;\n");
+    print_lit(book_buf, "}\n");
 }
 
 // Debug generation
-size_t gen_debug_dump_decl(String* book_buf, CCompound* ty, const char* dst_type) {    
+size_t gen_debug_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {    
+    (void)bk;
     print_string(book_buf, "void __indent_dump_debug_%s(%s* item, %s dst, int indent);\n", ty->name, ty->name, dst_type);
     print_string(book_buf, "void dump_debug_%s(%s* item, %s dst);\n", ty->name, ty->name, dst_type);
     return 2;
 }
-void gen_debug_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+void gen_debug_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    (void)bk;
     print_string(book_buf, "void __indent_dump_debug_%s(%s* item, %s dst, int indent) {\n", ty->name, ty->name, dst_type);
-    print_string(book_buf, "    BK_OFFSET_t offset = {0};\n");
-    print_string(book_buf, "    (void)offset; // suppress warnings\n");
+    print_lit(book_buf, "    BK_OFFSET_t offset = {0};\n");
+    print_lit(book_buf, "    (void)offset; // suppress warnings\n");
     print_string(book_buf, "    %s(\"%s {\\n\");\n", fmt_macro, ty->name);
     for (size_t j = 0; j < ty->fields.len; ++j) {
         Field* f = ty->fields.items + j;
-        char* tag = f->name;
+        const char* tag = f->name;
         // char* tag = f->tag ? f->tag : f->name;
         switch (f->type.kind) {
         case CPRIMITIVE: {
@@ -3004,14 +7070,14 @@ void gen_debug_dump_impl(String* book_buf, CCompound* ty, const char* dst_type,
         }
     }
     print_string(book_buf, "    %s(\"%%*s}\\n\", indent, \"\");\n", fmt_macro);
-    print_string(book_buf, "}\n");
+    print_lit(book_buf, "}\n");
 
     print_string(book_buf, "void dump_debug_%s(%s* item, %s dst) {\n", ty->name, ty->name, dst_type);
     print_string(book_buf, "    __indent_dump_debug_%s(item, dst, 0);\n", ty->name);
-    print_string(book_buf, "}\n");
+    print_lit(book_buf, "}\n");
 }
 
-bool help_cmd(int* i, int argc, char** argv) {
+bool help_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)bk;
 
     if ((*i + 1) < argc) {
@@ -3039,24 +7105,24 @@ bool help_cmd(int* i, int argc, char** argv) {
 }
 
 
-bool config_path_cmd(int* i, int argc, char** argv) {
+bool config_path_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        config_path = argv[*i];
+        bk->config_path = argv[*i];
         return true;
     }
     return false;
 }
 
-bool output_mode_cmd(int* i, int argc, char** argv) {
+bool output_mode_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.output_mode = argv[*i];
+        bk->conf.output_mode = argv[*i];
         return true;
     }
 
     return false;    
 }
 
-bool gen_ext_cmd(int* i, int argc, char** argv) {
+bool gen_ext_cmd(BkContext* bk, int* i, int argc, char** argv) {
     char* src = NULL;
     char* out = NULL;
 
@@ -3079,7 +7145,7 @@ bool gen_ext_cmd(int* i, int argc, char** argv) {
     char* save_end = NULL;
 
     String src_file = {0}; // alloc
-    if (!read_entire_file(src, &src_file) || src_file.len == 0) {
+    if (!read_entire_file(bk, src, &src_file) || src_file.len == 0) {
         if (src_file.items != NULL) free(src_file.items);
         return false;
     }
@@ -3143,28 +7209,90 @@ bool gen_ext_cmd(int* i, int argc, char** argv) {
     return true;
 }
 
-bool generics_cmd(int* i, int argc, char** argv) {
+bool compile_schema_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    char* src = NULL;
+    char* out = NULL;
+
+    if (++*i < argc) {
+        src = argv[*i];
+    }
+
+    if (++*i < argc) {
+        out = argv[*i];
+    }
+
+    if (src == NULL || out == NULL) return false;
+
+    String source = {0}; // alloc
+    DynamicSchema schema = {.file_name = src};
+    if (!parse_dynamic_schema_loc(bk, src, &schema, &source, __FILE__, __LINE__)) {
+        if (source.items != NULL) free(source.items);
+        return false;
+    }
+    String ext = {0}; // alloc
+    write_schema_extension(bk, &schema, &ext);
+    bool ok = write_entire_file(bk, out, &ext);
+    free(ext.items);
+    free(source.items);
+    if (schema.ops.items != NULL) free(schema.ops.items);
+    return ok;
+}
+
+bool load_plugin_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        return load_plugin(bk, argv[*i]);
+    }
+    return false;
+}
+
+bool generics_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.generics = true;
+    bk->conf.generics = true;
     return true;
 }
 
-bool watch_cmd(int* i, int argc, char** argv) {
+bool watch_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.watch_mode = true;
+    bk->conf.watch_mode = true;
     return true;
 }
 
-bool watch_delay_cmd(int* i, int argc, char** argv) {
+bool watch_delay_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
         char* endptr = NULL;
         long val = strtol(argv[*i], &endptr, 10);
         if (endptr && *endptr == 0) {
-            bk.conf.watch_delay = val;
+            bk->conf.watch_delay = val;
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+bool watch_debounce_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        char* endptr = NULL;
+        long val = strtol(argv[*i], &endptr, 10);
+        if (endptr && *endptr == 0 && val >= 0) {
+            bk->conf.watch_debounce = val;
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+bool jobs_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        char* endptr = NULL;
+        long val = strtol(argv[*i], &endptr, 10);
+        if (endptr && *endptr == 0 && val >= 0) {
+            bk->conf.jobs = val;
             return true;
         }
         return false;
@@ -3172,89 +7300,102 @@ bool watch_delay_cmd(int* i, int argc, char** argv) {
     return false;
 }
 
-bool include_file_cmd(int* i, int argc, char** argv) {
+bool include_file_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
         char* ent = argv[*i];
         Entry e = {0};
-        if (!entry_from_file(ent, &e)) return false; // alloc
-        push_da(&bk.entries, e);
+        if (!entry_from_file(bk, ent, &e)) return false; // alloc
+        push_da(&bk->entries, e);
         return true;
     }
     return false;
 }
 
-bool include_directory_cmd(int* i, int argc, char** argv) {
+bool include_directory_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.include_dir = argv[*i];
+        push_da(&bk->include_dirs, strdup(argv[*i])); // alloc
         return true;
     }
     return false;
 }
 
-bool output_directory_cmd(int* i, int argc, char** argv) {
+bool max_file_size_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        char* endptr = NULL;
+        long val = strtol(argv[*i], &endptr, 10);
+        if (endptr && *endptr == 0 && val >= 0) {
+            bk->conf.max_file_size = val;
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+bool output_directory_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.output_dir = argv[*i];
+        bk->conf.output_dir = argv[*i];
         return true;
     }
     return false;
 }
 
-bool schemas_cmd(int* i, int argc, char** argv) {
+bool schemas_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    if (bk.schemas.len == 0) {
+    if (bk->schemas.len == 0) {
         bk_printf("No schemas were loaded.\n");
         return true;
     } else {
         bk_printf("Loaded schemas: ");
     }
-    for (size_t i = 0; i < bk.schemas.len; ++i) {
+    for (size_t i = 0; i < bk->schemas.len; ++i) {
         if (i == 0) {
-            bk_printf("%s", bk.schemas.items[i].name);
+            bk_printf("%s", bk->schemas.items[i].name);
         } else {
-            bk_printf(", %s", bk.schemas.items[i].name);
+            bk_printf(", %s", bk->schemas.items[i].name);
         }
     }
     bk_printf("\n");
     return true;
 }
 
-bool include_schema_cmd(int* i, int argc, char** argv) {
+bool include_schema_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        if (!load_dynamic_schema(argv[*i])) return false;
+        if (!load_dynamic_schema(bk, argv[*i])) return false;
         return true;
     }
     return false;    
 }
 
-bool silent_cmd(int* i, int argc, char** argv) {
+bool silent_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.silent = true;
+    bk->conf.silent = true;
     return true;
 }
 
-bool verbose_cmd(int* i, int argc, char** argv) {
+bool verbose_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.verbose = true;
+    bk->conf.verbose = true;
     return true;
 }
 
-bool enable_warn_cmd(int* i, int argc, char** argv) {
+bool enable_warn_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
         char* w = argv[*i];
         if (strcmp(w, WARN_NO_INCLUDE) == 0) {
-            bk.conf.warn_no_include = true;
+            bk->conf.warn_no_include = true;
             return true;
         } else if (strcmp(w, WARN_NO_OUTPUT) == 0) {
-            bk.conf.warn_no_output = true;
+            bk->conf.warn_no_output = true;
             return true;
         } else if (strcmp(w, WARN_UNKNOWN_ATTR) == 0) {
-            bk.conf.warn_unknown_attr = true;
+            bk->conf.warn_unknown_attr = true;
             return true;
         } else {
             return false;
@@ -3264,17 +7405,17 @@ bool enable_warn_cmd(int* i, int argc, char** argv) {
     return false;
 }
 
-bool disable_warn_cmd(int* i, int argc, char** argv) {
+bool disable_warn_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
         char* w = argv[*i];
         if (strcmp(w, WARN_NO_INCLUDE) == 0) {
-            bk.conf.warn_no_include = false;
+            bk->conf.warn_no_include = false;
             return true;
         } else if (strcmp(w, WARN_NO_OUTPUT) == 0) {
-            bk.conf.warn_no_output = false;
+            bk->conf.warn_no_output = false;
             return true;
         } else if (strcmp(w, WARN_UNKNOWN_ATTR) == 0) {
-            bk.conf.warn_unknown_attr = false;
+            bk->conf.warn_unknown_attr = false;
             return true;
         } else {
             return false;
@@ -3284,21 +7425,21 @@ bool disable_warn_cmd(int* i, int argc, char** argv) {
     return false;
 }
 
-bool derive_all_cmd(int* i, int argc, char** argv) {
+bool derive_all_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.derive_all = true;
+    bk->conf.derive_all = true;
     return true;
 }
 
-bool derive_cmd(int* i, int argc, char** argv) {
+bool derive_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
         char* name = argv[*i];
         bool found = false;
-        for (size_t j = 0; j < bk.schemas.len; ++j) {
-            if (strcmp(name, bk.schemas.items[j].name) == 0) {
-                bk.derive_schemas |= get_schema_derive(SCHEMA_STATIC, j);
+        for (size_t j = 0; j < bk->schemas.len; ++j) {
+            if (strcmp(name, bk->schemas.items[j].name) == 0) {
+                derive_set_add(&bk->derive_schemas, schema_index(bk, SCHEMA_STATIC, j));
                 found = true;
                 break;
             }
@@ -3306,80 +7447,153 @@ bool derive_cmd(int* i, int argc, char** argv) {
         if (found) {
             return true;
         }
-        if (bk.conf.warn_unknown_attr) bk_log(LOG_WARN, "No schema named '%s' was defined.\n", name);
+        if (bk->conf.warn_unknown_attr) bk_log(LOG_WARN, "No schema named '%s' was defined.\n", name);
     }
     return false;    
 }
 
-bool gen_impl_cmd(int* i, int argc, char** argv) {
+bool gen_impl_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        bk->conf.gen_implementation_macro = argv[*i];
+        return true;
+    }
+    return false;
+}
+
+bool gen_fmt_dst_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        bk->conf.gen_fmt_dst_macro = argv[*i];
+        return true;
+    }
+    return false;
+}
+
+bool gen_fmt_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        bk->conf.gen_fmt_macro = argv[*i];
+        return true;
+    }
+    return false;
+}
+
+bool offset_type_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        bk->conf.offset_type_macro = argv[*i];
+        return true;
+    }
+    return false;
+}
+
+bool disable_prefix_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    if (++*i < argc) {
+        bk->conf.disable_macro_prefix = argv[*i];
+        return true;
+    }
+    return false;
+}
+
+bool enable_prefix_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.gen_implementation_macro = argv[*i];
+        bk->conf.enable_macro_prefix = argv[*i];
         return true;
     }
     return false;
 }
 
-bool gen_fmt_dst_cmd(int* i, int argc, char** argv) {
+bool no_cache_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    (void)i;
+    (void)argc;
+    (void)argv;
+    bk->conf.cache = false;
+    return true;
+}
+
+bool depfiles_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    (void)i;
+    (void)argc;
+    (void)argv;
+    bk->conf.depfiles = true;
+    return true;
+}
+
+bool depfile_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.gen_fmt_dst_macro = argv[*i];
+        bk->conf.depfile = argv[*i];
         return true;
     }
     return false;
 }
 
-bool gen_fmt_cmd(int* i, int argc, char** argv) {
+bool daemon_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.gen_fmt_macro = argv[*i];
+        bk->daemon_socket = argv[*i];
         return true;
     }
     return false;
 }
 
-bool offset_type_cmd(int* i, int argc, char** argv) {
+bool client_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.offset_type_macro = argv[*i];
+        bk->client_socket = argv[*i];
         return true;
     }
     return false;
 }
 
-bool disable_prefix_cmd(int* i, int argc, char** argv) {
+bool manifest_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.disable_macro_prefix = argv[*i];
+        bk->manifest_path = argv[*i];
         return true;
     }
     return false;
 }
 
-bool enable_prefix_cmd(int* i, int argc, char** argv) {
+bool stats_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    (void)i;
+    (void)argc;
+    (void)argv;
+    bk->show_stats = true;
+    return true;
+}
+
+bool stats_csv_cmd(BkContext* bk, int* i, int argc, char** argv) {
+    (void)i;
+    (void)argc;
+    (void)argv;
+    bk->show_stats = true;
+    bk->stats_csv = true;
+    return true;
+}
+
+bool trace_cmd(BkContext* bk, int* i, int argc, char** argv) {
     if (++*i < argc) {
-        bk.conf.enable_macro_prefix = argv[*i];
+        bk->trace_path = argv[*i];
         return true;
     }
     return false;
 }
 
-bool disable_dump_cmd(int* i, int argc, char** argv) {
+bool disable_dump_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.disable_dump = true;
+    bk->conf.disable_dump = true;
     return true;
 }
 
-bool disable_parse_cmd(int* i, int argc, char** argv) {
+bool disable_parse_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.disable_parse = true;
+    bk->conf.disable_parse = true;
     return true;
 }
 
-bool disabled_cmd(int* i, int argc, char** argv) {
+bool disabled_cmd(BkContext* bk, int* i, int argc, char** argv) {
     (void)i;
     (void)argc;
     (void)argv;
-    bk.conf.disabled_by_default = true;
+    bk->conf.disabled_by_default = true;
     return true;
 }
 
@@ -3432,7 +7646,9 @@ int parse_bkconf_BkConfig(const char* src, unsigned long len, BkConfig* dst) {
 			str_buf[sprintf(str_buf, "%.*s", (int)(name_end - name_start) + 1, name_start)] = 0;
 			if (strcmp(str_buf, "output_mode") == 0) {str_buf[sprintf(str_buf, "%.*s", (int)(value_end - value_start) + 1, value_start)] = 0;
 					dst->output_mode= strdup(str_buf);
-					str_buf[sprintf(str_buf, "%.*s", (int)(name_end - name_start) + 1, name_start)] = 0;}else if (strcmp(str_buf, "generics") == 0) {dst->generics= value_bool;}else if (strcmp(str_buf, "silent") == 0) {dst->silent= value_bool;}else if (strcmp(str_buf, "verbose") == 0) {dst->verbose= value_bool;}else if (strcmp(str_buf, "warn_unknown_attr") == 0) {dst->warn_unknown_attr= value_bool;}else if (strcmp(str_buf, "warn_no_include") == 0) {dst->warn_no_include= value_bool;}else if (strcmp(str_buf, "warn_no_output") == 0) {dst->warn_no_output= value_bool;}else if (strcmp(str_buf, "disable_dump") == 0) {dst->disable_dump= value_bool;}else if (strcmp(str_buf, "disable_parse") == 0) {dst->disable_parse= value_bool;}else if (strcmp(str_buf, "disabled_by_default") == 0) {dst->disabled_by_default= value_bool;}else if (strcmp(str_buf, "watch_mode") == 0) {dst->watch_mode= value_bool;}else if (strcmp(str_buf, "watch_delay") == 0) {dst->watch_delay= value_int;}else if (strcmp(str_buf, "gen_fmt_macro") == 0) {str_buf[sprintf(str_buf, "%.*s", (int)(value_end - value_start) + 1, value_start)] = 0;
+					str_buf[sprintf(str_buf, "%.*s", (int)(name_end - name_start) + 1, name_start)] = 0;}else if (strcmp(str_buf, "generics") == 0) {dst->generics= value_bool;}else if (strcmp(str_buf, "silent") == 0) {dst->silent= value_bool;}else if (strcmp(str_buf, "verbose") == 0) {dst->verbose= value_bool;}else if (strcmp(str_buf, "warn_unknown_attr") == 0) {dst->warn_unknown_attr= value_bool;}else if (strcmp(str_buf, "warn_no_include") == 0) {dst->warn_no_include= value_bool;}else if (strcmp(str_buf, "warn_no_output") == 0) {dst->warn_no_output= value_bool;}else if (strcmp(str_buf, "cache") == 0) {dst->cache= value_bool;}else if (strcmp(str_buf, "depfiles") == 0) {dst->depfiles= value_bool;}else if (strcmp(str_buf, "depfile") == 0) {str_buf[sprintf(str_buf, "%.*s", (int)(value_end - value_start) + 1, value_start)] = 0;
+					dst->depfile= strdup(str_buf);
+					str_buf[sprintf(str_buf, "%.*s", (int)(name_end - name_start) + 1, name_start)] = 0;}else if (strcmp(str_buf, "disable_dump") == 0) {dst->disable_dump= value_bool;}else if (strcmp(str_buf, "disable_parse") == 0) {dst->disable_parse= value_bool;}else if (strcmp(str_buf, "disabled_by_default") == 0) {dst->disabled_by_default= value_bool;}else if (strcmp(str_buf, "watch_mode") == 0) {dst->watch_mode= value_bool;}else if (strcmp(str_buf, "watch_delay") == 0) {dst->watch_delay= value_int;}else if (strcmp(str_buf, "watch_debounce") == 0) {dst->watch_debounce= value_int;}else if (strcmp(str_buf, "jobs") == 0) {dst->jobs= value_int;}else if (strcmp(str_buf, "max_file_size") == 0) {dst->max_file_size= value_int;}else if (strcmp(str_buf, "gen_fmt_macro") == 0) {str_buf[sprintf(str_buf, "%.*s", (int)(value_end - value_start) + 1, value_start)] = 0;
 					dst->gen_fmt_macro= strdup(str_buf);
 					str_buf[sprintf(str_buf, "%.*s", (int)(name_end - name_start) + 1, name_start)] = 0;}else if (strcmp(str_buf, "gen_implementation_macro") == 0) {str_buf[sprintf(str_buf, "%.*s", (int)(value_end - value_start) + 1, value_start)] = 0;
 					dst->gen_implementation_macro= strdup(str_buf);
@@ -3462,4 +7678,11 @@ int parse_bkconf_BkConfig(const char* src, unsigned long len, BkConfig* dst) {
 	return 0;
 }
 
+// Only this file counts its allocations, see the `allocs` group
+#undef malloc
+#undef calloc
+#undef realloc
+#undef strdup
+#undef free
+
 #endif // __BOOKKEEPER_GEN_C__
@@ -0,0 +1,94 @@
+#ifndef F000000_H
+#define F000000_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S0_0 derive_all();
+
+typedef struct {
+    S0_0 inner; tag("Inner")
+    float field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S0_1 derive_all();
+
+typedef struct {
+    S0_1 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S0_2 derive_all();
+
+typedef struct {
+    S0_2 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S0_3 derive_all();
+
+typedef struct {
+    S0_3 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S0_4 derive_all();
+
+typedef struct {
+    S0_4 inner; tag("Inner")
+    bool field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S0_5 derive_all();
+
+typedef struct {
+    S0_5 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S0_6 derive_all();
+
+typedef struct {
+    S0_6 inner; tag("Inner")
+    const char* field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S0_7 derive_all();
+
+#endif // F000000_H
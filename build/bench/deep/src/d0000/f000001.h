@@ -0,0 +1,94 @@
+#ifndef F000001_H
+#define F000001_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S1_0 derive_all();
+
+typedef struct {
+    S1_0 inner; tag("Inner")
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S1_1 derive_all();
+
+typedef struct {
+    S1_1 inner; tag("Inner")
+    int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S1_2 derive_all();
+
+typedef struct {
+    S1_2 inner; tag("Inner")
+    int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S1_3 derive_all();
+
+typedef struct {
+    S1_3 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S1_4 derive_all();
+
+typedef struct {
+    S1_4 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S1_5 derive_all();
+
+typedef struct {
+    S1_5 inner; tag("Inner")
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S1_6 derive_all();
+
+typedef struct {
+    S1_6 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S1_7 derive_all();
+
+#endif // F000001_H
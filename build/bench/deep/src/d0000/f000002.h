@@ -0,0 +1,94 @@
+#ifndef F000002_H
+#define F000002_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S2_0 derive_all();
+
+typedef struct {
+    S2_0 inner; tag("Inner")
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S2_1 derive_all();
+
+typedef struct {
+    S2_1 inner; tag("Inner")
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S2_2 derive_all();
+
+typedef struct {
+    S2_2 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S2_3 derive_all();
+
+typedef struct {
+    S2_3 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S2_4 derive_all();
+
+typedef struct {
+    S2_4 inner; tag("Inner")
+    unsigned int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S2_5 derive_all();
+
+typedef struct {
+    S2_5 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S2_6 derive_all();
+
+typedef struct {
+    S2_6 inner; tag("Inner")
+    const char* field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S2_7 derive_all();
+
+#endif // F000002_H
@@ -0,0 +1,94 @@
+#ifndef F000003_H
+#define F000003_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S3_0 derive_all();
+
+typedef struct {
+    S3_0 inner; tag("Inner")
+    int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S3_1 derive_all();
+
+typedef struct {
+    S3_1 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S3_2 derive_all();
+
+typedef struct {
+    S3_2 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S3_3 derive_all();
+
+typedef struct {
+    S3_3 inner; tag("Inner")
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S3_4 derive_all();
+
+typedef struct {
+    S3_4 inner; tag("Inner")
+    int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S3_5 derive_all();
+
+typedef struct {
+    S3_5 inner; tag("Inner")
+    unsigned int field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S3_6 derive_all();
+
+typedef struct {
+    S3_6 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S3_7 derive_all();
+
+#endif // F000003_H
@@ -0,0 +1,94 @@
+#ifndef F000004_H
+#define F000004_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S4_0 derive_all();
+
+typedef struct {
+    S4_0 inner; tag("Inner")
+    size_t field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S4_1 derive_all();
+
+typedef struct {
+    S4_1 inner; tag("Inner")
+    unsigned int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S4_2 derive_all();
+
+typedef struct {
+    S4_2 inner; tag("Inner")
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S4_3 derive_all();
+
+typedef struct {
+    S4_3 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S4_4 derive_all();
+
+typedef struct {
+    S4_4 inner; tag("Inner")
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S4_5 derive_all();
+
+typedef struct {
+    S4_5 inner; tag("Inner")
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S4_6 derive_all();
+
+typedef struct {
+    S4_6 inner; tag("Inner")
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S4_7 derive_all();
+
+#endif // F000004_H
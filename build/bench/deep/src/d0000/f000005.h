@@ -0,0 +1,94 @@
+#ifndef F000005_H
+#define F000005_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S5_0 derive_all();
+
+typedef struct {
+    S5_0 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S5_1 derive_all();
+
+typedef struct {
+    S5_1 inner; tag("Inner")
+    bool field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S5_2 derive_all();
+
+typedef struct {
+    S5_2 inner; tag("Inner")
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S5_3 derive_all();
+
+typedef struct {
+    S5_3 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S5_4 derive_all();
+
+typedef struct {
+    S5_4 inner; tag("Inner")
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S5_5 derive_all();
+
+typedef struct {
+    S5_5 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S5_6 derive_all();
+
+typedef struct {
+    S5_6 inner; tag("Inner")
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S5_7 derive_all();
+
+#endif // F000005_H
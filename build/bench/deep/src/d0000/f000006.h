@@ -0,0 +1,94 @@
+#ifndef F000006_H
+#define F000006_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S6_0 derive_all();
+
+typedef struct {
+    S6_0 inner; tag("Inner")
+    double field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S6_1 derive_all();
+
+typedef struct {
+    S6_1 inner; tag("Inner")
+    long field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S6_2 derive_all();
+
+typedef struct {
+    S6_2 inner; tag("Inner")
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S6_3 derive_all();
+
+typedef struct {
+    S6_3 inner; tag("Inner")
+    bool field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S6_4 derive_all();
+
+typedef struct {
+    S6_4 inner; tag("Inner")
+    float field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S6_5 derive_all();
+
+typedef struct {
+    S6_5 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S6_6 derive_all();
+
+typedef struct {
+    S6_6 inner; tag("Inner")
+    int field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S6_7 derive_all();
+
+#endif // F000006_H
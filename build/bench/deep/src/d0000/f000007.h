@@ -0,0 +1,94 @@
+#ifndef F000007_H
+#define F000007_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S7_0 derive_all();
+
+typedef struct {
+    S7_0 inner; tag("Inner")
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S7_1 derive_all();
+
+typedef struct {
+    S7_1 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S7_2 derive_all();
+
+typedef struct {
+    S7_2 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S7_3 derive_all();
+
+typedef struct {
+    S7_3 inner; tag("Inner")
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S7_4 derive_all();
+
+typedef struct {
+    S7_4 inner; tag("Inner")
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S7_5 derive_all();
+
+typedef struct {
+    S7_5 inner; tag("Inner")
+    size_t field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S7_6 derive_all();
+
+typedef struct {
+    S7_6 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S7_7 derive_all();
+
+#endif // F000007_H
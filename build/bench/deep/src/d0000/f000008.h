@@ -0,0 +1,94 @@
+#ifndef F000008_H
+#define F000008_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S8_0 derive_all();
+
+typedef struct {
+    S8_0 inner; tag("Inner")
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S8_1 derive_all();
+
+typedef struct {
+    S8_1 inner; tag("Inner")
+    double field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S8_2 derive_all();
+
+typedef struct {
+    S8_2 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S8_3 derive_all();
+
+typedef struct {
+    S8_3 inner; tag("Inner")
+    int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S8_4 derive_all();
+
+typedef struct {
+    S8_4 inner; tag("Inner")
+    bool field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S8_5 derive_all();
+
+typedef struct {
+    S8_5 inner; tag("Inner")
+    const char* field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S8_6 derive_all();
+
+typedef struct {
+    S8_6 inner; tag("Inner")
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S8_7 derive_all();
+
+#endif // F000008_H
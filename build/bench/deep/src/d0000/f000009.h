@@ -0,0 +1,94 @@
+#ifndef F000009_H
+#define F000009_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S9_0 derive_all();
+
+typedef struct {
+    S9_0 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S9_1 derive_all();
+
+typedef struct {
+    S9_1 inner; tag("Inner")
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S9_2 derive_all();
+
+typedef struct {
+    S9_2 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S9_3 derive_all();
+
+typedef struct {
+    S9_3 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S9_4 derive_all();
+
+typedef struct {
+    S9_4 inner; tag("Inner")
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S9_5 derive_all();
+
+typedef struct {
+    S9_5 inner; tag("Inner")
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S9_6 derive_all();
+
+typedef struct {
+    S9_6 inner; tag("Inner")
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S9_7 derive_all();
+
+#endif // F000009_H
@@ -0,0 +1,94 @@
+#ifndef F000010_H
+#define F000010_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S10_0 derive_all();
+
+typedef struct {
+    S10_0 inner; tag("Inner")
+    const char* field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S10_1 derive_all();
+
+typedef struct {
+    S10_1 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S10_2 derive_all();
+
+typedef struct {
+    S10_2 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S10_3 derive_all();
+
+typedef struct {
+    S10_3 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S10_4 derive_all();
+
+typedef struct {
+    S10_4 inner; tag("Inner")
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S10_5 derive_all();
+
+typedef struct {
+    S10_5 inner; tag("Inner")
+    bool field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S10_6 derive_all();
+
+typedef struct {
+    S10_6 inner; tag("Inner")
+    bool field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S10_7 derive_all();
+
+#endif // F000010_H
@@ -0,0 +1,94 @@
+#ifndef F000011_H
+#define F000011_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S11_0 derive_all();
+
+typedef struct {
+    S11_0 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S11_1 derive_all();
+
+typedef struct {
+    S11_1 inner; tag("Inner")
+    size_t field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S11_2 derive_all();
+
+typedef struct {
+    S11_2 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S11_3 derive_all();
+
+typedef struct {
+    S11_3 inner; tag("Inner")
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S11_4 derive_all();
+
+typedef struct {
+    S11_4 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S11_5 derive_all();
+
+typedef struct {
+    S11_5 inner; tag("Inner")
+    double field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S11_6 derive_all();
+
+typedef struct {
+    S11_6 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S11_7 derive_all();
+
+#endif // F000011_H
@@ -0,0 +1,94 @@
+#ifndef F000012_H
+#define F000012_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S12_0 derive_all();
+
+typedef struct {
+    S12_0 inner; tag("Inner")
+    unsigned int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S12_1 derive_all();
+
+typedef struct {
+    S12_1 inner; tag("Inner")
+    bool field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S12_2 derive_all();
+
+typedef struct {
+    S12_2 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S12_3 derive_all();
+
+typedef struct {
+    S12_3 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S12_4 derive_all();
+
+typedef struct {
+    S12_4 inner; tag("Inner")
+    size_t field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S12_5 derive_all();
+
+typedef struct {
+    S12_5 inner; tag("Inner")
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S12_6 derive_all();
+
+typedef struct {
+    S12_6 inner; tag("Inner")
+    const char* field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S12_7 derive_all();
+
+#endif // F000012_H
@@ -0,0 +1,94 @@
+#ifndef F000013_H
+#define F000013_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S13_0 derive_all();
+
+typedef struct {
+    S13_0 inner; tag("Inner")
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S13_1 derive_all();
+
+typedef struct {
+    S13_1 inner; tag("Inner")
+    long field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S13_2 derive_all();
+
+typedef struct {
+    S13_2 inner; tag("Inner")
+    unsigned int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S13_3 derive_all();
+
+typedef struct {
+    S13_3 inner; tag("Inner")
+    double field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S13_4 derive_all();
+
+typedef struct {
+    S13_4 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S13_5 derive_all();
+
+typedef struct {
+    S13_5 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S13_6 derive_all();
+
+typedef struct {
+    S13_6 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S13_7 derive_all();
+
+#endif // F000013_H
@@ -0,0 +1,94 @@
+#ifndef F000014_H
+#define F000014_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S14_0 derive_all();
+
+typedef struct {
+    S14_0 inner; tag("Inner")
+    bool field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S14_1 derive_all();
+
+typedef struct {
+    S14_1 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S14_2 derive_all();
+
+typedef struct {
+    S14_2 inner; tag("Inner")
+    size_t field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S14_3 derive_all();
+
+typedef struct {
+    S14_3 inner; tag("Inner")
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S14_4 derive_all();
+
+typedef struct {
+    S14_4 inner; tag("Inner")
+    const char* field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S14_5 derive_all();
+
+typedef struct {
+    S14_5 inner; tag("Inner")
+    bool field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S14_6 derive_all();
+
+typedef struct {
+    S14_6 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S14_7 derive_all();
+
+#endif // F000014_H
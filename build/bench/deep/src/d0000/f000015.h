@@ -0,0 +1,94 @@
+#ifndef F000015_H
+#define F000015_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S15_0 derive_all();
+
+typedef struct {
+    S15_0 inner; tag("Inner")
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S15_1 derive_all();
+
+typedef struct {
+    S15_1 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S15_2 derive_all();
+
+typedef struct {
+    S15_2 inner; tag("Inner")
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S15_3 derive_all();
+
+typedef struct {
+    S15_3 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S15_4 derive_all();
+
+typedef struct {
+    S15_4 inner; tag("Inner")
+    double field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S15_5 derive_all();
+
+typedef struct {
+    S15_5 inner; tag("Inner")
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S15_6 derive_all();
+
+typedef struct {
+    S15_6 inner; tag("Inner")
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S15_7 derive_all();
+
+#endif // F000015_H
@@ -0,0 +1,94 @@
+#ifndef F000017_H
+#define F000017_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S17_0 derive_all();
+
+typedef struct {
+    S17_0 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S17_1 derive_all();
+
+typedef struct {
+    S17_1 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S17_2 derive_all();
+
+typedef struct {
+    S17_2 inner; tag("Inner")
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S17_3 derive_all();
+
+typedef struct {
+    S17_3 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S17_4 derive_all();
+
+typedef struct {
+    S17_4 inner; tag("Inner")
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S17_5 derive_all();
+
+typedef struct {
+    S17_5 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S17_6 derive_all();
+
+typedef struct {
+    S17_6 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S17_7 derive_all();
+
+#endif // F000017_H
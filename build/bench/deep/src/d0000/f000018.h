@@ -0,0 +1,94 @@
+#ifndef F000018_H
+#define F000018_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S18_0 derive_all();
+
+typedef struct {
+    S18_0 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S18_1 derive_all();
+
+typedef struct {
+    S18_1 inner; tag("Inner")
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S18_2 derive_all();
+
+typedef struct {
+    S18_2 inner; tag("Inner")
+    long field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S18_3 derive_all();
+
+typedef struct {
+    S18_3 inner; tag("Inner")
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S18_4 derive_all();
+
+typedef struct {
+    S18_4 inner; tag("Inner")
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S18_5 derive_all();
+
+typedef struct {
+    S18_5 inner; tag("Inner")
+    float field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S18_6 derive_all();
+
+typedef struct {
+    S18_6 inner; tag("Inner")
+    size_t field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S18_7 derive_all();
+
+#endif // F000018_H
@@ -0,0 +1,94 @@
+#ifndef F000019_H
+#define F000019_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S19_0 derive_all();
+
+typedef struct {
+    S19_0 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S19_1 derive_all();
+
+typedef struct {
+    S19_1 inner; tag("Inner")
+    unsigned int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S19_2 derive_all();
+
+typedef struct {
+    S19_2 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S19_3 derive_all();
+
+typedef struct {
+    S19_3 inner; tag("Inner")
+    int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S19_4 derive_all();
+
+typedef struct {
+    S19_4 inner; tag("Inner")
+    const char* field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S19_5 derive_all();
+
+typedef struct {
+    S19_5 inner; tag("Inner")
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S19_6 derive_all();
+
+typedef struct {
+    S19_6 inner; tag("Inner")
+    int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S19_7 derive_all();
+
+#endif // F000019_H
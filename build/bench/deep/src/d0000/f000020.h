@@ -0,0 +1,94 @@
+#ifndef F000020_H
+#define F000020_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S20_0 derive_all();
+
+typedef struct {
+    S20_0 inner; tag("Inner")
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S20_1 derive_all();
+
+typedef struct {
+    S20_1 inner; tag("Inner")
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S20_2 derive_all();
+
+typedef struct {
+    S20_2 inner; tag("Inner")
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S20_3 derive_all();
+
+typedef struct {
+    S20_3 inner; tag("Inner")
+    int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S20_4 derive_all();
+
+typedef struct {
+    S20_4 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S20_5 derive_all();
+
+typedef struct {
+    S20_5 inner; tag("Inner")
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S20_6 derive_all();
+
+typedef struct {
+    S20_6 inner; tag("Inner")
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S20_7 derive_all();
+
+#endif // F000020_H
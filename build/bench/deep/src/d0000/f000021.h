@@ -0,0 +1,94 @@
+#ifndef F000021_H
+#define F000021_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S21_0 derive_all();
+
+typedef struct {
+    S21_0 inner; tag("Inner")
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S21_1 derive_all();
+
+typedef struct {
+    S21_1 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S21_2 derive_all();
+
+typedef struct {
+    S21_2 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S21_3 derive_all();
+
+typedef struct {
+    S21_3 inner; tag("Inner")
+    int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S21_4 derive_all();
+
+typedef struct {
+    S21_4 inner; tag("Inner")
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S21_5 derive_all();
+
+typedef struct {
+    S21_5 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S21_6 derive_all();
+
+typedef struct {
+    S21_6 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S21_7 derive_all();
+
+#endif // F000021_H
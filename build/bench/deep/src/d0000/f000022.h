@@ -0,0 +1,94 @@
+#ifndef F000022_H
+#define F000022_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S22_0 derive_all();
+
+typedef struct {
+    S22_0 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S22_1 derive_all();
+
+typedef struct {
+    S22_1 inner; tag("Inner")
+    const char* field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S22_2 derive_all();
+
+typedef struct {
+    S22_2 inner; tag("Inner")
+    unsigned int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S22_3 derive_all();
+
+typedef struct {
+    S22_3 inner; tag("Inner")
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S22_4 derive_all();
+
+typedef struct {
+    S22_4 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S22_5 derive_all();
+
+typedef struct {
+    S22_5 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S22_6 derive_all();
+
+typedef struct {
+    S22_6 inner; tag("Inner")
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S22_7 derive_all();
+
+#endif // F000022_H
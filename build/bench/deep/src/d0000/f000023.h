@@ -0,0 +1,94 @@
+#ifndef F000023_H
+#define F000023_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S23_0 derive_all();
+
+typedef struct {
+    S23_0 inner; tag("Inner")
+    bool field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S23_1 derive_all();
+
+typedef struct {
+    S23_1 inner; tag("Inner")
+    int field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S23_2 derive_all();
+
+typedef struct {
+    S23_2 inner; tag("Inner")
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S23_3 derive_all();
+
+typedef struct {
+    S23_3 inner; tag("Inner")
+    long field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S23_4 derive_all();
+
+typedef struct {
+    S23_4 inner; tag("Inner")
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S23_5 derive_all();
+
+typedef struct {
+    S23_5 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S23_6 derive_all();
+
+typedef struct {
+    S23_6 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S23_7 derive_all();
+
+#endif // F000023_H
@@ -0,0 +1,94 @@
+#ifndef F000024_H
+#define F000024_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S24_0 derive_all();
+
+typedef struct {
+    S24_0 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S24_1 derive_all();
+
+typedef struct {
+    S24_1 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S24_2 derive_all();
+
+typedef struct {
+    S24_2 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S24_3 derive_all();
+
+typedef struct {
+    S24_3 inner; tag("Inner")
+    const char* field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S24_4 derive_all();
+
+typedef struct {
+    S24_4 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S24_5 derive_all();
+
+typedef struct {
+    S24_5 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S24_6 derive_all();
+
+typedef struct {
+    S24_6 inner; tag("Inner")
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S24_7 derive_all();
+
+#endif // F000024_H
@@ -0,0 +1,94 @@
+#ifndef F000025_H
+#define F000025_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S25_0 derive_all();
+
+typedef struct {
+    S25_0 inner; tag("Inner")
+    unsigned int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S25_1 derive_all();
+
+typedef struct {
+    S25_1 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S25_2 derive_all();
+
+typedef struct {
+    S25_2 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S25_3 derive_all();
+
+typedef struct {
+    S25_3 inner; tag("Inner")
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S25_4 derive_all();
+
+typedef struct {
+    S25_4 inner; tag("Inner")
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S25_5 derive_all();
+
+typedef struct {
+    S25_5 inner; tag("Inner")
+    bool field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S25_6 derive_all();
+
+typedef struct {
+    S25_6 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S25_7 derive_all();
+
+#endif // F000025_H
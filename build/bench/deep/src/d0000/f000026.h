@@ -0,0 +1,94 @@
+#ifndef F000026_H
+#define F000026_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S26_0 derive_all();
+
+typedef struct {
+    S26_0 inner; tag("Inner")
+    int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S26_1 derive_all();
+
+typedef struct {
+    S26_1 inner; tag("Inner")
+    size_t field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S26_2 derive_all();
+
+typedef struct {
+    S26_2 inner; tag("Inner")
+    int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S26_3 derive_all();
+
+typedef struct {
+    S26_3 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S26_4 derive_all();
+
+typedef struct {
+    S26_4 inner; tag("Inner")
+    bool field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S26_5 derive_all();
+
+typedef struct {
+    S26_5 inner; tag("Inner")
+    bool field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S26_6 derive_all();
+
+typedef struct {
+    S26_6 inner; tag("Inner")
+    float field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S26_7 derive_all();
+
+#endif // F000026_H
@@ -0,0 +1,94 @@
+#ifndef F000027_H
+#define F000027_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S27_0 derive_all();
+
+typedef struct {
+    S27_0 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S27_1 derive_all();
+
+typedef struct {
+    S27_1 inner; tag("Inner")
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S27_2 derive_all();
+
+typedef struct {
+    S27_2 inner; tag("Inner")
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S27_3 derive_all();
+
+typedef struct {
+    S27_3 inner; tag("Inner")
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S27_4 derive_all();
+
+typedef struct {
+    S27_4 inner; tag("Inner")
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S27_5 derive_all();
+
+typedef struct {
+    S27_5 inner; tag("Inner")
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S27_6 derive_all();
+
+typedef struct {
+    S27_6 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S27_7 derive_all();
+
+#endif // F000027_H
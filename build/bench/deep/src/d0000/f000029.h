@@ -0,0 +1,94 @@
+#ifndef F000029_H
+#define F000029_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S29_0 derive_all();
+
+typedef struct {
+    S29_0 inner; tag("Inner")
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S29_1 derive_all();
+
+typedef struct {
+    S29_1 inner; tag("Inner")
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S29_2 derive_all();
+
+typedef struct {
+    S29_2 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S29_3 derive_all();
+
+typedef struct {
+    S29_3 inner; tag("Inner")
+    unsigned int field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S29_4 derive_all();
+
+typedef struct {
+    S29_4 inner; tag("Inner")
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S29_5 derive_all();
+
+typedef struct {
+    S29_5 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S29_6 derive_all();
+
+typedef struct {
+    S29_6 inner; tag("Inner")
+    bool field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S29_7 derive_all();
+
+#endif // F000029_H
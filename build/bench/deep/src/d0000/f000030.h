@@ -0,0 +1,94 @@
+#ifndef F000030_H
+#define F000030_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S30_0 derive_all();
+
+typedef struct {
+    S30_0 inner; tag("Inner")
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S30_1 derive_all();
+
+typedef struct {
+    S30_1 inner; tag("Inner")
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S30_2 derive_all();
+
+typedef struct {
+    S30_2 inner; tag("Inner")
+    long field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S30_3 derive_all();
+
+typedef struct {
+    S30_3 inner; tag("Inner")
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S30_4 derive_all();
+
+typedef struct {
+    S30_4 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S30_5 derive_all();
+
+typedef struct {
+    S30_5 inner; tag("Inner")
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S30_6 derive_all();
+
+typedef struct {
+    S30_6 inner; tag("Inner")
+    size_t field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S30_7 derive_all();
+
+#endif // F000030_H
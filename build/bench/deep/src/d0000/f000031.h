@@ -0,0 +1,94 @@
+#ifndef F000031_H
+#define F000031_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S31_0 derive_all();
+
+typedef struct {
+    S31_0 inner; tag("Inner")
+    unsigned int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S31_1 derive_all();
+
+typedef struct {
+    S31_1 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S31_2 derive_all();
+
+typedef struct {
+    S31_2 inner; tag("Inner")
+    const char* field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S31_3 derive_all();
+
+typedef struct {
+    S31_3 inner; tag("Inner")
+    unsigned int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S31_4 derive_all();
+
+typedef struct {
+    S31_4 inner; tag("Inner")
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S31_5 derive_all();
+
+typedef struct {
+    S31_5 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S31_6 derive_all();
+
+typedef struct {
+    S31_6 inner; tag("Inner")
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S31_7 derive_all();
+
+#endif // F000031_H
@@ -0,0 +1,94 @@
+#ifndef F000032_H
+#define F000032_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S32_0 derive_all();
+
+typedef struct {
+    S32_0 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S32_1 derive_all();
+
+typedef struct {
+    S32_1 inner; tag("Inner")
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S32_2 derive_all();
+
+typedef struct {
+    S32_2 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S32_3 derive_all();
+
+typedef struct {
+    S32_3 inner; tag("Inner")
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S32_4 derive_all();
+
+typedef struct {
+    S32_4 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S32_5 derive_all();
+
+typedef struct {
+    S32_5 inner; tag("Inner")
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S32_6 derive_all();
+
+typedef struct {
+    S32_6 inner; tag("Inner")
+    const char* field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S32_7 derive_all();
+
+#endif // F000032_H
@@ -0,0 +1,94 @@
+#ifndef F000033_H
+#define F000033_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S33_0 derive_all();
+
+typedef struct {
+    S33_0 inner; tag("Inner")
+    const char* field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S33_1 derive_all();
+
+typedef struct {
+    S33_1 inner; tag("Inner")
+    int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S33_2 derive_all();
+
+typedef struct {
+    S33_2 inner; tag("Inner")
+    float field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S33_3 derive_all();
+
+typedef struct {
+    S33_3 inner; tag("Inner")
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S33_4 derive_all();
+
+typedef struct {
+    S33_4 inner; tag("Inner")
+    double field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S33_5 derive_all();
+
+typedef struct {
+    S33_5 inner; tag("Inner")
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S33_6 derive_all();
+
+typedef struct {
+    S33_6 inner; tag("Inner")
+    long field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S33_7 derive_all();
+
+#endif // F000033_H
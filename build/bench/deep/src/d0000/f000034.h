@@ -0,0 +1,94 @@
+#ifndef F000034_H
+#define F000034_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S34_0 derive_all();
+
+typedef struct {
+    S34_0 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S34_1 derive_all();
+
+typedef struct {
+    S34_1 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S34_2 derive_all();
+
+typedef struct {
+    S34_2 inner; tag("Inner")
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S34_3 derive_all();
+
+typedef struct {
+    S34_3 inner; tag("Inner")
+    long field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S34_4 derive_all();
+
+typedef struct {
+    S34_4 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S34_5 derive_all();
+
+typedef struct {
+    S34_5 inner; tag("Inner")
+    float field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S34_6 derive_all();
+
+typedef struct {
+    S34_6 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S34_7 derive_all();
+
+#endif // F000034_H
@@ -0,0 +1,94 @@
+#ifndef F000035_H
+#define F000035_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S35_0 derive_all();
+
+typedef struct {
+    S35_0 inner; tag("Inner")
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S35_1 derive_all();
+
+typedef struct {
+    S35_1 inner; tag("Inner")
+    int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S35_2 derive_all();
+
+typedef struct {
+    S35_2 inner; tag("Inner")
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S35_3 derive_all();
+
+typedef struct {
+    S35_3 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S35_4 derive_all();
+
+typedef struct {
+    S35_4 inner; tag("Inner")
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S35_5 derive_all();
+
+typedef struct {
+    S35_5 inner; tag("Inner")
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S35_6 derive_all();
+
+typedef struct {
+    S35_6 inner; tag("Inner")
+    unsigned int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S35_7 derive_all();
+
+#endif // F000035_H
@@ -0,0 +1,94 @@
+#ifndef F000036_H
+#define F000036_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S36_0 derive_all();
+
+typedef struct {
+    S36_0 inner; tag("Inner")
+    const char* field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S36_1 derive_all();
+
+typedef struct {
+    S36_1 inner; tag("Inner")
+    int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S36_2 derive_all();
+
+typedef struct {
+    S36_2 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S36_3 derive_all();
+
+typedef struct {
+    S36_3 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S36_4 derive_all();
+
+typedef struct {
+    S36_4 inner; tag("Inner")
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S36_5 derive_all();
+
+typedef struct {
+    S36_5 inner; tag("Inner")
+    const char* field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S36_6 derive_all();
+
+typedef struct {
+    S36_6 inner; tag("Inner")
+    unsigned int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S36_7 derive_all();
+
+#endif // F000036_H
@@ -0,0 +1,94 @@
+#ifndef F000037_H
+#define F000037_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S37_0 derive_all();
+
+typedef struct {
+    S37_0 inner; tag("Inner")
+    bool field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S37_1 derive_all();
+
+typedef struct {
+    S37_1 inner; tag("Inner")
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S37_2 derive_all();
+
+typedef struct {
+    S37_2 inner; tag("Inner")
+    unsigned int field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S37_3 derive_all();
+
+typedef struct {
+    S37_3 inner; tag("Inner")
+    size_t field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S37_4 derive_all();
+
+typedef struct {
+    S37_4 inner; tag("Inner")
+    bool field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S37_5 derive_all();
+
+typedef struct {
+    S37_5 inner; tag("Inner")
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S37_6 derive_all();
+
+typedef struct {
+    S37_6 inner; tag("Inner")
+    const char* field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S37_7 derive_all();
+
+#endif // F000037_H
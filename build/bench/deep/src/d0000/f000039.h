@@ -0,0 +1,94 @@
+#ifndef F000039_H
+#define F000039_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S39_0 derive_all();
+
+typedef struct {
+    S39_0 inner; tag("Inner")
+    unsigned int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S39_1 derive_all();
+
+typedef struct {
+    S39_1 inner; tag("Inner")
+    double field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S39_2 derive_all();
+
+typedef struct {
+    S39_2 inner; tag("Inner")
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S39_3 derive_all();
+
+typedef struct {
+    S39_3 inner; tag("Inner")
+    const char* field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S39_4 derive_all();
+
+typedef struct {
+    S39_4 inner; tag("Inner")
+    int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S39_5 derive_all();
+
+typedef struct {
+    S39_5 inner; tag("Inner")
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S39_6 derive_all();
+
+typedef struct {
+    S39_6 inner; tag("Inner")
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S39_7 derive_all();
+
+#endif // F000039_H
@@ -0,0 +1,50 @@
+#ifndef F000000_H
+#define F000000_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S0_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S0_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S0_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S0_3 derive_all();
+
+#endif // F000000_H
@@ -0,0 +1,50 @@
+#ifndef F000001_H
+#define F000001_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S1_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S1_1 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S1_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S1_3 derive_all();
+
+#endif // F000001_H
@@ -0,0 +1,50 @@
+#ifndef F000002_H
+#define F000002_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S2_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S2_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S2_2 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S2_3 derive_all();
+
+#endif // F000002_H
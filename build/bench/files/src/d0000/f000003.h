@@ -0,0 +1,50 @@
+#ifndef F000003_H
+#define F000003_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S3_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S3_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S3_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S3_3 derive_all();
+
+#endif // F000003_H
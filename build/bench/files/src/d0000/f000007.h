@@ -0,0 +1,50 @@
+#ifndef F000007_H
+#define F000007_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S7_0 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S7_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S7_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S7_3 derive_all();
+
+#endif // F000007_H
@@ -0,0 +1,50 @@
+#ifndef F000010_H
+#define F000010_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S10_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S10_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S10_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S10_3 derive_all();
+
+#endif // F000010_H
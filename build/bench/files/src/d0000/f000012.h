@@ -0,0 +1,50 @@
+#ifndef F000012_H
+#define F000012_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S12_0 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S12_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S12_2 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S12_3 derive_all();
+
+#endif // F000012_H
@@ -0,0 +1,50 @@
+#ifndef F000015_H
+#define F000015_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S15_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S15_1 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S15_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S15_3 derive_all();
+
+#endif // F000015_H
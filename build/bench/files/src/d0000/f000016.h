@@ -0,0 +1,50 @@
+#ifndef F000016_H
+#define F000016_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S16_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S16_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S16_2 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S16_3 derive_all();
+
+#endif // F000016_H
@@ -0,0 +1,50 @@
+#ifndef F000017_H
+#define F000017_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S17_0 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S17_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S17_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S17_3 derive_all();
+
+#endif // F000017_H
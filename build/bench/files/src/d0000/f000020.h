@@ -0,0 +1,50 @@
+#ifndef F000020_H
+#define F000020_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S20_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S20_1 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S20_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S20_3 derive_all();
+
+#endif // F000020_H
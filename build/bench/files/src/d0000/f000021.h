@@ -0,0 +1,50 @@
+#ifndef F000021_H
+#define F000021_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S21_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S21_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S21_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S21_3 derive_all();
+
+#endif // F000021_H
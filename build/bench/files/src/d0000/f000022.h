@@ -0,0 +1,50 @@
+#ifndef F000022_H
+#define F000022_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S22_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S22_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S22_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S22_3 derive_all();
+
+#endif // F000022_H
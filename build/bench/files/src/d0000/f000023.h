@@ -0,0 +1,50 @@
+#ifndef F000023_H
+#define F000023_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S23_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S23_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S23_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S23_3 derive_all();
+
+#endif // F000023_H
@@ -0,0 +1,50 @@
+#ifndef F000024_H
+#define F000024_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S24_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S24_1 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S24_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S24_3 derive_all();
+
+#endif // F000024_H
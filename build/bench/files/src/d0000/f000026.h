@@ -0,0 +1,50 @@
+#ifndef F000026_H
+#define F000026_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S26_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S26_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S26_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S26_3 derive_all();
+
+#endif // F000026_H
@@ -0,0 +1,50 @@
+#ifndef F000027_H
+#define F000027_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S27_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S27_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S27_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S27_3 derive_all();
+
+#endif // F000027_H
@@ -0,0 +1,50 @@
+#ifndef F000028_H
+#define F000028_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S28_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S28_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S28_2 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S28_3 derive_all();
+
+#endif // F000028_H
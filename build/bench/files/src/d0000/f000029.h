@@ -0,0 +1,50 @@
+#ifndef F000029_H
+#define F000029_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S29_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S29_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S29_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S29_3 derive_all();
+
+#endif // F000029_H
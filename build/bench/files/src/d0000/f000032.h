@@ -0,0 +1,50 @@
+#ifndef F000032_H
+#define F000032_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S32_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S32_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S32_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S32_3 derive_all();
+
+#endif // F000032_H
@@ -0,0 +1,50 @@
+#ifndef F000033_H
+#define F000033_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S33_0 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S33_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S33_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S33_3 derive_all();
+
+#endif // F000033_H
@@ -0,0 +1,50 @@
+#ifndef F000037_H
+#define F000037_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S37_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S37_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S37_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S37_3 derive_all();
+
+#endif // F000037_H
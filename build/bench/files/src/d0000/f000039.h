@@ -0,0 +1,50 @@
+#ifndef F000039_H
+#define F000039_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S39_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S39_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S39_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S39_3 derive_all();
+
+#endif // F000039_H
@@ -0,0 +1,50 @@
+#ifndef F000041_H
+#define F000041_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S41_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S41_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S41_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S41_3 derive_all();
+
+#endif // F000041_H
@@ -0,0 +1,50 @@
+#ifndef F000042_H
+#define F000042_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S42_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S42_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S42_2 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S42_3 derive_all();
+
+#endif // F000042_H
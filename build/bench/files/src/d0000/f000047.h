@@ -0,0 +1,50 @@
+#ifndef F000047_H
+#define F000047_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S47_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S47_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S47_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S47_3 derive_all();
+
+#endif // F000047_H
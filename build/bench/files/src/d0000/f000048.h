@@ -0,0 +1,50 @@
+#ifndef F000048_H
+#define F000048_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S48_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S48_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S48_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S48_3 derive_all();
+
+#endif // F000048_H
@@ -0,0 +1,50 @@
+#ifndef F000051_H
+#define F000051_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S51_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S51_1 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S51_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S51_3 derive_all();
+
+#endif // F000051_H
@@ -0,0 +1,50 @@
+#ifndef F000052_H
+#define F000052_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S52_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S52_1 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S52_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S52_3 derive_all();
+
+#endif // F000052_H
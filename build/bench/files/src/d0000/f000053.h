@@ -0,0 +1,50 @@
+#ifndef F000053_H
+#define F000053_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S53_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S53_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S53_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S53_3 derive_all();
+
+#endif // F000053_H
@@ -0,0 +1,50 @@
+#ifndef F000054_H
+#define F000054_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S54_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S54_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S54_2 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S54_3 derive_all();
+
+#endif // F000054_H
@@ -0,0 +1,50 @@
+#ifndef F000055_H
+#define F000055_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S55_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S55_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S55_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S55_3 derive_all();
+
+#endif // F000055_H
@@ -0,0 +1,50 @@
+#ifndef F000056_H
+#define F000056_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S56_0 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S56_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S56_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S56_3 derive_all();
+
+#endif // F000056_H
@@ -0,0 +1,50 @@
+#ifndef F000058_H
+#define F000058_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S58_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S58_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S58_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S58_3 derive_all();
+
+#endif // F000058_H
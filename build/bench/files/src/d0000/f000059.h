@@ -0,0 +1,50 @@
+#ifndef F000059_H
+#define F000059_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S59_0 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S59_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S59_2 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S59_3 derive_all();
+
+#endif // F000059_H
@@ -0,0 +1,50 @@
+#ifndef F000060_H
+#define F000060_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S60_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S60_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S60_2 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S60_3 derive_all();
+
+#endif // F000060_H
@@ -0,0 +1,50 @@
+#ifndef F000061_H
+#define F000061_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S61_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S61_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S61_2 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S61_3 derive_all();
+
+#endif // F000061_H
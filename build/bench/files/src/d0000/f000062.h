@@ -0,0 +1,50 @@
+#ifndef F000062_H
+#define F000062_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S62_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S62_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S62_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S62_3 derive_all();
+
+#endif // F000062_H
@@ -0,0 +1,50 @@
+#ifndef F000063_H
+#define F000063_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S63_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S63_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S63_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S63_3 derive_all();
+
+#endif // F000063_H
@@ -0,0 +1,50 @@
+#ifndef F000064_H
+#define F000064_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S64_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S64_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S64_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S64_3 derive_all();
+
+#endif // F000064_H
@@ -0,0 +1,50 @@
+#ifndef F000065_H
+#define F000065_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S65_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S65_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S65_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S65_3 derive_all();
+
+#endif // F000065_H
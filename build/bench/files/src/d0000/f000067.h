@@ -0,0 +1,50 @@
+#ifndef F000067_H
+#define F000067_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S67_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S67_1 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S67_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S67_3 derive_all();
+
+#endif // F000067_H
@@ -0,0 +1,50 @@
+#ifndef F000069_H
+#define F000069_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S69_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S69_1 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S69_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S69_3 derive_all();
+
+#endif // F000069_H
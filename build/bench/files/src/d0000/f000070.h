@@ -0,0 +1,50 @@
+#ifndef F000070_H
+#define F000070_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S70_0 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S70_1 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S70_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S70_3 derive_all();
+
+#endif // F000070_H
@@ -0,0 +1,50 @@
+#ifndef F000071_H
+#define F000071_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S71_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S71_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S71_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S71_3 derive_all();
+
+#endif // F000071_H
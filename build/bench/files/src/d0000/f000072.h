@@ -0,0 +1,50 @@
+#ifndef F000072_H
+#define F000072_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S72_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S72_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S72_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S72_3 derive_all();
+
+#endif // F000072_H
@@ -0,0 +1,50 @@
+#ifndef F000074_H
+#define F000074_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S74_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S74_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S74_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S74_3 derive_all();
+
+#endif // F000074_H
@@ -0,0 +1,50 @@
+#ifndef F000075_H
+#define F000075_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S75_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S75_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S75_2 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S75_3 derive_all();
+
+#endif // F000075_H
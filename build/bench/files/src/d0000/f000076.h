@@ -0,0 +1,50 @@
+#ifndef F000076_H
+#define F000076_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S76_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S76_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S76_2 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S76_3 derive_all();
+
+#endif // F000076_H
@@ -0,0 +1,50 @@
+#ifndef F000077_H
+#define F000077_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S77_0 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S77_1 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S77_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S77_3 derive_all();
+
+#endif // F000077_H
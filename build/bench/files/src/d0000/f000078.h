@@ -0,0 +1,50 @@
+#ifndef F000078_H
+#define F000078_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S78_0 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S78_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S78_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S78_3 derive_all();
+
+#endif // F000078_H
@@ -0,0 +1,50 @@
+#ifndef F000080_H
+#define F000080_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S80_0 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S80_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S80_2 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S80_3 derive_all();
+
+#endif // F000080_H
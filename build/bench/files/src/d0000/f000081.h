@@ -0,0 +1,50 @@
+#ifndef F000081_H
+#define F000081_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S81_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S81_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S81_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S81_3 derive_all();
+
+#endif // F000081_H
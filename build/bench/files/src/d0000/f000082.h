@@ -0,0 +1,50 @@
+#ifndef F000082_H
+#define F000082_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S82_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S82_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S82_2 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S82_3 derive_all();
+
+#endif // F000082_H
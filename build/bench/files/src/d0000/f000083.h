@@ -0,0 +1,50 @@
+#ifndef F000083_H
+#define F000083_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S83_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S83_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S83_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S83_3 derive_all();
+
+#endif // F000083_H
@@ -0,0 +1,50 @@
+#ifndef F000084_H
+#define F000084_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S84_0 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S84_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S84_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S84_3 derive_all();
+
+#endif // F000084_H
@@ -0,0 +1,50 @@
+#ifndef F000085_H
+#define F000085_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S85_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S85_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S85_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S85_3 derive_all();
+
+#endif // F000085_H
@@ -0,0 +1,50 @@
+#ifndef F000086_H
+#define F000086_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S86_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S86_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S86_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S86_3 derive_all();
+
+#endif // F000086_H
@@ -0,0 +1,50 @@
+#ifndef F000088_H
+#define F000088_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S88_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S88_1 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S88_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S88_3 derive_all();
+
+#endif // F000088_H
@@ -0,0 +1,50 @@
+#ifndef F000089_H
+#define F000089_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S89_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S89_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S89_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S89_3 derive_all();
+
+#endif // F000089_H
@@ -0,0 +1,50 @@
+#ifndef F000090_H
+#define F000090_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S90_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S90_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S90_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S90_3 derive_all();
+
+#endif // F000090_H
@@ -0,0 +1,50 @@
+#ifndef F000091_H
+#define F000091_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S91_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S91_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S91_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S91_3 derive_all();
+
+#endif // F000091_H
@@ -0,0 +1,50 @@
+#ifndef F000092_H
+#define F000092_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S92_0 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S92_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S92_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S92_3 derive_all();
+
+#endif // F000092_H
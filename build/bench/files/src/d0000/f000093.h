@@ -0,0 +1,50 @@
+#ifndef F000093_H
+#define F000093_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S93_0 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S93_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S93_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S93_3 derive_all();
+
+#endif // F000093_H
@@ -0,0 +1,50 @@
+#ifndef F000096_H
+#define F000096_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S96_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S96_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S96_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S96_3 derive_all();
+
+#endif // F000096_H
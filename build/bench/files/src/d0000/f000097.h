@@ -0,0 +1,50 @@
+#ifndef F000097_H
+#define F000097_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S97_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S97_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S97_2 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S97_3 derive_all();
+
+#endif // F000097_H
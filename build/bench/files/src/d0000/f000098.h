@@ -0,0 +1,50 @@
+#ifndef F000098_H
+#define F000098_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S98_0 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S98_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S98_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S98_3 derive_all();
+
+#endif // F000098_H
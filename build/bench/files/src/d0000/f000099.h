@@ -0,0 +1,50 @@
+#ifndef F000099_H
+#define F000099_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S99_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S99_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S99_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S99_3 derive_all();
+
+#endif // F000099_H
@@ -0,0 +1,50 @@
+#ifndef F000100_H
+#define F000100_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S100_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S100_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S100_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S100_3 derive_all();
+
+#endif // F000100_H
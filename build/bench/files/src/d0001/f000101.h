@@ -0,0 +1,50 @@
+#ifndef F000101_H
+#define F000101_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S101_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S101_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S101_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S101_3 derive_all();
+
+#endif // F000101_H
@@ -0,0 +1,50 @@
+#ifndef F000102_H
+#define F000102_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S102_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S102_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S102_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S102_3 derive_all();
+
+#endif // F000102_H
@@ -0,0 +1,50 @@
+#ifndef F000104_H
+#define F000104_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S104_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S104_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S104_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S104_3 derive_all();
+
+#endif // F000104_H
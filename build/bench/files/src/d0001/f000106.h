@@ -0,0 +1,50 @@
+#ifndef F000106_H
+#define F000106_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S106_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S106_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S106_2 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S106_3 derive_all();
+
+#endif // F000106_H
@@ -0,0 +1,50 @@
+#ifndef F000107_H
+#define F000107_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S107_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S107_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S107_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S107_3 derive_all();
+
+#endif // F000107_H
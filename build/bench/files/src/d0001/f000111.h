@@ -0,0 +1,50 @@
+#ifndef F000111_H
+#define F000111_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S111_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S111_1 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S111_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S111_3 derive_all();
+
+#endif // F000111_H
@@ -0,0 +1,50 @@
+#ifndef F000113_H
+#define F000113_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S113_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S113_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S113_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S113_3 derive_all();
+
+#endif // F000113_H
@@ -0,0 +1,50 @@
+#ifndef F000115_H
+#define F000115_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S115_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S115_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S115_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S115_3 derive_all();
+
+#endif // F000115_H
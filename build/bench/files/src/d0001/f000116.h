@@ -0,0 +1,50 @@
+#ifndef F000116_H
+#define F000116_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S116_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S116_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S116_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S116_3 derive_all();
+
+#endif // F000116_H
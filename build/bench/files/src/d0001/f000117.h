@@ -0,0 +1,50 @@
+#ifndef F000117_H
+#define F000117_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S117_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S117_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S117_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S117_3 derive_all();
+
+#endif // F000117_H
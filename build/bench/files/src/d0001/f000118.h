@@ -0,0 +1,50 @@
+#ifndef F000118_H
+#define F000118_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S118_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S118_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S118_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S118_3 derive_all();
+
+#endif // F000118_H
@@ -0,0 +1,50 @@
+#ifndef F000120_H
+#define F000120_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S120_0 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S120_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S120_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S120_3 derive_all();
+
+#endif // F000120_H
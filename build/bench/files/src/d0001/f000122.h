@@ -0,0 +1,50 @@
+#ifndef F000122_H
+#define F000122_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S122_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S122_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S122_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S122_3 derive_all();
+
+#endif // F000122_H
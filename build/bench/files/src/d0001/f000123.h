@@ -0,0 +1,50 @@
+#ifndef F000123_H
+#define F000123_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S123_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S123_1 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S123_2 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S123_3 derive_all();
+
+#endif // F000123_H
@@ -0,0 +1,50 @@
+#ifndef F000124_H
+#define F000124_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S124_0 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S124_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S124_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S124_3 derive_all();
+
+#endif // F000124_H
@@ -0,0 +1,50 @@
+#ifndef F000127_H
+#define F000127_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S127_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S127_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S127_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S127_3 derive_all();
+
+#endif // F000127_H
@@ -0,0 +1,50 @@
+#ifndef F000128_H
+#define F000128_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S128_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S128_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S128_2 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S128_3 derive_all();
+
+#endif // F000128_H
@@ -0,0 +1,50 @@
+#ifndef F000129_H
+#define F000129_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S129_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S129_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S129_2 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S129_3 derive_all();
+
+#endif // F000129_H
@@ -0,0 +1,50 @@
+#ifndef F000130_H
+#define F000130_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S130_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S130_1 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S130_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S130_3 derive_all();
+
+#endif // F000130_H
@@ -0,0 +1,50 @@
+#ifndef F000131_H
+#define F000131_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S131_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S131_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S131_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S131_3 derive_all();
+
+#endif // F000131_H
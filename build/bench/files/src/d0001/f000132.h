@@ -0,0 +1,50 @@
+#ifndef F000132_H
+#define F000132_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S132_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S132_1 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S132_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S132_3 derive_all();
+
+#endif // F000132_H
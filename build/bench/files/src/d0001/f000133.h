@@ -0,0 +1,50 @@
+#ifndef F000133_H
+#define F000133_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S133_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S133_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S133_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S133_3 derive_all();
+
+#endif // F000133_H
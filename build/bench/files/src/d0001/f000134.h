@@ -0,0 +1,50 @@
+#ifndef F000134_H
+#define F000134_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S134_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S134_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S134_2 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S134_3 derive_all();
+
+#endif // F000134_H
@@ -0,0 +1,50 @@
+#ifndef F000136_H
+#define F000136_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S136_0 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S136_1 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S136_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S136_3 derive_all();
+
+#endif // F000136_H
@@ -0,0 +1,50 @@
+#ifndef F000137_H
+#define F000137_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S137_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S137_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S137_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S137_3 derive_all();
+
+#endif // F000137_H
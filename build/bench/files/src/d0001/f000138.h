@@ -0,0 +1,50 @@
+#ifndef F000138_H
+#define F000138_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S138_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S138_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S138_2 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S138_3 derive_all();
+
+#endif // F000138_H
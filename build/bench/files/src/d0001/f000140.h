@@ -0,0 +1,50 @@
+#ifndef F000140_H
+#define F000140_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S140_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S140_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S140_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S140_3 derive_all();
+
+#endif // F000140_H
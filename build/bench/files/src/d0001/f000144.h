@@ -0,0 +1,50 @@
+#ifndef F000144_H
+#define F000144_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S144_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S144_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S144_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S144_3 derive_all();
+
+#endif // F000144_H
@@ -0,0 +1,50 @@
+#ifndef F000145_H
+#define F000145_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S145_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S145_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S145_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S145_3 derive_all();
+
+#endif // F000145_H
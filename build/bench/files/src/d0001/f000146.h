@@ -0,0 +1,50 @@
+#ifndef F000146_H
+#define F000146_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S146_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S146_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S146_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S146_3 derive_all();
+
+#endif // F000146_H
@@ -0,0 +1,50 @@
+#ifndef F000147_H
+#define F000147_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S147_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S147_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S147_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S147_3 derive_all();
+
+#endif // F000147_H
@@ -0,0 +1,50 @@
+#ifndef F000148_H
+#define F000148_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S148_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S148_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S148_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S148_3 derive_all();
+
+#endif // F000148_H
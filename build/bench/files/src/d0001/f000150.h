@@ -0,0 +1,50 @@
+#ifndef F000150_H
+#define F000150_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S150_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S150_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S150_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S150_3 derive_all();
+
+#endif // F000150_H
@@ -0,0 +1,50 @@
+#ifndef F000153_H
+#define F000153_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S153_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S153_1 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S153_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S153_3 derive_all();
+
+#endif // F000153_H
@@ -0,0 +1,50 @@
+#ifndef F000154_H
+#define F000154_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S154_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S154_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S154_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S154_3 derive_all();
+
+#endif // F000154_H
@@ -0,0 +1,50 @@
+#ifndef F000155_H
+#define F000155_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S155_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S155_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S155_2 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S155_3 derive_all();
+
+#endif // F000155_H
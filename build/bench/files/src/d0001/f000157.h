@@ -0,0 +1,50 @@
+#ifndef F000157_H
+#define F000157_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S157_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S157_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S157_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S157_3 derive_all();
+
+#endif // F000157_H
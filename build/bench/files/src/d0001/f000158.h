@@ -0,0 +1,50 @@
+#ifndef F000158_H
+#define F000158_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S158_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S158_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S158_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S158_3 derive_all();
+
+#endif // F000158_H
@@ -0,0 +1,50 @@
+#ifndef F000159_H
+#define F000159_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S159_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S159_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S159_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S159_3 derive_all();
+
+#endif // F000159_H
@@ -0,0 +1,50 @@
+#ifndef F000160_H
+#define F000160_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S160_0 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S160_1 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S160_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S160_3 derive_all();
+
+#endif // F000160_H
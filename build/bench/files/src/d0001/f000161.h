@@ -0,0 +1,50 @@
+#ifndef F000161_H
+#define F000161_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S161_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S161_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S161_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S161_3 derive_all();
+
+#endif // F000161_H
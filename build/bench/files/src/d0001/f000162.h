@@ -0,0 +1,50 @@
+#ifndef F000162_H
+#define F000162_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S162_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S162_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S162_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S162_3 derive_all();
+
+#endif // F000162_H
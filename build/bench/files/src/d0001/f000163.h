@@ -0,0 +1,50 @@
+#ifndef F000163_H
+#define F000163_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S163_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S163_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S163_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S163_3 derive_all();
+
+#endif // F000163_H
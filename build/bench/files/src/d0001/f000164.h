@@ -0,0 +1,50 @@
+#ifndef F000164_H
+#define F000164_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S164_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S164_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S164_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S164_3 derive_all();
+
+#endif // F000164_H
@@ -0,0 +1,50 @@
+#ifndef F000165_H
+#define F000165_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    long field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S165_0 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S165_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S165_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S165_3 derive_all();
+
+#endif // F000165_H
@@ -0,0 +1,50 @@
+#ifndef F000166_H
+#define F000166_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S166_0 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S166_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S166_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S166_3 derive_all();
+
+#endif // F000166_H
@@ -0,0 +1,50 @@
+#ifndef F000168_H
+#define F000168_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S168_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S168_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S168_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S168_3 derive_all();
+
+#endif // F000168_H
@@ -0,0 +1,50 @@
+#ifndef F000169_H
+#define F000169_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S169_0 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S169_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S169_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S169_3 derive_all();
+
+#endif // F000169_H
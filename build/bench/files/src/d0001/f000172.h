@@ -0,0 +1,50 @@
+#ifndef F000172_H
+#define F000172_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S172_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S172_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S172_2 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S172_3 derive_all();
+
+#endif // F000172_H
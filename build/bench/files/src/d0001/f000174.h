@@ -0,0 +1,50 @@
+#ifndef F000174_H
+#define F000174_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S174_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S174_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S174_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S174_3 derive_all();
+
+#endif // F000174_H
@@ -0,0 +1,50 @@
+#ifndef F000176_H
+#define F000176_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S176_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S176_1 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S176_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S176_3 derive_all();
+
+#endif // F000176_H
@@ -0,0 +1,50 @@
+#ifndef F000177_H
+#define F000177_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S177_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S177_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S177_2 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S177_3 derive_all();
+
+#endif // F000177_H
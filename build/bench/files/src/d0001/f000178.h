@@ -0,0 +1,50 @@
+#ifndef F000178_H
+#define F000178_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S178_0 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S178_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S178_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S178_3 derive_all();
+
+#endif // F000178_H
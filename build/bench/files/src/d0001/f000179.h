@@ -0,0 +1,50 @@
+#ifndef F000179_H
+#define F000179_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S179_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S179_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S179_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S179_3 derive_all();
+
+#endif // F000179_H
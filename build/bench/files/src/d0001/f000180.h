@@ -0,0 +1,50 @@
+#ifndef F000180_H
+#define F000180_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S180_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S180_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S180_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S180_3 derive_all();
+
+#endif // F000180_H
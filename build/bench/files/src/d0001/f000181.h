@@ -0,0 +1,50 @@
+#ifndef F000181_H
+#define F000181_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S181_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S181_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S181_2 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S181_3 derive_all();
+
+#endif // F000181_H
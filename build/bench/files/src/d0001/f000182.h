@@ -0,0 +1,50 @@
+#ifndef F000182_H
+#define F000182_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S182_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S182_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S182_2 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S182_3 derive_all();
+
+#endif // F000182_H
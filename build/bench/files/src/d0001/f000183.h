@@ -0,0 +1,50 @@
+#ifndef F000183_H
+#define F000183_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S183_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S183_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S183_2 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S183_3 derive_all();
+
+#endif // F000183_H
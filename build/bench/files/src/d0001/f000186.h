@@ -0,0 +1,50 @@
+#ifndef F000186_H
+#define F000186_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S186_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S186_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S186_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S186_3 derive_all();
+
+#endif // F000186_H
@@ -0,0 +1,50 @@
+#ifndef F000187_H
+#define F000187_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S187_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S187_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S187_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S187_3 derive_all();
+
+#endif // F000187_H
@@ -0,0 +1,50 @@
+#ifndef F000188_H
+#define F000188_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S188_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S188_1 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S188_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S188_3 derive_all();
+
+#endif // F000188_H
@@ -0,0 +1,50 @@
+#ifndef F000189_H
+#define F000189_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S189_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S189_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S189_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S189_3 derive_all();
+
+#endif // F000189_H
@@ -0,0 +1,50 @@
+#ifndef F000190_H
+#define F000190_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S190_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S190_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S190_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S190_3 derive_all();
+
+#endif // F000190_H
@@ -0,0 +1,50 @@
+#ifndef F000191_H
+#define F000191_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S191_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S191_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S191_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S191_3 derive_all();
+
+#endif // F000191_H
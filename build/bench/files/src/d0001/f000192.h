@@ -0,0 +1,50 @@
+#ifndef F000192_H
+#define F000192_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S192_0 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S192_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S192_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S192_3 derive_all();
+
+#endif // F000192_H
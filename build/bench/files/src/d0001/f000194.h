@@ -0,0 +1,50 @@
+#ifndef F000194_H
+#define F000194_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S194_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S194_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S194_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S194_3 derive_all();
+
+#endif // F000194_H
@@ -0,0 +1,50 @@
+#ifndef F000197_H
+#define F000197_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S197_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S197_1 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S197_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S197_3 derive_all();
+
+#endif // F000197_H
@@ -0,0 +1,50 @@
+#ifndef F000198_H
+#define F000198_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S198_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S198_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S198_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S198_3 derive_all();
+
+#endif // F000198_H
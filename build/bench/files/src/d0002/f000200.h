@@ -0,0 +1,50 @@
+#ifndef F000200_H
+#define F000200_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S200_0 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S200_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S200_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S200_3 derive_all();
+
+#endif // F000200_H
@@ -0,0 +1,50 @@
+#ifndef F000202_H
+#define F000202_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S202_0 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S202_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S202_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S202_3 derive_all();
+
+#endif // F000202_H
@@ -0,0 +1,50 @@
+#ifndef F000203_H
+#define F000203_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S203_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S203_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S203_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S203_3 derive_all();
+
+#endif // F000203_H
@@ -0,0 +1,50 @@
+#ifndef F000204_H
+#define F000204_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S204_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S204_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S204_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S204_3 derive_all();
+
+#endif // F000204_H
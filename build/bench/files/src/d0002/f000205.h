@@ -0,0 +1,50 @@
+#ifndef F000205_H
+#define F000205_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S205_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S205_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S205_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S205_3 derive_all();
+
+#endif // F000205_H
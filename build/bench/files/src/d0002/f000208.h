@@ -0,0 +1,50 @@
+#ifndef F000208_H
+#define F000208_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S208_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S208_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S208_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S208_3 derive_all();
+
+#endif // F000208_H
@@ -0,0 +1,50 @@
+#ifndef F000211_H
+#define F000211_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S211_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S211_1 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S211_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S211_3 derive_all();
+
+#endif // F000211_H
@@ -0,0 +1,50 @@
+#ifndef F000212_H
+#define F000212_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S212_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S212_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S212_2 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S212_3 derive_all();
+
+#endif // F000212_H
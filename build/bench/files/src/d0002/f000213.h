@@ -0,0 +1,50 @@
+#ifndef F000213_H
+#define F000213_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S213_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S213_1 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S213_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S213_3 derive_all();
+
+#endif // F000213_H
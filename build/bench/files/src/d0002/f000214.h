@@ -0,0 +1,50 @@
+#ifndef F000214_H
+#define F000214_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S214_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S214_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S214_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S214_3 derive_all();
+
+#endif // F000214_H
@@ -0,0 +1,50 @@
+#ifndef F000215_H
+#define F000215_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S215_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S215_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S215_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S215_3 derive_all();
+
+#endif // F000215_H
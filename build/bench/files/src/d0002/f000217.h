@@ -0,0 +1,50 @@
+#ifndef F000217_H
+#define F000217_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S217_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S217_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S217_2 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S217_3 derive_all();
+
+#endif // F000217_H
@@ -0,0 +1,50 @@
+#ifndef F000218_H
+#define F000218_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S218_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S218_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S218_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S218_3 derive_all();
+
+#endif // F000218_H
@@ -0,0 +1,50 @@
+#ifndef F000219_H
+#define F000219_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S219_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S219_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S219_2 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S219_3 derive_all();
+
+#endif // F000219_H
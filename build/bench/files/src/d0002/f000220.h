@@ -0,0 +1,50 @@
+#ifndef F000220_H
+#define F000220_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S220_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S220_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S220_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S220_3 derive_all();
+
+#endif // F000220_H
@@ -0,0 +1,50 @@
+#ifndef F000222_H
+#define F000222_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S222_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S222_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S222_2 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S222_3 derive_all();
+
+#endif // F000222_H
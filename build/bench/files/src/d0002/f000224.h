@@ -0,0 +1,50 @@
+#ifndef F000224_H
+#define F000224_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S224_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S224_1 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S224_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S224_3 derive_all();
+
+#endif // F000224_H
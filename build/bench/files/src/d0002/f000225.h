@@ -0,0 +1,50 @@
+#ifndef F000225_H
+#define F000225_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S225_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S225_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S225_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S225_3 derive_all();
+
+#endif // F000225_H
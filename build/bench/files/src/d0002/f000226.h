@@ -0,0 +1,50 @@
+#ifndef F000226_H
+#define F000226_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S226_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S226_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S226_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S226_3 derive_all();
+
+#endif // F000226_H
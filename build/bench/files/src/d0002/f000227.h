@@ -0,0 +1,50 @@
+#ifndef F000227_H
+#define F000227_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S227_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S227_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S227_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S227_3 derive_all();
+
+#endif // F000227_H
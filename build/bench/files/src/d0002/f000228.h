@@ -0,0 +1,50 @@
+#ifndef F000228_H
+#define F000228_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S228_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S228_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S228_2 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S228_3 derive_all();
+
+#endif // F000228_H
@@ -0,0 +1,50 @@
+#ifndef F000229_H
+#define F000229_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S229_0 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S229_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S229_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S229_3 derive_all();
+
+#endif // F000229_H
@@ -0,0 +1,50 @@
+#ifndef F000230_H
+#define F000230_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S230_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S230_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S230_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S230_3 derive_all();
+
+#endif // F000230_H
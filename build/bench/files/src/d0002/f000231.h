@@ -0,0 +1,50 @@
+#ifndef F000231_H
+#define F000231_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S231_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S231_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S231_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S231_3 derive_all();
+
+#endif // F000231_H
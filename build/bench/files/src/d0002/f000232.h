@@ -0,0 +1,50 @@
+#ifndef F000232_H
+#define F000232_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S232_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S232_1 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S232_2 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S232_3 derive_all();
+
+#endif // F000232_H
@@ -0,0 +1,50 @@
+#ifndef F000233_H
+#define F000233_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S233_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S233_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S233_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S233_3 derive_all();
+
+#endif // F000233_H
@@ -0,0 +1,50 @@
+#ifndef F000234_H
+#define F000234_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S234_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S234_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S234_2 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S234_3 derive_all();
+
+#endif // F000234_H
@@ -0,0 +1,50 @@
+#ifndef F000235_H
+#define F000235_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S235_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S235_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S235_2 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S235_3 derive_all();
+
+#endif // F000235_H
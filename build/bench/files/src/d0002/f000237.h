@@ -0,0 +1,50 @@
+#ifndef F000237_H
+#define F000237_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S237_0 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S237_1 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S237_2 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S237_3 derive_all();
+
+#endif // F000237_H
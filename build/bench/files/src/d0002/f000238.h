@@ -0,0 +1,50 @@
+#ifndef F000238_H
+#define F000238_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S238_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S238_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S238_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S238_3 derive_all();
+
+#endif // F000238_H
@@ -0,0 +1,50 @@
+#ifndef F000239_H
+#define F000239_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S239_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S239_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S239_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S239_3 derive_all();
+
+#endif // F000239_H
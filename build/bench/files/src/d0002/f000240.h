@@ -0,0 +1,50 @@
+#ifndef F000240_H
+#define F000240_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S240_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S240_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S240_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S240_3 derive_all();
+
+#endif // F000240_H
@@ -0,0 +1,50 @@
+#ifndef F000242_H
+#define F000242_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S242_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S242_1 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S242_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S242_3 derive_all();
+
+#endif // F000242_H
@@ -0,0 +1,50 @@
+#ifndef F000244_H
+#define F000244_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S244_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S244_1 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S244_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S244_3 derive_all();
+
+#endif // F000244_H
@@ -0,0 +1,50 @@
+#ifndef F000245_H
+#define F000245_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S245_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S245_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S245_2 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S245_3 derive_all();
+
+#endif // F000245_H
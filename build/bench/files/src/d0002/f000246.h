@@ -0,0 +1,50 @@
+#ifndef F000246_H
+#define F000246_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S246_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S246_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S246_2 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S246_3 derive_all();
+
+#endif // F000246_H
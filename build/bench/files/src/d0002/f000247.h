@@ -0,0 +1,50 @@
+#ifndef F000247_H
+#define F000247_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S247_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S247_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S247_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S247_3 derive_all();
+
+#endif // F000247_H
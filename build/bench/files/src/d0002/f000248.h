@@ -0,0 +1,50 @@
+#ifndef F000248_H
+#define F000248_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S248_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S248_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S248_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S248_3 derive_all();
+
+#endif // F000248_H
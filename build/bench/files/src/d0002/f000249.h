@@ -0,0 +1,50 @@
+#ifndef F000249_H
+#define F000249_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S249_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S249_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S249_2 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S249_3 derive_all();
+
+#endif // F000249_H
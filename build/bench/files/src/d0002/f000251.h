@@ -0,0 +1,50 @@
+#ifndef F000251_H
+#define F000251_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S251_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S251_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S251_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S251_3 derive_all();
+
+#endif // F000251_H
@@ -0,0 +1,50 @@
+#ifndef F000252_H
+#define F000252_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S252_0 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S252_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S252_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S252_3 derive_all();
+
+#endif // F000252_H
@@ -0,0 +1,50 @@
+#ifndef F000253_H
+#define F000253_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S253_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S253_1 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S253_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S253_3 derive_all();
+
+#endif // F000253_H
@@ -0,0 +1,50 @@
+#ifndef F000254_H
+#define F000254_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S254_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S254_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S254_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S254_3 derive_all();
+
+#endif // F000254_H
@@ -0,0 +1,50 @@
+#ifndef F000255_H
+#define F000255_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S255_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S255_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S255_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S255_3 derive_all();
+
+#endif // F000255_H
@@ -0,0 +1,50 @@
+#ifndef F000256_H
+#define F000256_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S256_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S256_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S256_2 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S256_3 derive_all();
+
+#endif // F000256_H
@@ -0,0 +1,50 @@
+#ifndef F000258_H
+#define F000258_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S258_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S258_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S258_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S258_3 derive_all();
+
+#endif // F000258_H
@@ -0,0 +1,50 @@
+#ifndef F000259_H
+#define F000259_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S259_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S259_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S259_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S259_3 derive_all();
+
+#endif // F000259_H
@@ -0,0 +1,50 @@
+#ifndef F000260_H
+#define F000260_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S260_0 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S260_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S260_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S260_3 derive_all();
+
+#endif // F000260_H
@@ -0,0 +1,50 @@
+#ifndef F000261_H
+#define F000261_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S261_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S261_1 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S261_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S261_3 derive_all();
+
+#endif // F000261_H
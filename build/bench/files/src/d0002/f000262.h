@@ -0,0 +1,50 @@
+#ifndef F000262_H
+#define F000262_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S262_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S262_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S262_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S262_3 derive_all();
+
+#endif // F000262_H
@@ -0,0 +1,50 @@
+#ifndef F000264_H
+#define F000264_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S264_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S264_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S264_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S264_3 derive_all();
+
+#endif // F000264_H
@@ -0,0 +1,50 @@
+#ifndef F000265_H
+#define F000265_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S265_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S265_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S265_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S265_3 derive_all();
+
+#endif // F000265_H
@@ -0,0 +1,50 @@
+#ifndef F000266_H
+#define F000266_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S266_0 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S266_1 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S266_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S266_3 derive_all();
+
+#endif // F000266_H
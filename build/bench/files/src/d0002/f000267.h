@@ -0,0 +1,50 @@
+#ifndef F000267_H
+#define F000267_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S267_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S267_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S267_2 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S267_3 derive_all();
+
+#endif // F000267_H
@@ -0,0 +1,50 @@
+#ifndef F000269_H
+#define F000269_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S269_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S269_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S269_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S269_3 derive_all();
+
+#endif // F000269_H
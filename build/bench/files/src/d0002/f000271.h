@@ -0,0 +1,50 @@
+#ifndef F000271_H
+#define F000271_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S271_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S271_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S271_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S271_3 derive_all();
+
+#endif // F000271_H
@@ -0,0 +1,50 @@
+#ifndef F000272_H
+#define F000272_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S272_0 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S272_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S272_2 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S272_3 derive_all();
+
+#endif // F000272_H
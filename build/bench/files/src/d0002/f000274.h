@@ -0,0 +1,50 @@
+#ifndef F000274_H
+#define F000274_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S274_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S274_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S274_2 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S274_3 derive_all();
+
+#endif // F000274_H
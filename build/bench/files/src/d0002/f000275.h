@@ -0,0 +1,50 @@
+#ifndef F000275_H
+#define F000275_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S275_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S275_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S275_2 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S275_3 derive_all();
+
+#endif // F000275_H
@@ -0,0 +1,50 @@
+#ifndef F000276_H
+#define F000276_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S276_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S276_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S276_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S276_3 derive_all();
+
+#endif // F000276_H
@@ -0,0 +1,50 @@
+#ifndef F000277_H
+#define F000277_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S277_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S277_1 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S277_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S277_3 derive_all();
+
+#endif // F000277_H
@@ -0,0 +1,50 @@
+#ifndef F000278_H
+#define F000278_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S278_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S278_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S278_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S278_3 derive_all();
+
+#endif // F000278_H
@@ -0,0 +1,50 @@
+#ifndef F000279_H
+#define F000279_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S279_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S279_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S279_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S279_3 derive_all();
+
+#endif // F000279_H
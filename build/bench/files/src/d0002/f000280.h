@@ -0,0 +1,50 @@
+#ifndef F000280_H
+#define F000280_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S280_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S280_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S280_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S280_3 derive_all();
+
+#endif // F000280_H
@@ -0,0 +1,50 @@
+#ifndef F000282_H
+#define F000282_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S282_0 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S282_1 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S282_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S282_3 derive_all();
+
+#endif // F000282_H
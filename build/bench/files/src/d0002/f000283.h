@@ -0,0 +1,50 @@
+#ifndef F000283_H
+#define F000283_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S283_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S283_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S283_2 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S283_3 derive_all();
+
+#endif // F000283_H
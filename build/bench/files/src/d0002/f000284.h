@@ -0,0 +1,50 @@
+#ifndef F000284_H
+#define F000284_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S284_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S284_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S284_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S284_3 derive_all();
+
+#endif // F000284_H
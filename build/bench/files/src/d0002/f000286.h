@@ -0,0 +1,50 @@
+#ifndef F000286_H
+#define F000286_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S286_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S286_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S286_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S286_3 derive_all();
+
+#endif // F000286_H
@@ -0,0 +1,50 @@
+#ifndef F000288_H
+#define F000288_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S288_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S288_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S288_2 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S288_3 derive_all();
+
+#endif // F000288_H
@@ -0,0 +1,50 @@
+#ifndef F000291_H
+#define F000291_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S291_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S291_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S291_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S291_3 derive_all();
+
+#endif // F000291_H
@@ -0,0 +1,50 @@
+#ifndef F000292_H
+#define F000292_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S292_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S292_1 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S292_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S292_3 derive_all();
+
+#endif // F000292_H
@@ -0,0 +1,50 @@
+#ifndef F000294_H
+#define F000294_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S294_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S294_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S294_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S294_3 derive_all();
+
+#endif // F000294_H
@@ -0,0 +1,50 @@
+#ifndef F000295_H
+#define F000295_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S295_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S295_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S295_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S295_3 derive_all();
+
+#endif // F000295_H
@@ -0,0 +1,50 @@
+#ifndef F000296_H
+#define F000296_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S296_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S296_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S296_2 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S296_3 derive_all();
+
+#endif // F000296_H
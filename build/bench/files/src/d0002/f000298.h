@@ -0,0 +1,50 @@
+#ifndef F000298_H
+#define F000298_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S298_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S298_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S298_2 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S298_3 derive_all();
+
+#endif // F000298_H
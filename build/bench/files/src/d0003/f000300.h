@@ -0,0 +1,50 @@
+#ifndef F000300_H
+#define F000300_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S300_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S300_1 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S300_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S300_3 derive_all();
+
+#endif // F000300_H
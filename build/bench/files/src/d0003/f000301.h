@@ -0,0 +1,50 @@
+#ifndef F000301_H
+#define F000301_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S301_0 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S301_1 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S301_2 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S301_3 derive_all();
+
+#endif // F000301_H
@@ -0,0 +1,50 @@
+#ifndef F000302_H
+#define F000302_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S302_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S302_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S302_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S302_3 derive_all();
+
+#endif // F000302_H
@@ -0,0 +1,50 @@
+#ifndef F000304_H
+#define F000304_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S304_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S304_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S304_2 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S304_3 derive_all();
+
+#endif // F000304_H
@@ -0,0 +1,50 @@
+#ifndef F000305_H
+#define F000305_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S305_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S305_1 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S305_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S305_3 derive_all();
+
+#endif // F000305_H
@@ -0,0 +1,50 @@
+#ifndef F000306_H
+#define F000306_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S306_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S306_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S306_2 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S306_3 derive_all();
+
+#endif // F000306_H
@@ -0,0 +1,50 @@
+#ifndef F000308_H
+#define F000308_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S308_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S308_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S308_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S308_3 derive_all();
+
+#endif // F000308_H
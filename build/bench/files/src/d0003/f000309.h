@@ -0,0 +1,50 @@
+#ifndef F000309_H
+#define F000309_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S309_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S309_1 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S309_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S309_3 derive_all();
+
+#endif // F000309_H
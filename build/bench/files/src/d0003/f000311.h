@@ -0,0 +1,50 @@
+#ifndef F000311_H
+#define F000311_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S311_0 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S311_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S311_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S311_3 derive_all();
+
+#endif // F000311_H
@@ -0,0 +1,50 @@
+#ifndef F000312_H
+#define F000312_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S312_0 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S312_1 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S312_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S312_3 derive_all();
+
+#endif // F000312_H
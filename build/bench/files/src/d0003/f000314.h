@@ -0,0 +1,50 @@
+#ifndef F000314_H
+#define F000314_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S314_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S314_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S314_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S314_3 derive_all();
+
+#endif // F000314_H
@@ -0,0 +1,50 @@
+#ifndef F000315_H
+#define F000315_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S315_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S315_1 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S315_2 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S315_3 derive_all();
+
+#endif // F000315_H
@@ -0,0 +1,50 @@
+#ifndef F000316_H
+#define F000316_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S316_0 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S316_1 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S316_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S316_3 derive_all();
+
+#endif // F000316_H
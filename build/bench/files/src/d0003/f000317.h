@@ -0,0 +1,50 @@
+#ifndef F000317_H
+#define F000317_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S317_0 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S317_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S317_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S317_3 derive_all();
+
+#endif // F000317_H
@@ -0,0 +1,50 @@
+#ifndef F000318_H
+#define F000318_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S318_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S318_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S318_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S318_3 derive_all();
+
+#endif // F000318_H
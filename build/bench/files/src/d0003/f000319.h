@@ -0,0 +1,50 @@
+#ifndef F000319_H
+#define F000319_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S319_0 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S319_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S319_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S319_3 derive_all();
+
+#endif // F000319_H
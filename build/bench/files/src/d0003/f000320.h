@@ -0,0 +1,50 @@
+#ifndef F000320_H
+#define F000320_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S320_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S320_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S320_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S320_3 derive_all();
+
+#endif // F000320_H
@@ -0,0 +1,50 @@
+#ifndef F000321_H
+#define F000321_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S321_0 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S321_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S321_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S321_3 derive_all();
+
+#endif // F000321_H
@@ -0,0 +1,50 @@
+#ifndef F000322_H
+#define F000322_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S322_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S322_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S322_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S322_3 derive_all();
+
+#endif // F000322_H
@@ -0,0 +1,50 @@
+#ifndef F000323_H
+#define F000323_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S323_0 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S323_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S323_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S323_3 derive_all();
+
+#endif // F000323_H
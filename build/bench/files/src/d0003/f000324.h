@@ -0,0 +1,50 @@
+#ifndef F000324_H
+#define F000324_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S324_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S324_1 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S324_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S324_3 derive_all();
+
+#endif // F000324_H
@@ -0,0 +1,50 @@
+#ifndef F000325_H
+#define F000325_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S325_0 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S325_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S325_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S325_3 derive_all();
+
+#endif // F000325_H
@@ -0,0 +1,50 @@
+#ifndef F000327_H
+#define F000327_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S327_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S327_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S327_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S327_3 derive_all();
+
+#endif // F000327_H
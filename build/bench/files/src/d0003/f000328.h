@@ -0,0 +1,50 @@
+#ifndef F000328_H
+#define F000328_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S328_0 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S328_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S328_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S328_3 derive_all();
+
+#endif // F000328_H
@@ -0,0 +1,50 @@
+#ifndef F000330_H
+#define F000330_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S330_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S330_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S330_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S330_3 derive_all();
+
+#endif // F000330_H
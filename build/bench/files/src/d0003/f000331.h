@@ -0,0 +1,50 @@
+#ifndef F000331_H
+#define F000331_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S331_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S331_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S331_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S331_3 derive_all();
+
+#endif // F000331_H
@@ -0,0 +1,50 @@
+#ifndef F000332_H
+#define F000332_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S332_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S332_1 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S332_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S332_3 derive_all();
+
+#endif // F000332_H
@@ -0,0 +1,50 @@
+#ifndef F000333_H
+#define F000333_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S333_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S333_1 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S333_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S333_3 derive_all();
+
+#endif // F000333_H
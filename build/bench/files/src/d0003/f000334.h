@@ -0,0 +1,50 @@
+#ifndef F000334_H
+#define F000334_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S334_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S334_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S334_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S334_3 derive_all();
+
+#endif // F000334_H
@@ -0,0 +1,50 @@
+#ifndef F000335_H
+#define F000335_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S335_0 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S335_1 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S335_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S335_3 derive_all();
+
+#endif // F000335_H
@@ -0,0 +1,50 @@
+#ifndef F000337_H
+#define F000337_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S337_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S337_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S337_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S337_3 derive_all();
+
+#endif // F000337_H
@@ -0,0 +1,50 @@
+#ifndef F000339_H
+#define F000339_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S339_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S339_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S339_2 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S339_3 derive_all();
+
+#endif // F000339_H
@@ -0,0 +1,50 @@
+#ifndef F000340_H
+#define F000340_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S340_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S340_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S340_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S340_3 derive_all();
+
+#endif // F000340_H
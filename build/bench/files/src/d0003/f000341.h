@@ -0,0 +1,50 @@
+#ifndef F000341_H
+#define F000341_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S341_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S341_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S341_2 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S341_3 derive_all();
+
+#endif // F000341_H
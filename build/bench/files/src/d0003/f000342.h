@@ -0,0 +1,50 @@
+#ifndef F000342_H
+#define F000342_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S342_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S342_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S342_2 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S342_3 derive_all();
+
+#endif // F000342_H
@@ -0,0 +1,50 @@
+#ifndef F000345_H
+#define F000345_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S345_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S345_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S345_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S345_3 derive_all();
+
+#endif // F000345_H
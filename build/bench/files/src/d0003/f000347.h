@@ -0,0 +1,50 @@
+#ifndef F000347_H
+#define F000347_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S347_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S347_1 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S347_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S347_3 derive_all();
+
+#endif // F000347_H
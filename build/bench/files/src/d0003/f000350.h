@@ -0,0 +1,50 @@
+#ifndef F000350_H
+#define F000350_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S350_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S350_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S350_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S350_3 derive_all();
+
+#endif // F000350_H
@@ -0,0 +1,50 @@
+#ifndef F000351_H
+#define F000351_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S351_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S351_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S351_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S351_3 derive_all();
+
+#endif // F000351_H
@@ -0,0 +1,50 @@
+#ifndef F000352_H
+#define F000352_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S352_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S352_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S352_2 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S352_3 derive_all();
+
+#endif // F000352_H
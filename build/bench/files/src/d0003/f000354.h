@@ -0,0 +1,50 @@
+#ifndef F000354_H
+#define F000354_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S354_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S354_1 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S354_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S354_3 derive_all();
+
+#endif // F000354_H
@@ -0,0 +1,50 @@
+#ifndef F000355_H
+#define F000355_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S355_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S355_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S355_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S355_3 derive_all();
+
+#endif // F000355_H
@@ -0,0 +1,50 @@
+#ifndef F000356_H
+#define F000356_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S356_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S356_1 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S356_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S356_3 derive_all();
+
+#endif // F000356_H
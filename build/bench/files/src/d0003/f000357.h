@@ -0,0 +1,50 @@
+#ifndef F000357_H
+#define F000357_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S357_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S357_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S357_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S357_3 derive_all();
+
+#endif // F000357_H
@@ -0,0 +1,50 @@
+#ifndef F000358_H
+#define F000358_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S358_0 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S358_1 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S358_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S358_3 derive_all();
+
+#endif // F000358_H
@@ -0,0 +1,50 @@
+#ifndef F000359_H
+#define F000359_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S359_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S359_1 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S359_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S359_3 derive_all();
+
+#endif // F000359_H
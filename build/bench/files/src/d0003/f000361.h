@@ -0,0 +1,50 @@
+#ifndef F000361_H
+#define F000361_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S361_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S361_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S361_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S361_3 derive_all();
+
+#endif // F000361_H
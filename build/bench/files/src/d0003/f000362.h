@@ -0,0 +1,50 @@
+#ifndef F000362_H
+#define F000362_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S362_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S362_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S362_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S362_3 derive_all();
+
+#endif // F000362_H
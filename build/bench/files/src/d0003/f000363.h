@@ -0,0 +1,50 @@
+#ifndef F000363_H
+#define F000363_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S363_0 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S363_1 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S363_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S363_3 derive_all();
+
+#endif // F000363_H
@@ -0,0 +1,50 @@
+#ifndef F000364_H
+#define F000364_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S364_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S364_1 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S364_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S364_3 derive_all();
+
+#endif // F000364_H
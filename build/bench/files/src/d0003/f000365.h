@@ -0,0 +1,50 @@
+#ifndef F000365_H
+#define F000365_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S365_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S365_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S365_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S365_3 derive_all();
+
+#endif // F000365_H
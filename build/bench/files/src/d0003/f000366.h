@@ -0,0 +1,50 @@
+#ifndef F000366_H
+#define F000366_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S366_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S366_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S366_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S366_3 derive_all();
+
+#endif // F000366_H
@@ -0,0 +1,50 @@
+#ifndef F000367_H
+#define F000367_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S367_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S367_1 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S367_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S367_3 derive_all();
+
+#endif // F000367_H
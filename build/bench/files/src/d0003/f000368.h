@@ -0,0 +1,50 @@
+#ifndef F000368_H
+#define F000368_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S368_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S368_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S368_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S368_3 derive_all();
+
+#endif // F000368_H
@@ -0,0 +1,50 @@
+#ifndef F000369_H
+#define F000369_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S369_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S369_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S369_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S369_3 derive_all();
+
+#endif // F000369_H
@@ -0,0 +1,50 @@
+#ifndef F000371_H
+#define F000371_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S371_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S371_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S371_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S371_3 derive_all();
+
+#endif // F000371_H
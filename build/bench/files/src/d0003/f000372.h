@@ -0,0 +1,50 @@
+#ifndef F000372_H
+#define F000372_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S372_0 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S372_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S372_2 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S372_3 derive_all();
+
+#endif // F000372_H
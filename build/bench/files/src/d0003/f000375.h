@@ -0,0 +1,50 @@
+#ifndef F000375_H
+#define F000375_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S375_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S375_1 derive_all();
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S375_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S375_3 derive_all();
+
+#endif // F000375_H
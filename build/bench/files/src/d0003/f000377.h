@@ -0,0 +1,50 @@
+#ifndef F000377_H
+#define F000377_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S377_0 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S377_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S377_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S377_3 derive_all();
+
+#endif // F000377_H
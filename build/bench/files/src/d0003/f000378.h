@@ -0,0 +1,50 @@
+#ifndef F000378_H
+#define F000378_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S378_0 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S378_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S378_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S378_3 derive_all();
+
+#endif // F000378_H
@@ -0,0 +1,50 @@
+#ifndef F000379_H
+#define F000379_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S379_0 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S379_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S379_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S379_3 derive_all();
+
+#endif // F000379_H
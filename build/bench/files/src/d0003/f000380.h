@@ -0,0 +1,50 @@
+#ifndef F000380_H
+#define F000380_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S380_0 derive_all();
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S380_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S380_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S380_3 derive_all();
+
+#endif // F000380_H
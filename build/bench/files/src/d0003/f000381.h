@@ -0,0 +1,50 @@
+#ifndef F000381_H
+#define F000381_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S381_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S381_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S381_2 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S381_3 derive_all();
+
+#endif // F000381_H
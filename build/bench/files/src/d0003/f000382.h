@@ -0,0 +1,50 @@
+#ifndef F000382_H
+#define F000382_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S382_0 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S382_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S382_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S382_3 derive_all();
+
+#endif // F000382_H
@@ -0,0 +1,50 @@
+#ifndef F000383_H
+#define F000383_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S383_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S383_1 derive_all();
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S383_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S383_3 derive_all();
+
+#endif // F000383_H
@@ -0,0 +1,50 @@
+#ifndef F000384_H
+#define F000384_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S384_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S384_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S384_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S384_3 derive_all();
+
+#endif // F000384_H
@@ -0,0 +1,50 @@
+#ifndef F000385_H
+#define F000385_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S385_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S385_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S385_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S385_3 derive_all();
+
+#endif // F000385_H
@@ -0,0 +1,50 @@
+#ifndef F000386_H
+#define F000386_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S386_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S386_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S386_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S386_3 derive_all();
+
+#endif // F000386_H
@@ -0,0 +1,50 @@
+#ifndef F000387_H
+#define F000387_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S387_0 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S387_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S387_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S387_3 derive_all();
+
+#endif // F000387_H
@@ -0,0 +1,50 @@
+#ifndef F000389_H
+#define F000389_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S389_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S389_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S389_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S389_3 derive_all();
+
+#endif // F000389_H
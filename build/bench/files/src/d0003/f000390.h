@@ -0,0 +1,50 @@
+#ifndef F000390_H
+#define F000390_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S390_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S390_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S390_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S390_3 derive_all();
+
+#endif // F000390_H
@@ -0,0 +1,50 @@
+#ifndef F000393_H
+#define F000393_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S393_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S393_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S393_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S393_3 derive_all();
+
+#endif // F000393_H
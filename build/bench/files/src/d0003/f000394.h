@@ -0,0 +1,50 @@
+#ifndef F000394_H
+#define F000394_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S394_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S394_1 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S394_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S394_3 derive_all();
+
+#endif // F000394_H
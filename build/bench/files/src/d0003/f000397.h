@@ -0,0 +1,50 @@
+#ifndef F000397_H
+#define F000397_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S397_0 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S397_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S397_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S397_3 derive_all();
+
+#endif // F000397_H
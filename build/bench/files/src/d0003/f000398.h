@@ -0,0 +1,50 @@
+#ifndef F000398_H
+#define F000398_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S398_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S398_1 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S398_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S398_3 derive_all();
+
+#endif // F000398_H
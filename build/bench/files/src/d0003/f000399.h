@@ -0,0 +1,50 @@
+#ifndef F000399_H
+#define F000399_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S399_0 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S399_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S399_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S399_3 derive_all();
+
+#endif // F000399_H
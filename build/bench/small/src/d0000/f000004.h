@@ -0,0 +1,50 @@
+#ifndef F000004_H
+#define F000004_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S4_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S4_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S4_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S4_3 derive_all();
+
+#endif // F000004_H
@@ -0,0 +1,50 @@
+#ifndef F000005_H
+#define F000005_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S5_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S5_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S5_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S5_3 derive_all();
+
+#endif // F000005_H
@@ -0,0 +1,50 @@
+#ifndef F000006_H
+#define F000006_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S6_0 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S6_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S6_2 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S6_3 derive_all();
+
+#endif // F000006_H
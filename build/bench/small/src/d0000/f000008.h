@@ -0,0 +1,50 @@
+#ifndef F000008_H
+#define F000008_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S8_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S8_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S8_2 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S8_3 derive_all();
+
+#endif // F000008_H
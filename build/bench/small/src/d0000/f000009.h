@@ -0,0 +1,50 @@
+#ifndef F000009_H
+#define F000009_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S9_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S9_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S9_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S9_3 derive_all();
+
+#endif // F000009_H
@@ -0,0 +1,50 @@
+#ifndef F000013_H
+#define F000013_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S13_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S13_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S13_2 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S13_3 derive_all();
+
+#endif // F000013_H
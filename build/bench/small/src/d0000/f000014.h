@@ -0,0 +1,50 @@
+#ifndef F000014_H
+#define F000014_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S14_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S14_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S14_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S14_3 derive_all();
+
+#endif // F000014_H
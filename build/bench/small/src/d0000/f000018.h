@@ -0,0 +1,50 @@
+#ifndef F000018_H
+#define F000018_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S18_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S18_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S18_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S18_3 derive_all();
+
+#endif // F000018_H
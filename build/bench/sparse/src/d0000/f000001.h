@@ -0,0 +1,58 @@
+#ifndef F000001_H
+#define F000001_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S1_0;
+
+void s1_0_reset(S1_0* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S1_1;
+
+void s1_1_reset(S1_1* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S1_2;
+
+void s1_2_reset(S1_2* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S1_3;
+
+void s1_3_reset(S1_3* value);
+
+#endif // F000001_H
@@ -0,0 +1,58 @@
+#ifndef F000002_H
+#define F000002_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S2_0;
+
+void s2_0_reset(S2_0* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S2_1;
+
+void s2_1_reset(S2_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S2_2;
+
+void s2_2_reset(S2_2* value);
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S2_3;
+
+void s2_3_reset(S2_3* value);
+
+#endif // F000002_H
@@ -0,0 +1,58 @@
+#ifndef F000004_H
+#define F000004_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S4_0;
+
+void s4_0_reset(S4_0* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S4_1;
+
+void s4_1_reset(S4_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S4_2;
+
+void s4_2_reset(S4_2* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S4_3;
+
+void s4_3_reset(S4_3* value);
+
+#endif // F000004_H
@@ -0,0 +1,58 @@
+#ifndef F000008_H
+#define F000008_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S8_0;
+
+void s8_0_reset(S8_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S8_1;
+
+void s8_1_reset(S8_1* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S8_2;
+
+void s8_2_reset(S8_2* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S8_3;
+
+void s8_3_reset(S8_3* value);
+
+#endif // F000008_H
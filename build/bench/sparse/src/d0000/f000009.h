@@ -0,0 +1,58 @@
+#ifndef F000009_H
+#define F000009_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S9_0;
+
+void s9_0_reset(S9_0* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S9_1;
+
+void s9_1_reset(S9_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S9_2;
+
+void s9_2_reset(S9_2* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S9_3;
+
+void s9_3_reset(S9_3* value);
+
+#endif // F000009_H
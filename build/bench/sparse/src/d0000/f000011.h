@@ -0,0 +1,58 @@
+#ifndef F000011_H
+#define F000011_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S11_0;
+
+void s11_0_reset(S11_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S11_1;
+
+void s11_1_reset(S11_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S11_2;
+
+void s11_2_reset(S11_2* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S11_3;
+
+void s11_3_reset(S11_3* value);
+
+#endif // F000011_H
@@ -0,0 +1,58 @@
+#ifndef F000014_H
+#define F000014_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S14_0;
+
+void s14_0_reset(S14_0* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S14_1;
+
+void s14_1_reset(S14_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S14_2;
+
+void s14_2_reset(S14_2* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S14_3;
+
+void s14_3_reset(S14_3* value);
+
+#endif // F000014_H
@@ -0,0 +1,58 @@
+#ifndef F000015_H
+#define F000015_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S15_0;
+
+void s15_0_reset(S15_0* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S15_1;
+
+void s15_1_reset(S15_1* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S15_2;
+
+void s15_2_reset(S15_2* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S15_3;
+
+void s15_3_reset(S15_3* value);
+
+#endif // F000015_H
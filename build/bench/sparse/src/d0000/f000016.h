@@ -0,0 +1,58 @@
+#ifndef F000016_H
+#define F000016_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S16_0;
+
+void s16_0_reset(S16_0* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S16_1;
+
+void s16_1_reset(S16_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S16_2;
+
+void s16_2_reset(S16_2* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S16_3;
+
+void s16_3_reset(S16_3* value);
+
+#endif // F000016_H
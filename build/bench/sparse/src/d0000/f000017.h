@@ -0,0 +1,58 @@
+#ifndef F000017_H
+#define F000017_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S17_0;
+
+void s17_0_reset(S17_0* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S17_1;
+
+void s17_1_reset(S17_1* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S17_2;
+
+void s17_2_reset(S17_2* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S17_3;
+
+void s17_3_reset(S17_3* value);
+
+#endif // F000017_H
@@ -0,0 +1,58 @@
+#ifndef F000018_H
+#define F000018_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S18_0;
+
+void s18_0_reset(S18_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S18_1;
+
+void s18_1_reset(S18_1* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S18_2;
+
+void s18_2_reset(S18_2* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S18_3;
+
+void s18_3_reset(S18_3* value);
+
+#endif // F000018_H
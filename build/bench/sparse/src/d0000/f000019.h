@@ -0,0 +1,58 @@
+#ifndef F000019_H
+#define F000019_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S19_0;
+
+void s19_0_reset(S19_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S19_1;
+
+void s19_1_reset(S19_1* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S19_2;
+
+void s19_2_reset(S19_2* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S19_3;
+
+void s19_3_reset(S19_3* value);
+
+#endif // F000019_H
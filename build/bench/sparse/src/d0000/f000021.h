@@ -0,0 +1,58 @@
+#ifndef F000021_H
+#define F000021_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S21_0;
+
+void s21_0_reset(S21_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S21_1;
+
+void s21_1_reset(S21_1* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S21_2;
+
+void s21_2_reset(S21_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S21_3;
+
+void s21_3_reset(S21_3* value);
+
+#endif // F000021_H
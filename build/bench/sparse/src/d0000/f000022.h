@@ -0,0 +1,58 @@
+#ifndef F000022_H
+#define F000022_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S22_0;
+
+void s22_0_reset(S22_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S22_1;
+
+void s22_1_reset(S22_1* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S22_2;
+
+void s22_2_reset(S22_2* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S22_3;
+
+void s22_3_reset(S22_3* value);
+
+#endif // F000022_H
@@ -0,0 +1,58 @@
+#ifndef F000023_H
+#define F000023_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S23_0;
+
+void s23_0_reset(S23_0* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S23_1;
+
+void s23_1_reset(S23_1* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S23_2;
+
+void s23_2_reset(S23_2* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S23_3;
+
+void s23_3_reset(S23_3* value);
+
+#endif // F000023_H
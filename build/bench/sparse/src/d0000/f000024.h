@@ -0,0 +1,58 @@
+#ifndef F000024_H
+#define F000024_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S24_0;
+
+void s24_0_reset(S24_0* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S24_1;
+
+void s24_1_reset(S24_1* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S24_2;
+
+void s24_2_reset(S24_2* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S24_3;
+
+void s24_3_reset(S24_3* value);
+
+#endif // F000024_H
@@ -0,0 +1,58 @@
+#ifndef F000025_H
+#define F000025_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S25_0;
+
+void s25_0_reset(S25_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S25_1;
+
+void s25_1_reset(S25_1* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S25_2;
+
+void s25_2_reset(S25_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S25_3;
+
+void s25_3_reset(S25_3* value);
+
+#endif // F000025_H
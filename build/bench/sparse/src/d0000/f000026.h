@@ -0,0 +1,58 @@
+#ifndef F000026_H
+#define F000026_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S26_0;
+
+void s26_0_reset(S26_0* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S26_1;
+
+void s26_1_reset(S26_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S26_2;
+
+void s26_2_reset(S26_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S26_3;
+
+void s26_3_reset(S26_3* value);
+
+#endif // F000026_H
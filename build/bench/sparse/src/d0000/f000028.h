@@ -0,0 +1,58 @@
+#ifndef F000028_H
+#define F000028_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S28_0;
+
+void s28_0_reset(S28_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S28_1;
+
+void s28_1_reset(S28_1* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S28_2;
+
+void s28_2_reset(S28_2* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S28_3;
+
+void s28_3_reset(S28_3* value);
+
+#endif // F000028_H
@@ -0,0 +1,58 @@
+#ifndef F000029_H
+#define F000029_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S29_0;
+
+void s29_0_reset(S29_0* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S29_1;
+
+void s29_1_reset(S29_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S29_2;
+
+void s29_2_reset(S29_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S29_3;
+
+void s29_3_reset(S29_3* value);
+
+#endif // F000029_H
@@ -0,0 +1,50 @@
+#ifndef F000030_H
+#define F000030_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S30_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S30_1 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S30_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S30_3 derive_all();
+
+#endif // F000030_H
@@ -0,0 +1,58 @@
+#ifndef F000031_H
+#define F000031_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S31_0;
+
+void s31_0_reset(S31_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S31_1;
+
+void s31_1_reset(S31_1* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S31_2;
+
+void s31_2_reset(S31_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S31_3;
+
+void s31_3_reset(S31_3* value);
+
+#endif // F000031_H
@@ -0,0 +1,58 @@
+#ifndef F000032_H
+#define F000032_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S32_0;
+
+void s32_0_reset(S32_0* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S32_1;
+
+void s32_1_reset(S32_1* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S32_2;
+
+void s32_2_reset(S32_2* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S32_3;
+
+void s32_3_reset(S32_3* value);
+
+#endif // F000032_H
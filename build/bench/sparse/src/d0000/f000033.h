@@ -0,0 +1,58 @@
+#ifndef F000033_H
+#define F000033_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S33_0;
+
+void s33_0_reset(S33_0* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S33_1;
+
+void s33_1_reset(S33_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S33_2;
+
+void s33_2_reset(S33_2* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S33_3;
+
+void s33_3_reset(S33_3* value);
+
+#endif // F000033_H
@@ -0,0 +1,58 @@
+#ifndef F000034_H
+#define F000034_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S34_0;
+
+void s34_0_reset(S34_0* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S34_1;
+
+void s34_1_reset(S34_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S34_2;
+
+void s34_2_reset(S34_2* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S34_3;
+
+void s34_3_reset(S34_3* value);
+
+#endif // F000034_H
@@ -0,0 +1,58 @@
+#ifndef F000035_H
+#define F000035_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S35_0;
+
+void s35_0_reset(S35_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S35_1;
+
+void s35_1_reset(S35_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S35_2;
+
+void s35_2_reset(S35_2* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S35_3;
+
+void s35_3_reset(S35_3* value);
+
+#endif // F000035_H
@@ -0,0 +1,58 @@
+#ifndef F000036_H
+#define F000036_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S36_0;
+
+void s36_0_reset(S36_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S36_1;
+
+void s36_1_reset(S36_1* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S36_2;
+
+void s36_2_reset(S36_2* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S36_3;
+
+void s36_3_reset(S36_3* value);
+
+#endif // F000036_H
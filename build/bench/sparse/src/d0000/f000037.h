@@ -0,0 +1,58 @@
+#ifndef F000037_H
+#define F000037_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S37_0;
+
+void s37_0_reset(S37_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S37_1;
+
+void s37_1_reset(S37_1* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S37_2;
+
+void s37_2_reset(S37_2* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S37_3;
+
+void s37_3_reset(S37_3* value);
+
+#endif // F000037_H
@@ -0,0 +1,58 @@
+#ifndef F000038_H
+#define F000038_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S38_0;
+
+void s38_0_reset(S38_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S38_1;
+
+void s38_1_reset(S38_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S38_2;
+
+void s38_2_reset(S38_2* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S38_3;
+
+void s38_3_reset(S38_3* value);
+
+#endif // F000038_H
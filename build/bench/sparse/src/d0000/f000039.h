@@ -0,0 +1,58 @@
+#ifndef F000039_H
+#define F000039_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S39_0;
+
+void s39_0_reset(S39_0* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S39_1;
+
+void s39_1_reset(S39_1* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S39_2;
+
+void s39_2_reset(S39_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S39_3;
+
+void s39_3_reset(S39_3* value);
+
+#endif // F000039_H
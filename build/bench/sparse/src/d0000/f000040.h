@@ -0,0 +1,50 @@
+#ifndef F000040_H
+#define F000040_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S40_0 derive_all();
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S40_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S40_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S40_3 derive_all();
+
+#endif // F000040_H
@@ -0,0 +1,58 @@
+#ifndef F000043_H
+#define F000043_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S43_0;
+
+void s43_0_reset(S43_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S43_1;
+
+void s43_1_reset(S43_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S43_2;
+
+void s43_2_reset(S43_2* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S43_3;
+
+void s43_3_reset(S43_3* value);
+
+#endif // F000043_H
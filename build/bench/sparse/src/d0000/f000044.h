@@ -0,0 +1,58 @@
+#ifndef F000044_H
+#define F000044_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S44_0;
+
+void s44_0_reset(S44_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S44_1;
+
+void s44_1_reset(S44_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S44_2;
+
+void s44_2_reset(S44_2* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S44_3;
+
+void s44_3_reset(S44_3* value);
+
+#endif // F000044_H
@@ -0,0 +1,58 @@
+#ifndef F000045_H
+#define F000045_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S45_0;
+
+void s45_0_reset(S45_0* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S45_1;
+
+void s45_1_reset(S45_1* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S45_2;
+
+void s45_2_reset(S45_2* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S45_3;
+
+void s45_3_reset(S45_3* value);
+
+#endif // F000045_H
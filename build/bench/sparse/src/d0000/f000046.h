@@ -0,0 +1,58 @@
+#ifndef F000046_H
+#define F000046_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S46_0;
+
+void s46_0_reset(S46_0* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S46_1;
+
+void s46_1_reset(S46_1* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S46_2;
+
+void s46_2_reset(S46_2* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S46_3;
+
+void s46_3_reset(S46_3* value);
+
+#endif // F000046_H
@@ -0,0 +1,58 @@
+#ifndef F000047_H
+#define F000047_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S47_0;
+
+void s47_0_reset(S47_0* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S47_1;
+
+void s47_1_reset(S47_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S47_2;
+
+void s47_2_reset(S47_2* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S47_3;
+
+void s47_3_reset(S47_3* value);
+
+#endif // F000047_H
@@ -0,0 +1,58 @@
+#ifndef F000048_H
+#define F000048_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S48_0;
+
+void s48_0_reset(S48_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S48_1;
+
+void s48_1_reset(S48_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S48_2;
+
+void s48_2_reset(S48_2* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S48_3;
+
+void s48_3_reset(S48_3* value);
+
+#endif // F000048_H
@@ -0,0 +1,58 @@
+#ifndef F000049_H
+#define F000049_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S49_0;
+
+void s49_0_reset(S49_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S49_1;
+
+void s49_1_reset(S49_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S49_2;
+
+void s49_2_reset(S49_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S49_3;
+
+void s49_3_reset(S49_3* value);
+
+#endif // F000049_H
@@ -0,0 +1,50 @@
+#ifndef F000050_H
+#define F000050_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S50_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S50_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S50_2 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S50_3 derive_all();
+
+#endif // F000050_H
@@ -0,0 +1,58 @@
+#ifndef F000052_H
+#define F000052_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S52_0;
+
+void s52_0_reset(S52_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S52_1;
+
+void s52_1_reset(S52_1* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S52_2;
+
+void s52_2_reset(S52_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S52_3;
+
+void s52_3_reset(S52_3* value);
+
+#endif // F000052_H
@@ -0,0 +1,58 @@
+#ifndef F000053_H
+#define F000053_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S53_0;
+
+void s53_0_reset(S53_0* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S53_1;
+
+void s53_1_reset(S53_1* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S53_2;
+
+void s53_2_reset(S53_2* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S53_3;
+
+void s53_3_reset(S53_3* value);
+
+#endif // F000053_H
@@ -0,0 +1,58 @@
+#ifndef F000054_H
+#define F000054_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S54_0;
+
+void s54_0_reset(S54_0* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S54_1;
+
+void s54_1_reset(S54_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S54_2;
+
+void s54_2_reset(S54_2* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S54_3;
+
+void s54_3_reset(S54_3* value);
+
+#endif // F000054_H
@@ -0,0 +1,58 @@
+#ifndef F000055_H
+#define F000055_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S55_0;
+
+void s55_0_reset(S55_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S55_1;
+
+void s55_1_reset(S55_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S55_2;
+
+void s55_2_reset(S55_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S55_3;
+
+void s55_3_reset(S55_3* value);
+
+#endif // F000055_H
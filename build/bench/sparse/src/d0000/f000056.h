@@ -0,0 +1,58 @@
+#ifndef F000056_H
+#define F000056_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S56_0;
+
+void s56_0_reset(S56_0* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S56_1;
+
+void s56_1_reset(S56_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S56_2;
+
+void s56_2_reset(S56_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S56_3;
+
+void s56_3_reset(S56_3* value);
+
+#endif // F000056_H
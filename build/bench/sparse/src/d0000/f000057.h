@@ -0,0 +1,58 @@
+#ifndef F000057_H
+#define F000057_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S57_0;
+
+void s57_0_reset(S57_0* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S57_1;
+
+void s57_1_reset(S57_1* value);
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S57_2;
+
+void s57_2_reset(S57_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S57_3;
+
+void s57_3_reset(S57_3* value);
+
+#endif // F000057_H
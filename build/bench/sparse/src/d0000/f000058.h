@@ -0,0 +1,58 @@
+#ifndef F000058_H
+#define F000058_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S58_0;
+
+void s58_0_reset(S58_0* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S58_1;
+
+void s58_1_reset(S58_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S58_2;
+
+void s58_2_reset(S58_2* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S58_3;
+
+void s58_3_reset(S58_3* value);
+
+#endif // F000058_H
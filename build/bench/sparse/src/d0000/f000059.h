@@ -0,0 +1,58 @@
+#ifndef F000059_H
+#define F000059_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S59_0;
+
+void s59_0_reset(S59_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S59_1;
+
+void s59_1_reset(S59_1* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S59_2;
+
+void s59_2_reset(S59_2* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S59_3;
+
+void s59_3_reset(S59_3* value);
+
+#endif // F000059_H
@@ -0,0 +1,58 @@
+#ifndef F000061_H
+#define F000061_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S61_0;
+
+void s61_0_reset(S61_0* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S61_1;
+
+void s61_1_reset(S61_1* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S61_2;
+
+void s61_2_reset(S61_2* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S61_3;
+
+void s61_3_reset(S61_3* value);
+
+#endif // F000061_H
@@ -0,0 +1,58 @@
+#ifndef F000064_H
+#define F000064_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S64_0;
+
+void s64_0_reset(S64_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S64_1;
+
+void s64_1_reset(S64_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S64_2;
+
+void s64_2_reset(S64_2* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S64_3;
+
+void s64_3_reset(S64_3* value);
+
+#endif // F000064_H
@@ -0,0 +1,58 @@
+#ifndef F000065_H
+#define F000065_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S65_0;
+
+void s65_0_reset(S65_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S65_1;
+
+void s65_1_reset(S65_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S65_2;
+
+void s65_2_reset(S65_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S65_3;
+
+void s65_3_reset(S65_3* value);
+
+#endif // F000065_H
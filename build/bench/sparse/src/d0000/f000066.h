@@ -0,0 +1,58 @@
+#ifndef F000066_H
+#define F000066_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S66_0;
+
+void s66_0_reset(S66_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S66_1;
+
+void s66_1_reset(S66_1* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S66_2;
+
+void s66_2_reset(S66_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S66_3;
+
+void s66_3_reset(S66_3* value);
+
+#endif // F000066_H
@@ -0,0 +1,58 @@
+#ifndef F000068_H
+#define F000068_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S68_0;
+
+void s68_0_reset(S68_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S68_1;
+
+void s68_1_reset(S68_1* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S68_2;
+
+void s68_2_reset(S68_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S68_3;
+
+void s68_3_reset(S68_3* value);
+
+#endif // F000068_H
@@ -0,0 +1,58 @@
+#ifndef F000069_H
+#define F000069_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S69_0;
+
+void s69_0_reset(S69_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S69_1;
+
+void s69_1_reset(S69_1* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S69_2;
+
+void s69_2_reset(S69_2* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S69_3;
+
+void s69_3_reset(S69_3* value);
+
+#endif // F000069_H
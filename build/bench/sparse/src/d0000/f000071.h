@@ -0,0 +1,58 @@
+#ifndef F000071_H
+#define F000071_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S71_0;
+
+void s71_0_reset(S71_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S71_1;
+
+void s71_1_reset(S71_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S71_2;
+
+void s71_2_reset(S71_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S71_3;
+
+void s71_3_reset(S71_3* value);
+
+#endif // F000071_H
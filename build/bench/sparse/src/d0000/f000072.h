@@ -0,0 +1,58 @@
+#ifndef F000072_H
+#define F000072_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S72_0;
+
+void s72_0_reset(S72_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S72_1;
+
+void s72_1_reset(S72_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S72_2;
+
+void s72_2_reset(S72_2* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S72_3;
+
+void s72_3_reset(S72_3* value);
+
+#endif // F000072_H
@@ -0,0 +1,58 @@
+#ifndef F000073_H
+#define F000073_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S73_0;
+
+void s73_0_reset(S73_0* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S73_1;
+
+void s73_1_reset(S73_1* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S73_2;
+
+void s73_2_reset(S73_2* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S73_3;
+
+void s73_3_reset(S73_3* value);
+
+#endif // F000073_H
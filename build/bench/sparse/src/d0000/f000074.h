@@ -0,0 +1,58 @@
+#ifndef F000074_H
+#define F000074_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S74_0;
+
+void s74_0_reset(S74_0* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S74_1;
+
+void s74_1_reset(S74_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S74_2;
+
+void s74_2_reset(S74_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S74_3;
+
+void s74_3_reset(S74_3* value);
+
+#endif // F000074_H
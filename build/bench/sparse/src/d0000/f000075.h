@@ -0,0 +1,58 @@
+#ifndef F000075_H
+#define F000075_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S75_0;
+
+void s75_0_reset(S75_0* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S75_1;
+
+void s75_1_reset(S75_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S75_2;
+
+void s75_2_reset(S75_2* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S75_3;
+
+void s75_3_reset(S75_3* value);
+
+#endif // F000075_H
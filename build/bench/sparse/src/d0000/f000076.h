@@ -0,0 +1,58 @@
+#ifndef F000076_H
+#define F000076_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S76_0;
+
+void s76_0_reset(S76_0* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S76_1;
+
+void s76_1_reset(S76_1* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S76_2;
+
+void s76_2_reset(S76_2* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S76_3;
+
+void s76_3_reset(S76_3* value);
+
+#endif // F000076_H
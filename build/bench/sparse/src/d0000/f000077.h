@@ -0,0 +1,58 @@
+#ifndef F000077_H
+#define F000077_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S77_0;
+
+void s77_0_reset(S77_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S77_1;
+
+void s77_1_reset(S77_1* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S77_2;
+
+void s77_2_reset(S77_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S77_3;
+
+void s77_3_reset(S77_3* value);
+
+#endif // F000077_H
@@ -0,0 +1,58 @@
+#ifndef F000079_H
+#define F000079_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S79_0;
+
+void s79_0_reset(S79_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S79_1;
+
+void s79_1_reset(S79_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S79_2;
+
+void s79_2_reset(S79_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S79_3;
+
+void s79_3_reset(S79_3* value);
+
+#endif // F000079_H
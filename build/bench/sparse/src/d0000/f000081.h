@@ -0,0 +1,58 @@
+#ifndef F000081_H
+#define F000081_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S81_0;
+
+void s81_0_reset(S81_0* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S81_1;
+
+void s81_1_reset(S81_1* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S81_2;
+
+void s81_2_reset(S81_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S81_3;
+
+void s81_3_reset(S81_3* value);
+
+#endif // F000081_H
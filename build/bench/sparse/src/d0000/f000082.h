@@ -0,0 +1,58 @@
+#ifndef F000082_H
+#define F000082_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S82_0;
+
+void s82_0_reset(S82_0* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S82_1;
+
+void s82_1_reset(S82_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S82_2;
+
+void s82_2_reset(S82_2* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S82_3;
+
+void s82_3_reset(S82_3* value);
+
+#endif // F000082_H
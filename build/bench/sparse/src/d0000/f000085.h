@@ -0,0 +1,58 @@
+#ifndef F000085_H
+#define F000085_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S85_0;
+
+void s85_0_reset(S85_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S85_1;
+
+void s85_1_reset(S85_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S85_2;
+
+void s85_2_reset(S85_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S85_3;
+
+void s85_3_reset(S85_3* value);
+
+#endif // F000085_H
@@ -0,0 +1,58 @@
+#ifndef F000086_H
+#define F000086_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S86_0;
+
+void s86_0_reset(S86_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S86_1;
+
+void s86_1_reset(S86_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S86_2;
+
+void s86_2_reset(S86_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S86_3;
+
+void s86_3_reset(S86_3* value);
+
+#endif // F000086_H
@@ -0,0 +1,58 @@
+#ifndef F000087_H
+#define F000087_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S87_0;
+
+void s87_0_reset(S87_0* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S87_1;
+
+void s87_1_reset(S87_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S87_2;
+
+void s87_2_reset(S87_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S87_3;
+
+void s87_3_reset(S87_3* value);
+
+#endif // F000087_H
@@ -0,0 +1,58 @@
+#ifndef F000089_H
+#define F000089_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S89_0;
+
+void s89_0_reset(S89_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S89_1;
+
+void s89_1_reset(S89_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S89_2;
+
+void s89_2_reset(S89_2* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S89_3;
+
+void s89_3_reset(S89_3* value);
+
+#endif // F000089_H
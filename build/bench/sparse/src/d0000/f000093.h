@@ -0,0 +1,58 @@
+#ifndef F000093_H
+#define F000093_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S93_0;
+
+void s93_0_reset(S93_0* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S93_1;
+
+void s93_1_reset(S93_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S93_2;
+
+void s93_2_reset(S93_2* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S93_3;
+
+void s93_3_reset(S93_3* value);
+
+#endif // F000093_H
@@ -0,0 +1,58 @@
+#ifndef F000094_H
+#define F000094_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S94_0;
+
+void s94_0_reset(S94_0* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S94_1;
+
+void s94_1_reset(S94_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S94_2;
+
+void s94_2_reset(S94_2* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S94_3;
+
+void s94_3_reset(S94_3* value);
+
+#endif // F000094_H
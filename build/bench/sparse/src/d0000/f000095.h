@@ -0,0 +1,58 @@
+#ifndef F000095_H
+#define F000095_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S95_0;
+
+void s95_0_reset(S95_0* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S95_1;
+
+void s95_1_reset(S95_1* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S95_2;
+
+void s95_2_reset(S95_2* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S95_3;
+
+void s95_3_reset(S95_3* value);
+
+#endif // F000095_H
@@ -0,0 +1,58 @@
+#ifndef F000096_H
+#define F000096_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S96_0;
+
+void s96_0_reset(S96_0* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S96_1;
+
+void s96_1_reset(S96_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S96_2;
+
+void s96_2_reset(S96_2* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S96_3;
+
+void s96_3_reset(S96_3* value);
+
+#endif // F000096_H
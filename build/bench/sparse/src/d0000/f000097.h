@@ -0,0 +1,58 @@
+#ifndef F000097_H
+#define F000097_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S97_0;
+
+void s97_0_reset(S97_0* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S97_1;
+
+void s97_1_reset(S97_1* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S97_2;
+
+void s97_2_reset(S97_2* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S97_3;
+
+void s97_3_reset(S97_3* value);
+
+#endif // F000097_H
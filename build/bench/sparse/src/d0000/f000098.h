@@ -0,0 +1,58 @@
+#ifndef F000098_H
+#define F000098_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S98_0;
+
+void s98_0_reset(S98_0* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S98_1;
+
+void s98_1_reset(S98_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S98_2;
+
+void s98_2_reset(S98_2* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S98_3;
+
+void s98_3_reset(S98_3* value);
+
+#endif // F000098_H
@@ -0,0 +1,58 @@
+#ifndef F000099_H
+#define F000099_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S99_0;
+
+void s99_0_reset(S99_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S99_1;
+
+void s99_1_reset(S99_1* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S99_2;
+
+void s99_2_reset(S99_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S99_3;
+
+void s99_3_reset(S99_3* value);
+
+#endif // F000099_H
@@ -0,0 +1,58 @@
+#ifndef F000101_H
+#define F000101_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S101_0;
+
+void s101_0_reset(S101_0* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S101_1;
+
+void s101_1_reset(S101_1* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S101_2;
+
+void s101_2_reset(S101_2* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S101_3;
+
+void s101_3_reset(S101_3* value);
+
+#endif // F000101_H
@@ -0,0 +1,58 @@
+#ifndef F000102_H
+#define F000102_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S102_0;
+
+void s102_0_reset(S102_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S102_1;
+
+void s102_1_reset(S102_1* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S102_2;
+
+void s102_2_reset(S102_2* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S102_3;
+
+void s102_3_reset(S102_3* value);
+
+#endif // F000102_H
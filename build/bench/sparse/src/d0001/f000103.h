@@ -0,0 +1,58 @@
+#ifndef F000103_H
+#define F000103_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S103_0;
+
+void s103_0_reset(S103_0* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S103_1;
+
+void s103_1_reset(S103_1* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S103_2;
+
+void s103_2_reset(S103_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S103_3;
+
+void s103_3_reset(S103_3* value);
+
+#endif // F000103_H
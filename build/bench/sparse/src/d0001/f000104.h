@@ -0,0 +1,58 @@
+#ifndef F000104_H
+#define F000104_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S104_0;
+
+void s104_0_reset(S104_0* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S104_1;
+
+void s104_1_reset(S104_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S104_2;
+
+void s104_2_reset(S104_2* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S104_3;
+
+void s104_3_reset(S104_3* value);
+
+#endif // F000104_H
@@ -0,0 +1,58 @@
+#ifndef F000105_H
+#define F000105_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S105_0;
+
+void s105_0_reset(S105_0* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S105_1;
+
+void s105_1_reset(S105_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S105_2;
+
+void s105_2_reset(S105_2* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S105_3;
+
+void s105_3_reset(S105_3* value);
+
+#endif // F000105_H
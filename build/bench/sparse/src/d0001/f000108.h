@@ -0,0 +1,58 @@
+#ifndef F000108_H
+#define F000108_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S108_0;
+
+void s108_0_reset(S108_0* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S108_1;
+
+void s108_1_reset(S108_1* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S108_2;
+
+void s108_2_reset(S108_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S108_3;
+
+void s108_3_reset(S108_3* value);
+
+#endif // F000108_H
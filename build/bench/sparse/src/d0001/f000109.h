@@ -0,0 +1,58 @@
+#ifndef F000109_H
+#define F000109_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S109_0;
+
+void s109_0_reset(S109_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S109_1;
+
+void s109_1_reset(S109_1* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S109_2;
+
+void s109_2_reset(S109_2* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S109_3;
+
+void s109_3_reset(S109_3* value);
+
+#endif // F000109_H
@@ -0,0 +1,50 @@
+#ifndef F000110_H
+#define F000110_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S110_0 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S110_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S110_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S110_3 derive_all();
+
+#endif // F000110_H
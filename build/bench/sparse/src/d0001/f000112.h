@@ -0,0 +1,58 @@
+#ifndef F000112_H
+#define F000112_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S112_0;
+
+void s112_0_reset(S112_0* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S112_1;
+
+void s112_1_reset(S112_1* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S112_2;
+
+void s112_2_reset(S112_2* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S112_3;
+
+void s112_3_reset(S112_3* value);
+
+#endif // F000112_H
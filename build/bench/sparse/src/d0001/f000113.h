@@ -0,0 +1,58 @@
+#ifndef F000113_H
+#define F000113_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S113_0;
+
+void s113_0_reset(S113_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S113_1;
+
+void s113_1_reset(S113_1* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S113_2;
+
+void s113_2_reset(S113_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S113_3;
+
+void s113_3_reset(S113_3* value);
+
+#endif // F000113_H
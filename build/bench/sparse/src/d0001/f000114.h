@@ -0,0 +1,58 @@
+#ifndef F000114_H
+#define F000114_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S114_0;
+
+void s114_0_reset(S114_0* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S114_1;
+
+void s114_1_reset(S114_1* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S114_2;
+
+void s114_2_reset(S114_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S114_3;
+
+void s114_3_reset(S114_3* value);
+
+#endif // F000114_H
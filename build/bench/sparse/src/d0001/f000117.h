@@ -0,0 +1,58 @@
+#ifndef F000117_H
+#define F000117_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S117_0;
+
+void s117_0_reset(S117_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S117_1;
+
+void s117_1_reset(S117_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S117_2;
+
+void s117_2_reset(S117_2* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S117_3;
+
+void s117_3_reset(S117_3* value);
+
+#endif // F000117_H
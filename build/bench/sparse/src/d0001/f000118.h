@@ -0,0 +1,58 @@
+#ifndef F000118_H
+#define F000118_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S118_0;
+
+void s118_0_reset(S118_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S118_1;
+
+void s118_1_reset(S118_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S118_2;
+
+void s118_2_reset(S118_2* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S118_3;
+
+void s118_3_reset(S118_3* value);
+
+#endif // F000118_H
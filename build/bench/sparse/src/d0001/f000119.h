@@ -0,0 +1,58 @@
+#ifndef F000119_H
+#define F000119_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S119_0;
+
+void s119_0_reset(S119_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S119_1;
+
+void s119_1_reset(S119_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S119_2;
+
+void s119_2_reset(S119_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S119_3;
+
+void s119_3_reset(S119_3* value);
+
+#endif // F000119_H
@@ -0,0 +1,58 @@
+#ifndef F000121_H
+#define F000121_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S121_0;
+
+void s121_0_reset(S121_0* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S121_1;
+
+void s121_1_reset(S121_1* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S121_2;
+
+void s121_2_reset(S121_2* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S121_3;
+
+void s121_3_reset(S121_3* value);
+
+#endif // F000121_H
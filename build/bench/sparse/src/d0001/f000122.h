@@ -0,0 +1,58 @@
+#ifndef F000122_H
+#define F000122_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S122_0;
+
+void s122_0_reset(S122_0* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S122_1;
+
+void s122_1_reset(S122_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S122_2;
+
+void s122_2_reset(S122_2* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S122_3;
+
+void s122_3_reset(S122_3* value);
+
+#endif // F000122_H
@@ -0,0 +1,58 @@
+#ifndef F000124_H
+#define F000124_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S124_0;
+
+void s124_0_reset(S124_0* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S124_1;
+
+void s124_1_reset(S124_1* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S124_2;
+
+void s124_2_reset(S124_2* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S124_3;
+
+void s124_3_reset(S124_3* value);
+
+#endif // F000124_H
@@ -0,0 +1,58 @@
+#ifndef F000125_H
+#define F000125_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S125_0;
+
+void s125_0_reset(S125_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S125_1;
+
+void s125_1_reset(S125_1* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S125_2;
+
+void s125_2_reset(S125_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S125_3;
+
+void s125_3_reset(S125_3* value);
+
+#endif // F000125_H
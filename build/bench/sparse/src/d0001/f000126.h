@@ -0,0 +1,58 @@
+#ifndef F000126_H
+#define F000126_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S126_0;
+
+void s126_0_reset(S126_0* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S126_1;
+
+void s126_1_reset(S126_1* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S126_2;
+
+void s126_2_reset(S126_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S126_3;
+
+void s126_3_reset(S126_3* value);
+
+#endif // F000126_H
@@ -0,0 +1,58 @@
+#ifndef F000127_H
+#define F000127_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S127_0;
+
+void s127_0_reset(S127_0* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S127_1;
+
+void s127_1_reset(S127_1* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S127_2;
+
+void s127_2_reset(S127_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S127_3;
+
+void s127_3_reset(S127_3* value);
+
+#endif // F000127_H
@@ -0,0 +1,58 @@
+#ifndef F000129_H
+#define F000129_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S129_0;
+
+void s129_0_reset(S129_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S129_1;
+
+void s129_1_reset(S129_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S129_2;
+
+void s129_2_reset(S129_2* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S129_3;
+
+void s129_3_reset(S129_3* value);
+
+#endif // F000129_H
@@ -0,0 +1,58 @@
+#ifndef F000132_H
+#define F000132_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S132_0;
+
+void s132_0_reset(S132_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S132_1;
+
+void s132_1_reset(S132_1* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S132_2;
+
+void s132_2_reset(S132_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S132_3;
+
+void s132_3_reset(S132_3* value);
+
+#endif // F000132_H
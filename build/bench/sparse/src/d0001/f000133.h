@@ -0,0 +1,58 @@
+#ifndef F000133_H
+#define F000133_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S133_0;
+
+void s133_0_reset(S133_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S133_1;
+
+void s133_1_reset(S133_1* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S133_2;
+
+void s133_2_reset(S133_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S133_3;
+
+void s133_3_reset(S133_3* value);
+
+#endif // F000133_H
@@ -0,0 +1,58 @@
+#ifndef F000134_H
+#define F000134_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S134_0;
+
+void s134_0_reset(S134_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S134_1;
+
+void s134_1_reset(S134_1* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S134_2;
+
+void s134_2_reset(S134_2* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S134_3;
+
+void s134_3_reset(S134_3* value);
+
+#endif // F000134_H
@@ -0,0 +1,58 @@
+#ifndef F000135_H
+#define F000135_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S135_0;
+
+void s135_0_reset(S135_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S135_1;
+
+void s135_1_reset(S135_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S135_2;
+
+void s135_2_reset(S135_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S135_3;
+
+void s135_3_reset(S135_3* value);
+
+#endif // F000135_H
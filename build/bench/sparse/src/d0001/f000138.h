@@ -0,0 +1,58 @@
+#ifndef F000138_H
+#define F000138_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S138_0;
+
+void s138_0_reset(S138_0* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S138_1;
+
+void s138_1_reset(S138_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S138_2;
+
+void s138_2_reset(S138_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S138_3;
+
+void s138_3_reset(S138_3* value);
+
+#endif // F000138_H
@@ -0,0 +1,58 @@
+#ifndef F000139_H
+#define F000139_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S139_0;
+
+void s139_0_reset(S139_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S139_1;
+
+void s139_1_reset(S139_1* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S139_2;
+
+void s139_2_reset(S139_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S139_3;
+
+void s139_3_reset(S139_3* value);
+
+#endif // F000139_H
@@ -0,0 +1,58 @@
+#ifndef F000141_H
+#define F000141_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    double field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S141_0;
+
+void s141_0_reset(S141_0* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S141_1;
+
+void s141_1_reset(S141_1* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S141_2;
+
+void s141_2_reset(S141_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S141_3;
+
+void s141_3_reset(S141_3* value);
+
+#endif // F000141_H
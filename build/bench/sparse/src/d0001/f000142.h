@@ -0,0 +1,58 @@
+#ifndef F000142_H
+#define F000142_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S142_0;
+
+void s142_0_reset(S142_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S142_1;
+
+void s142_1_reset(S142_1* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S142_2;
+
+void s142_2_reset(S142_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S142_3;
+
+void s142_3_reset(S142_3* value);
+
+#endif // F000142_H
@@ -0,0 +1,58 @@
+#ifndef F000143_H
+#define F000143_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S143_0;
+
+void s143_0_reset(S143_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S143_1;
+
+void s143_1_reset(S143_1* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S143_2;
+
+void s143_2_reset(S143_2* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S143_3;
+
+void s143_3_reset(S143_3* value);
+
+#endif // F000143_H
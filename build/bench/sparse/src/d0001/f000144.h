@@ -0,0 +1,58 @@
+#ifndef F000144_H
+#define F000144_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S144_0;
+
+void s144_0_reset(S144_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S144_1;
+
+void s144_1_reset(S144_1* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S144_2;
+
+void s144_2_reset(S144_2* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S144_3;
+
+void s144_3_reset(S144_3* value);
+
+#endif // F000144_H
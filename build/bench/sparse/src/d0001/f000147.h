@@ -0,0 +1,58 @@
+#ifndef F000147_H
+#define F000147_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S147_0;
+
+void s147_0_reset(S147_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S147_1;
+
+void s147_1_reset(S147_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S147_2;
+
+void s147_2_reset(S147_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S147_3;
+
+void s147_3_reset(S147_3* value);
+
+#endif // F000147_H
@@ -0,0 +1,58 @@
+#ifndef F000148_H
+#define F000148_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S148_0;
+
+void s148_0_reset(S148_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S148_1;
+
+void s148_1_reset(S148_1* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S148_2;
+
+void s148_2_reset(S148_2* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S148_3;
+
+void s148_3_reset(S148_3* value);
+
+#endif // F000148_H
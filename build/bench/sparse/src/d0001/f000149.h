@@ -0,0 +1,58 @@
+#ifndef F000149_H
+#define F000149_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S149_0;
+
+void s149_0_reset(S149_0* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S149_1;
+
+void s149_1_reset(S149_1* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S149_2;
+
+void s149_2_reset(S149_2* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S149_3;
+
+void s149_3_reset(S149_3* value);
+
+#endif // F000149_H
@@ -0,0 +1,58 @@
+#ifndef F000151_H
+#define F000151_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S151_0;
+
+void s151_0_reset(S151_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S151_1;
+
+void s151_1_reset(S151_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S151_2;
+
+void s151_2_reset(S151_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S151_3;
+
+void s151_3_reset(S151_3* value);
+
+#endif // F000151_H
@@ -0,0 +1,58 @@
+#ifndef F000152_H
+#define F000152_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S152_0;
+
+void s152_0_reset(S152_0* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S152_1;
+
+void s152_1_reset(S152_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S152_2;
+
+void s152_2_reset(S152_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S152_3;
+
+void s152_3_reset(S152_3* value);
+
+#endif // F000152_H
@@ -0,0 +1,58 @@
+#ifndef F000155_H
+#define F000155_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S155_0;
+
+void s155_0_reset(S155_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S155_1;
+
+void s155_1_reset(S155_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S155_2;
+
+void s155_2_reset(S155_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S155_3;
+
+void s155_3_reset(S155_3* value);
+
+#endif // F000155_H
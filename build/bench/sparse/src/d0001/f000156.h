@@ -0,0 +1,58 @@
+#ifndef F000156_H
+#define F000156_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S156_0;
+
+void s156_0_reset(S156_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S156_1;
+
+void s156_1_reset(S156_1* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S156_2;
+
+void s156_2_reset(S156_2* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S156_3;
+
+void s156_3_reset(S156_3* value);
+
+#endif // F000156_H
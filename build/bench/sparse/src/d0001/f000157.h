@@ -0,0 +1,58 @@
+#ifndef F000157_H
+#define F000157_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S157_0;
+
+void s157_0_reset(S157_0* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S157_1;
+
+void s157_1_reset(S157_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S157_2;
+
+void s157_2_reset(S157_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S157_3;
+
+void s157_3_reset(S157_3* value);
+
+#endif // F000157_H
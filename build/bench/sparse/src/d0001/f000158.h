@@ -0,0 +1,58 @@
+#ifndef F000158_H
+#define F000158_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S158_0;
+
+void s158_0_reset(S158_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S158_1;
+
+void s158_1_reset(S158_1* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S158_2;
+
+void s158_2_reset(S158_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S158_3;
+
+void s158_3_reset(S158_3* value);
+
+#endif // F000158_H
@@ -0,0 +1,58 @@
+#ifndef F000159_H
+#define F000159_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S159_0;
+
+void s159_0_reset(S159_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S159_1;
+
+void s159_1_reset(S159_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S159_2;
+
+void s159_2_reset(S159_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S159_3;
+
+void s159_3_reset(S159_3* value);
+
+#endif // F000159_H
@@ -0,0 +1,58 @@
+#ifndef F000162_H
+#define F000162_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S162_0;
+
+void s162_0_reset(S162_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S162_1;
+
+void s162_1_reset(S162_1* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S162_2;
+
+void s162_2_reset(S162_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S162_3;
+
+void s162_3_reset(S162_3* value);
+
+#endif // F000162_H
@@ -0,0 +1,58 @@
+#ifndef F000163_H
+#define F000163_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S163_0;
+
+void s163_0_reset(S163_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S163_1;
+
+void s163_1_reset(S163_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S163_2;
+
+void s163_2_reset(S163_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S163_3;
+
+void s163_3_reset(S163_3* value);
+
+#endif // F000163_H
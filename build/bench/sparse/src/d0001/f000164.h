@@ -0,0 +1,58 @@
+#ifndef F000164_H
+#define F000164_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S164_0;
+
+void s164_0_reset(S164_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S164_1;
+
+void s164_1_reset(S164_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S164_2;
+
+void s164_2_reset(S164_2* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S164_3;
+
+void s164_3_reset(S164_3* value);
+
+#endif // F000164_H
@@ -0,0 +1,58 @@
+#ifndef F000165_H
+#define F000165_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    long field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S165_0;
+
+void s165_0_reset(S165_0* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S165_1;
+
+void s165_1_reset(S165_1* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S165_2;
+
+void s165_2_reset(S165_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S165_3;
+
+void s165_3_reset(S165_3* value);
+
+#endif // F000165_H
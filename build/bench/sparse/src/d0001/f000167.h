@@ -0,0 +1,58 @@
+#ifndef F000167_H
+#define F000167_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S167_0;
+
+void s167_0_reset(S167_0* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S167_1;
+
+void s167_1_reset(S167_1* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S167_2;
+
+void s167_2_reset(S167_2* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S167_3;
+
+void s167_3_reset(S167_3* value);
+
+#endif // F000167_H
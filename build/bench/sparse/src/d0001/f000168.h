@@ -0,0 +1,58 @@
+#ifndef F000168_H
+#define F000168_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S168_0;
+
+void s168_0_reset(S168_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S168_1;
+
+void s168_1_reset(S168_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S168_2;
+
+void s168_2_reset(S168_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S168_3;
+
+void s168_3_reset(S168_3* value);
+
+#endif // F000168_H
@@ -0,0 +1,58 @@
+#ifndef F000169_H
+#define F000169_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S169_0;
+
+void s169_0_reset(S169_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S169_1;
+
+void s169_1_reset(S169_1* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S169_2;
+
+void s169_2_reset(S169_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S169_3;
+
+void s169_3_reset(S169_3* value);
+
+#endif // F000169_H
@@ -0,0 +1,50 @@
+#ifndef F000170_H
+#define F000170_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S170_0 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S170_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S170_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S170_3 derive_all();
+
+#endif // F000170_H
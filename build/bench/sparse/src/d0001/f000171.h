@@ -0,0 +1,58 @@
+#ifndef F000171_H
+#define F000171_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S171_0;
+
+void s171_0_reset(S171_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S171_1;
+
+void s171_1_reset(S171_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S171_2;
+
+void s171_2_reset(S171_2* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S171_3;
+
+void s171_3_reset(S171_3* value);
+
+#endif // F000171_H
@@ -0,0 +1,58 @@
+#ifndef F000172_H
+#define F000172_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S172_0;
+
+void s172_0_reset(S172_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S172_1;
+
+void s172_1_reset(S172_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S172_2;
+
+void s172_2_reset(S172_2* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S172_3;
+
+void s172_3_reset(S172_3* value);
+
+#endif // F000172_H
@@ -0,0 +1,58 @@
+#ifndef F000173_H
+#define F000173_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S173_0;
+
+void s173_0_reset(S173_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S173_1;
+
+void s173_1_reset(S173_1* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S173_2;
+
+void s173_2_reset(S173_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S173_3;
+
+void s173_3_reset(S173_3* value);
+
+#endif // F000173_H
@@ -0,0 +1,58 @@
+#ifndef F000175_H
+#define F000175_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S175_0;
+
+void s175_0_reset(S175_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S175_1;
+
+void s175_1_reset(S175_1* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S175_2;
+
+void s175_2_reset(S175_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S175_3;
+
+void s175_3_reset(S175_3* value);
+
+#endif // F000175_H
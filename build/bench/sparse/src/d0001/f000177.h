@@ -0,0 +1,58 @@
+#ifndef F000177_H
+#define F000177_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S177_0;
+
+void s177_0_reset(S177_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S177_1;
+
+void s177_1_reset(S177_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S177_2;
+
+void s177_2_reset(S177_2* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S177_3;
+
+void s177_3_reset(S177_3* value);
+
+#endif // F000177_H
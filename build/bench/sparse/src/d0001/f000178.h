@@ -0,0 +1,58 @@
+#ifndef F000178_H
+#define F000178_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S178_0;
+
+void s178_0_reset(S178_0* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S178_1;
+
+void s178_1_reset(S178_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S178_2;
+
+void s178_2_reset(S178_2* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S178_3;
+
+void s178_3_reset(S178_3* value);
+
+#endif // F000178_H
@@ -0,0 +1,58 @@
+#ifndef F000179_H
+#define F000179_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S179_0;
+
+void s179_0_reset(S179_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S179_1;
+
+void s179_1_reset(S179_1* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S179_2;
+
+void s179_2_reset(S179_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S179_3;
+
+void s179_3_reset(S179_3* value);
+
+#endif // F000179_H
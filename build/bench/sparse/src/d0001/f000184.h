@@ -0,0 +1,58 @@
+#ifndef F000184_H
+#define F000184_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S184_0;
+
+void s184_0_reset(S184_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S184_1;
+
+void s184_1_reset(S184_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S184_2;
+
+void s184_2_reset(S184_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S184_3;
+
+void s184_3_reset(S184_3* value);
+
+#endif // F000184_H
@@ -0,0 +1,58 @@
+#ifndef F000185_H
+#define F000185_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S185_0;
+
+void s185_0_reset(S185_0* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S185_1;
+
+void s185_1_reset(S185_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S185_2;
+
+void s185_2_reset(S185_2* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S185_3;
+
+void s185_3_reset(S185_3* value);
+
+#endif // F000185_H
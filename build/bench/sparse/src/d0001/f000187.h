@@ -0,0 +1,58 @@
+#ifndef F000187_H
+#define F000187_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S187_0;
+
+void s187_0_reset(S187_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S187_1;
+
+void s187_1_reset(S187_1* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S187_2;
+
+void s187_2_reset(S187_2* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S187_3;
+
+void s187_3_reset(S187_3* value);
+
+#endif // F000187_H
@@ -0,0 +1,58 @@
+#ifndef F000192_H
+#define F000192_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S192_0;
+
+void s192_0_reset(S192_0* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S192_1;
+
+void s192_1_reset(S192_1* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S192_2;
+
+void s192_2_reset(S192_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S192_3;
+
+void s192_3_reset(S192_3* value);
+
+#endif // F000192_H
@@ -0,0 +1,58 @@
+#ifndef F000193_H
+#define F000193_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S193_0;
+
+void s193_0_reset(S193_0* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S193_1;
+
+void s193_1_reset(S193_1* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S193_2;
+
+void s193_2_reset(S193_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S193_3;
+
+void s193_3_reset(S193_3* value);
+
+#endif // F000193_H
@@ -0,0 +1,58 @@
+#ifndef F000194_H
+#define F000194_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S194_0;
+
+void s194_0_reset(S194_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S194_1;
+
+void s194_1_reset(S194_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S194_2;
+
+void s194_2_reset(S194_2* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S194_3;
+
+void s194_3_reset(S194_3* value);
+
+#endif // F000194_H
@@ -0,0 +1,58 @@
+#ifndef F000195_H
+#define F000195_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S195_0;
+
+void s195_0_reset(S195_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S195_1;
+
+void s195_1_reset(S195_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S195_2;
+
+void s195_2_reset(S195_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S195_3;
+
+void s195_3_reset(S195_3* value);
+
+#endif // F000195_H
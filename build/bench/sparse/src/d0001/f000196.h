@@ -0,0 +1,58 @@
+#ifndef F000196_H
+#define F000196_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S196_0;
+
+void s196_0_reset(S196_0* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S196_1;
+
+void s196_1_reset(S196_1* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S196_2;
+
+void s196_2_reset(S196_2* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S196_3;
+
+void s196_3_reset(S196_3* value);
+
+#endif // F000196_H
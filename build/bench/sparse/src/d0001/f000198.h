@@ -0,0 +1,58 @@
+#ifndef F000198_H
+#define F000198_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S198_0;
+
+void s198_0_reset(S198_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S198_1;
+
+void s198_1_reset(S198_1* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S198_2;
+
+void s198_2_reset(S198_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S198_3;
+
+void s198_3_reset(S198_3* value);
+
+#endif // F000198_H
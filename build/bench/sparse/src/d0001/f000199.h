@@ -0,0 +1,58 @@
+#ifndef F000199_H
+#define F000199_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S199_0;
+
+void s199_0_reset(S199_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S199_1;
+
+void s199_1_reset(S199_1* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S199_2;
+
+void s199_2_reset(S199_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S199_3;
+
+void s199_3_reset(S199_3* value);
+
+#endif // F000199_H
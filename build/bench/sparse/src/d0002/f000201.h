@@ -0,0 +1,58 @@
+#ifndef F000201_H
+#define F000201_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S201_0;
+
+void s201_0_reset(S201_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S201_1;
+
+void s201_1_reset(S201_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S201_2;
+
+void s201_2_reset(S201_2* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S201_3;
+
+void s201_3_reset(S201_3* value);
+
+#endif // F000201_H
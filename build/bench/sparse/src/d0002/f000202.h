@@ -0,0 +1,58 @@
+#ifndef F000202_H
+#define F000202_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S202_0;
+
+void s202_0_reset(S202_0* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S202_1;
+
+void s202_1_reset(S202_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S202_2;
+
+void s202_2_reset(S202_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S202_3;
+
+void s202_3_reset(S202_3* value);
+
+#endif // F000202_H
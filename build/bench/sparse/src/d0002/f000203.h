@@ -0,0 +1,58 @@
+#ifndef F000203_H
+#define F000203_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S203_0;
+
+void s203_0_reset(S203_0* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S203_1;
+
+void s203_1_reset(S203_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S203_2;
+
+void s203_2_reset(S203_2* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S203_3;
+
+void s203_3_reset(S203_3* value);
+
+#endif // F000203_H
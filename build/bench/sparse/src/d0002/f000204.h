@@ -0,0 +1,58 @@
+#ifndef F000204_H
+#define F000204_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S204_0;
+
+void s204_0_reset(S204_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S204_1;
+
+void s204_1_reset(S204_1* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S204_2;
+
+void s204_2_reset(S204_2* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S204_3;
+
+void s204_3_reset(S204_3* value);
+
+#endif // F000204_H
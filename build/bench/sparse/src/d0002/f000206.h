@@ -0,0 +1,58 @@
+#ifndef F000206_H
+#define F000206_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S206_0;
+
+void s206_0_reset(S206_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S206_1;
+
+void s206_1_reset(S206_1* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S206_2;
+
+void s206_2_reset(S206_2* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S206_3;
+
+void s206_3_reset(S206_3* value);
+
+#endif // F000206_H
@@ -0,0 +1,58 @@
+#ifndef F000207_H
+#define F000207_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S207_0;
+
+void s207_0_reset(S207_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S207_1;
+
+void s207_1_reset(S207_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S207_2;
+
+void s207_2_reset(S207_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S207_3;
+
+void s207_3_reset(S207_3* value);
+
+#endif // F000207_H
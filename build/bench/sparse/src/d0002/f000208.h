@@ -0,0 +1,58 @@
+#ifndef F000208_H
+#define F000208_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S208_0;
+
+void s208_0_reset(S208_0* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S208_1;
+
+void s208_1_reset(S208_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S208_2;
+
+void s208_2_reset(S208_2* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S208_3;
+
+void s208_3_reset(S208_3* value);
+
+#endif // F000208_H
@@ -0,0 +1,58 @@
+#ifndef F000209_H
+#define F000209_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S209_0;
+
+void s209_0_reset(S209_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S209_1;
+
+void s209_1_reset(S209_1* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S209_2;
+
+void s209_2_reset(S209_2* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S209_3;
+
+void s209_3_reset(S209_3* value);
+
+#endif // F000209_H
@@ -0,0 +1,50 @@
+#ifndef F000210_H
+#define F000210_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S210_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S210_1 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S210_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S210_3 derive_all();
+
+#endif // F000210_H
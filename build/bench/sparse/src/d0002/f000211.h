@@ -0,0 +1,58 @@
+#ifndef F000211_H
+#define F000211_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S211_0;
+
+void s211_0_reset(S211_0* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S211_1;
+
+void s211_1_reset(S211_1* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S211_2;
+
+void s211_2_reset(S211_2* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S211_3;
+
+void s211_3_reset(S211_3* value);
+
+#endif // F000211_H
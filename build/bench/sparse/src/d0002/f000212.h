@@ -0,0 +1,58 @@
+#ifndef F000212_H
+#define F000212_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S212_0;
+
+void s212_0_reset(S212_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S212_1;
+
+void s212_1_reset(S212_1* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S212_2;
+
+void s212_2_reset(S212_2* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S212_3;
+
+void s212_3_reset(S212_3* value);
+
+#endif // F000212_H
@@ -0,0 +1,58 @@
+#ifndef F000213_H
+#define F000213_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S213_0;
+
+void s213_0_reset(S213_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S213_1;
+
+void s213_1_reset(S213_1* value);
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S213_2;
+
+void s213_2_reset(S213_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S213_3;
+
+void s213_3_reset(S213_3* value);
+
+#endif // F000213_H
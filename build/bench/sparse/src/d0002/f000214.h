@@ -0,0 +1,58 @@
+#ifndef F000214_H
+#define F000214_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S214_0;
+
+void s214_0_reset(S214_0* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S214_1;
+
+void s214_1_reset(S214_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S214_2;
+
+void s214_2_reset(S214_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S214_3;
+
+void s214_3_reset(S214_3* value);
+
+#endif // F000214_H
@@ -0,0 +1,58 @@
+#ifndef F000215_H
+#define F000215_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S215_0;
+
+void s215_0_reset(S215_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S215_1;
+
+void s215_1_reset(S215_1* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S215_2;
+
+void s215_2_reset(S215_2* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S215_3;
+
+void s215_3_reset(S215_3* value);
+
+#endif // F000215_H
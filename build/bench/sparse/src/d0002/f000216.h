@@ -0,0 +1,58 @@
+#ifndef F000216_H
+#define F000216_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S216_0;
+
+void s216_0_reset(S216_0* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S216_1;
+
+void s216_1_reset(S216_1* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S216_2;
+
+void s216_2_reset(S216_2* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S216_3;
+
+void s216_3_reset(S216_3* value);
+
+#endif // F000216_H
@@ -0,0 +1,58 @@
+#ifndef F000217_H
+#define F000217_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S217_0;
+
+void s217_0_reset(S217_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S217_1;
+
+void s217_1_reset(S217_1* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S217_2;
+
+void s217_2_reset(S217_2* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S217_3;
+
+void s217_3_reset(S217_3* value);
+
+#endif // F000217_H
@@ -0,0 +1,58 @@
+#ifndef F000221_H
+#define F000221_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S221_0;
+
+void s221_0_reset(S221_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S221_1;
+
+void s221_1_reset(S221_1* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S221_2;
+
+void s221_2_reset(S221_2* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S221_3;
+
+void s221_3_reset(S221_3* value);
+
+#endif // F000221_H
@@ -0,0 +1,58 @@
+#ifndef F000223_H
+#define F000223_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S223_0;
+
+void s223_0_reset(S223_0* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S223_1;
+
+void s223_1_reset(S223_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S223_2;
+
+void s223_2_reset(S223_2* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S223_3;
+
+void s223_3_reset(S223_3* value);
+
+#endif // F000223_H
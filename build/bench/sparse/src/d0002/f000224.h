@@ -0,0 +1,58 @@
+#ifndef F000224_H
+#define F000224_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S224_0;
+
+void s224_0_reset(S224_0* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S224_1;
+
+void s224_1_reset(S224_1* value);
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S224_2;
+
+void s224_2_reset(S224_2* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S224_3;
+
+void s224_3_reset(S224_3* value);
+
+#endif // F000224_H
@@ -0,0 +1,58 @@
+#ifndef F000225_H
+#define F000225_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S225_0;
+
+void s225_0_reset(S225_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S225_1;
+
+void s225_1_reset(S225_1* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S225_2;
+
+void s225_2_reset(S225_2* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S225_3;
+
+void s225_3_reset(S225_3* value);
+
+#endif // F000225_H
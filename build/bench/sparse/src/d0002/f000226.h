@@ -0,0 +1,58 @@
+#ifndef F000226_H
+#define F000226_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S226_0;
+
+void s226_0_reset(S226_0* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S226_1;
+
+void s226_1_reset(S226_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S226_2;
+
+void s226_2_reset(S226_2* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S226_3;
+
+void s226_3_reset(S226_3* value);
+
+#endif // F000226_H
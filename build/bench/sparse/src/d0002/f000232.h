@@ -0,0 +1,58 @@
+#ifndef F000232_H
+#define F000232_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S232_0;
+
+void s232_0_reset(S232_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S232_1;
+
+void s232_1_reset(S232_1* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S232_2;
+
+void s232_2_reset(S232_2* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S232_3;
+
+void s232_3_reset(S232_3* value);
+
+#endif // F000232_H
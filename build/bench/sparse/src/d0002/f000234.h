@@ -0,0 +1,58 @@
+#ifndef F000234_H
+#define F000234_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S234_0;
+
+void s234_0_reset(S234_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S234_1;
+
+void s234_1_reset(S234_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S234_2;
+
+void s234_2_reset(S234_2* value);
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S234_3;
+
+void s234_3_reset(S234_3* value);
+
+#endif // F000234_H
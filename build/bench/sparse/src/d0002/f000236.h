@@ -0,0 +1,58 @@
+#ifndef F000236_H
+#define F000236_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S236_0;
+
+void s236_0_reset(S236_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S236_1;
+
+void s236_1_reset(S236_1* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S236_2;
+
+void s236_2_reset(S236_2* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S236_3;
+
+void s236_3_reset(S236_3* value);
+
+#endif // F000236_H
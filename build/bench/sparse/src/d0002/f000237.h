@@ -0,0 +1,58 @@
+#ifndef F000237_H
+#define F000237_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S237_0;
+
+void s237_0_reset(S237_0* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S237_1;
+
+void s237_1_reset(S237_1* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S237_2;
+
+void s237_2_reset(S237_2* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S237_3;
+
+void s237_3_reset(S237_3* value);
+
+#endif // F000237_H
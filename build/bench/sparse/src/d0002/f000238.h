@@ -0,0 +1,58 @@
+#ifndef F000238_H
+#define F000238_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S238_0;
+
+void s238_0_reset(S238_0* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S238_1;
+
+void s238_1_reset(S238_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S238_2;
+
+void s238_2_reset(S238_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S238_3;
+
+void s238_3_reset(S238_3* value);
+
+#endif // F000238_H
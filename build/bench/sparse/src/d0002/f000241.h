@@ -0,0 +1,58 @@
+#ifndef F000241_H
+#define F000241_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S241_0;
+
+void s241_0_reset(S241_0* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S241_1;
+
+void s241_1_reset(S241_1* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S241_2;
+
+void s241_2_reset(S241_2* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S241_3;
+
+void s241_3_reset(S241_3* value);
+
+#endif // F000241_H
@@ -0,0 +1,58 @@
+#ifndef F000242_H
+#define F000242_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S242_0;
+
+void s242_0_reset(S242_0* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S242_1;
+
+void s242_1_reset(S242_1* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S242_2;
+
+void s242_2_reset(S242_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S242_3;
+
+void s242_3_reset(S242_3* value);
+
+#endif // F000242_H
@@ -0,0 +1,58 @@
+#ifndef F000243_H
+#define F000243_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S243_0;
+
+void s243_0_reset(S243_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S243_1;
+
+void s243_1_reset(S243_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S243_2;
+
+void s243_2_reset(S243_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S243_3;
+
+void s243_3_reset(S243_3* value);
+
+#endif // F000243_H
@@ -0,0 +1,58 @@
+#ifndef F000244_H
+#define F000244_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S244_0;
+
+void s244_0_reset(S244_0* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S244_1;
+
+void s244_1_reset(S244_1* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S244_2;
+
+void s244_2_reset(S244_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S244_3;
+
+void s244_3_reset(S244_3* value);
+
+#endif // F000244_H
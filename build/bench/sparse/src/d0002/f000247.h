@@ -0,0 +1,58 @@
+#ifndef F000247_H
+#define F000247_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S247_0;
+
+void s247_0_reset(S247_0* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S247_1;
+
+void s247_1_reset(S247_1* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S247_2;
+
+void s247_2_reset(S247_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S247_3;
+
+void s247_3_reset(S247_3* value);
+
+#endif // F000247_H
@@ -0,0 +1,50 @@
+#ifndef F000250_H
+#define F000250_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S250_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S250_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S250_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S250_3 derive_all();
+
+#endif // F000250_H
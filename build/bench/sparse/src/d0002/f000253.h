@@ -0,0 +1,58 @@
+#ifndef F000253_H
+#define F000253_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S253_0;
+
+void s253_0_reset(S253_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S253_1;
+
+void s253_1_reset(S253_1* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S253_2;
+
+void s253_2_reset(S253_2* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S253_3;
+
+void s253_3_reset(S253_3* value);
+
+#endif // F000253_H
@@ -0,0 +1,58 @@
+#ifndef F000257_H
+#define F000257_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S257_0;
+
+void s257_0_reset(S257_0* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S257_1;
+
+void s257_1_reset(S257_1* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S257_2;
+
+void s257_2_reset(S257_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S257_3;
+
+void s257_3_reset(S257_3* value);
+
+#endif // F000257_H
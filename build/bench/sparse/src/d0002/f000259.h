@@ -0,0 +1,58 @@
+#ifndef F000259_H
+#define F000259_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S259_0;
+
+void s259_0_reset(S259_0* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S259_1;
+
+void s259_1_reset(S259_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S259_2;
+
+void s259_2_reset(S259_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S259_3;
+
+void s259_3_reset(S259_3* value);
+
+#endif // F000259_H
@@ -0,0 +1,58 @@
+#ifndef F000261_H
+#define F000261_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S261_0;
+
+void s261_0_reset(S261_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S261_1;
+
+void s261_1_reset(S261_1* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S261_2;
+
+void s261_2_reset(S261_2* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S261_3;
+
+void s261_3_reset(S261_3* value);
+
+#endif // F000261_H
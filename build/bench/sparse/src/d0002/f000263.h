@@ -0,0 +1,58 @@
+#ifndef F000263_H
+#define F000263_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S263_0;
+
+void s263_0_reset(S263_0* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S263_1;
+
+void s263_1_reset(S263_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S263_2;
+
+void s263_2_reset(S263_2* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S263_3;
+
+void s263_3_reset(S263_3* value);
+
+#endif // F000263_H
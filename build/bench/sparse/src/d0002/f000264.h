@@ -0,0 +1,58 @@
+#ifndef F000264_H
+#define F000264_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S264_0;
+
+void s264_0_reset(S264_0* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S264_1;
+
+void s264_1_reset(S264_1* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S264_2;
+
+void s264_2_reset(S264_2* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S264_3;
+
+void s264_3_reset(S264_3* value);
+
+#endif // F000264_H
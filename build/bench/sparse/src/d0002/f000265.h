@@ -0,0 +1,58 @@
+#ifndef F000265_H
+#define F000265_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S265_0;
+
+void s265_0_reset(S265_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S265_1;
+
+void s265_1_reset(S265_1* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S265_2;
+
+void s265_2_reset(S265_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S265_3;
+
+void s265_3_reset(S265_3* value);
+
+#endif // F000265_H
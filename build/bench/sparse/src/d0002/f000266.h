@@ -0,0 +1,58 @@
+#ifndef F000266_H
+#define F000266_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S266_0;
+
+void s266_0_reset(S266_0* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S266_1;
+
+void s266_1_reset(S266_1* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S266_2;
+
+void s266_2_reset(S266_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S266_3;
+
+void s266_3_reset(S266_3* value);
+
+#endif // F000266_H
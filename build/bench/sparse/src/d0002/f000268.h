@@ -0,0 +1,58 @@
+#ifndef F000268_H
+#define F000268_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S268_0;
+
+void s268_0_reset(S268_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S268_1;
+
+void s268_1_reset(S268_1* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S268_2;
+
+void s268_2_reset(S268_2* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S268_3;
+
+void s268_3_reset(S268_3* value);
+
+#endif // F000268_H
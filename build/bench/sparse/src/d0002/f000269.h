@@ -0,0 +1,58 @@
+#ifndef F000269_H
+#define F000269_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S269_0;
+
+void s269_0_reset(S269_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S269_1;
+
+void s269_1_reset(S269_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S269_2;
+
+void s269_2_reset(S269_2* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S269_3;
+
+void s269_3_reset(S269_3* value);
+
+#endif // F000269_H
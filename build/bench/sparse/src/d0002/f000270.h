@@ -0,0 +1,50 @@
+#ifndef F000270_H
+#define F000270_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S270_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S270_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S270_2 derive_all();
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S270_3 derive_all();
+
+#endif // F000270_H
@@ -0,0 +1,58 @@
+#ifndef F000272_H
+#define F000272_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S272_0;
+
+void s272_0_reset(S272_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S272_1;
+
+void s272_1_reset(S272_1* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S272_2;
+
+void s272_2_reset(S272_2* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S272_3;
+
+void s272_3_reset(S272_3* value);
+
+#endif // F000272_H
@@ -0,0 +1,58 @@
+#ifndef F000273_H
+#define F000273_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S273_0;
+
+void s273_0_reset(S273_0* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S273_1;
+
+void s273_1_reset(S273_1* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S273_2;
+
+void s273_2_reset(S273_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S273_3;
+
+void s273_3_reset(S273_3* value);
+
+#endif // F000273_H
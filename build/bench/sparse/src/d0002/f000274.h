@@ -0,0 +1,58 @@
+#ifndef F000274_H
+#define F000274_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S274_0;
+
+void s274_0_reset(S274_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S274_1;
+
+void s274_1_reset(S274_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S274_2;
+
+void s274_2_reset(S274_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S274_3;
+
+void s274_3_reset(S274_3* value);
+
+#endif // F000274_H
@@ -0,0 +1,58 @@
+#ifndef F000276_H
+#define F000276_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S276_0;
+
+void s276_0_reset(S276_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S276_1;
+
+void s276_1_reset(S276_1* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S276_2;
+
+void s276_2_reset(S276_2* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S276_3;
+
+void s276_3_reset(S276_3* value);
+
+#endif // F000276_H
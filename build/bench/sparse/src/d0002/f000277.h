@@ -0,0 +1,58 @@
+#ifndef F000277_H
+#define F000277_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S277_0;
+
+void s277_0_reset(S277_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S277_1;
+
+void s277_1_reset(S277_1* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S277_2;
+
+void s277_2_reset(S277_2* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S277_3;
+
+void s277_3_reset(S277_3* value);
+
+#endif // F000277_H
@@ -0,0 +1,58 @@
+#ifndef F000279_H
+#define F000279_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S279_0;
+
+void s279_0_reset(S279_0* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S279_1;
+
+void s279_1_reset(S279_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S279_2;
+
+void s279_2_reset(S279_2* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S279_3;
+
+void s279_3_reset(S279_3* value);
+
+#endif // F000279_H
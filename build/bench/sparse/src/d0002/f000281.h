@@ -0,0 +1,58 @@
+#ifndef F000281_H
+#define F000281_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S281_0;
+
+void s281_0_reset(S281_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S281_1;
+
+void s281_1_reset(S281_1* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S281_2;
+
+void s281_2_reset(S281_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S281_3;
+
+void s281_3_reset(S281_3* value);
+
+#endif // F000281_H
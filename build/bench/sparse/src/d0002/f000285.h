@@ -0,0 +1,58 @@
+#ifndef F000285_H
+#define F000285_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S285_0;
+
+void s285_0_reset(S285_0* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S285_1;
+
+void s285_1_reset(S285_1* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S285_2;
+
+void s285_2_reset(S285_2* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S285_3;
+
+void s285_3_reset(S285_3* value);
+
+#endif // F000285_H
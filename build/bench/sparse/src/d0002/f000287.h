@@ -0,0 +1,58 @@
+#ifndef F000287_H
+#define F000287_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S287_0;
+
+void s287_0_reset(S287_0* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S287_1;
+
+void s287_1_reset(S287_1* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S287_2;
+
+void s287_2_reset(S287_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S287_3;
+
+void s287_3_reset(S287_3* value);
+
+#endif // F000287_H
@@ -0,0 +1,58 @@
+#ifndef F000288_H
+#define F000288_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S288_0;
+
+void s288_0_reset(S288_0* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S288_1;
+
+void s288_1_reset(S288_1* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S288_2;
+
+void s288_2_reset(S288_2* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S288_3;
+
+void s288_3_reset(S288_3* value);
+
+#endif // F000288_H
@@ -0,0 +1,58 @@
+#ifndef F000289_H
+#define F000289_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S289_0;
+
+void s289_0_reset(S289_0* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S289_1;
+
+void s289_1_reset(S289_1* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S289_2;
+
+void s289_2_reset(S289_2* value);
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S289_3;
+
+void s289_3_reset(S289_3* value);
+
+#endif // F000289_H
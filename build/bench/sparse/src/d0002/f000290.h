@@ -0,0 +1,50 @@
+#ifndef F000290_H
+#define F000290_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S290_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S290_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S290_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S290_3 derive_all();
+
+#endif // F000290_H
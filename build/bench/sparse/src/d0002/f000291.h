@@ -0,0 +1,58 @@
+#ifndef F000291_H
+#define F000291_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S291_0;
+
+void s291_0_reset(S291_0* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S291_1;
+
+void s291_1_reset(S291_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S291_2;
+
+void s291_2_reset(S291_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S291_3;
+
+void s291_3_reset(S291_3* value);
+
+#endif // F000291_H
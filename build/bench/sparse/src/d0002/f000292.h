@@ -0,0 +1,58 @@
+#ifndef F000292_H
+#define F000292_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S292_0;
+
+void s292_0_reset(S292_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S292_1;
+
+void s292_1_reset(S292_1* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S292_2;
+
+void s292_2_reset(S292_2* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S292_3;
+
+void s292_3_reset(S292_3* value);
+
+#endif // F000292_H
@@ -0,0 +1,58 @@
+#ifndef F000293_H
+#define F000293_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S293_0;
+
+void s293_0_reset(S293_0* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S293_1;
+
+void s293_1_reset(S293_1* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S293_2;
+
+void s293_2_reset(S293_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S293_3;
+
+void s293_3_reset(S293_3* value);
+
+#endif // F000293_H
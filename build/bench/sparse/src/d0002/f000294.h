@@ -0,0 +1,58 @@
+#ifndef F000294_H
+#define F000294_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S294_0;
+
+void s294_0_reset(S294_0* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S294_1;
+
+void s294_1_reset(S294_1* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S294_2;
+
+void s294_2_reset(S294_2* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S294_3;
+
+void s294_3_reset(S294_3* value);
+
+#endif // F000294_H
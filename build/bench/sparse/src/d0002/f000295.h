@@ -0,0 +1,58 @@
+#ifndef F000295_H
+#define F000295_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S295_0;
+
+void s295_0_reset(S295_0* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S295_1;
+
+void s295_1_reset(S295_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S295_2;
+
+void s295_2_reset(S295_2* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S295_3;
+
+void s295_3_reset(S295_3* value);
+
+#endif // F000295_H
@@ -0,0 +1,58 @@
+#ifndef F000296_H
+#define F000296_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S296_0;
+
+void s296_0_reset(S296_0* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S296_1;
+
+void s296_1_reset(S296_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S296_2;
+
+void s296_2_reset(S296_2* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S296_3;
+
+void s296_3_reset(S296_3* value);
+
+#endif // F000296_H
@@ -0,0 +1,58 @@
+#ifndef F000297_H
+#define F000297_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S297_0;
+
+void s297_0_reset(S297_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S297_1;
+
+void s297_1_reset(S297_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S297_2;
+
+void s297_2_reset(S297_2* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S297_3;
+
+void s297_3_reset(S297_3* value);
+
+#endif // F000297_H
@@ -0,0 +1,58 @@
+#ifndef F000298_H
+#define F000298_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S298_0;
+
+void s298_0_reset(S298_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S298_1;
+
+void s298_1_reset(S298_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S298_2;
+
+void s298_2_reset(S298_2* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S298_3;
+
+void s298_3_reset(S298_3* value);
+
+#endif // F000298_H
@@ -0,0 +1,58 @@
+#ifndef F000299_H
+#define F000299_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S299_0;
+
+void s299_0_reset(S299_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S299_1;
+
+void s299_1_reset(S299_1* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S299_2;
+
+void s299_2_reset(S299_2* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S299_3;
+
+void s299_3_reset(S299_3* value);
+
+#endif // F000299_H
@@ -0,0 +1,58 @@
+#ifndef F000301_H
+#define F000301_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S301_0;
+
+void s301_0_reset(S301_0* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S301_1;
+
+void s301_1_reset(S301_1* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S301_2;
+
+void s301_2_reset(S301_2* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S301_3;
+
+void s301_3_reset(S301_3* value);
+
+#endif // F000301_H
@@ -0,0 +1,58 @@
+#ifndef F000303_H
+#define F000303_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S303_0;
+
+void s303_0_reset(S303_0* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S303_1;
+
+void s303_1_reset(S303_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S303_2;
+
+void s303_2_reset(S303_2* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S303_3;
+
+void s303_3_reset(S303_3* value);
+
+#endif // F000303_H
@@ -0,0 +1,58 @@
+#ifndef F000304_H
+#define F000304_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S304_0;
+
+void s304_0_reset(S304_0* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S304_1;
+
+void s304_1_reset(S304_1* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S304_2;
+
+void s304_2_reset(S304_2* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S304_3;
+
+void s304_3_reset(S304_3* value);
+
+#endif // F000304_H
@@ -0,0 +1,58 @@
+#ifndef F000306_H
+#define F000306_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S306_0;
+
+void s306_0_reset(S306_0* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S306_1;
+
+void s306_1_reset(S306_1* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S306_2;
+
+void s306_2_reset(S306_2* value);
+
+typedef struct {
+    float field_0;
+    double field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S306_3;
+
+void s306_3_reset(S306_3* value);
+
+#endif // F000306_H
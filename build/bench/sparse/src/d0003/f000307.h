@@ -0,0 +1,58 @@
+#ifndef F000307_H
+#define F000307_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S307_0;
+
+void s307_0_reset(S307_0* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S307_1;
+
+void s307_1_reset(S307_1* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S307_2;
+
+void s307_2_reset(S307_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S307_3;
+
+void s307_3_reset(S307_3* value);
+
+#endif // F000307_H
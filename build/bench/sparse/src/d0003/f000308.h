@@ -0,0 +1,58 @@
+#ifndef F000308_H
+#define F000308_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S308_0;
+
+void s308_0_reset(S308_0* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S308_1;
+
+void s308_1_reset(S308_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S308_2;
+
+void s308_2_reset(S308_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S308_3;
+
+void s308_3_reset(S308_3* value);
+
+#endif // F000308_H
@@ -0,0 +1,58 @@
+#ifndef F000309_H
+#define F000309_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S309_0;
+
+void s309_0_reset(S309_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S309_1;
+
+void s309_1_reset(S309_1* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S309_2;
+
+void s309_2_reset(S309_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S309_3;
+
+void s309_3_reset(S309_3* value);
+
+#endif // F000309_H
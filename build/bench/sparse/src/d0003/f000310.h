@@ -0,0 +1,50 @@
+#ifndef F000310_H
+#define F000310_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S310_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S310_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S310_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S310_3 derive_all();
+
+#endif // F000310_H
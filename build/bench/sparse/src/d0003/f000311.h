@@ -0,0 +1,58 @@
+#ifndef F000311_H
+#define F000311_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S311_0;
+
+void s311_0_reset(S311_0* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S311_1;
+
+void s311_1_reset(S311_1* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S311_2;
+
+void s311_2_reset(S311_2* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S311_3;
+
+void s311_3_reset(S311_3* value);
+
+#endif // F000311_H
@@ -0,0 +1,58 @@
+#ifndef F000312_H
+#define F000312_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S312_0;
+
+void s312_0_reset(S312_0* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S312_1;
+
+void s312_1_reset(S312_1* value);
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S312_2;
+
+void s312_2_reset(S312_2* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S312_3;
+
+void s312_3_reset(S312_3* value);
+
+#endif // F000312_H
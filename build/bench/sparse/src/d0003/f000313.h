@@ -0,0 +1,58 @@
+#ifndef F000313_H
+#define F000313_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S313_0;
+
+void s313_0_reset(S313_0* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S313_1;
+
+void s313_1_reset(S313_1* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S313_2;
+
+void s313_2_reset(S313_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S313_3;
+
+void s313_3_reset(S313_3* value);
+
+#endif // F000313_H
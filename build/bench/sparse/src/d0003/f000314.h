@@ -0,0 +1,58 @@
+#ifndef F000314_H
+#define F000314_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S314_0;
+
+void s314_0_reset(S314_0* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S314_1;
+
+void s314_1_reset(S314_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S314_2;
+
+void s314_2_reset(S314_2* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S314_3;
+
+void s314_3_reset(S314_3* value);
+
+#endif // F000314_H
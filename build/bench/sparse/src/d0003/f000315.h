@@ -0,0 +1,58 @@
+#ifndef F000315_H
+#define F000315_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S315_0;
+
+void s315_0_reset(S315_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S315_1;
+
+void s315_1_reset(S315_1* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S315_2;
+
+void s315_2_reset(S315_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S315_3;
+
+void s315_3_reset(S315_3* value);
+
+#endif // F000315_H
@@ -0,0 +1,58 @@
+#ifndef F000316_H
+#define F000316_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S316_0;
+
+void s316_0_reset(S316_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S316_1;
+
+void s316_1_reset(S316_1* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S316_2;
+
+void s316_2_reset(S316_2* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S316_3;
+
+void s316_3_reset(S316_3* value);
+
+#endif // F000316_H
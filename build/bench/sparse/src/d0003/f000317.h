@@ -0,0 +1,58 @@
+#ifndef F000317_H
+#define F000317_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S317_0;
+
+void s317_0_reset(S317_0* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S317_1;
+
+void s317_1_reset(S317_1* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S317_2;
+
+void s317_2_reset(S317_2* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S317_3;
+
+void s317_3_reset(S317_3* value);
+
+#endif // F000317_H
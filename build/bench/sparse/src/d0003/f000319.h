@@ -0,0 +1,58 @@
+#ifndef F000319_H
+#define F000319_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S319_0;
+
+void s319_0_reset(S319_0* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S319_1;
+
+void s319_1_reset(S319_1* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S319_2;
+
+void s319_2_reset(S319_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S319_3;
+
+void s319_3_reset(S319_3* value);
+
+#endif // F000319_H
@@ -0,0 +1,58 @@
+#ifndef F000321_H
+#define F000321_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S321_0;
+
+void s321_0_reset(S321_0* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S321_1;
+
+void s321_1_reset(S321_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S321_2;
+
+void s321_2_reset(S321_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S321_3;
+
+void s321_3_reset(S321_3* value);
+
+#endif // F000321_H
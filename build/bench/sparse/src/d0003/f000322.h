@@ -0,0 +1,58 @@
+#ifndef F000322_H
+#define F000322_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S322_0;
+
+void s322_0_reset(S322_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S322_1;
+
+void s322_1_reset(S322_1* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S322_2;
+
+void s322_2_reset(S322_2* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S322_3;
+
+void s322_3_reset(S322_3* value);
+
+#endif // F000322_H
@@ -0,0 +1,58 @@
+#ifndef F000323_H
+#define F000323_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S323_0;
+
+void s323_0_reset(S323_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S323_1;
+
+void s323_1_reset(S323_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S323_2;
+
+void s323_2_reset(S323_2* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S323_3;
+
+void s323_3_reset(S323_3* value);
+
+#endif // F000323_H
@@ -0,0 +1,58 @@
+#ifndef F000324_H
+#define F000324_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S324_0;
+
+void s324_0_reset(S324_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+} S324_1;
+
+void s324_1_reset(S324_1* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S324_2;
+
+void s324_2_reset(S324_2* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S324_3;
+
+void s324_3_reset(S324_3* value);
+
+#endif // F000324_H
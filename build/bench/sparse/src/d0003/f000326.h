@@ -0,0 +1,58 @@
+#ifndef F000326_H
+#define F000326_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S326_0;
+
+void s326_0_reset(S326_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S326_1;
+
+void s326_1_reset(S326_1* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+} S326_2;
+
+void s326_2_reset(S326_2* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S326_3;
+
+void s326_3_reset(S326_3* value);
+
+#endif // F000326_H
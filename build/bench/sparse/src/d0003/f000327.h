@@ -0,0 +1,58 @@
+#ifndef F000327_H
+#define F000327_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S327_0;
+
+void s327_0_reset(S327_0* value);
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S327_1;
+
+void s327_1_reset(S327_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S327_2;
+
+void s327_2_reset(S327_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S327_3;
+
+void s327_3_reset(S327_3* value);
+
+#endif // F000327_H
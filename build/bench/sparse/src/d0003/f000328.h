@@ -0,0 +1,58 @@
+#ifndef F000328_H
+#define F000328_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S328_0;
+
+void s328_0_reset(S328_0* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S328_1;
+
+void s328_1_reset(S328_1* value);
+
+typedef struct {
+    int field_0;
+    double field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S328_2;
+
+void s328_2_reset(S328_2* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+} S328_3;
+
+void s328_3_reset(S328_3* value);
+
+#endif // F000328_H
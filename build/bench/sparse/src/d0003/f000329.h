@@ -0,0 +1,58 @@
+#ifndef F000329_H
+#define F000329_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S329_0;
+
+void s329_0_reset(S329_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S329_1;
+
+void s329_1_reset(S329_1* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S329_2;
+
+void s329_2_reset(S329_2* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S329_3;
+
+void s329_3_reset(S329_3* value);
+
+#endif // F000329_H
@@ -0,0 +1,58 @@
+#ifndef F000331_H
+#define F000331_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S331_0;
+
+void s331_0_reset(S331_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S331_1;
+
+void s331_1_reset(S331_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S331_2;
+
+void s331_2_reset(S331_2* value);
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S331_3;
+
+void s331_3_reset(S331_3* value);
+
+#endif // F000331_H
@@ -0,0 +1,58 @@
+#ifndef F000332_H
+#define F000332_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S332_0;
+
+void s332_0_reset(S332_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S332_1;
+
+void s332_1_reset(S332_1* value);
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S332_2;
+
+void s332_2_reset(S332_2* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S332_3;
+
+void s332_3_reset(S332_3* value);
+
+#endif // F000332_H
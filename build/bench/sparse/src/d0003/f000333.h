@@ -0,0 +1,58 @@
+#ifndef F000333_H
+#define F000333_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S333_0;
+
+void s333_0_reset(S333_0* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S333_1;
+
+void s333_1_reset(S333_1* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S333_2;
+
+void s333_2_reset(S333_2* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S333_3;
+
+void s333_3_reset(S333_3* value);
+
+#endif // F000333_H
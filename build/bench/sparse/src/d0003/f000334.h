@@ -0,0 +1,58 @@
+#ifndef F000334_H
+#define F000334_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+} S334_0;
+
+void s334_0_reset(S334_0* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S334_1;
+
+void s334_1_reset(S334_1* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    long field_7; tag("Field7")
+} S334_2;
+
+void s334_2_reset(S334_2* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S334_3;
+
+void s334_3_reset(S334_3* value);
+
+#endif // F000334_H
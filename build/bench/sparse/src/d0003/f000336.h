@@ -0,0 +1,58 @@
+#ifndef F000336_H
+#define F000336_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S336_0;
+
+void s336_0_reset(S336_0* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S336_1;
+
+void s336_1_reset(S336_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S336_2;
+
+void s336_2_reset(S336_2* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S336_3;
+
+void s336_3_reset(S336_3* value);
+
+#endif // F000336_H
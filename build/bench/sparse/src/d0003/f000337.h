@@ -0,0 +1,58 @@
+#ifndef F000337_H
+#define F000337_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S337_0;
+
+void s337_0_reset(S337_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S337_1;
+
+void s337_1_reset(S337_1* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S337_2;
+
+void s337_2_reset(S337_2* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S337_3;
+
+void s337_3_reset(S337_3* value);
+
+#endif // F000337_H
@@ -0,0 +1,58 @@
+#ifndef F000338_H
+#define F000338_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S338_0;
+
+void s338_0_reset(S338_0* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S338_1;
+
+void s338_1_reset(S338_1* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S338_2;
+
+void s338_2_reset(S338_2* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S338_3;
+
+void s338_3_reset(S338_3* value);
+
+#endif // F000338_H
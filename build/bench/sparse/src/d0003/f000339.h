@@ -0,0 +1,58 @@
+#ifndef F000339_H
+#define F000339_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S339_0;
+
+void s339_0_reset(S339_0* value);
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S339_1;
+
+void s339_1_reset(S339_1* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S339_2;
+
+void s339_2_reset(S339_2* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S339_3;
+
+void s339_3_reset(S339_3* value);
+
+#endif // F000339_H
@@ -0,0 +1,58 @@
+#ifndef F000341_H
+#define F000341_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S341_0;
+
+void s341_0_reset(S341_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S341_1;
+
+void s341_1_reset(S341_1* value);
+
+typedef struct {
+    double field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S341_2;
+
+void s341_2_reset(S341_2* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    float field_6;
+    int field_7; tag("Field7")
+} S341_3;
+
+void s341_3_reset(S341_3* value);
+
+#endif // F000341_H
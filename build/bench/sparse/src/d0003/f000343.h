@@ -0,0 +1,58 @@
+#ifndef F000343_H
+#define F000343_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S343_0;
+
+void s343_0_reset(S343_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S343_1;
+
+void s343_1_reset(S343_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S343_2;
+
+void s343_2_reset(S343_2* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S343_3;
+
+void s343_3_reset(S343_3* value);
+
+#endif // F000343_H
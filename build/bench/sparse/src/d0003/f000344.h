@@ -0,0 +1,58 @@
+#ifndef F000344_H
+#define F000344_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S344_0;
+
+void s344_0_reset(S344_0* value);
+
+typedef struct {
+    int field_0;
+    long field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+} S344_1;
+
+void s344_1_reset(S344_1* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S344_2;
+
+void s344_2_reset(S344_2* value);
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S344_3;
+
+void s344_3_reset(S344_3* value);
+
+#endif // F000344_H
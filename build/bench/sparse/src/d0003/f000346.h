@@ -0,0 +1,58 @@
+#ifndef F000346_H
+#define F000346_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S346_0;
+
+void s346_0_reset(S346_0* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S346_1;
+
+void s346_1_reset(S346_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S346_2;
+
+void s346_2_reset(S346_2* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S346_3;
+
+void s346_3_reset(S346_3* value);
+
+#endif // F000346_H
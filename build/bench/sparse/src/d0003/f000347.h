@@ -0,0 +1,58 @@
+#ifndef F000347_H
+#define F000347_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+} S347_0;
+
+void s347_0_reset(S347_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S347_1;
+
+void s347_1_reset(S347_1* value);
+
+typedef struct {
+    float field_0;
+    float field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S347_2;
+
+void s347_2_reset(S347_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S347_3;
+
+void s347_3_reset(S347_3* value);
+
+#endif // F000347_H
@@ -0,0 +1,58 @@
+#ifndef F000348_H
+#define F000348_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S348_0;
+
+void s348_0_reset(S348_0* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S348_1;
+
+void s348_1_reset(S348_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S348_2;
+
+void s348_2_reset(S348_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S348_3;
+
+void s348_3_reset(S348_3* value);
+
+#endif // F000348_H
@@ -0,0 +1,58 @@
+#ifndef F000349_H
+#define F000349_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S349_0;
+
+void s349_0_reset(S349_0* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S349_1;
+
+void s349_1_reset(S349_1* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S349_2;
+
+void s349_2_reset(S349_2* value);
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S349_3;
+
+void s349_3_reset(S349_3* value);
+
+#endif // F000349_H
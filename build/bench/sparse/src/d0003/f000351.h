@@ -0,0 +1,58 @@
+#ifndef F000351_H
+#define F000351_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S351_0;
+
+void s351_0_reset(S351_0* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S351_1;
+
+void s351_1_reset(S351_1* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+} S351_2;
+
+void s351_2_reset(S351_2* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S351_3;
+
+void s351_3_reset(S351_3* value);
+
+#endif // F000351_H
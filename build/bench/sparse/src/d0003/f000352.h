@@ -0,0 +1,58 @@
+#ifndef F000352_H
+#define F000352_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S352_0;
+
+void s352_0_reset(S352_0* value);
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S352_1;
+
+void s352_1_reset(S352_1* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S352_2;
+
+void s352_2_reset(S352_2* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    bool field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S352_3;
+
+void s352_3_reset(S352_3* value);
+
+#endif // F000352_H
@@ -0,0 +1,58 @@
+#ifndef F000353_H
+#define F000353_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S353_0;
+
+void s353_0_reset(S353_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S353_1;
+
+void s353_1_reset(S353_1* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S353_2;
+
+void s353_2_reset(S353_2* value);
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S353_3;
+
+void s353_3_reset(S353_3* value);
+
+#endif // F000353_H
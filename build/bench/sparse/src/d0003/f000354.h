@@ -0,0 +1,58 @@
+#ifndef F000354_H
+#define F000354_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S354_0;
+
+void s354_0_reset(S354_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S354_1;
+
+void s354_1_reset(S354_1* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S354_2;
+
+void s354_2_reset(S354_2* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S354_3;
+
+void s354_3_reset(S354_3* value);
+
+#endif // F000354_H
@@ -0,0 +1,58 @@
+#ifndef F000355_H
+#define F000355_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+} S355_0;
+
+void s355_0_reset(S355_0* value);
+
+typedef struct {
+    long field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S355_1;
+
+void s355_1_reset(S355_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S355_2;
+
+void s355_2_reset(S355_2* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S355_3;
+
+void s355_3_reset(S355_3* value);
+
+#endif // F000355_H
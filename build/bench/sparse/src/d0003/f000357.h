@@ -0,0 +1,58 @@
+#ifndef F000357_H
+#define F000357_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S357_0;
+
+void s357_0_reset(S357_0* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S357_1;
+
+void s357_1_reset(S357_1* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S357_2;
+
+void s357_2_reset(S357_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S357_3;
+
+void s357_3_reset(S357_3* value);
+
+#endif // F000357_H
@@ -0,0 +1,58 @@
+#ifndef F000358_H
+#define F000358_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S358_0;
+
+void s358_0_reset(S358_0* value);
+
+typedef struct {
+    int field_0;
+    float field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S358_1;
+
+void s358_1_reset(S358_1* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+} S358_2;
+
+void s358_2_reset(S358_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S358_3;
+
+void s358_3_reset(S358_3* value);
+
+#endif // F000358_H
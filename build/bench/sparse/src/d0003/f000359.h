@@ -0,0 +1,58 @@
+#ifndef F000359_H
+#define F000359_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S359_0;
+
+void s359_0_reset(S359_0* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S359_1;
+
+void s359_1_reset(S359_1* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+} S359_2;
+
+void s359_2_reset(S359_2* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+} S359_3;
+
+void s359_3_reset(S359_3* value);
+
+#endif // F000359_H
@@ -0,0 +1,50 @@
+#ifndef F000360_H
+#define F000360_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+} S360_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+} S360_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S360_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S360_3 derive_all();
+
+#endif // F000360_H
@@ -0,0 +1,58 @@
+#ifndef F000362_H
+#define F000362_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S362_0;
+
+void s362_0_reset(S362_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S362_1;
+
+void s362_1_reset(S362_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S362_2;
+
+void s362_2_reset(S362_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S362_3;
+
+void s362_3_reset(S362_3* value);
+
+#endif // F000362_H
@@ -0,0 +1,58 @@
+#ifndef F000363_H
+#define F000363_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S363_0;
+
+void s363_0_reset(S363_0* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S363_1;
+
+void s363_1_reset(S363_1* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S363_2;
+
+void s363_2_reset(S363_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S363_3;
+
+void s363_3_reset(S363_3* value);
+
+#endif // F000363_H
@@ -0,0 +1,58 @@
+#ifndef F000364_H
+#define F000364_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+} S364_0;
+
+void s364_0_reset(S364_0* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S364_1;
+
+void s364_1_reset(S364_1* value);
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S364_2;
+
+void s364_2_reset(S364_2* value);
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S364_3;
+
+void s364_3_reset(S364_3* value);
+
+#endif // F000364_H
@@ -0,0 +1,58 @@
+#ifndef F000365_H
+#define F000365_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S365_0;
+
+void s365_0_reset(S365_0* value);
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S365_1;
+
+void s365_1_reset(S365_1* value);
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+} S365_2;
+
+void s365_2_reset(S365_2* value);
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S365_3;
+
+void s365_3_reset(S365_3* value);
+
+#endif // F000365_H
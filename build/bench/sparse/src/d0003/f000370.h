@@ -0,0 +1,50 @@
+#ifndef F000370_H
+#define F000370_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    long field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S370_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S370_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+} S370_2 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S370_3 derive_all();
+
+#endif // F000370_H
@@ -0,0 +1,58 @@
+#ifndef F000371_H
+#define F000371_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+} S371_0;
+
+void s371_0_reset(S371_0* value);
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S371_1;
+
+void s371_1_reset(S371_1* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    int field_6;
+    double field_7; tag("Field7")
+} S371_2;
+
+void s371_2_reset(S371_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S371_3;
+
+void s371_3_reset(S371_3* value);
+
+#endif // F000371_H
@@ -0,0 +1,58 @@
+#ifndef F000372_H
+#define F000372_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+} S372_0;
+
+void s372_0_reset(S372_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S372_1;
+
+void s372_1_reset(S372_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S372_2;
+
+void s372_2_reset(S372_2* value);
+
+typedef struct {
+    int field_0;
+    int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S372_3;
+
+void s372_3_reset(S372_3* value);
+
+#endif // F000372_H
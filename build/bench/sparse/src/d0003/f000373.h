@@ -0,0 +1,58 @@
+#ifndef F000373_H
+#define F000373_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+} S373_0;
+
+void s373_0_reset(S373_0* value);
+
+typedef struct {
+    bool field_0;
+    const char* field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S373_1;
+
+void s373_1_reset(S373_1* value);
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S373_2;
+
+void s373_2_reset(S373_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+} S373_3;
+
+void s373_3_reset(S373_3* value);
+
+#endif // F000373_H
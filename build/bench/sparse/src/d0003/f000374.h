@@ -0,0 +1,58 @@
+#ifndef F000374_H
+#define F000374_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S374_0;
+
+void s374_0_reset(S374_0* value);
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S374_1;
+
+void s374_1_reset(S374_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S374_2;
+
+void s374_2_reset(S374_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S374_3;
+
+void s374_3_reset(S374_3* value);
+
+#endif // F000374_H
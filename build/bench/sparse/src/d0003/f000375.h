@@ -0,0 +1,58 @@
+#ifndef F000375_H
+#define F000375_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    float field_5;
+    long field_6;
+    float field_7; tag("Field7")
+} S375_0;
+
+void s375_0_reset(S375_0* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+} S375_1;
+
+void s375_1_reset(S375_1* value);
+
+typedef struct {
+    double field_0;
+    long field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S375_2;
+
+void s375_2_reset(S375_2* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S375_3;
+
+void s375_3_reset(S375_3* value);
+
+#endif // F000375_H
@@ -0,0 +1,58 @@
+#ifndef F000376_H
+#define F000376_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+} S376_0;
+
+void s376_0_reset(S376_0* value);
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S376_1;
+
+void s376_1_reset(S376_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+} S376_2;
+
+void s376_2_reset(S376_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    size_t field_6;
+    unsigned int field_7; tag("Field7")
+} S376_3;
+
+void s376_3_reset(S376_3* value);
+
+#endif // F000376_H
@@ -0,0 +1,58 @@
+#ifndef F000377_H
+#define F000377_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+} S377_0;
+
+void s377_0_reset(S377_0* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+} S377_1;
+
+void s377_1_reset(S377_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S377_2;
+
+void s377_2_reset(S377_2* value);
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S377_3;
+
+void s377_3_reset(S377_3* value);
+
+#endif // F000377_H
@@ -0,0 +1,58 @@
+#ifndef F000381_H
+#define F000381_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    double field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+} S381_0;
+
+void s381_0_reset(S381_0* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    bool field_2;
+    double field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S381_1;
+
+void s381_1_reset(S381_1* value);
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    const char* field_6;
+    int field_7; tag("Field7")
+} S381_2;
+
+void s381_2_reset(S381_2* value);
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    double field_6;
+    int field_7; tag("Field7")
+} S381_3;
+
+void s381_3_reset(S381_3* value);
+
+#endif // F000381_H
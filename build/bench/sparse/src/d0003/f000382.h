@@ -0,0 +1,58 @@
+#ifndef F000382_H
+#define F000382_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S382_0;
+
+void s382_0_reset(S382_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    int field_6;
+    long field_7; tag("Field7")
+} S382_1;
+
+void s382_1_reset(S382_1* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S382_2;
+
+void s382_2_reset(S382_2* value);
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+} S382_3;
+
+void s382_3_reset(S382_3* value);
+
+#endif // F000382_H
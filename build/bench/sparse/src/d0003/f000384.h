@@ -0,0 +1,58 @@
+#ifndef F000384_H
+#define F000384_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    int field_7; tag("Field7")
+} S384_0;
+
+void s384_0_reset(S384_0* value);
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+} S384_1;
+
+void s384_1_reset(S384_1* value);
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+} S384_2;
+
+void s384_2_reset(S384_2* value);
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S384_3;
+
+void s384_3_reset(S384_3* value);
+
+#endif // F000384_H
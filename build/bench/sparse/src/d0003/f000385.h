@@ -0,0 +1,58 @@
+#ifndef F000385_H
+#define F000385_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S385_0;
+
+void s385_0_reset(S385_0* value);
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+} S385_1;
+
+void s385_1_reset(S385_1* value);
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+} S385_2;
+
+void s385_2_reset(S385_2* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+} S385_3;
+
+void s385_3_reset(S385_3* value);
+
+#endif // F000385_H
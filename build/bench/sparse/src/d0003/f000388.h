@@ -0,0 +1,58 @@
+#ifndef F000388_H
+#define F000388_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S388_0;
+
+void s388_0_reset(S388_0* value);
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+} S388_1;
+
+void s388_1_reset(S388_1* value);
+
+typedef struct {
+    long field_0;
+    int field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S388_2;
+
+void s388_2_reset(S388_2* value);
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+} S388_3;
+
+void s388_3_reset(S388_3* value);
+
+#endif // F000388_H
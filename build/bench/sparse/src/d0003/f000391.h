@@ -0,0 +1,58 @@
+#ifndef F000391_H
+#define F000391_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S391_0;
+
+void s391_0_reset(S391_0* value);
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+} S391_1;
+
+void s391_1_reset(S391_1* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+} S391_2;
+
+void s391_2_reset(S391_2* value);
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    int field_6;
+    float field_7; tag("Field7")
+} S391_3;
+
+void s391_3_reset(S391_3* value);
+
+#endif // F000391_H
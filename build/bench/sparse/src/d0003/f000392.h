@@ -0,0 +1,58 @@
+#ifndef F000392_H
+#define F000392_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S392_0;
+
+void s392_0_reset(S392_0* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+} S392_1;
+
+void s392_1_reset(S392_1* value);
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    double field_6;
+    long field_7; tag("Field7")
+} S392_2;
+
+void s392_2_reset(S392_2* value);
+
+typedef struct {
+    long field_0;
+    const char* field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+} S392_3;
+
+void s392_3_reset(S392_3* value);
+
+#endif // F000392_H
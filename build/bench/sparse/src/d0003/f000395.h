@@ -0,0 +1,58 @@
+#ifndef F000395_H
+#define F000395_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+} S395_0;
+
+void s395_0_reset(S395_0* value);
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+} S395_1;
+
+void s395_1_reset(S395_1* value);
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    int field_7; tag("Field7")
+} S395_2;
+
+void s395_2_reset(S395_2* value);
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+} S395_3;
+
+void s395_3_reset(S395_3* value);
+
+#endif // F000395_H
@@ -0,0 +1,58 @@
+#ifndef F000396_H
+#define F000396_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+} S396_0;
+
+void s396_0_reset(S396_0* value);
+
+typedef struct {
+    float field_0;
+    int field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+} S396_1;
+
+void s396_1_reset(S396_1* value);
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+} S396_2;
+
+void s396_2_reset(S396_2* value);
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    double field_6;
+    float field_7; tag("Field7")
+} S396_3;
+
+void s396_3_reset(S396_3* value);
+
+#endif // F000396_H
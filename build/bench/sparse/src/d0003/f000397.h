@@ -0,0 +1,58 @@
+#ifndef F000397_H
+#define F000397_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    unsigned int field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+} S397_0;
+
+void s397_0_reset(S397_0* value);
+
+typedef struct {
+    long field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+} S397_1;
+
+void s397_1_reset(S397_1* value);
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S397_2;
+
+void s397_2_reset(S397_2* value);
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+} S397_3;
+
+void s397_3_reset(S397_3* value);
+
+#endif // F000397_H
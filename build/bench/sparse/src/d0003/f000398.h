@@ -0,0 +1,58 @@
+#ifndef F000398_H
+#define F000398_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    long field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+} S398_0;
+
+void s398_0_reset(S398_0* value);
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+} S398_1;
+
+void s398_1_reset(S398_1* value);
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+} S398_2;
+
+void s398_2_reset(S398_2* value);
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+} S398_3;
+
+void s398_3_reset(S398_3* value);
+
+#endif // F000398_H
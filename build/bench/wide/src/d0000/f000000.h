@@ -0,0 +1,274 @@
+#ifndef F000000_H
+#define F000000_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    double field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    bool field_12;
+    unsigned int field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    int field_17;
+    double field_18;
+    double field_19; tag("Field19")
+    const char* field_20;
+    double field_21;
+    const char* field_22;
+    size_t field_23; tag("Field23")
+    bool field_24;
+    double field_25;
+    float field_26;
+    long field_27; tag("Field27")
+    const char* field_28;
+    unsigned int field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    int field_33;
+    int field_34;
+    long field_35; tag("Field35")
+    bool field_36;
+    bool field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    double field_40;
+    bool field_41;
+    const char* field_42;
+    size_t field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    float field_46;
+    long field_47; tag("Field47")
+    float field_48;
+    float field_49;
+    const char* field_50;
+    const char* field_51; tag("Field51")
+    long field_52;
+    float field_53;
+    long field_54;
+    long field_55; tag("Field55")
+    long field_56;
+    long field_57;
+    const char* field_58;
+    float field_59; tag("Field59")
+    float field_60;
+    unsigned int field_61;
+    int field_62;
+    size_t field_63; tag("Field63")
+} S0_0 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    int field_9;
+    long field_10;
+    float field_11; tag("Field11")
+    unsigned int field_12;
+    float field_13;
+    size_t field_14;
+    int field_15; tag("Field15")
+    float field_16;
+    long field_17;
+    unsigned int field_18;
+    int field_19; tag("Field19")
+    long field_20;
+    long field_21;
+    size_t field_22;
+    size_t field_23; tag("Field23")
+    double field_24;
+    const char* field_25;
+    int field_26;
+    float field_27; tag("Field27")
+    size_t field_28;
+    double field_29;
+    int field_30;
+    bool field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    long field_36;
+    int field_37;
+    int field_38;
+    bool field_39; tag("Field39")
+    const char* field_40;
+    const char* field_41;
+    bool field_42;
+    double field_43; tag("Field43")
+    int field_44;
+    int field_45;
+    float field_46;
+    float field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    bool field_53;
+    size_t field_54;
+    unsigned int field_55; tag("Field55")
+    bool field_56;
+    unsigned int field_57;
+    float field_58;
+    int field_59; tag("Field59")
+    long field_60;
+    unsigned int field_61;
+    bool field_62;
+    float field_63; tag("Field63")
+} S0_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+    size_t field_8;
+    unsigned int field_9;
+    bool field_10;
+    long field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    const char* field_14;
+    unsigned int field_15; tag("Field15")
+    unsigned int field_16;
+    float field_17;
+    bool field_18;
+    bool field_19; tag("Field19")
+    double field_20;
+    float field_21;
+    unsigned int field_22;
+    float field_23; tag("Field23")
+    int field_24;
+    double field_25;
+    int field_26;
+    long field_27; tag("Field27")
+    size_t field_28;
+    size_t field_29;
+    unsigned int field_30;
+    double field_31; tag("Field31")
+    int field_32;
+    bool field_33;
+    long field_34;
+    size_t field_35; tag("Field35")
+    const char* field_36;
+    bool field_37;
+    unsigned int field_38;
+    bool field_39; tag("Field39")
+    size_t field_40;
+    float field_41;
+    long field_42;
+    unsigned int field_43; tag("Field43")
+    float field_44;
+    int field_45;
+    size_t field_46;
+    int field_47; tag("Field47")
+    unsigned int field_48;
+    float field_49;
+    unsigned int field_50;
+    int field_51; tag("Field51")
+    double field_52;
+    double field_53;
+    const char* field_54;
+    const char* field_55; tag("Field55")
+    bool field_56;
+    double field_57;
+    double field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    size_t field_61;
+    size_t field_62;
+    size_t field_63; tag("Field63")
+} S0_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    unsigned int field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    double field_10;
+    float field_11; tag("Field11")
+    long field_12;
+    bool field_13;
+    bool field_14;
+    int field_15; tag("Field15")
+    int field_16;
+    unsigned int field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    size_t field_20;
+    bool field_21;
+    unsigned int field_22;
+    int field_23; tag("Field23")
+    float field_24;
+    unsigned int field_25;
+    int field_26;
+    float field_27; tag("Field27")
+    const char* field_28;
+    unsigned int field_29;
+    size_t field_30;
+    const char* field_31; tag("Field31")
+    int field_32;
+    unsigned int field_33;
+    const char* field_34;
+    unsigned int field_35; tag("Field35")
+    size_t field_36;
+    float field_37;
+    float field_38;
+    int field_39; tag("Field39")
+    double field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    int field_46;
+    bool field_47; tag("Field47")
+    float field_48;
+    size_t field_49;
+    size_t field_50;
+    unsigned int field_51; tag("Field51")
+    const char* field_52;
+    float field_53;
+    unsigned int field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    long field_58;
+    size_t field_59; tag("Field59")
+    const char* field_60;
+    unsigned int field_61;
+    float field_62;
+    long field_63; tag("Field63")
+} S0_3 derive_all();
+
+#endif // F000000_H
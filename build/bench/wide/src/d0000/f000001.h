@@ -0,0 +1,274 @@
+#ifndef F000001_H
+#define F000001_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+    const char* field_8;
+    float field_9;
+    unsigned int field_10;
+    int field_11; tag("Field11")
+    unsigned int field_12;
+    size_t field_13;
+    bool field_14;
+    bool field_15; tag("Field15")
+    size_t field_16;
+    unsigned int field_17;
+    double field_18;
+    bool field_19; tag("Field19")
+    bool field_20;
+    float field_21;
+    float field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    size_t field_25;
+    int field_26;
+    size_t field_27; tag("Field27")
+    size_t field_28;
+    long field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    int field_32;
+    double field_33;
+    bool field_34;
+    unsigned int field_35; tag("Field35")
+    long field_36;
+    int field_37;
+    size_t field_38;
+    unsigned int field_39; tag("Field39")
+    size_t field_40;
+    bool field_41;
+    unsigned int field_42;
+    bool field_43; tag("Field43")
+    bool field_44;
+    double field_45;
+    int field_46;
+    long field_47; tag("Field47")
+    unsigned int field_48;
+    size_t field_49;
+    int field_50;
+    const char* field_51; tag("Field51")
+    unsigned int field_52;
+    int field_53;
+    double field_54;
+    unsigned int field_55; tag("Field55")
+    const char* field_56;
+    const char* field_57;
+    unsigned int field_58;
+    size_t field_59; tag("Field59")
+    float field_60;
+    int field_61;
+    float field_62;
+    bool field_63; tag("Field63")
+} S1_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    int field_6;
+    long field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    unsigned int field_10;
+    size_t field_11; tag("Field11")
+    int field_12;
+    unsigned int field_13;
+    long field_14;
+    unsigned int field_15; tag("Field15")
+    bool field_16;
+    int field_17;
+    unsigned int field_18;
+    const char* field_19; tag("Field19")
+    size_t field_20;
+    unsigned int field_21;
+    int field_22;
+    int field_23; tag("Field23")
+    int field_24;
+    bool field_25;
+    size_t field_26;
+    float field_27; tag("Field27")
+    int field_28;
+    bool field_29;
+    double field_30;
+    unsigned int field_31; tag("Field31")
+    size_t field_32;
+    float field_33;
+    const char* field_34;
+    unsigned int field_35; tag("Field35")
+    unsigned int field_36;
+    long field_37;
+    size_t field_38;
+    unsigned int field_39; tag("Field39")
+    unsigned int field_40;
+    const char* field_41;
+    float field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    unsigned int field_45;
+    int field_46;
+    bool field_47; tag("Field47")
+    float field_48;
+    unsigned int field_49;
+    long field_50;
+    bool field_51; tag("Field51")
+    size_t field_52;
+    const char* field_53;
+    float field_54;
+    long field_55; tag("Field55")
+    size_t field_56;
+    unsigned int field_57;
+    float field_58;
+    long field_59; tag("Field59")
+    bool field_60;
+    long field_61;
+    float field_62;
+    int field_63; tag("Field63")
+} S1_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    int field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    long field_9;
+    long field_10;
+    const char* field_11; tag("Field11")
+    double field_12;
+    size_t field_13;
+    int field_14;
+    bool field_15; tag("Field15")
+    int field_16;
+    size_t field_17;
+    unsigned int field_18;
+    long field_19; tag("Field19")
+    unsigned int field_20;
+    const char* field_21;
+    unsigned int field_22;
+    long field_23; tag("Field23")
+    int field_24;
+    int field_25;
+    const char* field_26;
+    unsigned int field_27; tag("Field27")
+    bool field_28;
+    float field_29;
+    float field_30;
+    size_t field_31; tag("Field31")
+    const char* field_32;
+    int field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    int field_36;
+    const char* field_37;
+    size_t field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    const char* field_41;
+    const char* field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    double field_45;
+    const char* field_46;
+    int field_47; tag("Field47")
+    float field_48;
+    bool field_49;
+    int field_50;
+    int field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    long field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    unsigned int field_57;
+    size_t field_58;
+    long field_59; tag("Field59")
+    double field_60;
+    size_t field_61;
+    bool field_62;
+    int field_63; tag("Field63")
+} S1_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    int field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+    bool field_8;
+    bool field_9;
+    float field_10;
+    double field_11; tag("Field11")
+    long field_12;
+    bool field_13;
+    long field_14;
+    bool field_15; tag("Field15")
+    float field_16;
+    unsigned int field_17;
+    long field_18;
+    const char* field_19; tag("Field19")
+    bool field_20;
+    const char* field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    bool field_24;
+    int field_25;
+    float field_26;
+    int field_27; tag("Field27")
+    int field_28;
+    size_t field_29;
+    double field_30;
+    int field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    const char* field_34;
+    bool field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    double field_38;
+    double field_39; tag("Field39")
+    const char* field_40;
+    long field_41;
+    size_t field_42;
+    float field_43; tag("Field43")
+    bool field_44;
+    double field_45;
+    const char* field_46;
+    size_t field_47; tag("Field47")
+    float field_48;
+    int field_49;
+    size_t field_50;
+    const char* field_51; tag("Field51")
+    unsigned int field_52;
+    double field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    size_t field_56;
+    const char* field_57;
+    double field_58;
+    double field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    long field_62;
+    unsigned int field_63; tag("Field63")
+} S1_3 derive_all();
+
+#endif // F000001_H
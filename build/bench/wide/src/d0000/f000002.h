@@ -0,0 +1,274 @@
+#ifndef F000002_H
+#define F000002_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    long field_7; tag("Field7")
+    double field_8;
+    int field_9;
+    bool field_10;
+    unsigned int field_11; tag("Field11")
+    double field_12;
+    float field_13;
+    double field_14;
+    float field_15; tag("Field15")
+    float field_16;
+    unsigned int field_17;
+    unsigned int field_18;
+    double field_19; tag("Field19")
+    long field_20;
+    bool field_21;
+    const char* field_22;
+    size_t field_23; tag("Field23")
+    int field_24;
+    const char* field_25;
+    bool field_26;
+    float field_27; tag("Field27")
+    float field_28;
+    bool field_29;
+    float field_30;
+    const char* field_31; tag("Field31")
+    unsigned int field_32;
+    size_t field_33;
+    float field_34;
+    unsigned int field_35; tag("Field35")
+    float field_36;
+    size_t field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    double field_40;
+    double field_41;
+    double field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    float field_45;
+    long field_46;
+    size_t field_47; tag("Field47")
+    float field_48;
+    bool field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    double field_52;
+    double field_53;
+    int field_54;
+    float field_55; tag("Field55")
+    const char* field_56;
+    float field_57;
+    double field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    size_t field_61;
+    unsigned int field_62;
+    bool field_63; tag("Field63")
+} S2_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    long field_6;
+    long field_7; tag("Field7")
+    size_t field_8;
+    double field_9;
+    int field_10;
+    int field_11; tag("Field11")
+    const char* field_12;
+    int field_13;
+    const char* field_14;
+    long field_15; tag("Field15")
+    bool field_16;
+    float field_17;
+    double field_18;
+    float field_19; tag("Field19")
+    long field_20;
+    bool field_21;
+    const char* field_22;
+    float field_23; tag("Field23")
+    size_t field_24;
+    size_t field_25;
+    const char* field_26;
+    size_t field_27; tag("Field27")
+    const char* field_28;
+    bool field_29;
+    float field_30;
+    long field_31; tag("Field31")
+    unsigned int field_32;
+    const char* field_33;
+    unsigned int field_34;
+    bool field_35; tag("Field35")
+    const char* field_36;
+    bool field_37;
+    long field_38;
+    int field_39; tag("Field39")
+    float field_40;
+    unsigned int field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    bool field_44;
+    int field_45;
+    unsigned int field_46;
+    long field_47; tag("Field47")
+    double field_48;
+    int field_49;
+    const char* field_50;
+    long field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    float field_54;
+    float field_55; tag("Field55")
+    bool field_56;
+    size_t field_57;
+    size_t field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    float field_61;
+    unsigned int field_62;
+    size_t field_63; tag("Field63")
+} S2_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    unsigned int field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+    double field_8;
+    float field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    double field_12;
+    float field_13;
+    float field_14;
+    const char* field_15; tag("Field15")
+    long field_16;
+    double field_17;
+    const char* field_18;
+    unsigned int field_19; tag("Field19")
+    float field_20;
+    float field_21;
+    int field_22;
+    int field_23; tag("Field23")
+    size_t field_24;
+    long field_25;
+    int field_26;
+    double field_27; tag("Field27")
+    size_t field_28;
+    double field_29;
+    double field_30;
+    unsigned int field_31; tag("Field31")
+    const char* field_32;
+    int field_33;
+    bool field_34;
+    long field_35; tag("Field35")
+    bool field_36;
+    size_t field_37;
+    size_t field_38;
+    unsigned int field_39; tag("Field39")
+    unsigned int field_40;
+    long field_41;
+    bool field_42;
+    float field_43; tag("Field43")
+    const char* field_44;
+    const char* field_45;
+    float field_46;
+    unsigned int field_47; tag("Field47")
+    long field_48;
+    int field_49;
+    unsigned int field_50;
+    float field_51; tag("Field51")
+    unsigned int field_52;
+    bool field_53;
+    size_t field_54;
+    long field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    const char* field_58;
+    bool field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    long field_62;
+    int field_63; tag("Field63")
+} S2_2 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    float field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    int field_14;
+    float field_15; tag("Field15")
+    size_t field_16;
+    bool field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    unsigned int field_20;
+    size_t field_21;
+    bool field_22;
+    long field_23; tag("Field23")
+    const char* field_24;
+    size_t field_25;
+    unsigned int field_26;
+    float field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    const char* field_30;
+    double field_31; tag("Field31")
+    unsigned int field_32;
+    unsigned int field_33;
+    unsigned int field_34;
+    unsigned int field_35; tag("Field35")
+    bool field_36;
+    long field_37;
+    size_t field_38;
+    bool field_39; tag("Field39")
+    bool field_40;
+    long field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    unsigned int field_44;
+    long field_45;
+    unsigned int field_46;
+    const char* field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    float field_50;
+    bool field_51; tag("Field51")
+    long field_52;
+    bool field_53;
+    double field_54;
+    long field_55; tag("Field55")
+    const char* field_56;
+    bool field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    float field_60;
+    int field_61;
+    const char* field_62;
+    int field_63; tag("Field63")
+} S2_3 derive_all();
+
+#endif // F000002_H
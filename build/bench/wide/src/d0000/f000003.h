@@ -0,0 +1,274 @@
+#ifndef F000003_H
+#define F000003_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    const char* field_8;
+    int field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    float field_12;
+    bool field_13;
+    double field_14;
+    int field_15; tag("Field15")
+    double field_16;
+    int field_17;
+    size_t field_18;
+    int field_19; tag("Field19")
+    const char* field_20;
+    size_t field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    float field_24;
+    float field_25;
+    unsigned int field_26;
+    unsigned int field_27; tag("Field27")
+    int field_28;
+    double field_29;
+    const char* field_30;
+    bool field_31; tag("Field31")
+    size_t field_32;
+    long field_33;
+    int field_34;
+    float field_35; tag("Field35")
+    size_t field_36;
+    long field_37;
+    bool field_38;
+    unsigned int field_39; tag("Field39")
+    size_t field_40;
+    double field_41;
+    int field_42;
+    double field_43; tag("Field43")
+    unsigned int field_44;
+    unsigned int field_45;
+    unsigned int field_46;
+    double field_47; tag("Field47")
+    size_t field_48;
+    unsigned int field_49;
+    float field_50;
+    double field_51; tag("Field51")
+    size_t field_52;
+    bool field_53;
+    int field_54;
+    int field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    long field_58;
+    long field_59; tag("Field59")
+    float field_60;
+    bool field_61;
+    unsigned int field_62;
+    const char* field_63; tag("Field63")
+} S3_0 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+    double field_8;
+    bool field_9;
+    size_t field_10;
+    const char* field_11; tag("Field11")
+    size_t field_12;
+    double field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    bool field_18;
+    long field_19; tag("Field19")
+    float field_20;
+    unsigned int field_21;
+    int field_22;
+    size_t field_23; tag("Field23")
+    float field_24;
+    int field_25;
+    int field_26;
+    size_t field_27; tag("Field27")
+    float field_28;
+    double field_29;
+    long field_30;
+    size_t field_31; tag("Field31")
+    float field_32;
+    int field_33;
+    float field_34;
+    double field_35; tag("Field35")
+    long field_36;
+    const char* field_37;
+    size_t field_38;
+    unsigned int field_39; tag("Field39")
+    float field_40;
+    long field_41;
+    size_t field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    long field_45;
+    float field_46;
+    bool field_47; tag("Field47")
+    double field_48;
+    long field_49;
+    bool field_50;
+    size_t field_51; tag("Field51")
+    const char* field_52;
+    size_t field_53;
+    long field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    float field_57;
+    long field_58;
+    double field_59; tag("Field59")
+    const char* field_60;
+    float field_61;
+    const char* field_62;
+    const char* field_63; tag("Field63")
+} S3_1 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    long field_6;
+    unsigned int field_7; tag("Field7")
+    float field_8;
+    bool field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    float field_12;
+    unsigned int field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    const char* field_16;
+    long field_17;
+    const char* field_18;
+    const char* field_19; tag("Field19")
+    double field_20;
+    bool field_21;
+    long field_22;
+    size_t field_23; tag("Field23")
+    double field_24;
+    int field_25;
+    const char* field_26;
+    long field_27; tag("Field27")
+    float field_28;
+    size_t field_29;
+    bool field_30;
+    const char* field_31; tag("Field31")
+    double field_32;
+    bool field_33;
+    long field_34;
+    size_t field_35; tag("Field35")
+    bool field_36;
+    const char* field_37;
+    bool field_38;
+    unsigned int field_39; tag("Field39")
+    bool field_40;
+    double field_41;
+    int field_42;
+    double field_43; tag("Field43")
+    unsigned int field_44;
+    unsigned int field_45;
+    bool field_46;
+    float field_47; tag("Field47")
+    unsigned int field_48;
+    bool field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    bool field_52;
+    unsigned int field_53;
+    size_t field_54;
+    long field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    unsigned int field_60;
+    double field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S3_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    int field_7; tag("Field7")
+    bool field_8;
+    unsigned int field_9;
+    int field_10;
+    bool field_11; tag("Field11")
+    bool field_12;
+    size_t field_13;
+    int field_14;
+    size_t field_15; tag("Field15")
+    double field_16;
+    unsigned int field_17;
+    double field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    bool field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    size_t field_24;
+    unsigned int field_25;
+    int field_26;
+    double field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    long field_30;
+    const char* field_31; tag("Field31")
+    long field_32;
+    bool field_33;
+    long field_34;
+    int field_35; tag("Field35")
+    const char* field_36;
+    bool field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    unsigned int field_40;
+    size_t field_41;
+    double field_42;
+    float field_43; tag("Field43")
+    unsigned int field_44;
+    const char* field_45;
+    long field_46;
+    int field_47; tag("Field47")
+    size_t field_48;
+    const char* field_49;
+    double field_50;
+    unsigned int field_51; tag("Field51")
+    double field_52;
+    float field_53;
+    const char* field_54;
+    float field_55; tag("Field55")
+    unsigned int field_56;
+    float field_57;
+    double field_58;
+    int field_59; tag("Field59")
+    bool field_60;
+    const char* field_61;
+    unsigned int field_62;
+    bool field_63; tag("Field63")
+} S3_3 derive_all();
+
+#endif // F000003_H
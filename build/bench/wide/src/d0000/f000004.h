@@ -0,0 +1,274 @@
+#ifndef F000004_H
+#define F000004_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    const char* field_1;
+    size_t field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+    bool field_8;
+    const char* field_9;
+    unsigned int field_10;
+    size_t field_11; tag("Field11")
+    unsigned int field_12;
+    float field_13;
+    double field_14;
+    bool field_15; tag("Field15")
+    int field_16;
+    double field_17;
+    bool field_18;
+    size_t field_19; tag("Field19")
+    long field_20;
+    const char* field_21;
+    int field_22;
+    bool field_23; tag("Field23")
+    long field_24;
+    long field_25;
+    double field_26;
+    int field_27; tag("Field27")
+    const char* field_28;
+    unsigned int field_29;
+    int field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    int field_33;
+    double field_34;
+    int field_35; tag("Field35")
+    double field_36;
+    unsigned int field_37;
+    const char* field_38;
+    double field_39; tag("Field39")
+    int field_40;
+    double field_41;
+    int field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    float field_45;
+    unsigned int field_46;
+    bool field_47; tag("Field47")
+    unsigned int field_48;
+    bool field_49;
+    bool field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    double field_53;
+    size_t field_54;
+    const char* field_55; tag("Field55")
+    int field_56;
+    double field_57;
+    bool field_58;
+    bool field_59; tag("Field59")
+    unsigned int field_60;
+    float field_61;
+    int field_62;
+    long field_63; tag("Field63")
+} S4_0 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+    bool field_8;
+    double field_9;
+    unsigned int field_10;
+    const char* field_11; tag("Field11")
+    int field_12;
+    float field_13;
+    int field_14;
+    float field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    size_t field_18;
+    double field_19; tag("Field19")
+    double field_20;
+    float field_21;
+    float field_22;
+    unsigned int field_23; tag("Field23")
+    int field_24;
+    int field_25;
+    double field_26;
+    int field_27; tag("Field27")
+    int field_28;
+    unsigned int field_29;
+    size_t field_30;
+    const char* field_31; tag("Field31")
+    unsigned int field_32;
+    long field_33;
+    size_t field_34;
+    bool field_35; tag("Field35")
+    float field_36;
+    bool field_37;
+    unsigned int field_38;
+    unsigned int field_39; tag("Field39")
+    const char* field_40;
+    float field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    const char* field_44;
+    int field_45;
+    float field_46;
+    const char* field_47; tag("Field47")
+    unsigned int field_48;
+    const char* field_49;
+    int field_50;
+    unsigned int field_51; tag("Field51")
+    size_t field_52;
+    size_t field_53;
+    size_t field_54;
+    double field_55; tag("Field55")
+    const char* field_56;
+    double field_57;
+    long field_58;
+    const char* field_59; tag("Field59")
+    int field_60;
+    int field_61;
+    size_t field_62;
+    const char* field_63; tag("Field63")
+} S4_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    float field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    double field_10;
+    double field_11; tag("Field11")
+    const char* field_12;
+    double field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    size_t field_16;
+    int field_17;
+    double field_18;
+    long field_19; tag("Field19")
+    int field_20;
+    bool field_21;
+    int field_22;
+    const char* field_23; tag("Field23")
+    size_t field_24;
+    unsigned int field_25;
+    unsigned int field_26;
+    double field_27; tag("Field27")
+    float field_28;
+    int field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    const char* field_32;
+    size_t field_33;
+    float field_34;
+    bool field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    size_t field_38;
+    bool field_39; tag("Field39")
+    size_t field_40;
+    float field_41;
+    long field_42;
+    long field_43; tag("Field43")
+    int field_44;
+    const char* field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    const char* field_48;
+    const char* field_49;
+    float field_50;
+    unsigned int field_51; tag("Field51")
+    unsigned int field_52;
+    long field_53;
+    int field_54;
+    float field_55; tag("Field55")
+    long field_56;
+    float field_57;
+    size_t field_58;
+    const char* field_59; tag("Field59")
+    unsigned int field_60;
+    double field_61;
+    float field_62;
+    double field_63; tag("Field63")
+} S4_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    size_t field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    long field_6;
+    float field_7; tag("Field7")
+    const char* field_8;
+    unsigned int field_9;
+    int field_10;
+    unsigned int field_11; tag("Field11")
+    long field_12;
+    size_t field_13;
+    int field_14;
+    double field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    const char* field_18;
+    long field_19; tag("Field19")
+    bool field_20;
+    double field_21;
+    size_t field_22;
+    bool field_23; tag("Field23")
+    double field_24;
+    int field_25;
+    bool field_26;
+    const char* field_27; tag("Field27")
+    int field_28;
+    float field_29;
+    bool field_30;
+    double field_31; tag("Field31")
+    int field_32;
+    unsigned int field_33;
+    bool field_34;
+    float field_35; tag("Field35")
+    int field_36;
+    float field_37;
+    int field_38;
+    size_t field_39; tag("Field39")
+    const char* field_40;
+    double field_41;
+    const char* field_42;
+    double field_43; tag("Field43")
+    size_t field_44;
+    int field_45;
+    float field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    bool field_49;
+    int field_50;
+    double field_51; tag("Field51")
+    bool field_52;
+    const char* field_53;
+    long field_54;
+    float field_55; tag("Field55")
+    unsigned int field_56;
+    size_t field_57;
+    double field_58;
+    double field_59; tag("Field59")
+    unsigned int field_60;
+    float field_61;
+    float field_62;
+    int field_63; tag("Field63")
+} S4_3 derive_all();
+
+#endif // F000004_H
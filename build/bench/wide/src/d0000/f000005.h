@@ -0,0 +1,274 @@
+#ifndef F000005_H
+#define F000005_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    float field_6;
+    long field_7; tag("Field7")
+    double field_8;
+    const char* field_9;
+    size_t field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    float field_14;
+    size_t field_15; tag("Field15")
+    bool field_16;
+    size_t field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    double field_20;
+    float field_21;
+    double field_22;
+    float field_23; tag("Field23")
+    size_t field_24;
+    const char* field_25;
+    long field_26;
+    float field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    double field_30;
+    size_t field_31; tag("Field31")
+    unsigned int field_32;
+    double field_33;
+    long field_34;
+    const char* field_35; tag("Field35")
+    size_t field_36;
+    const char* field_37;
+    double field_38;
+    bool field_39; tag("Field39")
+    const char* field_40;
+    int field_41;
+    long field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    long field_45;
+    int field_46;
+    long field_47; tag("Field47")
+    long field_48;
+    float field_49;
+    double field_50;
+    const char* field_51; tag("Field51")
+    unsigned int field_52;
+    double field_53;
+    double field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    const char* field_57;
+    int field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    const char* field_61;
+    bool field_62;
+    unsigned int field_63; tag("Field63")
+} S5_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+    unsigned int field_8;
+    const char* field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    long field_12;
+    size_t field_13;
+    bool field_14;
+    size_t field_15; tag("Field15")
+    bool field_16;
+    size_t field_17;
+    size_t field_18;
+    double field_19; tag("Field19")
+    bool field_20;
+    const char* field_21;
+    bool field_22;
+    size_t field_23; tag("Field23")
+    double field_24;
+    long field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    double field_29;
+    const char* field_30;
+    bool field_31; tag("Field31")
+    bool field_32;
+    float field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    unsigned int field_37;
+    const char* field_38;
+    unsigned int field_39; tag("Field39")
+    double field_40;
+    float field_41;
+    double field_42;
+    long field_43; tag("Field43")
+    const char* field_44;
+    int field_45;
+    int field_46;
+    size_t field_47; tag("Field47")
+    double field_48;
+    long field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    size_t field_52;
+    const char* field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    double field_56;
+    double field_57;
+    const char* field_58;
+    long field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    size_t field_62;
+    unsigned int field_63; tag("Field63")
+} S5_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    int field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+    double field_8;
+    float field_9;
+    double field_10;
+    bool field_11; tag("Field11")
+    long field_12;
+    const char* field_13;
+    size_t field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    size_t field_17;
+    unsigned int field_18;
+    unsigned int field_19; tag("Field19")
+    bool field_20;
+    double field_21;
+    float field_22;
+    int field_23; tag("Field23")
+    const char* field_24;
+    unsigned int field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    long field_28;
+    int field_29;
+    unsigned int field_30;
+    unsigned int field_31; tag("Field31")
+    bool field_32;
+    float field_33;
+    int field_34;
+    unsigned int field_35; tag("Field35")
+    long field_36;
+    long field_37;
+    const char* field_38;
+    unsigned int field_39; tag("Field39")
+    double field_40;
+    long field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    const char* field_44;
+    double field_45;
+    unsigned int field_46;
+    int field_47; tag("Field47")
+    int field_48;
+    const char* field_49;
+    const char* field_50;
+    float field_51; tag("Field51")
+    float field_52;
+    const char* field_53;
+    bool field_54;
+    float field_55; tag("Field55")
+    float field_56;
+    float field_57;
+    bool field_58;
+    size_t field_59; tag("Field59")
+    bool field_60;
+    bool field_61;
+    const char* field_62;
+    long field_63; tag("Field63")
+} S5_2 derive_all();
+
+typedef struct {
+    int field_0;
+    float field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+    const char* field_8;
+    double field_9;
+    double field_10;
+    long field_11; tag("Field11")
+    unsigned int field_12;
+    float field_13;
+    unsigned int field_14;
+    int field_15; tag("Field15")
+    bool field_16;
+    double field_17;
+    int field_18;
+    double field_19; tag("Field19")
+    long field_20;
+    float field_21;
+    long field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    size_t field_25;
+    long field_26;
+    unsigned int field_27; tag("Field27")
+    unsigned int field_28;
+    unsigned int field_29;
+    int field_30;
+    size_t field_31; tag("Field31")
+    int field_32;
+    const char* field_33;
+    double field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    const char* field_37;
+    bool field_38;
+    size_t field_39; tag("Field39")
+    int field_40;
+    float field_41;
+    size_t field_42;
+    float field_43; tag("Field43")
+    const char* field_44;
+    float field_45;
+    bool field_46;
+    long field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    unsigned int field_50;
+    bool field_51; tag("Field51")
+    long field_52;
+    bool field_53;
+    int field_54;
+    unsigned int field_55; tag("Field55")
+    long field_56;
+    int field_57;
+    long field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    bool field_61;
+    size_t field_62;
+    const char* field_63; tag("Field63")
+} S5_3 derive_all();
+
+#endif // F000005_H
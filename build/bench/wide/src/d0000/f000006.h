@@ -0,0 +1,274 @@
+#ifndef F000006_H
+#define F000006_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    float field_6;
+    long field_7; tag("Field7")
+    unsigned int field_8;
+    double field_9;
+    const char* field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    unsigned int field_13;
+    double field_14;
+    bool field_15; tag("Field15")
+    unsigned int field_16;
+    int field_17;
+    long field_18;
+    unsigned int field_19; tag("Field19")
+    const char* field_20;
+    float field_21;
+    size_t field_22;
+    float field_23; tag("Field23")
+    long field_24;
+    float field_25;
+    size_t field_26;
+    unsigned int field_27; tag("Field27")
+    bool field_28;
+    float field_29;
+    int field_30;
+    double field_31; tag("Field31")
+    double field_32;
+    long field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    double field_36;
+    double field_37;
+    size_t field_38;
+    long field_39; tag("Field39")
+    unsigned int field_40;
+    int field_41;
+    bool field_42;
+    const char* field_43; tag("Field43")
+    bool field_44;
+    unsigned int field_45;
+    unsigned int field_46;
+    int field_47; tag("Field47")
+    const char* field_48;
+    size_t field_49;
+    const char* field_50;
+    double field_51; tag("Field51")
+    size_t field_52;
+    unsigned int field_53;
+    size_t field_54;
+    bool field_55; tag("Field55")
+    unsigned int field_56;
+    long field_57;
+    bool field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    double field_61;
+    size_t field_62;
+    size_t field_63; tag("Field63")
+} S6_0 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+    bool field_8;
+    long field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    double field_14;
+    const char* field_15; tag("Field15")
+    unsigned int field_16;
+    double field_17;
+    const char* field_18;
+    int field_19; tag("Field19")
+    unsigned int field_20;
+    const char* field_21;
+    long field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    size_t field_25;
+    long field_26;
+    double field_27; tag("Field27")
+    int field_28;
+    long field_29;
+    size_t field_30;
+    bool field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    int field_36;
+    bool field_37;
+    float field_38;
+    const char* field_39; tag("Field39")
+    unsigned int field_40;
+    int field_41;
+    double field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    double field_45;
+    bool field_46;
+    bool field_47; tag("Field47")
+    long field_48;
+    bool field_49;
+    size_t field_50;
+    long field_51; tag("Field51")
+    const char* field_52;
+    const char* field_53;
+    double field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    int field_57;
+    float field_58;
+    size_t field_59; tag("Field59")
+    float field_60;
+    float field_61;
+    double field_62;
+    const char* field_63; tag("Field63")
+} S6_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+    unsigned int field_8;
+    const char* field_9;
+    bool field_10;
+    int field_11; tag("Field11")
+    bool field_12;
+    const char* field_13;
+    const char* field_14;
+    float field_15; tag("Field15")
+    double field_16;
+    bool field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    float field_20;
+    float field_21;
+    unsigned int field_22;
+    int field_23; tag("Field23")
+    unsigned int field_24;
+    size_t field_25;
+    float field_26;
+    const char* field_27; tag("Field27")
+    double field_28;
+    bool field_29;
+    const char* field_30;
+    int field_31; tag("Field31")
+    size_t field_32;
+    unsigned int field_33;
+    unsigned int field_34;
+    int field_35; tag("Field35")
+    const char* field_36;
+    double field_37;
+    const char* field_38;
+    bool field_39; tag("Field39")
+    const char* field_40;
+    int field_41;
+    const char* field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    bool field_46;
+    const char* field_47; tag("Field47")
+    double field_48;
+    size_t field_49;
+    double field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    size_t field_53;
+    float field_54;
+    bool field_55; tag("Field55")
+    float field_56;
+    float field_57;
+    long field_58;
+    const char* field_59; tag("Field59")
+    double field_60;
+    bool field_61;
+    long field_62;
+    float field_63; tag("Field63")
+} S6_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    int field_8;
+    float field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    size_t field_12;
+    const char* field_13;
+    bool field_14;
+    int field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    size_t field_18;
+    unsigned int field_19; tag("Field19")
+    int field_20;
+    double field_21;
+    unsigned int field_22;
+    size_t field_23; tag("Field23")
+    int field_24;
+    const char* field_25;
+    float field_26;
+    size_t field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    size_t field_30;
+    int field_31; tag("Field31")
+    size_t field_32;
+    const char* field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    long field_37;
+    bool field_38;
+    long field_39; tag("Field39")
+    bool field_40;
+    float field_41;
+    unsigned int field_42;
+    int field_43; tag("Field43")
+    const char* field_44;
+    size_t field_45;
+    double field_46;
+    unsigned int field_47; tag("Field47")
+    const char* field_48;
+    double field_49;
+    size_t field_50;
+    long field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    const char* field_54;
+    size_t field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    float field_58;
+    float field_59; tag("Field59")
+    int field_60;
+    const char* field_61;
+    bool field_62;
+    size_t field_63; tag("Field63")
+} S6_3 derive_all();
+
+#endif // F000006_H
@@ -0,0 +1,274 @@
+#ifndef F000007_H
+#define F000007_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    float field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    long field_6;
+    double field_7; tag("Field7")
+    float field_8;
+    size_t field_9;
+    size_t field_10;
+    int field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    double field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    float field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    float field_21;
+    float field_22;
+    unsigned int field_23; tag("Field23")
+    float field_24;
+    int field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    unsigned int field_29;
+    const char* field_30;
+    long field_31; tag("Field31")
+    unsigned int field_32;
+    bool field_33;
+    const char* field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    bool field_37;
+    size_t field_38;
+    bool field_39; tag("Field39")
+    float field_40;
+    const char* field_41;
+    float field_42;
+    double field_43; tag("Field43")
+    unsigned int field_44;
+    long field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    double field_48;
+    const char* field_49;
+    int field_50;
+    long field_51; tag("Field51")
+    bool field_52;
+    const char* field_53;
+    size_t field_54;
+    size_t field_55; tag("Field55")
+    long field_56;
+    double field_57;
+    size_t field_58;
+    float field_59; tag("Field59")
+    size_t field_60;
+    float field_61;
+    bool field_62;
+    long field_63; tag("Field63")
+} S7_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+    int field_8;
+    size_t field_9;
+    long field_10;
+    long field_11; tag("Field11")
+    double field_12;
+    unsigned int field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    const char* field_16;
+    float field_17;
+    const char* field_18;
+    unsigned int field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    double field_22;
+    size_t field_23; tag("Field23")
+    const char* field_24;
+    int field_25;
+    float field_26;
+    int field_27; tag("Field27")
+    size_t field_28;
+    int field_29;
+    float field_30;
+    double field_31; tag("Field31")
+    float field_32;
+    const char* field_33;
+    const char* field_34;
+    long field_35; tag("Field35")
+    const char* field_36;
+    bool field_37;
+    float field_38;
+    unsigned int field_39; tag("Field39")
+    int field_40;
+    unsigned int field_41;
+    double field_42;
+    const char* field_43; tag("Field43")
+    float field_44;
+    size_t field_45;
+    int field_46;
+    float field_47; tag("Field47")
+    const char* field_48;
+    int field_49;
+    int field_50;
+    const char* field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    long field_54;
+    long field_55; tag("Field55")
+    int field_56;
+    long field_57;
+    unsigned int field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    double field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S7_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+    float field_8;
+    double field_9;
+    float field_10;
+    long field_11; tag("Field11")
+    float field_12;
+    unsigned int field_13;
+    unsigned int field_14;
+    const char* field_15; tag("Field15")
+    long field_16;
+    float field_17;
+    float field_18;
+    long field_19; tag("Field19")
+    bool field_20;
+    long field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    float field_24;
+    const char* field_25;
+    size_t field_26;
+    unsigned int field_27; tag("Field27")
+    int field_28;
+    unsigned int field_29;
+    size_t field_30;
+    const char* field_31; tag("Field31")
+    unsigned int field_32;
+    unsigned int field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    float field_36;
+    int field_37;
+    long field_38;
+    float field_39; tag("Field39")
+    const char* field_40;
+    const char* field_41;
+    size_t field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    bool field_46;
+    long field_47; tag("Field47")
+    bool field_48;
+    float field_49;
+    double field_50;
+    size_t field_51; tag("Field51")
+    int field_52;
+    float field_53;
+    size_t field_54;
+    unsigned int field_55; tag("Field55")
+    long field_56;
+    size_t field_57;
+    double field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    float field_61;
+    long field_62;
+    bool field_63; tag("Field63")
+} S7_2 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    float field_6;
+    int field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    size_t field_14;
+    size_t field_15; tag("Field15")
+    const char* field_16;
+    float field_17;
+    int field_18;
+    long field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    unsigned int field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    bool field_25;
+    int field_26;
+    long field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    float field_30;
+    double field_31; tag("Field31")
+    size_t field_32;
+    long field_33;
+    int field_34;
+    float field_35; tag("Field35")
+    size_t field_36;
+    size_t field_37;
+    const char* field_38;
+    size_t field_39; tag("Field39")
+    int field_40;
+    bool field_41;
+    double field_42;
+    size_t field_43; tag("Field43")
+    double field_44;
+    double field_45;
+    bool field_46;
+    int field_47; tag("Field47")
+    bool field_48;
+    const char* field_49;
+    bool field_50;
+    float field_51; tag("Field51")
+    const char* field_52;
+    long field_53;
+    size_t field_54;
+    size_t field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    float field_58;
+    long field_59; tag("Field59")
+    int field_60;
+    unsigned int field_61;
+    const char* field_62;
+    int field_63; tag("Field63")
+} S7_3 derive_all();
+
+#endif // F000007_H
@@ -0,0 +1,274 @@
+#ifndef F000008_H
+#define F000008_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    const char* field_7; tag("Field7")
+    unsigned int field_8;
+    unsigned int field_9;
+    bool field_10;
+    int field_11; tag("Field11")
+    const char* field_12;
+    int field_13;
+    double field_14;
+    long field_15; tag("Field15")
+    float field_16;
+    long field_17;
+    unsigned int field_18;
+    int field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    const char* field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    double field_25;
+    double field_26;
+    float field_27; tag("Field27")
+    unsigned int field_28;
+    long field_29;
+    double field_30;
+    long field_31; tag("Field31")
+    int field_32;
+    bool field_33;
+    float field_34;
+    size_t field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    bool field_38;
+    float field_39; tag("Field39")
+    bool field_40;
+    float field_41;
+    size_t field_42;
+    const char* field_43; tag("Field43")
+    bool field_44;
+    bool field_45;
+    bool field_46;
+    const char* field_47; tag("Field47")
+    const char* field_48;
+    float field_49;
+    const char* field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    float field_53;
+    unsigned int field_54;
+    bool field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    bool field_60;
+    long field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S8_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+    const char* field_8;
+    float field_9;
+    int field_10;
+    long field_11; tag("Field11")
+    size_t field_12;
+    unsigned int field_13;
+    bool field_14;
+    float field_15; tag("Field15")
+    double field_16;
+    bool field_17;
+    double field_18;
+    unsigned int field_19; tag("Field19")
+    long field_20;
+    size_t field_21;
+    unsigned int field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    bool field_25;
+    size_t field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    float field_29;
+    float field_30;
+    float field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    double field_34;
+    int field_35; tag("Field35")
+    float field_36;
+    size_t field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    int field_41;
+    int field_42;
+    size_t field_43; tag("Field43")
+    int field_44;
+    bool field_45;
+    unsigned int field_46;
+    const char* field_47; tag("Field47")
+    long field_48;
+    const char* field_49;
+    float field_50;
+    float field_51; tag("Field51")
+    unsigned int field_52;
+    const char* field_53;
+    const char* field_54;
+    bool field_55; tag("Field55")
+    size_t field_56;
+    unsigned int field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    size_t field_60;
+    int field_61;
+    bool field_62;
+    int field_63; tag("Field63")
+} S8_1 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    double field_7; tag("Field7")
+    size_t field_8;
+    const char* field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    const char* field_12;
+    bool field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    long field_16;
+    bool field_17;
+    float field_18;
+    float field_19; tag("Field19")
+    double field_20;
+    float field_21;
+    size_t field_22;
+    size_t field_23; tag("Field23")
+    int field_24;
+    size_t field_25;
+    float field_26;
+    long field_27; tag("Field27")
+    bool field_28;
+    const char* field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    double field_32;
+    const char* field_33;
+    int field_34;
+    unsigned int field_35; tag("Field35")
+    size_t field_36;
+    bool field_37;
+    bool field_38;
+    double field_39; tag("Field39")
+    size_t field_40;
+    double field_41;
+    int field_42;
+    unsigned int field_43; tag("Field43")
+    const char* field_44;
+    long field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    long field_48;
+    double field_49;
+    const char* field_50;
+    bool field_51; tag("Field51")
+    unsigned int field_52;
+    long field_53;
+    int field_54;
+    unsigned int field_55; tag("Field55")
+    double field_56;
+    unsigned int field_57;
+    size_t field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    unsigned int field_61;
+    double field_62;
+    float field_63; tag("Field63")
+} S8_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    int field_7; tag("Field7")
+    float field_8;
+    float field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    size_t field_13;
+    bool field_14;
+    const char* field_15; tag("Field15")
+    double field_16;
+    int field_17;
+    float field_18;
+    int field_19; tag("Field19")
+    size_t field_20;
+    size_t field_21;
+    float field_22;
+    const char* field_23; tag("Field23")
+    bool field_24;
+    double field_25;
+    unsigned int field_26;
+    int field_27; tag("Field27")
+    bool field_28;
+    unsigned int field_29;
+    float field_30;
+    size_t field_31; tag("Field31")
+    const char* field_32;
+    long field_33;
+    float field_34;
+    long field_35; tag("Field35")
+    double field_36;
+    bool field_37;
+    unsigned int field_38;
+    const char* field_39; tag("Field39")
+    bool field_40;
+    float field_41;
+    bool field_42;
+    int field_43; tag("Field43")
+    long field_44;
+    int field_45;
+    const char* field_46;
+    bool field_47; tag("Field47")
+    double field_48;
+    float field_49;
+    bool field_50;
+    unsigned int field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    size_t field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    bool field_60;
+    size_t field_61;
+    double field_62;
+    bool field_63; tag("Field63")
+} S8_3 derive_all();
+
+#endif // F000008_H
@@ -0,0 +1,274 @@
+#ifndef F000009_H
+#define F000009_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    float field_6;
+    float field_7; tag("Field7")
+    float field_8;
+    bool field_9;
+    size_t field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    double field_13;
+    long field_14;
+    size_t field_15; tag("Field15")
+    unsigned int field_16;
+    const char* field_17;
+    long field_18;
+    int field_19; tag("Field19")
+    double field_20;
+    long field_21;
+    bool field_22;
+    double field_23; tag("Field23")
+    double field_24;
+    bool field_25;
+    int field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    int field_30;
+    long field_31; tag("Field31")
+    size_t field_32;
+    unsigned int field_33;
+    long field_34;
+    float field_35; tag("Field35")
+    bool field_36;
+    const char* field_37;
+    int field_38;
+    const char* field_39; tag("Field39")
+    int field_40;
+    bool field_41;
+    float field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    unsigned int field_45;
+    double field_46;
+    size_t field_47; tag("Field47")
+    long field_48;
+    double field_49;
+    double field_50;
+    long field_51; tag("Field51")
+    float field_52;
+    float field_53;
+    size_t field_54;
+    int field_55; tag("Field55")
+    int field_56;
+    unsigned int field_57;
+    float field_58;
+    bool field_59; tag("Field59")
+    const char* field_60;
+    float field_61;
+    size_t field_62;
+    float field_63; tag("Field63")
+} S9_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    double field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    double field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    float field_10;
+    unsigned int field_11; tag("Field11")
+    float field_12;
+    int field_13;
+    unsigned int field_14;
+    double field_15; tag("Field15")
+    long field_16;
+    float field_17;
+    size_t field_18;
+    float field_19; tag("Field19")
+    float field_20;
+    int field_21;
+    long field_22;
+    bool field_23; tag("Field23")
+    bool field_24;
+    bool field_25;
+    const char* field_26;
+    bool field_27; tag("Field27")
+    const char* field_28;
+    double field_29;
+    double field_30;
+    int field_31; tag("Field31")
+    double field_32;
+    const char* field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    const char* field_38;
+    const char* field_39; tag("Field39")
+    long field_40;
+    unsigned int field_41;
+    float field_42;
+    float field_43; tag("Field43")
+    double field_44;
+    bool field_45;
+    const char* field_46;
+    bool field_47; tag("Field47")
+    const char* field_48;
+    float field_49;
+    size_t field_50;
+    const char* field_51; tag("Field51")
+    size_t field_52;
+    unsigned int field_53;
+    size_t field_54;
+    bool field_55; tag("Field55")
+    float field_56;
+    long field_57;
+    long field_58;
+    bool field_59; tag("Field59")
+    size_t field_60;
+    float field_61;
+    int field_62;
+    int field_63; tag("Field63")
+} S9_1 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+    size_t field_8;
+    int field_9;
+    long field_10;
+    int field_11; tag("Field11")
+    int field_12;
+    double field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    bool field_16;
+    unsigned int field_17;
+    double field_18;
+    float field_19; tag("Field19")
+    bool field_20;
+    size_t field_21;
+    bool field_22;
+    size_t field_23; tag("Field23")
+    double field_24;
+    float field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    float field_28;
+    const char* field_29;
+    const char* field_30;
+    size_t field_31; tag("Field31")
+    unsigned int field_32;
+    double field_33;
+    size_t field_34;
+    double field_35; tag("Field35")
+    size_t field_36;
+    float field_37;
+    int field_38;
+    size_t field_39; tag("Field39")
+    float field_40;
+    int field_41;
+    unsigned int field_42;
+    float field_43; tag("Field43")
+    float field_44;
+    long field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    long field_48;
+    long field_49;
+    int field_50;
+    const char* field_51; tag("Field51")
+    int field_52;
+    float field_53;
+    const char* field_54;
+    long field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    const char* field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    size_t field_61;
+    int field_62;
+    long field_63; tag("Field63")
+} S9_2 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+    double field_8;
+    double field_9;
+    const char* field_10;
+    long field_11; tag("Field11")
+    bool field_12;
+    double field_13;
+    float field_14;
+    float field_15; tag("Field15")
+    size_t field_16;
+    double field_17;
+    unsigned int field_18;
+    unsigned int field_19; tag("Field19")
+    const char* field_20;
+    const char* field_21;
+    double field_22;
+    double field_23; tag("Field23")
+    bool field_24;
+    int field_25;
+    double field_26;
+    unsigned int field_27; tag("Field27")
+    size_t field_28;
+    size_t field_29;
+    int field_30;
+    int field_31; tag("Field31")
+    const char* field_32;
+    const char* field_33;
+    const char* field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    const char* field_37;
+    double field_38;
+    float field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    long field_43; tag("Field43")
+    size_t field_44;
+    long field_45;
+    unsigned int field_46;
+    bool field_47; tag("Field47")
+    size_t field_48;
+    double field_49;
+    size_t field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    double field_53;
+    unsigned int field_54;
+    unsigned int field_55; tag("Field55")
+    bool field_56;
+    const char* field_57;
+    size_t field_58;
+    float field_59; tag("Field59")
+    const char* field_60;
+    bool field_61;
+    double field_62;
+    double field_63; tag("Field63")
+} S9_3 derive_all();
+
+#endif // F000009_H
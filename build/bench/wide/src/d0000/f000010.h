@@ -0,0 +1,274 @@
+#ifndef F000010_H
+#define F000010_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+    float field_8;
+    float field_9;
+    int field_10;
+    const char* field_11; tag("Field11")
+    const char* field_12;
+    const char* field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    double field_16;
+    size_t field_17;
+    int field_18;
+    float field_19; tag("Field19")
+    int field_20;
+    const char* field_21;
+    const char* field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    double field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    long field_28;
+    unsigned int field_29;
+    const char* field_30;
+    float field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    size_t field_34;
+    unsigned int field_35; tag("Field35")
+    int field_36;
+    unsigned int field_37;
+    unsigned int field_38;
+    long field_39; tag("Field39")
+    const char* field_40;
+    long field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    const char* field_45;
+    double field_46;
+    bool field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    long field_50;
+    bool field_51; tag("Field51")
+    double field_52;
+    size_t field_53;
+    unsigned int field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    unsigned int field_58;
+    long field_59; tag("Field59")
+    bool field_60;
+    unsigned int field_61;
+    int field_62;
+    const char* field_63; tag("Field63")
+} S10_0 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    size_t field_6;
+    double field_7; tag("Field7")
+    const char* field_8;
+    long field_9;
+    int field_10;
+    long field_11; tag("Field11")
+    bool field_12;
+    const char* field_13;
+    unsigned int field_14;
+    double field_15; tag("Field15")
+    unsigned int field_16;
+    int field_17;
+    size_t field_18;
+    int field_19; tag("Field19")
+    float field_20;
+    size_t field_21;
+    long field_22;
+    int field_23; tag("Field23")
+    float field_24;
+    bool field_25;
+    double field_26;
+    size_t field_27; tag("Field27")
+    size_t field_28;
+    size_t field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    float field_32;
+    const char* field_33;
+    unsigned int field_34;
+    long field_35; tag("Field35")
+    const char* field_36;
+    size_t field_37;
+    size_t field_38;
+    double field_39; tag("Field39")
+    float field_40;
+    bool field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    size_t field_45;
+    long field_46;
+    int field_47; tag("Field47")
+    float field_48;
+    unsigned int field_49;
+    float field_50;
+    size_t field_51; tag("Field51")
+    size_t field_52;
+    const char* field_53;
+    const char* field_54;
+    double field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    long field_61;
+    bool field_62;
+    long field_63; tag("Field63")
+} S10_1 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+    long field_8;
+    const char* field_9;
+    size_t field_10;
+    float field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    size_t field_14;
+    bool field_15; tag("Field15")
+    const char* field_16;
+    float field_17;
+    double field_18;
+    int field_19; tag("Field19")
+    float field_20;
+    double field_21;
+    int field_22;
+    bool field_23; tag("Field23")
+    float field_24;
+    int field_25;
+    bool field_26;
+    bool field_27; tag("Field27")
+    bool field_28;
+    size_t field_29;
+    size_t field_30;
+    size_t field_31; tag("Field31")
+    float field_32;
+    const char* field_33;
+    size_t field_34;
+    size_t field_35; tag("Field35")
+    const char* field_36;
+    long field_37;
+    double field_38;
+    float field_39; tag("Field39")
+    double field_40;
+    float field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    float field_45;
+    long field_46;
+    const char* field_47; tag("Field47")
+    size_t field_48;
+    double field_49;
+    long field_50;
+    long field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    bool field_54;
+    unsigned int field_55; tag("Field55")
+    bool field_56;
+    bool field_57;
+    size_t field_58;
+    bool field_59; tag("Field59")
+    long field_60;
+    float field_61;
+    size_t field_62;
+    double field_63; tag("Field63")
+} S10_2 derive_all();
+
+typedef struct {
+    float field_0;
+    long field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+    unsigned int field_8;
+    float field_9;
+    int field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    size_t field_13;
+    size_t field_14;
+    unsigned int field_15; tag("Field15")
+    const char* field_16;
+    size_t field_17;
+    double field_18;
+    long field_19; tag("Field19")
+    unsigned int field_20;
+    int field_21;
+    float field_22;
+    bool field_23; tag("Field23")
+    bool field_24;
+    long field_25;
+    long field_26;
+    size_t field_27; tag("Field27")
+    bool field_28;
+    size_t field_29;
+    long field_30;
+    long field_31; tag("Field31")
+    int field_32;
+    float field_33;
+    size_t field_34;
+    unsigned int field_35; tag("Field35")
+    double field_36;
+    double field_37;
+    double field_38;
+    long field_39; tag("Field39")
+    const char* field_40;
+    int field_41;
+    const char* field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    double field_45;
+    unsigned int field_46;
+    bool field_47; tag("Field47")
+    unsigned int field_48;
+    float field_49;
+    bool field_50;
+    unsigned int field_51; tag("Field51")
+    const char* field_52;
+    double field_53;
+    unsigned int field_54;
+    size_t field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    int field_60;
+    size_t field_61;
+    unsigned int field_62;
+    float field_63; tag("Field63")
+} S10_3 derive_all();
+
+#endif // F000010_H
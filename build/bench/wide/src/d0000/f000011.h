@@ -0,0 +1,274 @@
+#ifndef F000011_H
+#define F000011_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+    unsigned int field_8;
+    unsigned int field_9;
+    size_t field_10;
+    float field_11; tag("Field11")
+    bool field_12;
+    double field_13;
+    long field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    const char* field_17;
+    double field_18;
+    double field_19; tag("Field19")
+    const char* field_20;
+    double field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    int field_24;
+    double field_25;
+    bool field_26;
+    long field_27; tag("Field27")
+    int field_28;
+    double field_29;
+    int field_30;
+    unsigned int field_31; tag("Field31")
+    double field_32;
+    bool field_33;
+    float field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    float field_37;
+    bool field_38;
+    double field_39; tag("Field39")
+    unsigned int field_40;
+    unsigned int field_41;
+    int field_42;
+    int field_43; tag("Field43")
+    int field_44;
+    long field_45;
+    float field_46;
+    const char* field_47; tag("Field47")
+    const char* field_48;
+    size_t field_49;
+    bool field_50;
+    size_t field_51; tag("Field51")
+    double field_52;
+    long field_53;
+    bool field_54;
+    unsigned int field_55; tag("Field55")
+    const char* field_56;
+    long field_57;
+    const char* field_58;
+    double field_59; tag("Field59")
+    unsigned int field_60;
+    double field_61;
+    size_t field_62;
+    long field_63; tag("Field63")
+} S11_0 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+    double field_8;
+    int field_9;
+    unsigned int field_10;
+    double field_11; tag("Field11")
+    const char* field_12;
+    double field_13;
+    unsigned int field_14;
+    const char* field_15; tag("Field15")
+    float field_16;
+    size_t field_17;
+    bool field_18;
+    int field_19; tag("Field19")
+    bool field_20;
+    long field_21;
+    float field_22;
+    size_t field_23; tag("Field23")
+    long field_24;
+    int field_25;
+    const char* field_26;
+    bool field_27; tag("Field27")
+    int field_28;
+    bool field_29;
+    const char* field_30;
+    unsigned int field_31; tag("Field31")
+    float field_32;
+    const char* field_33;
+    size_t field_34;
+    float field_35; tag("Field35")
+    double field_36;
+    unsigned int field_37;
+    const char* field_38;
+    const char* field_39; tag("Field39")
+    double field_40;
+    bool field_41;
+    bool field_42;
+    float field_43; tag("Field43")
+    float field_44;
+    bool field_45;
+    const char* field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    unsigned int field_49;
+    int field_50;
+    bool field_51; tag("Field51")
+    long field_52;
+    int field_53;
+    const char* field_54;
+    long field_55; tag("Field55")
+    unsigned int field_56;
+    int field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    float field_61;
+    unsigned int field_62;
+    const char* field_63; tag("Field63")
+} S11_1 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    double field_6;
+    long field_7; tag("Field7")
+    float field_8;
+    size_t field_9;
+    int field_10;
+    long field_11; tag("Field11")
+    int field_12;
+    size_t field_13;
+    float field_14;
+    float field_15; tag("Field15")
+    const char* field_16;
+    const char* field_17;
+    bool field_18;
+    int field_19; tag("Field19")
+    size_t field_20;
+    bool field_21;
+    long field_22;
+    size_t field_23; tag("Field23")
+    bool field_24;
+    const char* field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    int field_28;
+    const char* field_29;
+    int field_30;
+    int field_31; tag("Field31")
+    bool field_32;
+    bool field_33;
+    int field_34;
+    const char* field_35; tag("Field35")
+    size_t field_36;
+    const char* field_37;
+    const char* field_38;
+    const char* field_39; tag("Field39")
+    long field_40;
+    bool field_41;
+    const char* field_42;
+    long field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    float field_46;
+    bool field_47; tag("Field47")
+    double field_48;
+    long field_49;
+    float field_50;
+    double field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    bool field_54;
+    int field_55; tag("Field55")
+    const char* field_56;
+    int field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    size_t field_60;
+    size_t field_61;
+    double field_62;
+    unsigned int field_63; tag("Field63")
+} S11_2 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    float field_8;
+    float field_9;
+    double field_10;
+    unsigned int field_11; tag("Field11")
+    bool field_12;
+    long field_13;
+    long field_14;
+    long field_15; tag("Field15")
+    float field_16;
+    unsigned int field_17;
+    size_t field_18;
+    float field_19; tag("Field19")
+    double field_20;
+    double field_21;
+    double field_22;
+    const char* field_23; tag("Field23")
+    int field_24;
+    const char* field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    unsigned int field_29;
+    float field_30;
+    double field_31; tag("Field31")
+    bool field_32;
+    size_t field_33;
+    long field_34;
+    size_t field_35; tag("Field35")
+    unsigned int field_36;
+    const char* field_37;
+    int field_38;
+    unsigned int field_39; tag("Field39")
+    bool field_40;
+    long field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    double field_46;
+    unsigned int field_47; tag("Field47")
+    bool field_48;
+    unsigned int field_49;
+    long field_50;
+    bool field_51; tag("Field51")
+    double field_52;
+    const char* field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    int field_56;
+    const char* field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    const char* field_61;
+    size_t field_62;
+    const char* field_63; tag("Field63")
+} S11_3 derive_all();
+
+#endif // F000011_H
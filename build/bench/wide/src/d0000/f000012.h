@@ -0,0 +1,274 @@
+#ifndef F000012_H
+#define F000012_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    float field_10;
+    double field_11; tag("Field11")
+    bool field_12;
+    bool field_13;
+    double field_14;
+    float field_15; tag("Field15")
+    size_t field_16;
+    double field_17;
+    int field_18;
+    size_t field_19; tag("Field19")
+    long field_20;
+    long field_21;
+    float field_22;
+    bool field_23; tag("Field23")
+    size_t field_24;
+    int field_25;
+    int field_26;
+    size_t field_27; tag("Field27")
+    size_t field_28;
+    float field_29;
+    const char* field_30;
+    float field_31; tag("Field31")
+    unsigned int field_32;
+    unsigned int field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    size_t field_36;
+    const char* field_37;
+    int field_38;
+    int field_39; tag("Field39")
+    bool field_40;
+    long field_41;
+    double field_42;
+    unsigned int field_43; tag("Field43")
+    bool field_44;
+    size_t field_45;
+    bool field_46;
+    float field_47; tag("Field47")
+    long field_48;
+    unsigned int field_49;
+    size_t field_50;
+    double field_51; tag("Field51")
+    unsigned int field_52;
+    const char* field_53;
+    bool field_54;
+    double field_55; tag("Field55")
+    long field_56;
+    unsigned int field_57;
+    size_t field_58;
+    float field_59; tag("Field59")
+    int field_60;
+    int field_61;
+    int field_62;
+    const char* field_63; tag("Field63")
+} S12_0 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+    double field_8;
+    double field_9;
+    int field_10;
+    long field_11; tag("Field11")
+    int field_12;
+    float field_13;
+    size_t field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    float field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    long field_21;
+    long field_22;
+    int field_23; tag("Field23")
+    bool field_24;
+    int field_25;
+    double field_26;
+    const char* field_27; tag("Field27")
+    bool field_28;
+    double field_29;
+    unsigned int field_30;
+    long field_31; tag("Field31")
+    long field_32;
+    long field_33;
+    bool field_34;
+    float field_35; tag("Field35")
+    long field_36;
+    double field_37;
+    double field_38;
+    long field_39; tag("Field39")
+    unsigned int field_40;
+    size_t field_41;
+    bool field_42;
+    float field_43; tag("Field43")
+    int field_44;
+    const char* field_45;
+    size_t field_46;
+    long field_47; tag("Field47")
+    double field_48;
+    size_t field_49;
+    double field_50;
+    double field_51; tag("Field51")
+    bool field_52;
+    unsigned int field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    size_t field_57;
+    long field_58;
+    size_t field_59; tag("Field59")
+    int field_60;
+    long field_61;
+    size_t field_62;
+    const char* field_63; tag("Field63")
+} S12_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    size_t field_9;
+    long field_10;
+    double field_11; tag("Field11")
+    int field_12;
+    long field_13;
+    double field_14;
+    const char* field_15; tag("Field15")
+    bool field_16;
+    bool field_17;
+    long field_18;
+    long field_19; tag("Field19")
+    float field_20;
+    unsigned int field_21;
+    long field_22;
+    long field_23; tag("Field23")
+    unsigned int field_24;
+    size_t field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    long field_28;
+    const char* field_29;
+    const char* field_30;
+    int field_31; tag("Field31")
+    unsigned int field_32;
+    const char* field_33;
+    bool field_34;
+    long field_35; tag("Field35")
+    const char* field_36;
+    float field_37;
+    double field_38;
+    bool field_39; tag("Field39")
+    size_t field_40;
+    bool field_41;
+    float field_42;
+    float field_43; tag("Field43")
+    const char* field_44;
+    unsigned int field_45;
+    long field_46;
+    const char* field_47; tag("Field47")
+    double field_48;
+    size_t field_49;
+    long field_50;
+    long field_51; tag("Field51")
+    float field_52;
+    const char* field_53;
+    double field_54;
+    const char* field_55; tag("Field55")
+    bool field_56;
+    double field_57;
+    unsigned int field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    float field_61;
+    bool field_62;
+    const char* field_63; tag("Field63")
+} S12_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+    unsigned int field_8;
+    size_t field_9;
+    float field_10;
+    const char* field_11; tag("Field11")
+    bool field_12;
+    long field_13;
+    long field_14;
+    const char* field_15; tag("Field15")
+    size_t field_16;
+    const char* field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    long field_20;
+    unsigned int field_21;
+    double field_22;
+    float field_23; tag("Field23")
+    double field_24;
+    unsigned int field_25;
+    unsigned int field_26;
+    double field_27; tag("Field27")
+    double field_28;
+    float field_29;
+    const char* field_30;
+    float field_31; tag("Field31")
+    size_t field_32;
+    double field_33;
+    unsigned int field_34;
+    long field_35; tag("Field35")
+    long field_36;
+    const char* field_37;
+    double field_38;
+    float field_39; tag("Field39")
+    int field_40;
+    float field_41;
+    double field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    long field_45;
+    int field_46;
+    bool field_47; tag("Field47")
+    bool field_48;
+    unsigned int field_49;
+    long field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    long field_53;
+    bool field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    size_t field_57;
+    long field_58;
+    size_t field_59; tag("Field59")
+    unsigned int field_60;
+    int field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S12_3 derive_all();
+
+#endif // F000012_H
@@ -0,0 +1,274 @@
+#ifndef F000013_H
+#define F000013_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    long field_0;
+    long field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    const char* field_9;
+    unsigned int field_10;
+    const char* field_11; tag("Field11")
+    bool field_12;
+    long field_13;
+    double field_14;
+    long field_15; tag("Field15")
+    const char* field_16;
+    size_t field_17;
+    bool field_18;
+    bool field_19; tag("Field19")
+    bool field_20;
+    bool field_21;
+    long field_22;
+    double field_23; tag("Field23")
+    double field_24;
+    unsigned int field_25;
+    double field_26;
+    int field_27; tag("Field27")
+    float field_28;
+    long field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    long field_32;
+    const char* field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    long field_36;
+    size_t field_37;
+    int field_38;
+    int field_39; tag("Field39")
+    int field_40;
+    long field_41;
+    double field_42;
+    long field_43; tag("Field43")
+    int field_44;
+    int field_45;
+    bool field_46;
+    unsigned int field_47; tag("Field47")
+    unsigned int field_48;
+    unsigned int field_49;
+    int field_50;
+    double field_51; tag("Field51")
+    const char* field_52;
+    float field_53;
+    bool field_54;
+    size_t field_55; tag("Field55")
+    bool field_56;
+    int field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    const char* field_60;
+    const char* field_61;
+    bool field_62;
+    unsigned int field_63; tag("Field63")
+} S13_0 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+    size_t field_8;
+    const char* field_9;
+    int field_10;
+    unsigned int field_11; tag("Field11")
+    unsigned int field_12;
+    int field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    double field_17;
+    float field_18;
+    float field_19; tag("Field19")
+    size_t field_20;
+    long field_21;
+    size_t field_22;
+    long field_23; tag("Field23")
+    double field_24;
+    double field_25;
+    float field_26;
+    const char* field_27; tag("Field27")
+    size_t field_28;
+    size_t field_29;
+    bool field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    bool field_33;
+    bool field_34;
+    long field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    bool field_38;
+    float field_39; tag("Field39")
+    bool field_40;
+    double field_41;
+    double field_42;
+    const char* field_43; tag("Field43")
+    const char* field_44;
+    double field_45;
+    bool field_46;
+    bool field_47; tag("Field47")
+    long field_48;
+    int field_49;
+    unsigned int field_50;
+    size_t field_51; tag("Field51")
+    size_t field_52;
+    float field_53;
+    double field_54;
+    bool field_55; tag("Field55")
+    size_t field_56;
+    bool field_57;
+    bool field_58;
+    unsigned int field_59; tag("Field59")
+    bool field_60;
+    const char* field_61;
+    const char* field_62;
+    size_t field_63; tag("Field63")
+} S13_1 derive_all();
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+    long field_8;
+    unsigned int field_9;
+    long field_10;
+    int field_11; tag("Field11")
+    int field_12;
+    float field_13;
+    float field_14;
+    size_t field_15; tag("Field15")
+    int field_16;
+    float field_17;
+    double field_18;
+    const char* field_19; tag("Field19")
+    const char* field_20;
+    unsigned int field_21;
+    const char* field_22;
+    double field_23; tag("Field23")
+    long field_24;
+    const char* field_25;
+    int field_26;
+    bool field_27; tag("Field27")
+    int field_28;
+    double field_29;
+    bool field_30;
+    bool field_31; tag("Field31")
+    float field_32;
+    bool field_33;
+    long field_34;
+    size_t field_35; tag("Field35")
+    const char* field_36;
+    float field_37;
+    long field_38;
+    bool field_39; tag("Field39")
+    unsigned int field_40;
+    long field_41;
+    const char* field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    long field_45;
+    int field_46;
+    double field_47; tag("Field47")
+    size_t field_48;
+    bool field_49;
+    size_t field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    float field_53;
+    float field_54;
+    size_t field_55; tag("Field55")
+    const char* field_56;
+    long field_57;
+    size_t field_58;
+    float field_59; tag("Field59")
+    const char* field_60;
+    const char* field_61;
+    size_t field_62;
+    size_t field_63; tag("Field63")
+} S13_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    unsigned int field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    const char* field_9;
+    unsigned int field_10;
+    long field_11; tag("Field11")
+    unsigned int field_12;
+    int field_13;
+    unsigned int field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    size_t field_20;
+    unsigned int field_21;
+    bool field_22;
+    int field_23; tag("Field23")
+    size_t field_24;
+    size_t field_25;
+    const char* field_26;
+    unsigned int field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    float field_30;
+    unsigned int field_31; tag("Field31")
+    int field_32;
+    float field_33;
+    float field_34;
+    int field_35; tag("Field35")
+    const char* field_36;
+    float field_37;
+    float field_38;
+    float field_39; tag("Field39")
+    double field_40;
+    float field_41;
+    size_t field_42;
+    const char* field_43; tag("Field43")
+    unsigned int field_44;
+    bool field_45;
+    float field_46;
+    double field_47; tag("Field47")
+    double field_48;
+    unsigned int field_49;
+    size_t field_50;
+    float field_51; tag("Field51")
+    int field_52;
+    float field_53;
+    float field_54;
+    unsigned int field_55; tag("Field55")
+    bool field_56;
+    float field_57;
+    long field_58;
+    const char* field_59; tag("Field59")
+    size_t field_60;
+    long field_61;
+    const char* field_62;
+    int field_63; tag("Field63")
+} S13_3 derive_all();
+
+#endif // F000013_H
@@ -0,0 +1,274 @@
+#ifndef F000014_H
+#define F000014_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    float field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    double field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    int field_9;
+    size_t field_10;
+    double field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    double field_16;
+    unsigned int field_17;
+    const char* field_18;
+    bool field_19; tag("Field19")
+    const char* field_20;
+    double field_21;
+    unsigned int field_22;
+    bool field_23; tag("Field23")
+    int field_24;
+    unsigned int field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    double field_28;
+    unsigned int field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    float field_32;
+    unsigned int field_33;
+    double field_34;
+    double field_35; tag("Field35")
+    unsigned int field_36;
+    double field_37;
+    double field_38;
+    float field_39; tag("Field39")
+    float field_40;
+    unsigned int field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    bool field_44;
+    int field_45;
+    int field_46;
+    double field_47; tag("Field47")
+    bool field_48;
+    size_t field_49;
+    double field_50;
+    long field_51; tag("Field51")
+    const char* field_52;
+    long field_53;
+    int field_54;
+    unsigned int field_55; tag("Field55")
+    bool field_56;
+    const char* field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    const char* field_60;
+    const char* field_61;
+    bool field_62;
+    size_t field_63; tag("Field63")
+} S14_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+    double field_8;
+    unsigned int field_9;
+    unsigned int field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    long field_14;
+    long field_15; tag("Field15")
+    float field_16;
+    float field_17;
+    double field_18;
+    size_t field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    const char* field_22;
+    long field_23; tag("Field23")
+    unsigned int field_24;
+    float field_25;
+    long field_26;
+    long field_27; tag("Field27")
+    bool field_28;
+    double field_29;
+    int field_30;
+    long field_31; tag("Field31")
+    unsigned int field_32;
+    bool field_33;
+    unsigned int field_34;
+    float field_35; tag("Field35")
+    long field_36;
+    size_t field_37;
+    double field_38;
+    long field_39; tag("Field39")
+    double field_40;
+    bool field_41;
+    long field_42;
+    long field_43; tag("Field43")
+    size_t field_44;
+    int field_45;
+    double field_46;
+    int field_47; tag("Field47")
+    float field_48;
+    unsigned int field_49;
+    long field_50;
+    const char* field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    double field_54;
+    double field_55; tag("Field55")
+    long field_56;
+    long field_57;
+    unsigned int field_58;
+    size_t field_59; tag("Field59")
+    double field_60;
+    int field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S14_1 derive_all();
+
+typedef struct {
+    long field_0;
+    int field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+    bool field_8;
+    int field_9;
+    unsigned int field_10;
+    double field_11; tag("Field11")
+    const char* field_12;
+    int field_13;
+    size_t field_14;
+    double field_15; tag("Field15")
+    unsigned int field_16;
+    size_t field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    unsigned int field_20;
+    int field_21;
+    bool field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    double field_25;
+    const char* field_26;
+    bool field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    float field_30;
+    int field_31; tag("Field31")
+    unsigned int field_32;
+    int field_33;
+    unsigned int field_34;
+    long field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    float field_38;
+    bool field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    long field_44;
+    int field_45;
+    bool field_46;
+    bool field_47; tag("Field47")
+    const char* field_48;
+    double field_49;
+    int field_50;
+    const char* field_51; tag("Field51")
+    const char* field_52;
+    unsigned int field_53;
+    const char* field_54;
+    bool field_55; tag("Field55")
+    bool field_56;
+    size_t field_57;
+    float field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    long field_61;
+    double field_62;
+    size_t field_63; tag("Field63")
+} S14_2 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    long field_6;
+    double field_7; tag("Field7")
+    unsigned int field_8;
+    const char* field_9;
+    bool field_10;
+    long field_11; tag("Field11")
+    const char* field_12;
+    bool field_13;
+    size_t field_14;
+    double field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    bool field_18;
+    const char* field_19; tag("Field19")
+    unsigned int field_20;
+    unsigned int field_21;
+    const char* field_22;
+    bool field_23; tag("Field23")
+    long field_24;
+    int field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    bool field_28;
+    bool field_29;
+    const char* field_30;
+    double field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    float field_34;
+    float field_35; tag("Field35")
+    bool field_36;
+    const char* field_37;
+    const char* field_38;
+    int field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    size_t field_42;
+    int field_43; tag("Field43")
+    int field_44;
+    int field_45;
+    unsigned int field_46;
+    long field_47; tag("Field47")
+    unsigned int field_48;
+    double field_49;
+    unsigned int field_50;
+    double field_51; tag("Field51")
+    int field_52;
+    double field_53;
+    bool field_54;
+    bool field_55; tag("Field55")
+    int field_56;
+    size_t field_57;
+    bool field_58;
+    double field_59; tag("Field59")
+    unsigned int field_60;
+    size_t field_61;
+    float field_62;
+    unsigned int field_63; tag("Field63")
+} S14_3 derive_all();
+
+#endif // F000014_H
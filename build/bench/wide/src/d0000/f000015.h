@@ -0,0 +1,274 @@
+#ifndef F000015_H
+#define F000015_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    long field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    double field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    bool field_13;
+    const char* field_14;
+    const char* field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    float field_18;
+    unsigned int field_19; tag("Field19")
+    size_t field_20;
+    unsigned int field_21;
+    bool field_22;
+    bool field_23; tag("Field23")
+    const char* field_24;
+    double field_25;
+    size_t field_26;
+    size_t field_27; tag("Field27")
+    long field_28;
+    size_t field_29;
+    const char* field_30;
+    int field_31; tag("Field31")
+    long field_32;
+    int field_33;
+    bool field_34;
+    int field_35; tag("Field35")
+    float field_36;
+    double field_37;
+    size_t field_38;
+    const char* field_39; tag("Field39")
+    size_t field_40;
+    unsigned int field_41;
+    const char* field_42;
+    long field_43; tag("Field43")
+    unsigned int field_44;
+    int field_45;
+    const char* field_46;
+    double field_47; tag("Field47")
+    bool field_48;
+    unsigned int field_49;
+    float field_50;
+    unsigned int field_51; tag("Field51")
+    double field_52;
+    double field_53;
+    size_t field_54;
+    size_t field_55; tag("Field55")
+    const char* field_56;
+    float field_57;
+    bool field_58;
+    double field_59; tag("Field59")
+    unsigned int field_60;
+    double field_61;
+    float field_62;
+    const char* field_63; tag("Field63")
+} S15_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+    const char* field_8;
+    size_t field_9;
+    double field_10;
+    size_t field_11; tag("Field11")
+    const char* field_12;
+    unsigned int field_13;
+    size_t field_14;
+    const char* field_15; tag("Field15")
+    float field_16;
+    long field_17;
+    const char* field_18;
+    const char* field_19; tag("Field19")
+    unsigned int field_20;
+    long field_21;
+    const char* field_22;
+    bool field_23; tag("Field23")
+    const char* field_24;
+    unsigned int field_25;
+    bool field_26;
+    unsigned int field_27; tag("Field27")
+    float field_28;
+    double field_29;
+    long field_30;
+    const char* field_31; tag("Field31")
+    float field_32;
+    float field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    float field_36;
+    unsigned int field_37;
+    const char* field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    bool field_41;
+    size_t field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    long field_45;
+    double field_46;
+    double field_47; tag("Field47")
+    long field_48;
+    size_t field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    long field_52;
+    float field_53;
+    size_t field_54;
+    int field_55; tag("Field55")
+    float field_56;
+    const char* field_57;
+    long field_58;
+    float field_59; tag("Field59")
+    bool field_60;
+    bool field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S15_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    const char* field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    double field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+    long field_8;
+    bool field_9;
+    float field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    float field_13;
+    bool field_14;
+    bool field_15; tag("Field15")
+    bool field_16;
+    int field_17;
+    size_t field_18;
+    double field_19; tag("Field19")
+    float field_20;
+    size_t field_21;
+    const char* field_22;
+    size_t field_23; tag("Field23")
+    int field_24;
+    bool field_25;
+    int field_26;
+    double field_27; tag("Field27")
+    size_t field_28;
+    double field_29;
+    long field_30;
+    bool field_31; tag("Field31")
+    size_t field_32;
+    float field_33;
+    size_t field_34;
+    bool field_35; tag("Field35")
+    long field_36;
+    long field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    const char* field_41;
+    float field_42;
+    float field_43; tag("Field43")
+    size_t field_44;
+    bool field_45;
+    const char* field_46;
+    const char* field_47; tag("Field47")
+    float field_48;
+    bool field_49;
+    size_t field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    long field_53;
+    unsigned int field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    bool field_57;
+    double field_58;
+    unsigned int field_59; tag("Field59")
+    double field_60;
+    long field_61;
+    bool field_62;
+    int field_63; tag("Field63")
+} S15_2 derive_all();
+
+typedef struct {
+    int field_0;
+    size_t field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    float field_6;
+    const char* field_7; tag("Field7")
+    const char* field_8;
+    bool field_9;
+    float field_10;
+    const char* field_11; tag("Field11")
+    bool field_12;
+    float field_13;
+    float field_14;
+    unsigned int field_15; tag("Field15")
+    int field_16;
+    double field_17;
+    double field_18;
+    double field_19; tag("Field19")
+    size_t field_20;
+    size_t field_21;
+    int field_22;
+    float field_23; tag("Field23")
+    unsigned int field_24;
+    float field_25;
+    const char* field_26;
+    const char* field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    int field_30;
+    size_t field_31; tag("Field31")
+    float field_32;
+    size_t field_33;
+    unsigned int field_34;
+    size_t field_35; tag("Field35")
+    int field_36;
+    size_t field_37;
+    size_t field_38;
+    const char* field_39; tag("Field39")
+    double field_40;
+    int field_41;
+    float field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    float field_45;
+    float field_46;
+    const char* field_47; tag("Field47")
+    const char* field_48;
+    long field_49;
+    bool field_50;
+    unsigned int field_51; tag("Field51")
+    int field_52;
+    const char* field_53;
+    double field_54;
+    bool field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    bool field_58;
+    size_t field_59; tag("Field59")
+    unsigned int field_60;
+    float field_61;
+    int field_62;
+    bool field_63; tag("Field63")
+} S15_3 derive_all();
+
+#endif // F000015_H
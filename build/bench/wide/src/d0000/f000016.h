@@ -0,0 +1,274 @@
+#ifndef F000016_H
+#define F000016_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    double field_9;
+    int field_10;
+    float field_11; tag("Field11")
+    float field_12;
+    int field_13;
+    long field_14;
+    double field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    unsigned int field_18;
+    size_t field_19; tag("Field19")
+    float field_20;
+    double field_21;
+    bool field_22;
+    bool field_23; tag("Field23")
+    int field_24;
+    int field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    size_t field_28;
+    double field_29;
+    double field_30;
+    float field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    long field_34;
+    int field_35; tag("Field35")
+    bool field_36;
+    bool field_37;
+    float field_38;
+    int field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    unsigned int field_42;
+    double field_43; tag("Field43")
+    double field_44;
+    double field_45;
+    float field_46;
+    size_t field_47; tag("Field47")
+    double field_48;
+    float field_49;
+    int field_50;
+    long field_51; tag("Field51")
+    double field_52;
+    int field_53;
+    long field_54;
+    bool field_55; tag("Field55")
+    float field_56;
+    long field_57;
+    unsigned int field_58;
+    const char* field_59; tag("Field59")
+    double field_60;
+    bool field_61;
+    long field_62;
+    float field_63; tag("Field63")
+} S16_0 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    float field_2;
+    bool field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    long field_6;
+    double field_7; tag("Field7")
+    const char* field_8;
+    unsigned int field_9;
+    const char* field_10;
+    float field_11; tag("Field11")
+    long field_12;
+    long field_13;
+    long field_14;
+    unsigned int field_15; tag("Field15")
+    int field_16;
+    const char* field_17;
+    unsigned int field_18;
+    float field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    unsigned int field_22;
+    double field_23; tag("Field23")
+    size_t field_24;
+    long field_25;
+    unsigned int field_26;
+    double field_27; tag("Field27")
+    float field_28;
+    bool field_29;
+    float field_30;
+    long field_31; tag("Field31")
+    int field_32;
+    bool field_33;
+    bool field_34;
+    float field_35; tag("Field35")
+    unsigned int field_36;
+    long field_37;
+    const char* field_38;
+    bool field_39; tag("Field39")
+    size_t field_40;
+    float field_41;
+    bool field_42;
+    bool field_43; tag("Field43")
+    long field_44;
+    bool field_45;
+    const char* field_46;
+    float field_47; tag("Field47")
+    long field_48;
+    unsigned int field_49;
+    long field_50;
+    int field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    float field_54;
+    bool field_55; tag("Field55")
+    bool field_56;
+    bool field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    float field_60;
+    bool field_61;
+    long field_62;
+    long field_63; tag("Field63")
+} S16_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    size_t field_6;
+    size_t field_7; tag("Field7")
+    float field_8;
+    bool field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    double field_12;
+    long field_13;
+    size_t field_14;
+    float field_15; tag("Field15")
+    long field_16;
+    const char* field_17;
+    size_t field_18;
+    long field_19; tag("Field19")
+    unsigned int field_20;
+    unsigned int field_21;
+    const char* field_22;
+    float field_23; tag("Field23")
+    int field_24;
+    size_t field_25;
+    long field_26;
+    const char* field_27; tag("Field27")
+    int field_28;
+    double field_29;
+    long field_30;
+    float field_31; tag("Field31")
+    size_t field_32;
+    double field_33;
+    unsigned int field_34;
+    int field_35; tag("Field35")
+    long field_36;
+    const char* field_37;
+    unsigned int field_38;
+    bool field_39; tag("Field39")
+    unsigned int field_40;
+    size_t field_41;
+    const char* field_42;
+    size_t field_43; tag("Field43")
+    double field_44;
+    double field_45;
+    int field_46;
+    bool field_47; tag("Field47")
+    double field_48;
+    size_t field_49;
+    double field_50;
+    double field_51; tag("Field51")
+    const char* field_52;
+    const char* field_53;
+    unsigned int field_54;
+    bool field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    size_t field_58;
+    double field_59; tag("Field59")
+    long field_60;
+    long field_61;
+    unsigned int field_62;
+    long field_63; tag("Field63")
+} S16_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    float field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    size_t field_6;
+    const char* field_7; tag("Field7")
+    size_t field_8;
+    long field_9;
+    unsigned int field_10;
+    double field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    double field_14;
+    bool field_15; tag("Field15")
+    bool field_16;
+    long field_17;
+    bool field_18;
+    size_t field_19; tag("Field19")
+    unsigned int field_20;
+    long field_21;
+    float field_22;
+    int field_23; tag("Field23")
+    int field_24;
+    int field_25;
+    float field_26;
+    unsigned int field_27; tag("Field27")
+    bool field_28;
+    unsigned int field_29;
+    float field_30;
+    size_t field_31; tag("Field31")
+    int field_32;
+    bool field_33;
+    long field_34;
+    unsigned int field_35; tag("Field35")
+    unsigned int field_36;
+    bool field_37;
+    double field_38;
+    bool field_39; tag("Field39")
+    int field_40;
+    unsigned int field_41;
+    const char* field_42;
+    int field_43; tag("Field43")
+    unsigned int field_44;
+    double field_45;
+    long field_46;
+    const char* field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    size_t field_50;
+    long field_51; tag("Field51")
+    int field_52;
+    double field_53;
+    const char* field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    double field_60;
+    size_t field_61;
+    unsigned int field_62;
+    const char* field_63; tag("Field63")
+} S16_3 derive_all();
+
+#endif // F000016_H
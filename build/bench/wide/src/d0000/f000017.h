@@ -0,0 +1,274 @@
+#ifndef F000017_H
+#define F000017_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+    long field_8;
+    double field_9;
+    long field_10;
+    float field_11; tag("Field11")
+    bool field_12;
+    const char* field_13;
+    bool field_14;
+    long field_15; tag("Field15")
+    double field_16;
+    bool field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    unsigned int field_20;
+    long field_21;
+    double field_22;
+    unsigned int field_23; tag("Field23")
+    const char* field_24;
+    float field_25;
+    const char* field_26;
+    double field_27; tag("Field27")
+    size_t field_28;
+    float field_29;
+    const char* field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    long field_34;
+    int field_35; tag("Field35")
+    long field_36;
+    double field_37;
+    double field_38;
+    double field_39; tag("Field39")
+    unsigned int field_40;
+    unsigned int field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    long field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    unsigned int field_48;
+    bool field_49;
+    unsigned int field_50;
+    size_t field_51; tag("Field51")
+    float field_52;
+    bool field_53;
+    float field_54;
+    unsigned int field_55; tag("Field55")
+    const char* field_56;
+    unsigned int field_57;
+    size_t field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    size_t field_61;
+    double field_62;
+    const char* field_63; tag("Field63")
+} S17_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    float field_4;
+    float field_5;
+    bool field_6;
+    long field_7; tag("Field7")
+    size_t field_8;
+    size_t field_9;
+    const char* field_10;
+    const char* field_11; tag("Field11")
+    int field_12;
+    size_t field_13;
+    long field_14;
+    int field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    int field_18;
+    bool field_19; tag("Field19")
+    bool field_20;
+    size_t field_21;
+    unsigned int field_22;
+    double field_23; tag("Field23")
+    long field_24;
+    const char* field_25;
+    bool field_26;
+    size_t field_27; tag("Field27")
+    unsigned int field_28;
+    bool field_29;
+    size_t field_30;
+    int field_31; tag("Field31")
+    int field_32;
+    float field_33;
+    int field_34;
+    bool field_35; tag("Field35")
+    long field_36;
+    int field_37;
+    long field_38;
+    float field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    double field_42;
+    bool field_43; tag("Field43")
+    bool field_44;
+    int field_45;
+    long field_46;
+    float field_47; tag("Field47")
+    bool field_48;
+    int field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    bool field_52;
+    bool field_53;
+    double field_54;
+    float field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    bool field_58;
+    bool field_59; tag("Field59")
+    unsigned int field_60;
+    unsigned int field_61;
+    bool field_62;
+    bool field_63; tag("Field63")
+} S17_1 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    const char* field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    int field_6;
+    long field_7; tag("Field7")
+    const char* field_8;
+    float field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    double field_12;
+    int field_13;
+    size_t field_14;
+    const char* field_15; tag("Field15")
+    double field_16;
+    float field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    unsigned int field_22;
+    double field_23; tag("Field23")
+    size_t field_24;
+    float field_25;
+    long field_26;
+    unsigned int field_27; tag("Field27")
+    int field_28;
+    bool field_29;
+    long field_30;
+    unsigned int field_31; tag("Field31")
+    long field_32;
+    double field_33;
+    float field_34;
+    bool field_35; tag("Field35")
+    unsigned int field_36;
+    long field_37;
+    const char* field_38;
+    const char* field_39; tag("Field39")
+    const char* field_40;
+    long field_41;
+    bool field_42;
+    unsigned int field_43; tag("Field43")
+    unsigned int field_44;
+    bool field_45;
+    int field_46;
+    unsigned int field_47; tag("Field47")
+    long field_48;
+    long field_49;
+    long field_50;
+    int field_51; tag("Field51")
+    bool field_52;
+    const char* field_53;
+    bool field_54;
+    float field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    double field_58;
+    double field_59; tag("Field59")
+    double field_60;
+    double field_61;
+    size_t field_62;
+    float field_63; tag("Field63")
+} S17_2 derive_all();
+
+typedef struct {
+    long field_0;
+    float field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    unsigned int field_4;
+    unsigned int field_5;
+    size_t field_6;
+    float field_7; tag("Field7")
+    unsigned int field_8;
+    bool field_9;
+    float field_10;
+    double field_11; tag("Field11")
+    const char* field_12;
+    float field_13;
+    float field_14;
+    long field_15; tag("Field15")
+    double field_16;
+    int field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    long field_20;
+    int field_21;
+    const char* field_22;
+    bool field_23; tag("Field23")
+    unsigned int field_24;
+    double field_25;
+    size_t field_26;
+    const char* field_27; tag("Field27")
+    int field_28;
+    long field_29;
+    size_t field_30;
+    int field_31; tag("Field31")
+    long field_32;
+    size_t field_33;
+    float field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    size_t field_37;
+    float field_38;
+    double field_39; tag("Field39")
+    const char* field_40;
+    float field_41;
+    const char* field_42;
+    long field_43; tag("Field43")
+    size_t field_44;
+    long field_45;
+    const char* field_46;
+    float field_47; tag("Field47")
+    const char* field_48;
+    long field_49;
+    size_t field_50;
+    const char* field_51; tag("Field51")
+    float field_52;
+    size_t field_53;
+    long field_54;
+    unsigned int field_55; tag("Field55")
+    const char* field_56;
+    double field_57;
+    unsigned int field_58;
+    long field_59; tag("Field59")
+    int field_60;
+    unsigned int field_61;
+    const char* field_62;
+    float field_63; tag("Field63")
+} S17_3 derive_all();
+
+#endif // F000017_H
@@ -0,0 +1,274 @@
+#ifndef F000018_H
+#define F000018_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+    const char* field_8;
+    float field_9;
+    float field_10;
+    bool field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    long field_14;
+    size_t field_15; tag("Field15")
+    const char* field_16;
+    int field_17;
+    const char* field_18;
+    long field_19; tag("Field19")
+    const char* field_20;
+    double field_21;
+    double field_22;
+    unsigned int field_23; tag("Field23")
+    size_t field_24;
+    float field_25;
+    const char* field_26;
+    const char* field_27; tag("Field27")
+    size_t field_28;
+    int field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    int field_32;
+    double field_33;
+    float field_34;
+    int field_35; tag("Field35")
+    long field_36;
+    size_t field_37;
+    unsigned int field_38;
+    float field_39; tag("Field39")
+    bool field_40;
+    long field_41;
+    long field_42;
+    int field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    double field_46;
+    bool field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    unsigned int field_50;
+    int field_51; tag("Field51")
+    size_t field_52;
+    long field_53;
+    double field_54;
+    bool field_55; tag("Field55")
+    bool field_56;
+    float field_57;
+    bool field_58;
+    double field_59; tag("Field59")
+    size_t field_60;
+    bool field_61;
+    long field_62;
+    const char* field_63; tag("Field63")
+} S18_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    unsigned int field_6;
+    int field_7; tag("Field7")
+    float field_8;
+    bool field_9;
+    int field_10;
+    unsigned int field_11; tag("Field11")
+    size_t field_12;
+    unsigned int field_13;
+    unsigned int field_14;
+    const char* field_15; tag("Field15")
+    size_t field_16;
+    const char* field_17;
+    long field_18;
+    long field_19; tag("Field19")
+    double field_20;
+    long field_21;
+    unsigned int field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    const char* field_25;
+    long field_26;
+    const char* field_27; tag("Field27")
+    int field_28;
+    double field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    float field_32;
+    double field_33;
+    long field_34;
+    unsigned int field_35; tag("Field35")
+    long field_36;
+    float field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    unsigned int field_40;
+    bool field_41;
+    bool field_42;
+    long field_43; tag("Field43")
+    unsigned int field_44;
+    long field_45;
+    double field_46;
+    int field_47; tag("Field47")
+    const char* field_48;
+    float field_49;
+    unsigned int field_50;
+    long field_51; tag("Field51")
+    unsigned int field_52;
+    float field_53;
+    float field_54;
+    float field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    double field_61;
+    double field_62;
+    int field_63; tag("Field63")
+} S18_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    size_t field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+    double field_8;
+    float field_9;
+    double field_10;
+    long field_11; tag("Field11")
+    int field_12;
+    unsigned int field_13;
+    size_t field_14;
+    long field_15; tag("Field15")
+    size_t field_16;
+    unsigned int field_17;
+    long field_18;
+    const char* field_19; tag("Field19")
+    bool field_20;
+    unsigned int field_21;
+    int field_22;
+    const char* field_23; tag("Field23")
+    size_t field_24;
+    float field_25;
+    unsigned int field_26;
+    const char* field_27; tag("Field27")
+    bool field_28;
+    bool field_29;
+    float field_30;
+    long field_31; tag("Field31")
+    float field_32;
+    bool field_33;
+    size_t field_34;
+    size_t field_35; tag("Field35")
+    long field_36;
+    float field_37;
+    float field_38;
+    double field_39; tag("Field39")
+    const char* field_40;
+    double field_41;
+    float field_42;
+    size_t field_43; tag("Field43")
+    const char* field_44;
+    float field_45;
+    float field_46;
+    double field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    float field_50;
+    size_t field_51; tag("Field51")
+    float field_52;
+    int field_53;
+    unsigned int field_54;
+    size_t field_55; tag("Field55")
+    double field_56;
+    float field_57;
+    const char* field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    const char* field_61;
+    const char* field_62;
+    const char* field_63; tag("Field63")
+} S18_2 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    unsigned int field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+    bool field_8;
+    unsigned int field_9;
+    const char* field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    unsigned int field_13;
+    float field_14;
+    long field_15; tag("Field15")
+    int field_16;
+    double field_17;
+    long field_18;
+    size_t field_19; tag("Field19")
+    float field_20;
+    float field_21;
+    long field_22;
+    bool field_23; tag("Field23")
+    bool field_24;
+    unsigned int field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    float field_28;
+    bool field_29;
+    long field_30;
+    unsigned int field_31; tag("Field31")
+    int field_32;
+    float field_33;
+    long field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    unsigned int field_37;
+    size_t field_38;
+    unsigned int field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    int field_44;
+    int field_45;
+    double field_46;
+    float field_47; tag("Field47")
+    unsigned int field_48;
+    double field_49;
+    unsigned int field_50;
+    bool field_51; tag("Field51")
+    const char* field_52;
+    int field_53;
+    int field_54;
+    long field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    float field_60;
+    long field_61;
+    unsigned int field_62;
+    const char* field_63; tag("Field63")
+} S18_3 derive_all();
+
+#endif // F000018_H
@@ -0,0 +1,274 @@
+#ifndef F000019_H
+#define F000019_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    double field_9;
+    float field_10;
+    unsigned int field_11; tag("Field11")
+    size_t field_12;
+    float field_13;
+    float field_14;
+    bool field_15; tag("Field15")
+    long field_16;
+    float field_17;
+    bool field_18;
+    float field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    unsigned int field_22;
+    float field_23; tag("Field23")
+    bool field_24;
+    const char* field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    bool field_28;
+    const char* field_29;
+    const char* field_30;
+    long field_31; tag("Field31")
+    float field_32;
+    double field_33;
+    size_t field_34;
+    int field_35; tag("Field35")
+    long field_36;
+    int field_37;
+    int field_38;
+    float field_39; tag("Field39")
+    size_t field_40;
+    size_t field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    unsigned int field_44;
+    const char* field_45;
+    unsigned int field_46;
+    size_t field_47; tag("Field47")
+    long field_48;
+    bool field_49;
+    unsigned int field_50;
+    long field_51; tag("Field51")
+    double field_52;
+    double field_53;
+    bool field_54;
+    unsigned int field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    bool field_58;
+    double field_59; tag("Field59")
+    bool field_60;
+    size_t field_61;
+    long field_62;
+    const char* field_63; tag("Field63")
+} S19_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    const char* field_8;
+    unsigned int field_9;
+    float field_10;
+    double field_11; tag("Field11")
+    unsigned int field_12;
+    int field_13;
+    const char* field_14;
+    const char* field_15; tag("Field15")
+    bool field_16;
+    bool field_17;
+    int field_18;
+    size_t field_19; tag("Field19")
+    float field_20;
+    const char* field_21;
+    bool field_22;
+    size_t field_23; tag("Field23")
+    size_t field_24;
+    int field_25;
+    unsigned int field_26;
+    size_t field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    unsigned int field_30;
+    double field_31; tag("Field31")
+    long field_32;
+    unsigned int field_33;
+    const char* field_34;
+    const char* field_35; tag("Field35")
+    float field_36;
+    long field_37;
+    int field_38;
+    int field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    const char* field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    size_t field_45;
+    unsigned int field_46;
+    double field_47; tag("Field47")
+    int field_48;
+    size_t field_49;
+    int field_50;
+    bool field_51; tag("Field51")
+    long field_52;
+    const char* field_53;
+    double field_54;
+    unsigned int field_55; tag("Field55")
+    long field_56;
+    const char* field_57;
+    long field_58;
+    size_t field_59; tag("Field59")
+    size_t field_60;
+    float field_61;
+    unsigned int field_62;
+    size_t field_63; tag("Field63")
+} S19_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    unsigned int field_8;
+    bool field_9;
+    bool field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    double field_13;
+    float field_14;
+    double field_15; tag("Field15")
+    size_t field_16;
+    const char* field_17;
+    size_t field_18;
+    int field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    double field_22;
+    float field_23; tag("Field23")
+    float field_24;
+    const char* field_25;
+    int field_26;
+    int field_27; tag("Field27")
+    size_t field_28;
+    bool field_29;
+    unsigned int field_30;
+    int field_31; tag("Field31")
+    unsigned int field_32;
+    float field_33;
+    const char* field_34;
+    const char* field_35; tag("Field35")
+    unsigned int field_36;
+    unsigned int field_37;
+    long field_38;
+    int field_39; tag("Field39")
+    bool field_40;
+    size_t field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    float field_44;
+    double field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    unsigned int field_48;
+    long field_49;
+    unsigned int field_50;
+    long field_51; tag("Field51")
+    long field_52;
+    bool field_53;
+    int field_54;
+    int field_55; tag("Field55")
+    bool field_56;
+    bool field_57;
+    float field_58;
+    long field_59; tag("Field59")
+    int field_60;
+    float field_61;
+    double field_62;
+    unsigned int field_63; tag("Field63")
+} S19_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+    size_t field_8;
+    const char* field_9;
+    long field_10;
+    double field_11; tag("Field11")
+    size_t field_12;
+    double field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    float field_18;
+    unsigned int field_19; tag("Field19")
+    float field_20;
+    int field_21;
+    const char* field_22;
+    int field_23; tag("Field23")
+    unsigned int field_24;
+    unsigned int field_25;
+    int field_26;
+    bool field_27; tag("Field27")
+    float field_28;
+    unsigned int field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    unsigned int field_34;
+    int field_35; tag("Field35")
+    bool field_36;
+    unsigned int field_37;
+    float field_38;
+    float field_39; tag("Field39")
+    float field_40;
+    long field_41;
+    size_t field_42;
+    unsigned int field_43; tag("Field43")
+    bool field_44;
+    double field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    unsigned int field_48;
+    const char* field_49;
+    double field_50;
+    size_t field_51; tag("Field51")
+    bool field_52;
+    float field_53;
+    long field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    size_t field_58;
+    double field_59; tag("Field59")
+    bool field_60;
+    double field_61;
+    double field_62;
+    size_t field_63; tag("Field63")
+} S19_3 derive_all();
+
+#endif // F000019_H
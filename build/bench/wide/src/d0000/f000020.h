@@ -0,0 +1,274 @@
+#ifndef F000020_H
+#define F000020_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    float field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    long field_9;
+    bool field_10;
+    const char* field_11; tag("Field11")
+    unsigned int field_12;
+    long field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    size_t field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    int field_20;
+    const char* field_21;
+    double field_22;
+    unsigned int field_23; tag("Field23")
+    const char* field_24;
+    long field_25;
+    double field_26;
+    double field_27; tag("Field27")
+    float field_28;
+    double field_29;
+    float field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    unsigned int field_34;
+    float field_35; tag("Field35")
+    int field_36;
+    unsigned int field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    const char* field_40;
+    size_t field_41;
+    float field_42;
+    float field_43; tag("Field43")
+    double field_44;
+    bool field_45;
+    bool field_46;
+    long field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    long field_50;
+    unsigned int field_51; tag("Field51")
+    int field_52;
+    bool field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    const char* field_57;
+    double field_58;
+    const char* field_59; tag("Field59")
+    size_t field_60;
+    bool field_61;
+    double field_62;
+    float field_63; tag("Field63")
+} S20_0 derive_all();
+
+typedef struct {
+    int field_0;
+    unsigned int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    long field_10;
+    int field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    bool field_16;
+    bool field_17;
+    bool field_18;
+    const char* field_19; tag("Field19")
+    size_t field_20;
+    float field_21;
+    double field_22;
+    double field_23; tag("Field23")
+    int field_24;
+    size_t field_25;
+    const char* field_26;
+    const char* field_27; tag("Field27")
+    size_t field_28;
+    float field_29;
+    unsigned int field_30;
+    int field_31; tag("Field31")
+    unsigned int field_32;
+    unsigned int field_33;
+    int field_34;
+    int field_35; tag("Field35")
+    int field_36;
+    float field_37;
+    bool field_38;
+    size_t field_39; tag("Field39")
+    bool field_40;
+    float field_41;
+    float field_42;
+    const char* field_43; tag("Field43")
+    double field_44;
+    const char* field_45;
+    long field_46;
+    int field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    double field_50;
+    size_t field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    float field_54;
+    float field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    size_t field_58;
+    bool field_59; tag("Field59")
+    const char* field_60;
+    int field_61;
+    float field_62;
+    int field_63; tag("Field63")
+} S20_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    size_t field_2;
+    double field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+    const char* field_8;
+    unsigned int field_9;
+    double field_10;
+    long field_11; tag("Field11")
+    const char* field_12;
+    unsigned int field_13;
+    unsigned int field_14;
+    float field_15; tag("Field15")
+    double field_16;
+    double field_17;
+    bool field_18;
+    float field_19; tag("Field19")
+    const char* field_20;
+    size_t field_21;
+    bool field_22;
+    const char* field_23; tag("Field23")
+    const char* field_24;
+    size_t field_25;
+    bool field_26;
+    long field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    long field_30;
+    float field_31; tag("Field31")
+    int field_32;
+    long field_33;
+    int field_34;
+    double field_35; tag("Field35")
+    const char* field_36;
+    double field_37;
+    size_t field_38;
+    double field_39; tag("Field39")
+    double field_40;
+    unsigned int field_41;
+    double field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    unsigned int field_45;
+    const char* field_46;
+    int field_47; tag("Field47")
+    bool field_48;
+    double field_49;
+    long field_50;
+    float field_51; tag("Field51")
+    const char* field_52;
+    float field_53;
+    const char* field_54;
+    double field_55; tag("Field55")
+    float field_56;
+    size_t field_57;
+    int field_58;
+    float field_59; tag("Field59")
+    size_t field_60;
+    int field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S20_2 derive_all();
+
+typedef struct {
+    long field_0;
+    bool field_1;
+    long field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+    long field_8;
+    int field_9;
+    const char* field_10;
+    long field_11; tag("Field11")
+    double field_12;
+    float field_13;
+    int field_14;
+    const char* field_15; tag("Field15")
+    const char* field_16;
+    unsigned int field_17;
+    unsigned int field_18;
+    unsigned int field_19; tag("Field19")
+    size_t field_20;
+    long field_21;
+    unsigned int field_22;
+    float field_23; tag("Field23")
+    bool field_24;
+    unsigned int field_25;
+    unsigned int field_26;
+    int field_27; tag("Field27")
+    long field_28;
+    double field_29;
+    float field_30;
+    double field_31; tag("Field31")
+    const char* field_32;
+    size_t field_33;
+    size_t field_34;
+    unsigned int field_35; tag("Field35")
+    float field_36;
+    size_t field_37;
+    size_t field_38;
+    double field_39; tag("Field39")
+    long field_40;
+    long field_41;
+    const char* field_42;
+    size_t field_43; tag("Field43")
+    long field_44;
+    unsigned int field_45;
+    const char* field_46;
+    double field_47; tag("Field47")
+    const char* field_48;
+    const char* field_49;
+    bool field_50;
+    long field_51; tag("Field51")
+    int field_52;
+    size_t field_53;
+    long field_54;
+    size_t field_55; tag("Field55")
+    long field_56;
+    int field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    const char* field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S20_3 derive_all();
+
+#endif // F000020_H
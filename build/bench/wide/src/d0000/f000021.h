@@ -0,0 +1,274 @@
+#ifndef F000021_H
+#define F000021_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    long field_5;
+    long field_6;
+    float field_7; tag("Field7")
+    bool field_8;
+    float field_9;
+    long field_10;
+    bool field_11; tag("Field11")
+    size_t field_12;
+    size_t field_13;
+    const char* field_14;
+    bool field_15; tag("Field15")
+    double field_16;
+    long field_17;
+    unsigned int field_18;
+    size_t field_19; tag("Field19")
+    unsigned int field_20;
+    unsigned int field_21;
+    size_t field_22;
+    bool field_23; tag("Field23")
+    int field_24;
+    size_t field_25;
+    size_t field_26;
+    const char* field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    float field_32;
+    unsigned int field_33;
+    const char* field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    double field_37;
+    int field_38;
+    int field_39; tag("Field39")
+    float field_40;
+    int field_41;
+    int field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    float field_45;
+    bool field_46;
+    int field_47; tag("Field47")
+    size_t field_48;
+    float field_49;
+    float field_50;
+    int field_51; tag("Field51")
+    const char* field_52;
+    const char* field_53;
+    int field_54;
+    int field_55; tag("Field55")
+    unsigned int field_56;
+    const char* field_57;
+    unsigned int field_58;
+    bool field_59; tag("Field59")
+    float field_60;
+    long field_61;
+    long field_62;
+    unsigned int field_63; tag("Field63")
+} S21_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+    long field_8;
+    bool field_9;
+    const char* field_10;
+    long field_11; tag("Field11")
+    int field_12;
+    long field_13;
+    double field_14;
+    long field_15; tag("Field15")
+    int field_16;
+    unsigned int field_17;
+    long field_18;
+    long field_19; tag("Field19")
+    int field_20;
+    unsigned int field_21;
+    double field_22;
+    long field_23; tag("Field23")
+    long field_24;
+    double field_25;
+    double field_26;
+    int field_27; tag("Field27")
+    bool field_28;
+    bool field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    unsigned int field_32;
+    double field_33;
+    unsigned int field_34;
+    long field_35; tag("Field35")
+    size_t field_36;
+    int field_37;
+    long field_38;
+    int field_39; tag("Field39")
+    unsigned int field_40;
+    bool field_41;
+    bool field_42;
+    long field_43; tag("Field43")
+    unsigned int field_44;
+    bool field_45;
+    double field_46;
+    size_t field_47; tag("Field47")
+    long field_48;
+    float field_49;
+    int field_50;
+    float field_51; tag("Field51")
+    double field_52;
+    unsigned int field_53;
+    size_t field_54;
+    int field_55; tag("Field55")
+    int field_56;
+    const char* field_57;
+    double field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    size_t field_61;
+    double field_62;
+    double field_63; tag("Field63")
+} S21_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    int field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    float field_9;
+    int field_10;
+    const char* field_11; tag("Field11")
+    bool field_12;
+    const char* field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    long field_16;
+    float field_17;
+    size_t field_18;
+    float field_19; tag("Field19")
+    unsigned int field_20;
+    bool field_21;
+    unsigned int field_22;
+    double field_23; tag("Field23")
+    double field_24;
+    float field_25;
+    const char* field_26;
+    const char* field_27; tag("Field27")
+    long field_28;
+    const char* field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    const char* field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    long field_37;
+    float field_38;
+    double field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    bool field_42;
+    const char* field_43; tag("Field43")
+    const char* field_44;
+    const char* field_45;
+    double field_46;
+    long field_47; tag("Field47")
+    long field_48;
+    bool field_49;
+    const char* field_50;
+    float field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    double field_54;
+    const char* field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    float field_58;
+    double field_59; tag("Field59")
+    bool field_60;
+    long field_61;
+    bool field_62;
+    double field_63; tag("Field63")
+} S21_2 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    unsigned int field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    double field_10;
+    float field_11; tag("Field11")
+    bool field_12;
+    long field_13;
+    const char* field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    double field_17;
+    float field_18;
+    int field_19; tag("Field19")
+    const char* field_20;
+    bool field_21;
+    unsigned int field_22;
+    size_t field_23; tag("Field23")
+    long field_24;
+    double field_25;
+    const char* field_26;
+    int field_27; tag("Field27")
+    long field_28;
+    bool field_29;
+    float field_30;
+    size_t field_31; tag("Field31")
+    size_t field_32;
+    int field_33;
+    size_t field_34;
+    double field_35; tag("Field35")
+    long field_36;
+    long field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    float field_41;
+    int field_42;
+    unsigned int field_43; tag("Field43")
+    double field_44;
+    long field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    const char* field_48;
+    unsigned int field_49;
+    unsigned int field_50;
+    long field_51; tag("Field51")
+    const char* field_52;
+    double field_53;
+    float field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    unsigned int field_58;
+    float field_59; tag("Field59")
+    bool field_60;
+    int field_61;
+    bool field_62;
+    const char* field_63; tag("Field63")
+} S21_3 derive_all();
+
+#endif // F000021_H
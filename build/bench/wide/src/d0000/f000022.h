@@ -0,0 +1,274 @@
+#ifndef F000022_H
+#define F000022_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    unsigned int field_2;
+    bool field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+    bool field_8;
+    float field_9;
+    double field_10;
+    const char* field_11; tag("Field11")
+    int field_12;
+    double field_13;
+    const char* field_14;
+    int field_15; tag("Field15")
+    float field_16;
+    const char* field_17;
+    long field_18;
+    long field_19; tag("Field19")
+    double field_20;
+    bool field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    float field_24;
+    size_t field_25;
+    double field_26;
+    double field_27; tag("Field27")
+    float field_28;
+    unsigned int field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    const char* field_32;
+    unsigned int field_33;
+    size_t field_34;
+    size_t field_35; tag("Field35")
+    double field_36;
+    int field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    size_t field_40;
+    float field_41;
+    int field_42;
+    size_t field_43; tag("Field43")
+    float field_44;
+    const char* field_45;
+    unsigned int field_46;
+    unsigned int field_47; tag("Field47")
+    float field_48;
+    long field_49;
+    bool field_50;
+    int field_51; tag("Field51")
+    float field_52;
+    float field_53;
+    float field_54;
+    bool field_55; tag("Field55")
+    float field_56;
+    long field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    unsigned int field_61;
+    unsigned int field_62;
+    size_t field_63; tag("Field63")
+} S22_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    float field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    int field_6;
+    double field_7; tag("Field7")
+    double field_8;
+    size_t field_9;
+    long field_10;
+    bool field_11; tag("Field11")
+    int field_12;
+    bool field_13;
+    unsigned int field_14;
+    long field_15; tag("Field15")
+    float field_16;
+    long field_17;
+    double field_18;
+    int field_19; tag("Field19")
+    long field_20;
+    int field_21;
+    const char* field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    int field_25;
+    size_t field_26;
+    int field_27; tag("Field27")
+    float field_28;
+    float field_29;
+    bool field_30;
+    bool field_31; tag("Field31")
+    bool field_32;
+    size_t field_33;
+    bool field_34;
+    long field_35; tag("Field35")
+    float field_36;
+    bool field_37;
+    float field_38;
+    const char* field_39; tag("Field39")
+    double field_40;
+    float field_41;
+    float field_42;
+    size_t field_43; tag("Field43")
+    unsigned int field_44;
+    const char* field_45;
+    float field_46;
+    double field_47; tag("Field47")
+    int field_48;
+    double field_49;
+    float field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    long field_53;
+    unsigned int field_54;
+    unsigned int field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    const char* field_58;
+    const char* field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    long field_62;
+    const char* field_63; tag("Field63")
+} S22_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+    double field_8;
+    bool field_9;
+    int field_10;
+    int field_11; tag("Field11")
+    long field_12;
+    int field_13;
+    unsigned int field_14;
+    long field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    bool field_18;
+    long field_19; tag("Field19")
+    const char* field_20;
+    unsigned int field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    const char* field_24;
+    size_t field_25;
+    bool field_26;
+    const char* field_27; tag("Field27")
+    unsigned int field_28;
+    long field_29;
+    double field_30;
+    float field_31; tag("Field31")
+    unsigned int field_32;
+    bool field_33;
+    bool field_34;
+    size_t field_35; tag("Field35")
+    bool field_36;
+    int field_37;
+    long field_38;
+    size_t field_39; tag("Field39")
+    long field_40;
+    long field_41;
+    double field_42;
+    int field_43; tag("Field43")
+    float field_44;
+    const char* field_45;
+    bool field_46;
+    size_t field_47; tag("Field47")
+    bool field_48;
+    float field_49;
+    int field_50;
+    int field_51; tag("Field51")
+    const char* field_52;
+    const char* field_53;
+    size_t field_54;
+    const char* field_55; tag("Field55")
+    int field_56;
+    unsigned int field_57;
+    int field_58;
+    size_t field_59; tag("Field59")
+    long field_60;
+    int field_61;
+    bool field_62;
+    long field_63; tag("Field63")
+} S22_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    const char* field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+    bool field_8;
+    double field_9;
+    int field_10;
+    long field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    int field_14;
+    float field_15; tag("Field15")
+    const char* field_16;
+    int field_17;
+    double field_18;
+    bool field_19; tag("Field19")
+    bool field_20;
+    int field_21;
+    float field_22;
+    bool field_23; tag("Field23")
+    double field_24;
+    float field_25;
+    int field_26;
+    long field_27; tag("Field27")
+    long field_28;
+    size_t field_29;
+    bool field_30;
+    const char* field_31; tag("Field31")
+    size_t field_32;
+    const char* field_33;
+    size_t field_34;
+    long field_35; tag("Field35")
+    float field_36;
+    long field_37;
+    unsigned int field_38;
+    double field_39; tag("Field39")
+    size_t field_40;
+    const char* field_41;
+    const char* field_42;
+    unsigned int field_43; tag("Field43")
+    int field_44;
+    double field_45;
+    size_t field_46;
+    const char* field_47; tag("Field47")
+    const char* field_48;
+    bool field_49;
+    bool field_50;
+    unsigned int field_51; tag("Field51")
+    double field_52;
+    size_t field_53;
+    const char* field_54;
+    double field_55; tag("Field55")
+    int field_56;
+    long field_57;
+    long field_58;
+    long field_59; tag("Field59")
+    unsigned int field_60;
+    long field_61;
+    double field_62;
+    bool field_63; tag("Field63")
+} S22_3 derive_all();
+
+#endif // F000022_H
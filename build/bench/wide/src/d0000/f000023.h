@@ -0,0 +1,274 @@
+#ifndef F000023_H
+#define F000023_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    bool field_4;
+    int field_5;
+    unsigned int field_6;
+    float field_7; tag("Field7")
+    unsigned int field_8;
+    int field_9;
+    size_t field_10;
+    bool field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    size_t field_14;
+    const char* field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    bool field_18;
+    unsigned int field_19; tag("Field19")
+    bool field_20;
+    double field_21;
+    const char* field_22;
+    bool field_23; tag("Field23")
+    float field_24;
+    int field_25;
+    const char* field_26;
+    long field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    bool field_32;
+    unsigned int field_33;
+    size_t field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    unsigned int field_37;
+    bool field_38;
+    unsigned int field_39; tag("Field39")
+    const char* field_40;
+    float field_41;
+    unsigned int field_42;
+    float field_43; tag("Field43")
+    size_t field_44;
+    bool field_45;
+    const char* field_46;
+    size_t field_47; tag("Field47")
+    unsigned int field_48;
+    double field_49;
+    long field_50;
+    bool field_51; tag("Field51")
+    bool field_52;
+    double field_53;
+    const char* field_54;
+    float field_55; tag("Field55")
+    float field_56;
+    unsigned int field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    float field_60;
+    size_t field_61;
+    unsigned int field_62;
+    unsigned int field_63; tag("Field63")
+} S23_0 derive_all();
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    float field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    unsigned int field_9;
+    size_t field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    size_t field_13;
+    double field_14;
+    size_t field_15; tag("Field15")
+    unsigned int field_16;
+    int field_17;
+    float field_18;
+    unsigned int field_19; tag("Field19")
+    float field_20;
+    long field_21;
+    bool field_22;
+    float field_23; tag("Field23")
+    size_t field_24;
+    size_t field_25;
+    const char* field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    int field_30;
+    bool field_31; tag("Field31")
+    long field_32;
+    float field_33;
+    size_t field_34;
+    const char* field_35; tag("Field35")
+    long field_36;
+    long field_37;
+    long field_38;
+    bool field_39; tag("Field39")
+    unsigned int field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    double field_43; tag("Field43")
+    double field_44;
+    const char* field_45;
+    size_t field_46;
+    bool field_47; tag("Field47")
+    int field_48;
+    int field_49;
+    long field_50;
+    float field_51; tag("Field51")
+    size_t field_52;
+    double field_53;
+    const char* field_54;
+    int field_55; tag("Field55")
+    size_t field_56;
+    long field_57;
+    bool field_58;
+    long field_59; tag("Field59")
+    long field_60;
+    double field_61;
+    size_t field_62;
+    bool field_63; tag("Field63")
+} S23_1 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    double field_4;
+    bool field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    const char* field_9;
+    long field_10;
+    long field_11; tag("Field11")
+    float field_12;
+    const char* field_13;
+    unsigned int field_14;
+    bool field_15; tag("Field15")
+    long field_16;
+    double field_17;
+    const char* field_18;
+    bool field_19; tag("Field19")
+    long field_20;
+    float field_21;
+    bool field_22;
+    int field_23; tag("Field23")
+    long field_24;
+    double field_25;
+    long field_26;
+    const char* field_27; tag("Field27")
+    long field_28;
+    long field_29;
+    long field_30;
+    int field_31; tag("Field31")
+    unsigned int field_32;
+    float field_33;
+    float field_34;
+    double field_35; tag("Field35")
+    float field_36;
+    float field_37;
+    int field_38;
+    long field_39; tag("Field39")
+    unsigned int field_40;
+    float field_41;
+    int field_42;
+    unsigned int field_43; tag("Field43")
+    size_t field_44;
+    unsigned int field_45;
+    float field_46;
+    double field_47; tag("Field47")
+    bool field_48;
+    size_t field_49;
+    bool field_50;
+    float field_51; tag("Field51")
+    bool field_52;
+    double field_53;
+    size_t field_54;
+    float field_55; tag("Field55")
+    const char* field_56;
+    long field_57;
+    const char* field_58;
+    double field_59; tag("Field59")
+    float field_60;
+    size_t field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S23_2 derive_all();
+
+typedef struct {
+    long field_0;
+    double field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    size_t field_5;
+    float field_6;
+    unsigned int field_7; tag("Field7")
+    bool field_8;
+    size_t field_9;
+    long field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    unsigned int field_13;
+    float field_14;
+    unsigned int field_15; tag("Field15")
+    int field_16;
+    size_t field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    size_t field_20;
+    double field_21;
+    size_t field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    float field_25;
+    float field_26;
+    float field_27; tag("Field27")
+    float field_28;
+    double field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    unsigned int field_32;
+    unsigned int field_33;
+    double field_34;
+    float field_35; tag("Field35")
+    float field_36;
+    unsigned int field_37;
+    float field_38;
+    const char* field_39; tag("Field39")
+    float field_40;
+    double field_41;
+    double field_42;
+    long field_43; tag("Field43")
+    float field_44;
+    long field_45;
+    float field_46;
+    float field_47; tag("Field47")
+    int field_48;
+    double field_49;
+    float field_50;
+    int field_51; tag("Field51")
+    const char* field_52;
+    int field_53;
+    size_t field_54;
+    const char* field_55; tag("Field55")
+    size_t field_56;
+    size_t field_57;
+    size_t field_58;
+    size_t field_59; tag("Field59")
+    bool field_60;
+    long field_61;
+    double field_62;
+    double field_63; tag("Field63")
+} S23_3 derive_all();
+
+#endif // F000023_H
@@ -0,0 +1,274 @@
+#ifndef F000024_H
+#define F000024_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    bool field_7; tag("Field7")
+    long field_8;
+    bool field_9;
+    int field_10;
+    float field_11; tag("Field11")
+    double field_12;
+    float field_13;
+    long field_14;
+    int field_15; tag("Field15")
+    float field_16;
+    double field_17;
+    long field_18;
+    unsigned int field_19; tag("Field19")
+    float field_20;
+    const char* field_21;
+    const char* field_22;
+    bool field_23; tag("Field23")
+    bool field_24;
+    const char* field_25;
+    long field_26;
+    double field_27; tag("Field27")
+    const char* field_28;
+    long field_29;
+    int field_30;
+    int field_31; tag("Field31")
+    const char* field_32;
+    int field_33;
+    bool field_34;
+    unsigned int field_35; tag("Field35")
+    float field_36;
+    double field_37;
+    long field_38;
+    float field_39; tag("Field39")
+    double field_40;
+    long field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    long field_44;
+    const char* field_45;
+    const char* field_46;
+    size_t field_47; tag("Field47")
+    float field_48;
+    int field_49;
+    size_t field_50;
+    int field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    bool field_54;
+    size_t field_55; tag("Field55")
+    unsigned int field_56;
+    size_t field_57;
+    float field_58;
+    bool field_59; tag("Field59")
+    long field_60;
+    unsigned int field_61;
+    bool field_62;
+    unsigned int field_63; tag("Field63")
+} S24_0 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    float field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    bool field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    double field_12;
+    double field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    double field_16;
+    long field_17;
+    unsigned int field_18;
+    float field_19; tag("Field19")
+    size_t field_20;
+    long field_21;
+    const char* field_22;
+    size_t field_23; tag("Field23")
+    size_t field_24;
+    int field_25;
+    size_t field_26;
+    unsigned int field_27; tag("Field27")
+    bool field_28;
+    size_t field_29;
+    size_t field_30;
+    size_t field_31; tag("Field31")
+    int field_32;
+    unsigned int field_33;
+    double field_34;
+    unsigned int field_35; tag("Field35")
+    double field_36;
+    float field_37;
+    double field_38;
+    double field_39; tag("Field39")
+    int field_40;
+    unsigned int field_41;
+    long field_42;
+    unsigned int field_43; tag("Field43")
+    const char* field_44;
+    long field_45;
+    bool field_46;
+    bool field_47; tag("Field47")
+    size_t field_48;
+    double field_49;
+    const char* field_50;
+    long field_51; tag("Field51")
+    const char* field_52;
+    int field_53;
+    size_t field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    unsigned int field_58;
+    const char* field_59; tag("Field59")
+    unsigned int field_60;
+    int field_61;
+    const char* field_62;
+    unsigned int field_63; tag("Field63")
+} S24_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    float field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    int field_6;
+    const char* field_7; tag("Field7")
+    long field_8;
+    double field_9;
+    bool field_10;
+    const char* field_11; tag("Field11")
+    size_t field_12;
+    bool field_13;
+    long field_14;
+    float field_15; tag("Field15")
+    size_t field_16;
+    size_t field_17;
+    long field_18;
+    long field_19; tag("Field19")
+    const char* field_20;
+    int field_21;
+    unsigned int field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    const char* field_25;
+    float field_26;
+    double field_27; tag("Field27")
+    size_t field_28;
+    bool field_29;
+    size_t field_30;
+    unsigned int field_31; tag("Field31")
+    unsigned int field_32;
+    const char* field_33;
+    size_t field_34;
+    float field_35; tag("Field35")
+    long field_36;
+    size_t field_37;
+    int field_38;
+    float field_39; tag("Field39")
+    int field_40;
+    int field_41;
+    bool field_42;
+    const char* field_43; tag("Field43")
+    double field_44;
+    float field_45;
+    int field_46;
+    unsigned int field_47; tag("Field47")
+    double field_48;
+    int field_49;
+    unsigned int field_50;
+    bool field_51; tag("Field51")
+    long field_52;
+    int field_53;
+    int field_54;
+    int field_55; tag("Field55")
+    double field_56;
+    bool field_57;
+    size_t field_58;
+    size_t field_59; tag("Field59")
+    long field_60;
+    long field_61;
+    double field_62;
+    float field_63; tag("Field63")
+} S24_2 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    const char* field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    unsigned int field_5;
+    int field_6;
+    unsigned int field_7; tag("Field7")
+    bool field_8;
+    int field_9;
+    double field_10;
+    unsigned int field_11; tag("Field11")
+    long field_12;
+    int field_13;
+    unsigned int field_14;
+    double field_15; tag("Field15")
+    bool field_16;
+    long field_17;
+    int field_18;
+    bool field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    int field_22;
+    const char* field_23; tag("Field23")
+    unsigned int field_24;
+    float field_25;
+    size_t field_26;
+    int field_27; tag("Field27")
+    size_t field_28;
+    int field_29;
+    bool field_30;
+    bool field_31; tag("Field31")
+    int field_32;
+    long field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    size_t field_36;
+    bool field_37;
+    const char* field_38;
+    size_t field_39; tag("Field39")
+    unsigned int field_40;
+    unsigned int field_41;
+    float field_42;
+    unsigned int field_43; tag("Field43")
+    size_t field_44;
+    int field_45;
+    size_t field_46;
+    long field_47; tag("Field47")
+    long field_48;
+    unsigned int field_49;
+    int field_50;
+    bool field_51; tag("Field51")
+    bool field_52;
+    size_t field_53;
+    long field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    long field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    unsigned int field_60;
+    int field_61;
+    double field_62;
+    const char* field_63; tag("Field63")
+} S24_3 derive_all();
+
+#endif // F000024_H
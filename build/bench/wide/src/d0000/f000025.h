@@ -0,0 +1,274 @@
+#ifndef F000025_H
+#define F000025_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    float field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    size_t field_6;
+    bool field_7; tag("Field7")
+    double field_8;
+    const char* field_9;
+    float field_10;
+    const char* field_11; tag("Field11")
+    unsigned int field_12;
+    unsigned int field_13;
+    size_t field_14;
+    bool field_15; tag("Field15")
+    bool field_16;
+    long field_17;
+    unsigned int field_18;
+    float field_19; tag("Field19")
+    float field_20;
+    unsigned int field_21;
+    float field_22;
+    double field_23; tag("Field23")
+    bool field_24;
+    const char* field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    unsigned int field_28;
+    bool field_29;
+    const char* field_30;
+    unsigned int field_31; tag("Field31")
+    bool field_32;
+    size_t field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    long field_36;
+    long field_37;
+    const char* field_38;
+    double field_39; tag("Field39")
+    bool field_40;
+    int field_41;
+    double field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    const char* field_46;
+    double field_47; tag("Field47")
+    double field_48;
+    float field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    long field_52;
+    long field_53;
+    float field_54;
+    int field_55; tag("Field55")
+    const char* field_56;
+    bool field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    bool field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S25_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    bool field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    bool field_7; tag("Field7")
+    int field_8;
+    double field_9;
+    double field_10;
+    float field_11; tag("Field11")
+    int field_12;
+    unsigned int field_13;
+    size_t field_14;
+    const char* field_15; tag("Field15")
+    unsigned int field_16;
+    long field_17;
+    unsigned int field_18;
+    double field_19; tag("Field19")
+    long field_20;
+    long field_21;
+    double field_22;
+    double field_23; tag("Field23")
+    unsigned int field_24;
+    const char* field_25;
+    size_t field_26;
+    unsigned int field_27; tag("Field27")
+    size_t field_28;
+    bool field_29;
+    const char* field_30;
+    double field_31; tag("Field31")
+    double field_32;
+    bool field_33;
+    int field_34;
+    double field_35; tag("Field35")
+    size_t field_36;
+    long field_37;
+    size_t field_38;
+    long field_39; tag("Field39")
+    long field_40;
+    long field_41;
+    bool field_42;
+    size_t field_43; tag("Field43")
+    int field_44;
+    unsigned int field_45;
+    long field_46;
+    float field_47; tag("Field47")
+    unsigned int field_48;
+    size_t field_49;
+    long field_50;
+    const char* field_51; tag("Field51")
+    size_t field_52;
+    unsigned int field_53;
+    float field_54;
+    long field_55; tag("Field55")
+    const char* field_56;
+    float field_57;
+    size_t field_58;
+    long field_59; tag("Field59")
+    int field_60;
+    size_t field_61;
+    float field_62;
+    bool field_63; tag("Field63")
+} S25_1 derive_all();
+
+typedef struct {
+    bool field_0;
+    long field_1;
+    double field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    const char* field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    const char* field_9;
+    float field_10;
+    size_t field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    int field_14;
+    float field_15; tag("Field15")
+    size_t field_16;
+    long field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    long field_20;
+    unsigned int field_21;
+    float field_22;
+    double field_23; tag("Field23")
+    int field_24;
+    bool field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    const char* field_30;
+    double field_31; tag("Field31")
+    long field_32;
+    bool field_33;
+    unsigned int field_34;
+    float field_35; tag("Field35")
+    int field_36;
+    double field_37;
+    unsigned int field_38;
+    float field_39; tag("Field39")
+    int field_40;
+    size_t field_41;
+    int field_42;
+    long field_43; tag("Field43")
+    long field_44;
+    double field_45;
+    const char* field_46;
+    float field_47; tag("Field47")
+    bool field_48;
+    double field_49;
+    float field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    unsigned int field_53;
+    double field_54;
+    float field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    float field_60;
+    const char* field_61;
+    long field_62;
+    size_t field_63; tag("Field63")
+} S25_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    int field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    const char* field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+    int field_8;
+    unsigned int field_9;
+    const char* field_10;
+    const char* field_11; tag("Field11")
+    unsigned int field_12;
+    size_t field_13;
+    int field_14;
+    long field_15; tag("Field15")
+    size_t field_16;
+    unsigned int field_17;
+    size_t field_18;
+    bool field_19; tag("Field19")
+    double field_20;
+    double field_21;
+    bool field_22;
+    int field_23; tag("Field23")
+    double field_24;
+    long field_25;
+    float field_26;
+    long field_27; tag("Field27")
+    long field_28;
+    int field_29;
+    double field_30;
+    unsigned int field_31; tag("Field31")
+    long field_32;
+    unsigned int field_33;
+    bool field_34;
+    double field_35; tag("Field35")
+    const char* field_36;
+    double field_37;
+    double field_38;
+    const char* field_39; tag("Field39")
+    float field_40;
+    int field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    long field_44;
+    int field_45;
+    bool field_46;
+    size_t field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    double field_50;
+    const char* field_51; tag("Field51")
+    double field_52;
+    float field_53;
+    bool field_54;
+    const char* field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    unsigned int field_58;
+    float field_59; tag("Field59")
+    long field_60;
+    bool field_61;
+    int field_62;
+    const char* field_63; tag("Field63")
+} S25_3 derive_all();
+
+#endif // F000025_H
@@ -0,0 +1,274 @@
+#ifndef F000026_H
+#define F000026_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    const char* field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+    long field_8;
+    unsigned int field_9;
+    unsigned int field_10;
+    int field_11; tag("Field11")
+    unsigned int field_12;
+    long field_13;
+    long field_14;
+    unsigned int field_15; tag("Field15")
+    float field_16;
+    unsigned int field_17;
+    double field_18;
+    long field_19; tag("Field19")
+    bool field_20;
+    size_t field_21;
+    unsigned int field_22;
+    unsigned int field_23; tag("Field23")
+    const char* field_24;
+    int field_25;
+    float field_26;
+    bool field_27; tag("Field27")
+    int field_28;
+    long field_29;
+    double field_30;
+    size_t field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    float field_34;
+    size_t field_35; tag("Field35")
+    bool field_36;
+    int field_37;
+    double field_38;
+    unsigned int field_39; tag("Field39")
+    float field_40;
+    unsigned int field_41;
+    long field_42;
+    int field_43; tag("Field43")
+    long field_44;
+    unsigned int field_45;
+    int field_46;
+    unsigned int field_47; tag("Field47")
+    size_t field_48;
+    int field_49;
+    const char* field_50;
+    const char* field_51; tag("Field51")
+    float field_52;
+    double field_53;
+    bool field_54;
+    const char* field_55; tag("Field55")
+    size_t field_56;
+    size_t field_57;
+    unsigned int field_58;
+    const char* field_59; tag("Field59")
+    unsigned int field_60;
+    long field_61;
+    unsigned int field_62;
+    unsigned int field_63; tag("Field63")
+} S26_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    size_t field_1;
+    double field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+    long field_8;
+    unsigned int field_9;
+    double field_10;
+    int field_11; tag("Field11")
+    unsigned int field_12;
+    bool field_13;
+    unsigned int field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    int field_17;
+    float field_18;
+    size_t field_19; tag("Field19")
+    size_t field_20;
+    float field_21;
+    size_t field_22;
+    long field_23; tag("Field23")
+    const char* field_24;
+    int field_25;
+    bool field_26;
+    unsigned int field_27; tag("Field27")
+    long field_28;
+    const char* field_29;
+    int field_30;
+    const char* field_31; tag("Field31")
+    double field_32;
+    double field_33;
+    bool field_34;
+    const char* field_35; tag("Field35")
+    long field_36;
+    float field_37;
+    int field_38;
+    float field_39; tag("Field39")
+    bool field_40;
+    double field_41;
+    unsigned int field_42;
+    int field_43; tag("Field43")
+    bool field_44;
+    double field_45;
+    int field_46;
+    unsigned int field_47; tag("Field47")
+    long field_48;
+    long field_49;
+    size_t field_50;
+    unsigned int field_51; tag("Field51")
+    long field_52;
+    long field_53;
+    double field_54;
+    long field_55; tag("Field55")
+    const char* field_56;
+    const char* field_57;
+    unsigned int field_58;
+    float field_59; tag("Field59")
+    bool field_60;
+    const char* field_61;
+    float field_62;
+    int field_63; tag("Field63")
+} S26_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    int field_1;
+    const char* field_2;
+    float field_3; tag("Field3")
+    const char* field_4;
+    long field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+    bool field_8;
+    int field_9;
+    float field_10;
+    bool field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    long field_14;
+    double field_15; tag("Field15")
+    bool field_16;
+    size_t field_17;
+    size_t field_18;
+    unsigned int field_19; tag("Field19")
+    unsigned int field_20;
+    bool field_21;
+    float field_22;
+    double field_23; tag("Field23")
+    float field_24;
+    unsigned int field_25;
+    unsigned int field_26;
+    size_t field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    long field_30;
+    long field_31; tag("Field31")
+    size_t field_32;
+    bool field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    unsigned int field_36;
+    const char* field_37;
+    bool field_38;
+    double field_39; tag("Field39")
+    const char* field_40;
+    unsigned int field_41;
+    long field_42;
+    float field_43; tag("Field43")
+    double field_44;
+    const char* field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    double field_48;
+    const char* field_49;
+    double field_50;
+    double field_51; tag("Field51")
+    float field_52;
+    bool field_53;
+    size_t field_54;
+    float field_55; tag("Field55")
+    float field_56;
+    size_t field_57;
+    double field_58;
+    size_t field_59; tag("Field59")
+    int field_60;
+    int field_61;
+    bool field_62;
+    long field_63; tag("Field63")
+} S26_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    bool field_9;
+    size_t field_10;
+    double field_11; tag("Field11")
+    size_t field_12;
+    double field_13;
+    size_t field_14;
+    int field_15; tag("Field15")
+    unsigned int field_16;
+    const char* field_17;
+    unsigned int field_18;
+    long field_19; tag("Field19")
+    bool field_20;
+    bool field_21;
+    unsigned int field_22;
+    int field_23; tag("Field23")
+    long field_24;
+    double field_25;
+    long field_26;
+    double field_27; tag("Field27")
+    bool field_28;
+    long field_29;
+    bool field_30;
+    size_t field_31; tag("Field31")
+    bool field_32;
+    int field_33;
+    double field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    int field_37;
+    const char* field_38;
+    const char* field_39; tag("Field39")
+    size_t field_40;
+    double field_41;
+    bool field_42;
+    long field_43; tag("Field43")
+    float field_44;
+    unsigned int field_45;
+    size_t field_46;
+    float field_47; tag("Field47")
+    const char* field_48;
+    unsigned int field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    float field_52;
+    const char* field_53;
+    unsigned int field_54;
+    int field_55; tag("Field55")
+    bool field_56;
+    double field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    unsigned int field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S26_3 derive_all();
+
+#endif // F000026_H
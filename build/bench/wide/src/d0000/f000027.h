@@ -0,0 +1,274 @@
+#ifndef F000027_H
+#define F000027_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    size_t field_3; tag("Field3")
+    long field_4;
+    double field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    long field_9;
+    long field_10;
+    unsigned int field_11; tag("Field11")
+    long field_12;
+    float field_13;
+    const char* field_14;
+    int field_15; tag("Field15")
+    long field_16;
+    size_t field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    unsigned int field_20;
+    int field_21;
+    size_t field_22;
+    bool field_23; tag("Field23")
+    long field_24;
+    size_t field_25;
+    int field_26;
+    const char* field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    double field_30;
+    size_t field_31; tag("Field31")
+    float field_32;
+    float field_33;
+    long field_34;
+    double field_35; tag("Field35")
+    size_t field_36;
+    unsigned int field_37;
+    float field_38;
+    const char* field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    unsigned int field_42;
+    double field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    size_t field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    unsigned int field_49;
+    size_t field_50;
+    unsigned int field_51; tag("Field51")
+    int field_52;
+    size_t field_53;
+    long field_54;
+    size_t field_55; tag("Field55")
+    double field_56;
+    long field_57;
+    bool field_58;
+    long field_59; tag("Field59")
+    double field_60;
+    int field_61;
+    bool field_62;
+    unsigned int field_63; tag("Field63")
+} S27_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    bool field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+    unsigned int field_8;
+    size_t field_9;
+    size_t field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    size_t field_13;
+    unsigned int field_14;
+    int field_15; tag("Field15")
+    bool field_16;
+    long field_17;
+    bool field_18;
+    bool field_19; tag("Field19")
+    unsigned int field_20;
+    size_t field_21;
+    size_t field_22;
+    unsigned int field_23; tag("Field23")
+    double field_24;
+    bool field_25;
+    size_t field_26;
+    long field_27; tag("Field27")
+    unsigned int field_28;
+    float field_29;
+    long field_30;
+    const char* field_31; tag("Field31")
+    unsigned int field_32;
+    size_t field_33;
+    size_t field_34;
+    double field_35; tag("Field35")
+    size_t field_36;
+    float field_37;
+    unsigned int field_38;
+    double field_39; tag("Field39")
+    size_t field_40;
+    unsigned int field_41;
+    long field_42;
+    float field_43; tag("Field43")
+    bool field_44;
+    double field_45;
+    double field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    bool field_49;
+    bool field_50;
+    long field_51; tag("Field51")
+    double field_52;
+    const char* field_53;
+    double field_54;
+    long field_55; tag("Field55")
+    double field_56;
+    const char* field_57;
+    double field_58;
+    int field_59; tag("Field59")
+    const char* field_60;
+    int field_61;
+    double field_62;
+    size_t field_63; tag("Field63")
+} S27_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    const char* field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    float field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    double field_12;
+    const char* field_13;
+    double field_14;
+    float field_15; tag("Field15")
+    bool field_16;
+    unsigned int field_17;
+    int field_18;
+    float field_19; tag("Field19")
+    long field_20;
+    size_t field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    int field_24;
+    bool field_25;
+    int field_26;
+    unsigned int field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    unsigned int field_30;
+    bool field_31; tag("Field31")
+    double field_32;
+    size_t field_33;
+    const char* field_34;
+    const char* field_35; tag("Field35")
+    unsigned int field_36;
+    unsigned int field_37;
+    long field_38;
+    float field_39; tag("Field39")
+    size_t field_40;
+    long field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    double field_44;
+    size_t field_45;
+    float field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    int field_49;
+    bool field_50;
+    const char* field_51; tag("Field51")
+    const char* field_52;
+    unsigned int field_53;
+    const char* field_54;
+    bool field_55; tag("Field55")
+    const char* field_56;
+    const char* field_57;
+    bool field_58;
+    bool field_59; tag("Field59")
+    long field_60;
+    double field_61;
+    unsigned int field_62;
+    int field_63; tag("Field63")
+} S27_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    size_t field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    size_t field_5;
+    float field_6;
+    int field_7; tag("Field7")
+    float field_8;
+    const char* field_9;
+    size_t field_10;
+    double field_11; tag("Field11")
+    bool field_12;
+    int field_13;
+    float field_14;
+    int field_15; tag("Field15")
+    int field_16;
+    int field_17;
+    const char* field_18;
+    bool field_19; tag("Field19")
+    int field_20;
+    long field_21;
+    double field_22;
+    long field_23; tag("Field23")
+    int field_24;
+    int field_25;
+    unsigned int field_26;
+    size_t field_27; tag("Field27")
+    size_t field_28;
+    bool field_29;
+    long field_30;
+    unsigned int field_31; tag("Field31")
+    double field_32;
+    long field_33;
+    int field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    bool field_37;
+    unsigned int field_38;
+    const char* field_39; tag("Field39")
+    double field_40;
+    long field_41;
+    float field_42;
+    double field_43; tag("Field43")
+    double field_44;
+    long field_45;
+    size_t field_46;
+    double field_47; tag("Field47")
+    const char* field_48;
+    size_t field_49;
+    int field_50;
+    double field_51; tag("Field51")
+    unsigned int field_52;
+    long field_53;
+    unsigned int field_54;
+    const char* field_55; tag("Field55")
+    int field_56;
+    bool field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    size_t field_60;
+    unsigned int field_61;
+    int field_62;
+    float field_63; tag("Field63")
+} S27_3 derive_all();
+
+#endif // F000027_H
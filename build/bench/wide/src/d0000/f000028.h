@@ -0,0 +1,274 @@
+#ifndef F000028_H
+#define F000028_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    float field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    double field_6;
+    size_t field_7; tag("Field7")
+    const char* field_8;
+    const char* field_9;
+    float field_10;
+    size_t field_11; tag("Field11")
+    unsigned int field_12;
+    const char* field_13;
+    float field_14;
+    float field_15; tag("Field15")
+    double field_16;
+    size_t field_17;
+    bool field_18;
+    size_t field_19; tag("Field19")
+    float field_20;
+    const char* field_21;
+    int field_22;
+    float field_23; tag("Field23")
+    size_t field_24;
+    const char* field_25;
+    unsigned int field_26;
+    unsigned int field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    double field_30;
+    bool field_31; tag("Field31")
+    size_t field_32;
+    int field_33;
+    long field_34;
+    double field_35; tag("Field35")
+    long field_36;
+    const char* field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    unsigned int field_40;
+    unsigned int field_41;
+    const char* field_42;
+    float field_43; tag("Field43")
+    long field_44;
+    long field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    const char* field_48;
+    unsigned int field_49;
+    const char* field_50;
+    unsigned int field_51; tag("Field51")
+    const char* field_52;
+    const char* field_53;
+    double field_54;
+    double field_55; tag("Field55")
+    size_t field_56;
+    float field_57;
+    int field_58;
+    double field_59; tag("Field59")
+    const char* field_60;
+    double field_61;
+    int field_62;
+    long field_63; tag("Field63")
+} S28_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    long field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+    bool field_8;
+    double field_9;
+    const char* field_10;
+    double field_11; tag("Field11")
+    const char* field_12;
+    bool field_13;
+    unsigned int field_14;
+    float field_15; tag("Field15")
+    float field_16;
+    long field_17;
+    unsigned int field_18;
+    unsigned int field_19; tag("Field19")
+    bool field_20;
+    size_t field_21;
+    long field_22;
+    size_t field_23; tag("Field23")
+    size_t field_24;
+    const char* field_25;
+    const char* field_26;
+    bool field_27; tag("Field27")
+    int field_28;
+    long field_29;
+    const char* field_30;
+    long field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    unsigned int field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    bool field_37;
+    const char* field_38;
+    int field_39; tag("Field39")
+    float field_40;
+    long field_41;
+    float field_42;
+    size_t field_43; tag("Field43")
+    double field_44;
+    bool field_45;
+    long field_46;
+    const char* field_47; tag("Field47")
+    float field_48;
+    unsigned int field_49;
+    float field_50;
+    const char* field_51; tag("Field51")
+    const char* field_52;
+    size_t field_53;
+    size_t field_54;
+    const char* field_55; tag("Field55")
+    int field_56;
+    double field_57;
+    bool field_58;
+    unsigned int field_59; tag("Field59")
+    int field_60;
+    int field_61;
+    int field_62;
+    const char* field_63; tag("Field63")
+} S28_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    long field_1;
+    long field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    unsigned int field_5;
+    const char* field_6;
+    bool field_7; tag("Field7")
+    unsigned int field_8;
+    float field_9;
+    size_t field_10;
+    float field_11; tag("Field11")
+    size_t field_12;
+    long field_13;
+    unsigned int field_14;
+    int field_15; tag("Field15")
+    float field_16;
+    double field_17;
+    long field_18;
+    unsigned int field_19; tag("Field19")
+    size_t field_20;
+    size_t field_21;
+    long field_22;
+    size_t field_23; tag("Field23")
+    double field_24;
+    float field_25;
+    int field_26;
+    float field_27; tag("Field27")
+    unsigned int field_28;
+    double field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    long field_32;
+    bool field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    long field_36;
+    const char* field_37;
+    bool field_38;
+    size_t field_39; tag("Field39")
+    float field_40;
+    size_t field_41;
+    int field_42;
+    size_t field_43; tag("Field43")
+    long field_44;
+    size_t field_45;
+    bool field_46;
+    bool field_47; tag("Field47")
+    unsigned int field_48;
+    bool field_49;
+    size_t field_50;
+    unsigned int field_51; tag("Field51")
+    size_t field_52;
+    int field_53;
+    size_t field_54;
+    bool field_55; tag("Field55")
+    size_t field_56;
+    size_t field_57;
+    double field_58;
+    double field_59; tag("Field59")
+    size_t field_60;
+    int field_61;
+    float field_62;
+    double field_63; tag("Field63")
+} S28_2 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    long field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    double field_6;
+    unsigned int field_7; tag("Field7")
+    int field_8;
+    float field_9;
+    bool field_10;
+    bool field_11; tag("Field11")
+    bool field_12;
+    float field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    bool field_16;
+    long field_17;
+    size_t field_18;
+    double field_19; tag("Field19")
+    const char* field_20;
+    const char* field_21;
+    unsigned int field_22;
+    bool field_23; tag("Field23")
+    size_t field_24;
+    const char* field_25;
+    bool field_26;
+    bool field_27; tag("Field27")
+    float field_28;
+    unsigned int field_29;
+    float field_30;
+    long field_31; tag("Field31")
+    float field_32;
+    int field_33;
+    float field_34;
+    size_t field_35; tag("Field35")
+    float field_36;
+    double field_37;
+    const char* field_38;
+    float field_39; tag("Field39")
+    int field_40;
+    size_t field_41;
+    float field_42;
+    const char* field_43; tag("Field43")
+    long field_44;
+    long field_45;
+    double field_46;
+    const char* field_47; tag("Field47")
+    int field_48;
+    int field_49;
+    bool field_50;
+    int field_51; tag("Field51")
+    float field_52;
+    bool field_53;
+    size_t field_54;
+    unsigned int field_55; tag("Field55")
+    float field_56;
+    int field_57;
+    unsigned int field_58;
+    size_t field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    long field_62;
+    size_t field_63; tag("Field63")
+} S28_3 derive_all();
+
+#endif // F000028_H
@@ -0,0 +1,274 @@
+#ifndef F000029_H
+#define F000029_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    int field_4;
+    long field_5;
+    double field_6;
+    double field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    int field_10;
+    double field_11; tag("Field11")
+    long field_12;
+    double field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    double field_17;
+    unsigned int field_18;
+    double field_19; tag("Field19")
+    unsigned int field_20;
+    float field_21;
+    long field_22;
+    long field_23; tag("Field23")
+    int field_24;
+    long field_25;
+    long field_26;
+    size_t field_27; tag("Field27")
+    long field_28;
+    const char* field_29;
+    float field_30;
+    int field_31; tag("Field31")
+    bool field_32;
+    const char* field_33;
+    const char* field_34;
+    double field_35; tag("Field35")
+    size_t field_36;
+    double field_37;
+    bool field_38;
+    unsigned int field_39; tag("Field39")
+    size_t field_40;
+    int field_41;
+    long field_42;
+    unsigned int field_43; tag("Field43")
+    const char* field_44;
+    int field_45;
+    float field_46;
+    int field_47; tag("Field47")
+    unsigned int field_48;
+    float field_49;
+    const char* field_50;
+    long field_51; tag("Field51")
+    double field_52;
+    unsigned int field_53;
+    float field_54;
+    int field_55; tag("Field55")
+    const char* field_56;
+    bool field_57;
+    int field_58;
+    size_t field_59; tag("Field59")
+    bool field_60;
+    int field_61;
+    const char* field_62;
+    unsigned int field_63; tag("Field63")
+} S29_0 derive_all();
+
+typedef struct {
+    int field_0;
+    bool field_1;
+    size_t field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    const char* field_5;
+    int field_6;
+    size_t field_7; tag("Field7")
+    float field_8;
+    unsigned int field_9;
+    size_t field_10;
+    size_t field_11; tag("Field11")
+    unsigned int field_12;
+    long field_13;
+    int field_14;
+    int field_15; tag("Field15")
+    double field_16;
+    long field_17;
+    bool field_18;
+    unsigned int field_19; tag("Field19")
+    long field_20;
+    bool field_21;
+    int field_22;
+    unsigned int field_23; tag("Field23")
+    double field_24;
+    const char* field_25;
+    const char* field_26;
+    double field_27; tag("Field27")
+    size_t field_28;
+    const char* field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    int field_32;
+    double field_33;
+    unsigned int field_34;
+    bool field_35; tag("Field35")
+    size_t field_36;
+    double field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    bool field_40;
+    long field_41;
+    size_t field_42;
+    const char* field_43; tag("Field43")
+    unsigned int field_44;
+    const char* field_45;
+    bool field_46;
+    const char* field_47; tag("Field47")
+    double field_48;
+    long field_49;
+    unsigned int field_50;
+    int field_51; tag("Field51")
+    unsigned int field_52;
+    size_t field_53;
+    float field_54;
+    unsigned int field_55; tag("Field55")
+    float field_56;
+    bool field_57;
+    int field_58;
+    double field_59; tag("Field59")
+    const char* field_60;
+    int field_61;
+    long field_62;
+    unsigned int field_63; tag("Field63")
+} S29_1 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    int field_2;
+    float field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    size_t field_8;
+    long field_9;
+    double field_10;
+    bool field_11; tag("Field11")
+    float field_12;
+    size_t field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    size_t field_17;
+    bool field_18;
+    const char* field_19; tag("Field19")
+    bool field_20;
+    const char* field_21;
+    unsigned int field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    const char* field_25;
+    bool field_26;
+    double field_27; tag("Field27")
+    bool field_28;
+    float field_29;
+    size_t field_30;
+    size_t field_31; tag("Field31")
+    float field_32;
+    size_t field_33;
+    double field_34;
+    int field_35; tag("Field35")
+    double field_36;
+    const char* field_37;
+    size_t field_38;
+    const char* field_39; tag("Field39")
+    double field_40;
+    long field_41;
+    unsigned int field_42;
+    long field_43; tag("Field43")
+    int field_44;
+    bool field_45;
+    double field_46;
+    double field_47; tag("Field47")
+    float field_48;
+    int field_49;
+    bool field_50;
+    const char* field_51; tag("Field51")
+    unsigned int field_52;
+    const char* field_53;
+    float field_54;
+    int field_55; tag("Field55")
+    float field_56;
+    unsigned int field_57;
+    long field_58;
+    bool field_59; tag("Field59")
+    float field_60;
+    double field_61;
+    bool field_62;
+    long field_63; tag("Field63")
+} S29_2 derive_all();
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+    double field_8;
+    bool field_9;
+    const char* field_10;
+    int field_11; tag("Field11")
+    float field_12;
+    bool field_13;
+    const char* field_14;
+    double field_15; tag("Field15")
+    unsigned int field_16;
+    float field_17;
+    size_t field_18;
+    int field_19; tag("Field19")
+    long field_20;
+    float field_21;
+    unsigned int field_22;
+    double field_23; tag("Field23")
+    bool field_24;
+    long field_25;
+    const char* field_26;
+    unsigned int field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    const char* field_30;
+    float field_31; tag("Field31")
+    size_t field_32;
+    double field_33;
+    unsigned int field_34;
+    bool field_35; tag("Field35")
+    const char* field_36;
+    long field_37;
+    double field_38;
+    int field_39; tag("Field39")
+    int field_40;
+    int field_41;
+    bool field_42;
+    unsigned int field_43; tag("Field43")
+    float field_44;
+    bool field_45;
+    int field_46;
+    const char* field_47; tag("Field47")
+    int field_48;
+    size_t field_49;
+    double field_50;
+    const char* field_51; tag("Field51")
+    double field_52;
+    bool field_53;
+    unsigned int field_54;
+    float field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    long field_58;
+    bool field_59; tag("Field59")
+    unsigned int field_60;
+    bool field_61;
+    double field_62;
+    size_t field_63; tag("Field63")
+} S29_3 derive_all();
+
+#endif // F000029_H
@@ -0,0 +1,274 @@
+#ifndef F000030_H
+#define F000030_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    const char* field_0;
+    size_t field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    double field_5;
+    double field_6;
+    int field_7; tag("Field7")
+    bool field_8;
+    unsigned int field_9;
+    size_t field_10;
+    double field_11; tag("Field11")
+    int field_12;
+    float field_13;
+    long field_14;
+    float field_15; tag("Field15")
+    const char* field_16;
+    const char* field_17;
+    int field_18;
+    unsigned int field_19; tag("Field19")
+    long field_20;
+    unsigned int field_21;
+    bool field_22;
+    unsigned int field_23; tag("Field23")
+    int field_24;
+    bool field_25;
+    float field_26;
+    float field_27; tag("Field27")
+    double field_28;
+    int field_29;
+    double field_30;
+    size_t field_31; tag("Field31")
+    bool field_32;
+    int field_33;
+    size_t field_34;
+    int field_35; tag("Field35")
+    bool field_36;
+    float field_37;
+    bool field_38;
+    double field_39; tag("Field39")
+    bool field_40;
+    float field_41;
+    bool field_42;
+    long field_43; tag("Field43")
+    bool field_44;
+    unsigned int field_45;
+    float field_46;
+    float field_47; tag("Field47")
+    float field_48;
+    size_t field_49;
+    const char* field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    unsigned int field_53;
+    const char* field_54;
+    int field_55; tag("Field55")
+    float field_56;
+    unsigned int field_57;
+    int field_58;
+    double field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    unsigned int field_62;
+    double field_63; tag("Field63")
+} S30_0 derive_all();
+
+typedef struct {
+    long field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    unsigned int field_6;
+    long field_7; tag("Field7")
+    int field_8;
+    float field_9;
+    bool field_10;
+    float field_11; tag("Field11")
+    unsigned int field_12;
+    double field_13;
+    long field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    float field_17;
+    const char* field_18;
+    bool field_19; tag("Field19")
+    const char* field_20;
+    size_t field_21;
+    float field_22;
+    long field_23; tag("Field23")
+    bool field_24;
+    bool field_25;
+    bool field_26;
+    float field_27; tag("Field27")
+    float field_28;
+    size_t field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    bool field_32;
+    double field_33;
+    bool field_34;
+    unsigned int field_35; tag("Field35")
+    const char* field_36;
+    long field_37;
+    unsigned int field_38;
+    float field_39; tag("Field39")
+    size_t field_40;
+    const char* field_41;
+    long field_42;
+    int field_43; tag("Field43")
+    bool field_44;
+    long field_45;
+    bool field_46;
+    int field_47; tag("Field47")
+    unsigned int field_48;
+    int field_49;
+    float field_50;
+    float field_51; tag("Field51")
+    double field_52;
+    const char* field_53;
+    unsigned int field_54;
+    double field_55; tag("Field55")
+    unsigned int field_56;
+    unsigned int field_57;
+    unsigned int field_58;
+    bool field_59; tag("Field59")
+    size_t field_60;
+    long field_61;
+    double field_62;
+    unsigned int field_63; tag("Field63")
+} S30_1 derive_all();
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    const char* field_2;
+    double field_3; tag("Field3")
+    size_t field_4;
+    const char* field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+    const char* field_8;
+    size_t field_9;
+    double field_10;
+    bool field_11; tag("Field11")
+    unsigned int field_12;
+    const char* field_13;
+    int field_14;
+    int field_15; tag("Field15")
+    float field_16;
+    const char* field_17;
+    const char* field_18;
+    int field_19; tag("Field19")
+    long field_20;
+    double field_21;
+    float field_22;
+    const char* field_23; tag("Field23")
+    unsigned int field_24;
+    size_t field_25;
+    const char* field_26;
+    double field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    unsigned int field_32;
+    long field_33;
+    size_t field_34;
+    float field_35; tag("Field35")
+    int field_36;
+    double field_37;
+    int field_38;
+    double field_39; tag("Field39")
+    float field_40;
+    bool field_41;
+    double field_42;
+    bool field_43; tag("Field43")
+    int field_44;
+    int field_45;
+    float field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    bool field_49;
+    const char* field_50;
+    int field_51; tag("Field51")
+    float field_52;
+    float field_53;
+    long field_54;
+    size_t field_55; tag("Field55")
+    float field_56;
+    unsigned int field_57;
+    size_t field_58;
+    size_t field_59; tag("Field59")
+    size_t field_60;
+    int field_61;
+    const char* field_62;
+    bool field_63; tag("Field63")
+} S30_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    size_t field_1;
+    bool field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    int field_9;
+    int field_10;
+    float field_11; tag("Field11")
+    size_t field_12;
+    size_t field_13;
+    int field_14;
+    double field_15; tag("Field15")
+    unsigned int field_16;
+    float field_17;
+    unsigned int field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    bool field_21;
+    int field_22;
+    float field_23; tag("Field23")
+    int field_24;
+    long field_25;
+    long field_26;
+    int field_27; tag("Field27")
+    double field_28;
+    float field_29;
+    long field_30;
+    size_t field_31; tag("Field31")
+    size_t field_32;
+    int field_33;
+    int field_34;
+    const char* field_35; tag("Field35")
+    unsigned int field_36;
+    size_t field_37;
+    bool field_38;
+    float field_39; tag("Field39")
+    long field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    int field_43; tag("Field43")
+    unsigned int field_44;
+    double field_45;
+    bool field_46;
+    int field_47; tag("Field47")
+    const char* field_48;
+    long field_49;
+    long field_50;
+    long field_51; tag("Field51")
+    int field_52;
+    int field_53;
+    unsigned int field_54;
+    int field_55; tag("Field55")
+    long field_56;
+    double field_57;
+    size_t field_58;
+    int field_59; tag("Field59")
+    long field_60;
+    const char* field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S30_3 derive_all();
+
+#endif // F000030_H
@@ -0,0 +1,274 @@
+#ifndef F000031_H
+#define F000031_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+    float field_8;
+    double field_9;
+    long field_10;
+    size_t field_11; tag("Field11")
+    bool field_12;
+    bool field_13;
+    unsigned int field_14;
+    double field_15; tag("Field15")
+    bool field_16;
+    size_t field_17;
+    long field_18;
+    float field_19; tag("Field19")
+    long field_20;
+    float field_21;
+    float field_22;
+    int field_23; tag("Field23")
+    unsigned int field_24;
+    size_t field_25;
+    size_t field_26;
+    long field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    size_t field_30;
+    long field_31; tag("Field31")
+    bool field_32;
+    const char* field_33;
+    size_t field_34;
+    const char* field_35; tag("Field35")
+    long field_36;
+    unsigned int field_37;
+    unsigned int field_38;
+    unsigned int field_39; tag("Field39")
+    double field_40;
+    bool field_41;
+    double field_42;
+    double field_43; tag("Field43")
+    float field_44;
+    int field_45;
+    size_t field_46;
+    const char* field_47; tag("Field47")
+    unsigned int field_48;
+    unsigned int field_49;
+    unsigned int field_50;
+    unsigned int field_51; tag("Field51")
+    float field_52;
+    const char* field_53;
+    float field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    double field_57;
+    float field_58;
+    size_t field_59; tag("Field59")
+    unsigned int field_60;
+    long field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S31_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    bool field_1;
+    double field_2;
+    double field_3; tag("Field3")
+    long field_4;
+    long field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+    size_t field_8;
+    bool field_9;
+    bool field_10;
+    long field_11; tag("Field11")
+    long field_12;
+    double field_13;
+    bool field_14;
+    unsigned int field_15; tag("Field15")
+    bool field_16;
+    int field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    int field_20;
+    int field_21;
+    size_t field_22;
+    float field_23; tag("Field23")
+    int field_24;
+    double field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    int field_30;
+    const char* field_31; tag("Field31")
+    size_t field_32;
+    float field_33;
+    bool field_34;
+    float field_35; tag("Field35")
+    long field_36;
+    size_t field_37;
+    double field_38;
+    float field_39; tag("Field39")
+    int field_40;
+    size_t field_41;
+    bool field_42;
+    float field_43; tag("Field43")
+    double field_44;
+    float field_45;
+    const char* field_46;
+    size_t field_47; tag("Field47")
+    unsigned int field_48;
+    bool field_49;
+    bool field_50;
+    const char* field_51; tag("Field51")
+    float field_52;
+    bool field_53;
+    int field_54;
+    float field_55; tag("Field55")
+    float field_56;
+    float field_57;
+    unsigned int field_58;
+    int field_59; tag("Field59")
+    float field_60;
+    bool field_61;
+    size_t field_62;
+    bool field_63; tag("Field63")
+} S31_1 derive_all();
+
+typedef struct {
+    double field_0;
+    float field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    long field_5;
+    const char* field_6;
+    size_t field_7; tag("Field7")
+    int field_8;
+    long field_9;
+    float field_10;
+    bool field_11; tag("Field11")
+    long field_12;
+    int field_13;
+    long field_14;
+    bool field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    bool field_18;
+    double field_19; tag("Field19")
+    const char* field_20;
+    double field_21;
+    bool field_22;
+    unsigned int field_23; tag("Field23")
+    long field_24;
+    float field_25;
+    size_t field_26;
+    size_t field_27; tag("Field27")
+    int field_28;
+    float field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    size_t field_32;
+    bool field_33;
+    float field_34;
+    bool field_35; tag("Field35")
+    size_t field_36;
+    bool field_37;
+    int field_38;
+    double field_39; tag("Field39")
+    unsigned int field_40;
+    double field_41;
+    double field_42;
+    float field_43; tag("Field43")
+    float field_44;
+    unsigned int field_45;
+    unsigned int field_46;
+    float field_47; tag("Field47")
+    double field_48;
+    bool field_49;
+    bool field_50;
+    double field_51; tag("Field51")
+    bool field_52;
+    unsigned int field_53;
+    float field_54;
+    int field_55; tag("Field55")
+    const char* field_56;
+    unsigned int field_57;
+    int field_58;
+    const char* field_59; tag("Field59")
+    float field_60;
+    float field_61;
+    bool field_62;
+    unsigned int field_63; tag("Field63")
+} S31_2 derive_all();
+
+typedef struct {
+    int field_0;
+    long field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    float field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    bool field_8;
+    long field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    size_t field_12;
+    double field_13;
+    size_t field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    int field_17;
+    double field_18;
+    bool field_19; tag("Field19")
+    unsigned int field_20;
+    size_t field_21;
+    float field_22;
+    int field_23; tag("Field23")
+    size_t field_24;
+    long field_25;
+    const char* field_26;
+    size_t field_27; tag("Field27")
+    const char* field_28;
+    unsigned int field_29;
+    size_t field_30;
+    double field_31; tag("Field31")
+    long field_32;
+    float field_33;
+    bool field_34;
+    float field_35; tag("Field35")
+    float field_36;
+    const char* field_37;
+    long field_38;
+    float field_39; tag("Field39")
+    float field_40;
+    const char* field_41;
+    bool field_42;
+    double field_43; tag("Field43")
+    long field_44;
+    size_t field_45;
+    const char* field_46;
+    float field_47; tag("Field47")
+    size_t field_48;
+    const char* field_49;
+    bool field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    bool field_53;
+    double field_54;
+    long field_55; tag("Field55")
+    size_t field_56;
+    long field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    long field_60;
+    bool field_61;
+    size_t field_62;
+    float field_63; tag("Field63")
+} S31_3 derive_all();
+
+#endif // F000031_H
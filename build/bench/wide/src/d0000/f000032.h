@@ -0,0 +1,274 @@
+#ifndef F000032_H
+#define F000032_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    float field_2;
+    const char* field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    long field_6;
+    float field_7; tag("Field7")
+    unsigned int field_8;
+    bool field_9;
+    unsigned int field_10;
+    long field_11; tag("Field11")
+    size_t field_12;
+    unsigned int field_13;
+    float field_14;
+    bool field_15; tag("Field15")
+    unsigned int field_16;
+    size_t field_17;
+    float field_18;
+    bool field_19; tag("Field19")
+    unsigned int field_20;
+    size_t field_21;
+    bool field_22;
+    bool field_23; tag("Field23")
+    double field_24;
+    double field_25;
+    const char* field_26;
+    size_t field_27; tag("Field27")
+    long field_28;
+    float field_29;
+    double field_30;
+    size_t field_31; tag("Field31")
+    unsigned int field_32;
+    bool field_33;
+    float field_34;
+    long field_35; tag("Field35")
+    unsigned int field_36;
+    double field_37;
+    unsigned int field_38;
+    int field_39; tag("Field39")
+    int field_40;
+    bool field_41;
+    bool field_42;
+    unsigned int field_43; tag("Field43")
+    unsigned int field_44;
+    bool field_45;
+    bool field_46;
+    const char* field_47; tag("Field47")
+    size_t field_48;
+    size_t field_49;
+    bool field_50;
+    double field_51; tag("Field51")
+    long field_52;
+    float field_53;
+    int field_54;
+    unsigned int field_55; tag("Field55")
+    unsigned int field_56;
+    double field_57;
+    int field_58;
+    double field_59; tag("Field59")
+    size_t field_60;
+    long field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S32_0 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    long field_3; tag("Field3")
+    double field_4;
+    double field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+    int field_8;
+    bool field_9;
+    const char* field_10;
+    const char* field_11; tag("Field11")
+    unsigned int field_12;
+    bool field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    const char* field_16;
+    float field_17;
+    bool field_18;
+    size_t field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    float field_22;
+    const char* field_23; tag("Field23")
+    unsigned int field_24;
+    const char* field_25;
+    const char* field_26;
+    long field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    int field_34;
+    unsigned int field_35; tag("Field35")
+    unsigned int field_36;
+    size_t field_37;
+    const char* field_38;
+    long field_39; tag("Field39")
+    int field_40;
+    bool field_41;
+    bool field_42;
+    int field_43; tag("Field43")
+    unsigned int field_44;
+    float field_45;
+    bool field_46;
+    size_t field_47; tag("Field47")
+    const char* field_48;
+    double field_49;
+    bool field_50;
+    int field_51; tag("Field51")
+    double field_52;
+    int field_53;
+    int field_54;
+    float field_55; tag("Field55")
+    int field_56;
+    size_t field_57;
+    bool field_58;
+    unsigned int field_59; tag("Field59")
+    long field_60;
+    double field_61;
+    float field_62;
+    bool field_63; tag("Field63")
+} S32_1 derive_all();
+
+typedef struct {
+    float field_0;
+    int field_1;
+    unsigned int field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    long field_5;
+    float field_6;
+    float field_7; tag("Field7")
+    int field_8;
+    unsigned int field_9;
+    bool field_10;
+    bool field_11; tag("Field11")
+    const char* field_12;
+    const char* field_13;
+    size_t field_14;
+    long field_15; tag("Field15")
+    float field_16;
+    bool field_17;
+    double field_18;
+    int field_19; tag("Field19")
+    const char* field_20;
+    const char* field_21;
+    int field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    double field_25;
+    float field_26;
+    float field_27; tag("Field27")
+    double field_28;
+    float field_29;
+    const char* field_30;
+    size_t field_31; tag("Field31")
+    unsigned int field_32;
+    size_t field_33;
+    unsigned int field_34;
+    float field_35; tag("Field35")
+    float field_36;
+    int field_37;
+    float field_38;
+    const char* field_39; tag("Field39")
+    float field_40;
+    bool field_41;
+    int field_42;
+    double field_43; tag("Field43")
+    double field_44;
+    long field_45;
+    int field_46;
+    float field_47; tag("Field47")
+    double field_48;
+    int field_49;
+    int field_50;
+    size_t field_51; tag("Field51")
+    double field_52;
+    long field_53;
+    unsigned int field_54;
+    long field_55; tag("Field55")
+    size_t field_56;
+    bool field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    unsigned int field_60;
+    double field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S32_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    long field_1;
+    const char* field_2;
+    unsigned int field_3; tag("Field3")
+    float field_4;
+    int field_5;
+    double field_6;
+    const char* field_7; tag("Field7")
+    unsigned int field_8;
+    long field_9;
+    bool field_10;
+    double field_11; tag("Field11")
+    int field_12;
+    long field_13;
+    long field_14;
+    unsigned int field_15; tag("Field15")
+    const char* field_16;
+    bool field_17;
+    int field_18;
+    float field_19; tag("Field19")
+    float field_20;
+    bool field_21;
+    unsigned int field_22;
+    const char* field_23; tag("Field23")
+    double field_24;
+    unsigned int field_25;
+    float field_26;
+    unsigned int field_27; tag("Field27")
+    double field_28;
+    long field_29;
+    const char* field_30;
+    unsigned int field_31; tag("Field31")
+    double field_32;
+    long field_33;
+    bool field_34;
+    const char* field_35; tag("Field35")
+    unsigned int field_36;
+    bool field_37;
+    size_t field_38;
+    float field_39; tag("Field39")
+    float field_40;
+    float field_41;
+    float field_42;
+    long field_43; tag("Field43")
+    float field_44;
+    bool field_45;
+    float field_46;
+    int field_47; tag("Field47")
+    size_t field_48;
+    double field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    float field_52;
+    float field_53;
+    double field_54;
+    size_t field_55; tag("Field55")
+    size_t field_56;
+    double field_57;
+    double field_58;
+    double field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    double field_62;
+    float field_63; tag("Field63")
+} S32_3 derive_all();
+
+#endif // F000032_H
@@ -0,0 +1,274 @@
+#ifndef F000033_H
+#define F000033_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    size_t field_0;
+    bool field_1;
+    long field_2;
+    long field_3; tag("Field3")
+    long field_4;
+    int field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+    bool field_8;
+    size_t field_9;
+    bool field_10;
+    size_t field_11; tag("Field11")
+    const char* field_12;
+    double field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    float field_16;
+    bool field_17;
+    long field_18;
+    size_t field_19; tag("Field19")
+    long field_20;
+    bool field_21;
+    bool field_22;
+    float field_23; tag("Field23")
+    long field_24;
+    float field_25;
+    unsigned int field_26;
+    double field_27; tag("Field27")
+    bool field_28;
+    double field_29;
+    size_t field_30;
+    float field_31; tag("Field31")
+    int field_32;
+    unsigned int field_33;
+    int field_34;
+    const char* field_35; tag("Field35")
+    int field_36;
+    size_t field_37;
+    bool field_38;
+    const char* field_39; tag("Field39")
+    float field_40;
+    unsigned int field_41;
+    double field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    double field_46;
+    bool field_47; tag("Field47")
+    bool field_48;
+    bool field_49;
+    bool field_50;
+    float field_51; tag("Field51")
+    float field_52;
+    long field_53;
+    int field_54;
+    size_t field_55; tag("Field55")
+    long field_56;
+    double field_57;
+    bool field_58;
+    float field_59; tag("Field59")
+    size_t field_60;
+    float field_61;
+    float field_62;
+    size_t field_63; tag("Field63")
+} S33_0 derive_all();
+
+typedef struct {
+    const char* field_0;
+    bool field_1;
+    float field_2;
+    int field_3; tag("Field3")
+    const char* field_4;
+    float field_5;
+    const char* field_6;
+    const char* field_7; tag("Field7")
+    float field_8;
+    float field_9;
+    unsigned int field_10;
+    long field_11; tag("Field11")
+    int field_12;
+    bool field_13;
+    bool field_14;
+    float field_15; tag("Field15")
+    int field_16;
+    const char* field_17;
+    long field_18;
+    size_t field_19; tag("Field19")
+    bool field_20;
+    double field_21;
+    size_t field_22;
+    float field_23; tag("Field23")
+    unsigned int field_24;
+    size_t field_25;
+    int field_26;
+    bool field_27; tag("Field27")
+    const char* field_28;
+    bool field_29;
+    bool field_30;
+    float field_31; tag("Field31")
+    double field_32;
+    float field_33;
+    double field_34;
+    float field_35; tag("Field35")
+    unsigned int field_36;
+    float field_37;
+    const char* field_38;
+    size_t field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    long field_42;
+    float field_43; tag("Field43")
+    unsigned int field_44;
+    double field_45;
+    double field_46;
+    long field_47; tag("Field47")
+    float field_48;
+    unsigned int field_49;
+    unsigned int field_50;
+    bool field_51; tag("Field51")
+    double field_52;
+    unsigned int field_53;
+    int field_54;
+    const char* field_55; tag("Field55")
+    float field_56;
+    double field_57;
+    size_t field_58;
+    long field_59; tag("Field59")
+    double field_60;
+    size_t field_61;
+    size_t field_62;
+    long field_63; tag("Field63")
+} S33_1 derive_all();
+
+typedef struct {
+    long field_0;
+    long field_1;
+    const char* field_2;
+    long field_3; tag("Field3")
+    unsigned int field_4;
+    bool field_5;
+    bool field_6;
+    const char* field_7; tag("Field7")
+    bool field_8;
+    int field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    double field_12;
+    unsigned int field_13;
+    unsigned int field_14;
+    unsigned int field_15; tag("Field15")
+    int field_16;
+    const char* field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    size_t field_20;
+    bool field_21;
+    const char* field_22;
+    int field_23; tag("Field23")
+    const char* field_24;
+    float field_25;
+    size_t field_26;
+    size_t field_27; tag("Field27")
+    unsigned int field_28;
+    int field_29;
+    long field_30;
+    long field_31; tag("Field31")
+    long field_32;
+    float field_33;
+    const char* field_34;
+    float field_35; tag("Field35")
+    float field_36;
+    unsigned int field_37;
+    unsigned int field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    double field_41;
+    const char* field_42;
+    double field_43; tag("Field43")
+    long field_44;
+    long field_45;
+    long field_46;
+    double field_47; tag("Field47")
+    unsigned int field_48;
+    size_t field_49;
+    size_t field_50;
+    double field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    bool field_54;
+    long field_55; tag("Field55")
+    const char* field_56;
+    size_t field_57;
+    long field_58;
+    unsigned int field_59; tag("Field59")
+    double field_60;
+    float field_61;
+    const char* field_62;
+    unsigned int field_63; tag("Field63")
+} S33_2 derive_all();
+
+typedef struct {
+    float field_0;
+    const char* field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    int field_5;
+    const char* field_6;
+    float field_7; tag("Field7")
+    const char* field_8;
+    float field_9;
+    size_t field_10;
+    float field_11; tag("Field11")
+    double field_12;
+    bool field_13;
+    unsigned int field_14;
+    bool field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    float field_18;
+    int field_19; tag("Field19")
+    const char* field_20;
+    const char* field_21;
+    long field_22;
+    bool field_23; tag("Field23")
+    double field_24;
+    double field_25;
+    bool field_26;
+    const char* field_27; tag("Field27")
+    unsigned int field_28;
+    unsigned int field_29;
+    int field_30;
+    float field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    const char* field_34;
+    int field_35; tag("Field35")
+    float field_36;
+    long field_37;
+    const char* field_38;
+    long field_39; tag("Field39")
+    bool field_40;
+    int field_41;
+    bool field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    size_t field_45;
+    const char* field_46;
+    bool field_47; tag("Field47")
+    int field_48;
+    unsigned int field_49;
+    const char* field_50;
+    double field_51; tag("Field51")
+    float field_52;
+    bool field_53;
+    int field_54;
+    float field_55; tag("Field55")
+    size_t field_56;
+    bool field_57;
+    int field_58;
+    long field_59; tag("Field59")
+    double field_60;
+    long field_61;
+    size_t field_62;
+    unsigned int field_63; tag("Field63")
+} S33_3 derive_all();
+
+#endif // F000033_H
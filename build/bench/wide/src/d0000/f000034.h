@@ -0,0 +1,274 @@
+#ifndef F000034_H
+#define F000034_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    int field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    double field_5;
+    float field_6;
+    double field_7; tag("Field7")
+    double field_8;
+    float field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    float field_12;
+    unsigned int field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    const char* field_16;
+    bool field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    double field_20;
+    int field_21;
+    int field_22;
+    float field_23; tag("Field23")
+    double field_24;
+    double field_25;
+    const char* field_26;
+    const char* field_27; tag("Field27")
+    unsigned int field_28;
+    const char* field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    float field_32;
+    bool field_33;
+    size_t field_34;
+    int field_35; tag("Field35")
+    float field_36;
+    int field_37;
+    const char* field_38;
+    bool field_39; tag("Field39")
+    double field_40;
+    int field_41;
+    const char* field_42;
+    long field_43; tag("Field43")
+    double field_44;
+    const char* field_45;
+    double field_46;
+    const char* field_47; tag("Field47")
+    bool field_48;
+    const char* field_49;
+    double field_50;
+    size_t field_51; tag("Field51")
+    unsigned int field_52;
+    unsigned int field_53;
+    long field_54;
+    size_t field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    const char* field_58;
+    float field_59; tag("Field59")
+    unsigned int field_60;
+    size_t field_61;
+    bool field_62;
+    double field_63; tag("Field63")
+} S34_0 derive_all();
+
+typedef struct {
+    double field_0;
+    int field_1;
+    size_t field_2;
+    long field_3; tag("Field3")
+    int field_4;
+    bool field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    size_t field_10;
+    const char* field_11; tag("Field11")
+    float field_12;
+    unsigned int field_13;
+    bool field_14;
+    unsigned int field_15; tag("Field15")
+    unsigned int field_16;
+    int field_17;
+    unsigned int field_18;
+    bool field_19; tag("Field19")
+    const char* field_20;
+    bool field_21;
+    const char* field_22;
+    float field_23; tag("Field23")
+    long field_24;
+    const char* field_25;
+    const char* field_26;
+    size_t field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    bool field_30;
+    const char* field_31; tag("Field31")
+    bool field_32;
+    unsigned int field_33;
+    bool field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    int field_37;
+    bool field_38;
+    unsigned int field_39; tag("Field39")
+    bool field_40;
+    size_t field_41;
+    unsigned int field_42;
+    size_t field_43; tag("Field43")
+    size_t field_44;
+    long field_45;
+    float field_46;
+    float field_47; tag("Field47")
+    float field_48;
+    double field_49;
+    const char* field_50;
+    unsigned int field_51; tag("Field51")
+    long field_52;
+    unsigned int field_53;
+    size_t field_54;
+    double field_55; tag("Field55")
+    double field_56;
+    double field_57;
+    int field_58;
+    int field_59; tag("Field59")
+    int field_60;
+    bool field_61;
+    float field_62;
+    float field_63; tag("Field63")
+} S34_1 derive_all();
+
+typedef struct {
+    double field_0;
+    unsigned int field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    const char* field_6;
+    unsigned int field_7; tag("Field7")
+    const char* field_8;
+    unsigned int field_9;
+    size_t field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    const char* field_13;
+    unsigned int field_14;
+    float field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    int field_18;
+    double field_19; tag("Field19")
+    unsigned int field_20;
+    bool field_21;
+    double field_22;
+    bool field_23; tag("Field23")
+    bool field_24;
+    float field_25;
+    long field_26;
+    float field_27; tag("Field27")
+    bool field_28;
+    int field_29;
+    int field_30;
+    int field_31; tag("Field31")
+    long field_32;
+    bool field_33;
+    unsigned int field_34;
+    float field_35; tag("Field35")
+    bool field_36;
+    size_t field_37;
+    double field_38;
+    unsigned int field_39; tag("Field39")
+    unsigned int field_40;
+    int field_41;
+    bool field_42;
+    size_t field_43; tag("Field43")
+    bool field_44;
+    long field_45;
+    float field_46;
+    bool field_47; tag("Field47")
+    long field_48;
+    const char* field_49;
+    unsigned int field_50;
+    unsigned int field_51; tag("Field51")
+    size_t field_52;
+    const char* field_53;
+    const char* field_54;
+    double field_55; tag("Field55")
+    long field_56;
+    float field_57;
+    float field_58;
+    bool field_59; tag("Field59")
+    bool field_60;
+    size_t field_61;
+    size_t field_62;
+    int field_63; tag("Field63")
+} S34_2 derive_all();
+
+typedef struct {
+    float field_0;
+    size_t field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    long field_4;
+    bool field_5;
+    bool field_6;
+    bool field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    double field_10;
+    long field_11; tag("Field11")
+    bool field_12;
+    long field_13;
+    long field_14;
+    const char* field_15; tag("Field15")
+    long field_16;
+    unsigned int field_17;
+    long field_18;
+    float field_19; tag("Field19")
+    unsigned int field_20;
+    bool field_21;
+    double field_22;
+    float field_23; tag("Field23")
+    const char* field_24;
+    float field_25;
+    long field_26;
+    double field_27; tag("Field27")
+    long field_28;
+    bool field_29;
+    size_t field_30;
+    bool field_31; tag("Field31")
+    size_t field_32;
+    size_t field_33;
+    unsigned int field_34;
+    size_t field_35; tag("Field35")
+    int field_36;
+    size_t field_37;
+    double field_38;
+    unsigned int field_39; tag("Field39")
+    float field_40;
+    double field_41;
+    long field_42;
+    double field_43; tag("Field43")
+    unsigned int field_44;
+    unsigned int field_45;
+    bool field_46;
+    unsigned int field_47; tag("Field47")
+    long field_48;
+    float field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    float field_52;
+    long field_53;
+    size_t field_54;
+    double field_55; tag("Field55")
+    int field_56;
+    float field_57;
+    float field_58;
+    const char* field_59; tag("Field59")
+    const char* field_60;
+    size_t field_61;
+    size_t field_62;
+    double field_63; tag("Field63")
+} S34_3 derive_all();
+
+#endif // F000034_H
@@ -0,0 +1,274 @@
+#ifndef F000035_H
+#define F000035_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    unsigned int field_0;
+    int field_1;
+    long field_2;
+    const char* field_3; tag("Field3")
+    long field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+    const char* field_8;
+    bool field_9;
+    long field_10;
+    float field_11; tag("Field11")
+    bool field_12;
+    float field_13;
+    bool field_14;
+    size_t field_15; tag("Field15")
+    long field_16;
+    int field_17;
+    double field_18;
+    size_t field_19; tag("Field19")
+    const char* field_20;
+    size_t field_21;
+    double field_22;
+    size_t field_23; tag("Field23")
+    unsigned int field_24;
+    int field_25;
+    unsigned int field_26;
+    size_t field_27; tag("Field27")
+    float field_28;
+    double field_29;
+    unsigned int field_30;
+    const char* field_31; tag("Field31")
+    double field_32;
+    const char* field_33;
+    const char* field_34;
+    unsigned int field_35; tag("Field35")
+    long field_36;
+    bool field_37;
+    const char* field_38;
+    bool field_39; tag("Field39")
+    bool field_40;
+    unsigned int field_41;
+    size_t field_42;
+    int field_43; tag("Field43")
+    const char* field_44;
+    float field_45;
+    unsigned int field_46;
+    bool field_47; tag("Field47")
+    int field_48;
+    const char* field_49;
+    const char* field_50;
+    size_t field_51; tag("Field51")
+    unsigned int field_52;
+    unsigned int field_53;
+    int field_54;
+    unsigned int field_55; tag("Field55")
+    float field_56;
+    size_t field_57;
+    size_t field_58;
+    const char* field_59; tag("Field59")
+    double field_60;
+    const char* field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S35_0 derive_all();
+
+typedef struct {
+    size_t field_0;
+    int field_1;
+    const char* field_2;
+    int field_3; tag("Field3")
+    int field_4;
+    unsigned int field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    int field_8;
+    double field_9;
+    double field_10;
+    bool field_11; tag("Field11")
+    long field_12;
+    unsigned int field_13;
+    double field_14;
+    float field_15; tag("Field15")
+    int field_16;
+    const char* field_17;
+    int field_18;
+    int field_19; tag("Field19")
+    bool field_20;
+    bool field_21;
+    bool field_22;
+    int field_23; tag("Field23")
+    bool field_24;
+    const char* field_25;
+    float field_26;
+    float field_27; tag("Field27")
+    unsigned int field_28;
+    int field_29;
+    double field_30;
+    double field_31; tag("Field31")
+    const char* field_32;
+    int field_33;
+    int field_34;
+    unsigned int field_35; tag("Field35")
+    unsigned int field_36;
+    double field_37;
+    bool field_38;
+    size_t field_39; tag("Field39")
+    float field_40;
+    double field_41;
+    const char* field_42;
+    int field_43; tag("Field43")
+    float field_44;
+    long field_45;
+    double field_46;
+    size_t field_47; tag("Field47")
+    int field_48;
+    size_t field_49;
+    int field_50;
+    bool field_51; tag("Field51")
+    double field_52;
+    long field_53;
+    bool field_54;
+    bool field_55; tag("Field55")
+    float field_56;
+    const char* field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    double field_60;
+    int field_61;
+    const char* field_62;
+    long field_63; tag("Field63")
+} S35_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    unsigned int field_1;
+    float field_2;
+    float field_3; tag("Field3")
+    double field_4;
+    unsigned int field_5;
+    long field_6;
+    size_t field_7; tag("Field7")
+    long field_8;
+    unsigned int field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    const char* field_12;
+    double field_13;
+    size_t field_14;
+    long field_15; tag("Field15")
+    size_t field_16;
+    size_t field_17;
+    bool field_18;
+    const char* field_19; tag("Field19")
+    float field_20;
+    const char* field_21;
+    long field_22;
+    unsigned int field_23; tag("Field23")
+    unsigned int field_24;
+    float field_25;
+    float field_26;
+    unsigned int field_27; tag("Field27")
+    double field_28;
+    float field_29;
+    bool field_30;
+    long field_31; tag("Field31")
+    size_t field_32;
+    unsigned int field_33;
+    int field_34;
+    size_t field_35; tag("Field35")
+    long field_36;
+    float field_37;
+    const char* field_38;
+    size_t field_39; tag("Field39")
+    long field_40;
+    float field_41;
+    long field_42;
+    double field_43; tag("Field43")
+    const char* field_44;
+    unsigned int field_45;
+    bool field_46;
+    long field_47; tag("Field47")
+    int field_48;
+    bool field_49;
+    double field_50;
+    int field_51; tag("Field51")
+    bool field_52;
+    float field_53;
+    const char* field_54;
+    float field_55; tag("Field55")
+    const char* field_56;
+    int field_57;
+    unsigned int field_58;
+    unsigned int field_59; tag("Field59")
+    const char* field_60;
+    unsigned int field_61;
+    const char* field_62;
+    int field_63; tag("Field63")
+} S35_2 derive_all();
+
+typedef struct {
+    const char* field_0;
+    long field_1;
+    unsigned int field_2;
+    int field_3; tag("Field3")
+    size_t field_4;
+    size_t field_5;
+    float field_6;
+    size_t field_7; tag("Field7")
+    size_t field_8;
+    int field_9;
+    size_t field_10;
+    bool field_11; tag("Field11")
+    float field_12;
+    bool field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    bool field_16;
+    double field_17;
+    double field_18;
+    long field_19; tag("Field19")
+    unsigned int field_20;
+    float field_21;
+    float field_22;
+    float field_23; tag("Field23")
+    long field_24;
+    float field_25;
+    size_t field_26;
+    size_t field_27; tag("Field27")
+    unsigned int field_28;
+    unsigned int field_29;
+    const char* field_30;
+    const char* field_31; tag("Field31")
+    double field_32;
+    long field_33;
+    size_t field_34;
+    bool field_35; tag("Field35")
+    const char* field_36;
+    int field_37;
+    unsigned int field_38;
+    int field_39; tag("Field39")
+    bool field_40;
+    bool field_41;
+    size_t field_42;
+    unsigned int field_43; tag("Field43")
+    bool field_44;
+    int field_45;
+    double field_46;
+    unsigned int field_47; tag("Field47")
+    int field_48;
+    double field_49;
+    int field_50;
+    const char* field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    bool field_54;
+    size_t field_55; tag("Field55")
+    long field_56;
+    double field_57;
+    size_t field_58;
+    int field_59; tag("Field59")
+    unsigned int field_60;
+    int field_61;
+    unsigned int field_62;
+    unsigned int field_63; tag("Field63")
+} S35_3 derive_all();
+
+#endif // F000035_H
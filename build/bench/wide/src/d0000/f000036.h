@@ -0,0 +1,274 @@
+#ifndef F000036_H
+#define F000036_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    float field_0;
+    double field_1;
+    double field_2;
+    size_t field_3; tag("Field3")
+    unsigned int field_4;
+    size_t field_5;
+    bool field_6;
+    size_t field_7; tag("Field7")
+    size_t field_8;
+    int field_9;
+    size_t field_10;
+    unsigned int field_11; tag("Field11")
+    int field_12;
+    bool field_13;
+    int field_14;
+    double field_15; tag("Field15")
+    float field_16;
+    size_t field_17;
+    const char* field_18;
+    size_t field_19; tag("Field19")
+    int field_20;
+    const char* field_21;
+    bool field_22;
+    double field_23; tag("Field23")
+    float field_24;
+    float field_25;
+    size_t field_26;
+    unsigned int field_27; tag("Field27")
+    int field_28;
+    const char* field_29;
+    bool field_30;
+    bool field_31; tag("Field31")
+    unsigned int field_32;
+    int field_33;
+    float field_34;
+    unsigned int field_35; tag("Field35")
+    size_t field_36;
+    bool field_37;
+    int field_38;
+    int field_39; tag("Field39")
+    long field_40;
+    unsigned int field_41;
+    int field_42;
+    unsigned int field_43; tag("Field43")
+    long field_44;
+    bool field_45;
+    float field_46;
+    long field_47; tag("Field47")
+    long field_48;
+    const char* field_49;
+    float field_50;
+    unsigned int field_51; tag("Field51")
+    size_t field_52;
+    long field_53;
+    double field_54;
+    unsigned int field_55; tag("Field55")
+    double field_56;
+    const char* field_57;
+    long field_58;
+    long field_59; tag("Field59")
+    float field_60;
+    long field_61;
+    const char* field_62;
+    int field_63; tag("Field63")
+} S36_0 derive_all();
+
+typedef struct {
+    bool field_0;
+    double field_1;
+    bool field_2;
+    size_t field_3; tag("Field3")
+    size_t field_4;
+    double field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+    size_t field_8;
+    bool field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    double field_12;
+    unsigned int field_13;
+    const char* field_14;
+    size_t field_15; tag("Field15")
+    size_t field_16;
+    size_t field_17;
+    double field_18;
+    double field_19; tag("Field19")
+    float field_20;
+    const char* field_21;
+    int field_22;
+    double field_23; tag("Field23")
+    unsigned int field_24;
+    float field_25;
+    bool field_26;
+    bool field_27; tag("Field27")
+    size_t field_28;
+    float field_29;
+    int field_30;
+    unsigned int field_31; tag("Field31")
+    bool field_32;
+    float field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    unsigned int field_36;
+    const char* field_37;
+    float field_38;
+    bool field_39; tag("Field39")
+    float field_40;
+    double field_41;
+    float field_42;
+    unsigned int field_43; tag("Field43")
+    size_t field_44;
+    float field_45;
+    double field_46;
+    const char* field_47; tag("Field47")
+    double field_48;
+    float field_49;
+    const char* field_50;
+    size_t field_51; tag("Field51")
+    size_t field_52;
+    bool field_53;
+    double field_54;
+    int field_55; tag("Field55")
+    long field_56;
+    bool field_57;
+    double field_58;
+    long field_59; tag("Field59")
+    bool field_60;
+    size_t field_61;
+    float field_62;
+    const char* field_63; tag("Field63")
+} S36_1 derive_all();
+
+typedef struct {
+    int field_0;
+    int field_1;
+    bool field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    bool field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+    bool field_8;
+    int field_9;
+    bool field_10;
+    long field_11; tag("Field11")
+    bool field_12;
+    double field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    long field_17;
+    unsigned int field_18;
+    double field_19; tag("Field19")
+    const char* field_20;
+    long field_21;
+    float field_22;
+    long field_23; tag("Field23")
+    size_t field_24;
+    double field_25;
+    size_t field_26;
+    bool field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    size_t field_30;
+    const char* field_31; tag("Field31")
+    const char* field_32;
+    bool field_33;
+    size_t field_34;
+    bool field_35; tag("Field35")
+    int field_36;
+    float field_37;
+    long field_38;
+    unsigned int field_39; tag("Field39")
+    long field_40;
+    int field_41;
+    float field_42;
+    long field_43; tag("Field43")
+    size_t field_44;
+    long field_45;
+    size_t field_46;
+    unsigned int field_47; tag("Field47")
+    bool field_48;
+    const char* field_49;
+    size_t field_50;
+    size_t field_51; tag("Field51")
+    float field_52;
+    int field_53;
+    double field_54;
+    const char* field_55; tag("Field55")
+    bool field_56;
+    bool field_57;
+    long field_58;
+    float field_59; tag("Field59")
+    unsigned int field_60;
+    float field_61;
+    float field_62;
+    float field_63; tag("Field63")
+} S36_2 derive_all();
+
+typedef struct {
+    int field_0;
+    double field_1;
+    unsigned int field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    bool field_5;
+    bool field_6;
+    unsigned int field_7; tag("Field7")
+    bool field_8;
+    size_t field_9;
+    unsigned int field_10;
+    size_t field_11; tag("Field11")
+    float field_12;
+    unsigned int field_13;
+    long field_14;
+    long field_15; tag("Field15")
+    const char* field_16;
+    int field_17;
+    int field_18;
+    const char* field_19; tag("Field19")
+    float field_20;
+    int field_21;
+    double field_22;
+    size_t field_23; tag("Field23")
+    size_t field_24;
+    const char* field_25;
+    double field_26;
+    unsigned int field_27; tag("Field27")
+    unsigned int field_28;
+    bool field_29;
+    size_t field_30;
+    bool field_31; tag("Field31")
+    const char* field_32;
+    double field_33;
+    int field_34;
+    bool field_35; tag("Field35")
+    bool field_36;
+    long field_37;
+    bool field_38;
+    size_t field_39; tag("Field39")
+    int field_40;
+    size_t field_41;
+    float field_42;
+    bool field_43; tag("Field43")
+    size_t field_44;
+    const char* field_45;
+    int field_46;
+    long field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    bool field_50;
+    long field_51; tag("Field51")
+    bool field_52;
+    unsigned int field_53;
+    long field_54;
+    size_t field_55; tag("Field55")
+    int field_56;
+    float field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    bool field_60;
+    double field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S36_3 derive_all();
+
+#endif // F000036_H
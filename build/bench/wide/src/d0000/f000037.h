@@ -0,0 +1,274 @@
+#ifndef F000037_H
+#define F000037_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    int field_1;
+    double field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    const char* field_5;
+    long field_6;
+    const char* field_7; tag("Field7")
+    size_t field_8;
+    bool field_9;
+    float field_10;
+    unsigned int field_11; tag("Field11")
+    float field_12;
+    bool field_13;
+    double field_14;
+    const char* field_15; tag("Field15")
+    const char* field_16;
+    double field_17;
+    float field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    size_t field_21;
+    const char* field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    long field_25;
+    long field_26;
+    float field_27; tag("Field27")
+    double field_28;
+    float field_29;
+    float field_30;
+    bool field_31; tag("Field31")
+    float field_32;
+    long field_33;
+    unsigned int field_34;
+    size_t field_35; tag("Field35")
+    float field_36;
+    bool field_37;
+    unsigned int field_38;
+    size_t field_39; tag("Field39")
+    unsigned int field_40;
+    bool field_41;
+    bool field_42;
+    double field_43; tag("Field43")
+    float field_44;
+    unsigned int field_45;
+    long field_46;
+    long field_47; tag("Field47")
+    double field_48;
+    double field_49;
+    float field_50;
+    long field_51; tag("Field51")
+    size_t field_52;
+    bool field_53;
+    size_t field_54;
+    float field_55; tag("Field55")
+    size_t field_56;
+    float field_57;
+    int field_58;
+    unsigned int field_59; tag("Field59")
+    int field_60;
+    float field_61;
+    double field_62;
+    bool field_63; tag("Field63")
+} S37_0 derive_all();
+
+typedef struct {
+    long field_0;
+    size_t field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    bool field_4;
+    long field_5;
+    const char* field_6;
+    double field_7; tag("Field7")
+    size_t field_8;
+    const char* field_9;
+    float field_10;
+    int field_11; tag("Field11")
+    double field_12;
+    double field_13;
+    long field_14;
+    bool field_15; tag("Field15")
+    size_t field_16;
+    double field_17;
+    size_t field_18;
+    size_t field_19; tag("Field19")
+    unsigned int field_20;
+    int field_21;
+    const char* field_22;
+    const char* field_23; tag("Field23")
+    float field_24;
+    bool field_25;
+    bool field_26;
+    long field_27; tag("Field27")
+    bool field_28;
+    long field_29;
+    unsigned int field_30;
+    long field_31; tag("Field31")
+    float field_32;
+    const char* field_33;
+    bool field_34;
+    const char* field_35; tag("Field35")
+    double field_36;
+    long field_37;
+    long field_38;
+    size_t field_39; tag("Field39")
+    int field_40;
+    unsigned int field_41;
+    bool field_42;
+    unsigned int field_43; tag("Field43")
+    int field_44;
+    float field_45;
+    long field_46;
+    const char* field_47; tag("Field47")
+    const char* field_48;
+    double field_49;
+    float field_50;
+    int field_51; tag("Field51")
+    int field_52;
+    size_t field_53;
+    float field_54;
+    int field_55; tag("Field55")
+    long field_56;
+    unsigned int field_57;
+    unsigned int field_58;
+    const char* field_59; tag("Field59")
+    int field_60;
+    float field_61;
+    double field_62;
+    unsigned int field_63; tag("Field63")
+} S37_1 derive_all();
+
+typedef struct {
+    const char* field_0;
+    double field_1;
+    long field_2;
+    size_t field_3; tag("Field3")
+    const char* field_4;
+    size_t field_5;
+    size_t field_6;
+    long field_7; tag("Field7")
+    unsigned int field_8;
+    float field_9;
+    bool field_10;
+    unsigned int field_11; tag("Field11")
+    size_t field_12;
+    bool field_13;
+    unsigned int field_14;
+    unsigned int field_15; tag("Field15")
+    double field_16;
+    bool field_17;
+    int field_18;
+    bool field_19; tag("Field19")
+    size_t field_20;
+    const char* field_21;
+    long field_22;
+    unsigned int field_23; tag("Field23")
+    const char* field_24;
+    double field_25;
+    bool field_26;
+    bool field_27; tag("Field27")
+    unsigned int field_28;
+    size_t field_29;
+    long field_30;
+    float field_31; tag("Field31")
+    float field_32;
+    bool field_33;
+    const char* field_34;
+    bool field_35; tag("Field35")
+    bool field_36;
+    int field_37;
+    unsigned int field_38;
+    long field_39; tag("Field39")
+    int field_40;
+    const char* field_41;
+    double field_42;
+    float field_43; tag("Field43")
+    float field_44;
+    float field_45;
+    float field_46;
+    double field_47; tag("Field47")
+    long field_48;
+    const char* field_49;
+    long field_50;
+    long field_51; tag("Field51")
+    bool field_52;
+    float field_53;
+    unsigned int field_54;
+    int field_55; tag("Field55")
+    int field_56;
+    bool field_57;
+    size_t field_58;
+    int field_59; tag("Field59")
+    size_t field_60;
+    long field_61;
+    long field_62;
+    int field_63; tag("Field63")
+} S37_2 derive_all();
+
+typedef struct {
+    int field_0;
+    const char* field_1;
+    long field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    float field_5;
+    int field_6;
+    long field_7; tag("Field7")
+    unsigned int field_8;
+    unsigned int field_9;
+    long field_10;
+    unsigned int field_11; tag("Field11")
+    int field_12;
+    const char* field_13;
+    double field_14;
+    unsigned int field_15; tag("Field15")
+    const char* field_16;
+    int field_17;
+    const char* field_18;
+    unsigned int field_19; tag("Field19")
+    unsigned int field_20;
+    long field_21;
+    float field_22;
+    const char* field_23; tag("Field23")
+    long field_24;
+    long field_25;
+    size_t field_26;
+    double field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    long field_30;
+    double field_31; tag("Field31")
+    unsigned int field_32;
+    long field_33;
+    float field_34;
+    size_t field_35; tag("Field35")
+    size_t field_36;
+    const char* field_37;
+    double field_38;
+    int field_39; tag("Field39")
+    size_t field_40;
+    bool field_41;
+    double field_42;
+    long field_43; tag("Field43")
+    double field_44;
+    int field_45;
+    double field_46;
+    bool field_47; tag("Field47")
+    float field_48;
+    long field_49;
+    unsigned int field_50;
+    bool field_51; tag("Field51")
+    const char* field_52;
+    long field_53;
+    const char* field_54;
+    double field_55; tag("Field55")
+    const char* field_56;
+    bool field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    bool field_60;
+    int field_61;
+    float field_62;
+    bool field_63; tag("Field63")
+} S37_3 derive_all();
+
+#endif // F000037_H
@@ -0,0 +1,274 @@
+#ifndef F000038_H
+#define F000038_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    double field_0;
+    bool field_1;
+    int field_2;
+    int field_3; tag("Field3")
+    float field_4;
+    double field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+    const char* field_8;
+    int field_9;
+    long field_10;
+    int field_11; tag("Field11")
+    long field_12;
+    double field_13;
+    int field_14;
+    unsigned int field_15; tag("Field15")
+    float field_16;
+    double field_17;
+    int field_18;
+    const char* field_19; tag("Field19")
+    int field_20;
+    double field_21;
+    bool field_22;
+    long field_23; tag("Field23")
+    double field_24;
+    int field_25;
+    long field_26;
+    const char* field_27; tag("Field27")
+    long field_28;
+    int field_29;
+    unsigned int field_30;
+    unsigned int field_31; tag("Field31")
+    bool field_32;
+    size_t field_33;
+    const char* field_34;
+    const char* field_35; tag("Field35")
+    float field_36;
+    double field_37;
+    size_t field_38;
+    size_t field_39; tag("Field39")
+    size_t field_40;
+    unsigned int field_41;
+    long field_42;
+    const char* field_43; tag("Field43")
+    size_t field_44;
+    double field_45;
+    const char* field_46;
+    int field_47; tag("Field47")
+    long field_48;
+    unsigned int field_49;
+    int field_50;
+    int field_51; tag("Field51")
+    long field_52;
+    size_t field_53;
+    float field_54;
+    double field_55; tag("Field55")
+    size_t field_56;
+    size_t field_57;
+    bool field_58;
+    bool field_59; tag("Field59")
+    double field_60;
+    double field_61;
+    int field_62;
+    long field_63; tag("Field63")
+} S38_0 derive_all();
+
+typedef struct {
+    float field_0;
+    unsigned int field_1;
+    bool field_2;
+    long field_3; tag("Field3")
+    const char* field_4;
+    const char* field_5;
+    bool field_6;
+    double field_7; tag("Field7")
+    double field_8;
+    int field_9;
+    unsigned int field_10;
+    float field_11; tag("Field11")
+    unsigned int field_12;
+    bool field_13;
+    size_t field_14;
+    size_t field_15; tag("Field15")
+    bool field_16;
+    int field_17;
+    double field_18;
+    int field_19; tag("Field19")
+    int field_20;
+    unsigned int field_21;
+    const char* field_22;
+    int field_23; tag("Field23")
+    float field_24;
+    double field_25;
+    const char* field_26;
+    size_t field_27; tag("Field27")
+    const char* field_28;
+    size_t field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    int field_32;
+    int field_33;
+    double field_34;
+    const char* field_35; tag("Field35")
+    size_t field_36;
+    float field_37;
+    float field_38;
+    size_t field_39; tag("Field39")
+    long field_40;
+    double field_41;
+    double field_42;
+    double field_43; tag("Field43")
+    int field_44;
+    unsigned int field_45;
+    double field_46;
+    long field_47; tag("Field47")
+    bool field_48;
+    unsigned int field_49;
+    int field_50;
+    size_t field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    int field_54;
+    bool field_55; tag("Field55")
+    bool field_56;
+    long field_57;
+    size_t field_58;
+    double field_59; tag("Field59")
+    int field_60;
+    double field_61;
+    const char* field_62;
+    double field_63; tag("Field63")
+} S38_1 derive_all();
+
+typedef struct {
+    float field_0;
+    bool field_1;
+    int field_2;
+    double field_3; tag("Field3")
+    bool field_4;
+    float field_5;
+    unsigned int field_6;
+    bool field_7; tag("Field7")
+    bool field_8;
+    double field_9;
+    int field_10;
+    unsigned int field_11; tag("Field11")
+    const char* field_12;
+    float field_13;
+    double field_14;
+    double field_15; tag("Field15")
+    int field_16;
+    size_t field_17;
+    unsigned int field_18;
+    int field_19; tag("Field19")
+    double field_20;
+    size_t field_21;
+    double field_22;
+    const char* field_23; tag("Field23")
+    unsigned int field_24;
+    long field_25;
+    int field_26;
+    unsigned int field_27; tag("Field27")
+    double field_28;
+    bool field_29;
+    float field_30;
+    bool field_31; tag("Field31")
+    float field_32;
+    int field_33;
+    size_t field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    const char* field_37;
+    float field_38;
+    long field_39; tag("Field39")
+    size_t field_40;
+    const char* field_41;
+    int field_42;
+    float field_43; tag("Field43")
+    long field_44;
+    unsigned int field_45;
+    int field_46;
+    const char* field_47; tag("Field47")
+    int field_48;
+    long field_49;
+    size_t field_50;
+    double field_51; tag("Field51")
+    bool field_52;
+    size_t field_53;
+    bool field_54;
+    size_t field_55; tag("Field55")
+    unsigned int field_56;
+    float field_57;
+    float field_58;
+    bool field_59; tag("Field59")
+    double field_60;
+    unsigned int field_61;
+    long field_62;
+    int field_63; tag("Field63")
+} S38_2 derive_all();
+
+typedef struct {
+    size_t field_0;
+    unsigned int field_1;
+    int field_2;
+    bool field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    long field_6;
+    bool field_7; tag("Field7")
+    const char* field_8;
+    bool field_9;
+    const char* field_10;
+    size_t field_11; tag("Field11")
+    int field_12;
+    const char* field_13;
+    double field_14;
+    long field_15; tag("Field15")
+    unsigned int field_16;
+    unsigned int field_17;
+    size_t field_18;
+    size_t field_19; tag("Field19")
+    bool field_20;
+    int field_21;
+    float field_22;
+    double field_23; tag("Field23")
+    size_t field_24;
+    bool field_25;
+    int field_26;
+    bool field_27; tag("Field27")
+    float field_28;
+    float field_29;
+    unsigned int field_30;
+    float field_31; tag("Field31")
+    int field_32;
+    bool field_33;
+    float field_34;
+    int field_35; tag("Field35")
+    unsigned int field_36;
+    long field_37;
+    long field_38;
+    int field_39; tag("Field39")
+    int field_40;
+    const char* field_41;
+    unsigned int field_42;
+    bool field_43; tag("Field43")
+    double field_44;
+    bool field_45;
+    int field_46;
+    double field_47; tag("Field47")
+    size_t field_48;
+    double field_49;
+    unsigned int field_50;
+    double field_51; tag("Field51")
+    double field_52;
+    const char* field_53;
+    int field_54;
+    bool field_55; tag("Field55")
+    const char* field_56;
+    float field_57;
+    const char* field_58;
+    unsigned int field_59; tag("Field59")
+    float field_60;
+    const char* field_61;
+    const char* field_62;
+    const char* field_63; tag("Field63")
+} S38_3 derive_all();
+
+#endif // F000038_H
@@ -0,0 +1,274 @@
+#ifndef F000039_H
+#define F000039_H
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    bool field_0;
+    size_t field_1;
+    int field_2;
+    unsigned int field_3; tag("Field3")
+    bool field_4;
+    double field_5;
+    size_t field_6;
+    int field_7; tag("Field7")
+    float field_8;
+    float field_9;
+    unsigned int field_10;
+    int field_11; tag("Field11")
+    size_t field_12;
+    float field_13;
+    float field_14;
+    int field_15; tag("Field15")
+    int field_16;
+    const char* field_17;
+    long field_18;
+    size_t field_19; tag("Field19")
+    double field_20;
+    const char* field_21;
+    const char* field_22;
+    long field_23; tag("Field23")
+    double field_24;
+    bool field_25;
+    int field_26;
+    size_t field_27; tag("Field27")
+    double field_28;
+    size_t field_29;
+    const char* field_30;
+    unsigned int field_31; tag("Field31")
+    size_t field_32;
+    const char* field_33;
+    long field_34;
+    size_t field_35; tag("Field35")
+    float field_36;
+    unsigned int field_37;
+    bool field_38;
+    int field_39; tag("Field39")
+    size_t field_40;
+    unsigned int field_41;
+    unsigned int field_42;
+    long field_43; tag("Field43")
+    double field_44;
+    bool field_45;
+    size_t field_46;
+    long field_47; tag("Field47")
+    size_t field_48;
+    long field_49;
+    int field_50;
+    float field_51; tag("Field51")
+    int field_52;
+    int field_53;
+    long field_54;
+    bool field_55; tag("Field55")
+    long field_56;
+    double field_57;
+    float field_58;
+    unsigned int field_59; tag("Field59")
+    const char* field_60;
+    size_t field_61;
+    size_t field_62;
+    long field_63; tag("Field63")
+} S39_0 derive_all();
+
+typedef struct {
+    double field_0;
+    size_t field_1;
+    size_t field_2;
+    unsigned int field_3; tag("Field3")
+    size_t field_4;
+    unsigned int field_5;
+    const char* field_6;
+    long field_7; tag("Field7")
+    long field_8;
+    long field_9;
+    int field_10;
+    bool field_11; tag("Field11")
+    int field_12;
+    long field_13;
+    bool field_14;
+    int field_15; tag("Field15")
+    unsigned int field_16;
+    float field_17;
+    long field_18;
+    float field_19; tag("Field19")
+    bool field_20;
+    size_t field_21;
+    long field_22;
+    const char* field_23; tag("Field23")
+    double field_24;
+    unsigned int field_25;
+    unsigned int field_26;
+    bool field_27; tag("Field27")
+    float field_28;
+    float field_29;
+    bool field_30;
+    int field_31; tag("Field31")
+    float field_32;
+    float field_33;
+    float field_34;
+    int field_35; tag("Field35")
+    float field_36;
+    size_t field_37;
+    unsigned int field_38;
+    const char* field_39; tag("Field39")
+    unsigned int field_40;
+    long field_41;
+    long field_42;
+    bool field_43; tag("Field43")
+    int field_44;
+    float field_45;
+    unsigned int field_46;
+    double field_47; tag("Field47")
+    long field_48;
+    long field_49;
+    int field_50;
+    size_t field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    long field_54;
+    unsigned int field_55; tag("Field55")
+    long field_56;
+    const char* field_57;
+    double field_58;
+    long field_59; tag("Field59")
+    const char* field_60;
+    unsigned int field_61;
+    size_t field_62;
+    double field_63; tag("Field63")
+} S39_1 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    double field_2;
+    const char* field_3; tag("Field3")
+    size_t field_4;
+    long field_5;
+    unsigned int field_6;
+    unsigned int field_7; tag("Field7")
+    float field_8;
+    int field_9;
+    size_t field_10;
+    float field_11; tag("Field11")
+    const char* field_12;
+    double field_13;
+    float field_14;
+    size_t field_15; tag("Field15")
+    float field_16;
+    const char* field_17;
+    size_t field_18;
+    double field_19; tag("Field19")
+    int field_20;
+    long field_21;
+    long field_22;
+    int field_23; tag("Field23")
+    bool field_24;
+    float field_25;
+    long field_26;
+    int field_27; tag("Field27")
+    double field_28;
+    unsigned int field_29;
+    const char* field_30;
+    long field_31; tag("Field31")
+    const char* field_32;
+    long field_33;
+    unsigned int field_34;
+    unsigned int field_35; tag("Field35")
+    int field_36;
+    bool field_37;
+    float field_38;
+    int field_39; tag("Field39")
+    double field_40;
+    bool field_41;
+    long field_42;
+    long field_43; tag("Field43")
+    bool field_44;
+    const char* field_45;
+    double field_46;
+    const char* field_47; tag("Field47")
+    float field_48;
+    size_t field_49;
+    const char* field_50;
+    double field_51; tag("Field51")
+    unsigned int field_52;
+    const char* field_53;
+    int field_54;
+    const char* field_55; tag("Field55")
+    const char* field_56;
+    unsigned int field_57;
+    float field_58;
+    long field_59; tag("Field59")
+    unsigned int field_60;
+    int field_61;
+    double field_62;
+    const char* field_63; tag("Field63")
+} S39_2 derive_all();
+
+typedef struct {
+    unsigned int field_0;
+    double field_1;
+    unsigned int field_2;
+    size_t field_3; tag("Field3")
+    int field_4;
+    const char* field_5;
+    unsigned int field_6;
+    size_t field_7; tag("Field7")
+    float field_8;
+    long field_9;
+    float field_10;
+    long field_11; tag("Field11")
+    unsigned int field_12;
+    const char* field_13;
+    size_t field_14;
+    long field_15; tag("Field15")
+    bool field_16;
+    int field_17;
+    unsigned int field_18;
+    double field_19; tag("Field19")
+    double field_20;
+    long field_21;
+    double field_22;
+    unsigned int field_23; tag("Field23")
+    bool field_24;
+    bool field_25;
+    size_t field_26;
+    int field_27; tag("Field27")
+    int field_28;
+    long field_29;
+    bool field_30;
+    float field_31; tag("Field31")
+    float field_32;
+    unsigned int field_33;
+    unsigned int field_34;
+    const char* field_35; tag("Field35")
+    bool field_36;
+    int field_37;
+    int field_38;
+    long field_39; tag("Field39")
+    long field_40;
+    const char* field_41;
+    float field_42;
+    unsigned int field_43; tag("Field43")
+    const char* field_44;
+    double field_45;
+    size_t field_46;
+    int field_47; tag("Field47")
+    size_t field_48;
+    unsigned int field_49;
+    bool field_50;
+    double field_51; tag("Field51")
+    long field_52;
+    double field_53;
+    unsigned int field_54;
+    int field_55; tag("Field55")
+    int field_56;
+    size_t field_57;
+    float field_58;
+    int field_59; tag("Field59")
+    bool field_60;
+    unsigned int field_61;
+    long field_62;
+    double field_63; tag("Field63")
+} S39_3 derive_all();
+
+#endif // F000039_H
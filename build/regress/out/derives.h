@@ -0,0 +1,7 @@
+#ifndef __DERIVES_H__
+#define __DERIVES_H__
+#define tag(s)
+#define derive_all(...)
+#define derive_json(...)
+#define derive_debug(...)
+#endif // __DERIVES_H__
@@ -0,0 +1,222 @@
+#ifndef __BK_18182945995232196528_0_H__ // Generated from: /root/repo/build/regress/page_end_4096.h
+#define __BK_18182945995232196528_0_H__
+#ifndef BK_FMT_DST_t
+#define BK_FMT_DST_t FILE*
+#endif // BK_FMT_DST_t
+#ifndef BK_FMT
+#define BK_FMT(...) offset += fprintf(dst, __VA_ARGS__)
+#endif // BK_FMT
+#ifndef BK_OFFSET_t
+#define BK_OFFSET_t size_t
+#endif // BK_OFFSET_t
+#ifndef ___BK_PRELUDE_json___
+#define ___BK_PRELUDE_json___
+typedef enum {
+    BKJSON_OK = 0,
+    BKJSON_cJSON_ERROR,
+    BKJSON_FIELD_NOT_FOUND,
+    BKJSON_MISMATCHED_FIELD_TYPE,
+} BkJSON_Result;
+#endif // ___BK_PRELUDE_json___
+#ifndef ___BK_PRELUDE_debug___
+#define ___BK_PRELUDE_debug___
+#endif // ___BK_PRELUDE_debug___
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PageEnd
+
+#ifndef BK_DISABLE_PageEnd_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_PageEnd_json
+
+#ifndef BK_DISABLE_PageEnd_json_DUMP
+void dump_json_PageEnd(PageEnd* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_PageEnd_json_DUMP
+
+#endif // BK_DISABLE_PageEnd_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_PageEnd_debug
+
+#ifndef BK_DISABLE_PageEnd_debug_DUMP
+void __indent_dump_debug_PageEnd(PageEnd* item, BK_FMT_DST_t dst, int indent);
+void dump_debug_PageEnd(PageEnd* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_PageEnd_debug_DUMP
+
+#endif // BK_DISABLE_PageEnd_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_PageEnd_DUMP
+
+#endif // BK_DISABLE_PageEnd
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_PageEnd
+
+#ifndef BK_DISABLE_PageEnd_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_PageEnd_json
+
+#ifndef BK_DISABLE_PageEnd_json_PARSE
+BkJSON_Result parse_cjson_PageEnd(cJSON* src, PageEnd* dst);
+
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_PageEnd(const char* src, unsigned long len, PageEnd* dst);
+
+#endif // BK_DISABLE_PageEnd_json_PARSE
+
+#endif // BK_DISABLE_PageEnd_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_PageEnd_PARSE
+
+#endif // BK_DISABLE_PageEnd
+
+#endif // BK_DISABLE_PARSE
+
+#ifdef BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PageEnd
+
+#ifndef BK_DISABLE_PageEnd_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_PageEnd_json
+
+#ifndef BK_DISABLE_PageEnd_json_DUMP
+void dump_json_PageEnd(PageEnd* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("{");
+    BK_FMT("\"x\":%d", item->x);
+    BK_FMT("}");
+}
+
+#endif // BK_DISABLE_PageEnd_json_DUMP
+
+#endif // BK_DISABLE_PageEnd_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_PageEnd_debug
+
+#ifndef BK_DISABLE_PageEnd_debug_DUMP
+void __indent_dump_debug_PageEnd(PageEnd* item, BK_FMT_DST_t dst, int indent) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("PageEnd {\n");
+    BK_FMT("%*s(int) x: %d\n", indent + 4, "", item->x);
+    BK_FMT("%*s}\n", indent, "");
+}
+void dump_debug_PageEnd(PageEnd* item, BK_FMT_DST_t dst) {
+    __indent_dump_debug_PageEnd(item, dst, 0);
+}
+
+#endif // BK_DISABLE_PageEnd_debug_DUMP
+
+#endif // BK_DISABLE_PageEnd_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_PageEnd_DUMP
+
+#endif // BK_DISABLE_PageEnd
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_PageEnd
+
+#ifndef BK_DISABLE_PageEnd_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_PageEnd_json
+
+#ifndef BK_DISABLE_PageEnd_json_PARSE
+BkJSON_Result parse_cjson_PageEnd(cJSON* src, PageEnd* dst) {
+    BkJSON_Result _res = 0; (void)_res;
+    cJSON* PageEnd_x = cJSON_GetObjectItemCaseSensitive(src, "x");
+    if (!PageEnd_x) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(PageEnd_x)) {
+        dst->x = PageEnd_x->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    return BKJSON_OK;
+}
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_PageEnd(const char* src, unsigned long len, PageEnd* dst) {
+    cJSON* json = cJSON_ParseWithLength(src, len);
+    if (!json) return BKJSON_cJSON_ERROR;
+    BkJSON_Result res = parse_cjson_PageEnd(json, dst);
+    cJSON_Delete(json);
+    return res;
+}
+
+#endif // BK_DISABLE_PageEnd_json_PARSE
+
+#endif // BK_DISABLE_PageEnd_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_PageEnd_PARSE
+
+#endif // BK_DISABLE_PageEnd
+
+#endif // BK_DISABLE_PARSE
+
+#define ___BK_INCLUDE_TYPE_PageEnd
+
+#endif // BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_PageEnd
+
+#endif // BK_DISABLE_PageEnd
+
+#endif // __BK_18182945995232196528_0_H__
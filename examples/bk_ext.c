@@ -6,25 +6,30 @@
 
 #include "../gen/bk_ext.h"
 
-void gen_example_prelude(String* book_buf) {
+void gen_example_prelude(BkContext* bk, String* book_buf) {
+    (void)bk;
     print_string(book_buf, "// Put important definitions/declarations here\n");
 }
 
-size_t gen_example_dump_decl(String* book_buf, CCompound* ty, const char* dst_type) {
+size_t gen_example_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {
+    (void)bk;
     print_string(book_buf, "void dump_example_%s(%s* item, %s dst);\n", ty->name, ty->name, dst_type);
     return 1;
 }
-size_t gen_example_parse_decl(String* book_buf, CCompound* ty) {
+size_t gen_example_parse_decl(BkContext* bk, String* book_buf, CCompound* ty) {
+    (void)bk;
     print_string(book_buf, "int parse_example_%s(char* src, unsigned long len, %s* item);\n", ty->name, ty->name);
     return 1;
 }
 
-void gen_example_dump_impl(String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+void gen_example_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    (void)bk;
     print_string(book_buf, "void dump_example_%s(%s* item, %s dst) {\n", ty->name, ty->name, dst_type);
     print_string(book_buf, "    %s(\"Example schema extension\\n\");\n", fmt_macro);
     print_string(book_buf, "}\n");
 }
-void gen_example_parse_impl(String* book_buf, CCompound* ty) {
+void gen_example_parse_impl(BkContext* bk, String* book_buf, CCompound* ty) {
+    (void)bk;
     print_string(book_buf, "int parse_example_%s(char* src, unsigned long len, %s* item) {\n;", ty->name, ty->name);
     print_string(book_buf, "    return 0;\n");
     print_string(book_buf, "}\n");
@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../gen/bk_ext.h"
+
+size_t gen_plugin_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {
+    (void)bk;
+    print_string(book_buf, "void dump_plugin_%s(%s* item, %s dst);\n", ty->name, ty->name, dst_type);
+    return 1;
+}
+
+void gen_plugin_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    (void)bk;
+    print_string(book_buf, "void dump_plugin_%s(%s* item, %s dst) {\n", ty->name, ty->name, dst_type);
+    print_string(book_buf, "    %s(\"Plugin schema extension\\n\");\n", fmt_macro);
+    print_string(book_buf, "}\n");
+}
+
+static const StaticSchema schemas[] = {
+    {
+        .gen_prelude = NULL,
+        .gen_dump_decl = gen_plugin_dump_decl,
+        .gen_parse_decl = NULL,
+        .gen_dump_impl = gen_plugin_dump_impl,
+        .gen_parse_impl = NULL,
+        .derive_attr = "derive_plugin",
+        .name = "plugin"
+    },
+};
+
+// Lets `bk --load-plugin` reject plugins that were built against a different extension header
+BK_DEFINE_PLUGIN_ABI;
+
+const StaticSchema* bk_plugin_register(size_t* count) {
+    *count = sizeof schemas / sizeof *schemas;
+    return schemas;
+}
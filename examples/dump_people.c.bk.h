@@ -0,0 +1,267 @@
+#ifndef __BK_9210620181337319195_0_H__ // Generated from: ./examples/dump_people.c
+#define __BK_9210620181337319195_0_H__
+#ifndef BK_FMT_DST_t
+#define BK_FMT_DST_t FILE*
+#endif // BK_FMT_DST_t
+#ifndef BK_FMT
+#define BK_FMT(...) offset += fprintf(dst, __VA_ARGS__)
+#endif // BK_FMT
+#ifndef BK_OFFSET_t
+#define BK_OFFSET_t size_t
+#endif // BK_OFFSET_t
+#ifndef ___BK_PRELUDE_json___
+#define ___BK_PRELUDE_json___
+typedef enum {
+    BKJSON_OK = 0,
+    BKJSON_cJSON_ERROR,
+    BKJSON_FIELD_NOT_FOUND,
+    BKJSON_MISMATCHED_FIELD_TYPE,
+} BkJSON_Result;
+#endif // ___BK_PRELUDE_json___
+#ifndef ___BK_PRELUDE_debug___
+#define ___BK_PRELUDE_debug___
+#endif // ___BK_PRELUDE_debug___
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary
+
+#ifndef BK_DISABLE_ManagerWithSalary_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_json
+
+#ifndef BK_DISABLE_ManagerWithSalary_json_DUMP
+void dump_json_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_ManagerWithSalary_json_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_debug
+
+#ifndef BK_DISABLE_ManagerWithSalary_debug_DUMP
+void __indent_dump_debug_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst, int indent);
+void dump_debug_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_ManagerWithSalary_debug_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_ManagerWithSalary_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_ManagerWithSalary
+
+#ifndef BK_DISABLE_ManagerWithSalary_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_ManagerWithSalary_json
+
+#ifndef BK_DISABLE_ManagerWithSalary_json_PARSE
+BkJSON_Result parse_cjson_ManagerWithSalary(cJSON* src, ManagerWithSalary* dst);
+
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_ManagerWithSalary(const char* src, unsigned long len, ManagerWithSalary* dst);
+
+#endif // BK_DISABLE_ManagerWithSalary_json_PARSE
+
+#endif // BK_DISABLE_ManagerWithSalary_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_ManagerWithSalary_PARSE
+
+#endif // BK_DISABLE_ManagerWithSalary
+
+#endif // BK_DISABLE_PARSE
+
+#ifdef BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary
+
+#ifndef BK_DISABLE_ManagerWithSalary_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_json
+
+#ifndef BK_DISABLE_ManagerWithSalary_json_DUMP
+void dump_json_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("{");
+    BK_FMT("\"inner\":");
+    dump_json_Manager(&item->inner, dst);
+    BK_FMT(",");
+    BK_FMT("\"salary\":%lu", item->salary);
+    BK_FMT("}");
+}
+
+#endif // BK_DISABLE_ManagerWithSalary_json_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_debug
+
+#ifndef BK_DISABLE_ManagerWithSalary_debug_DUMP
+void __indent_dump_debug_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst, int indent) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("ManagerWithSalary {\n");
+    BK_FMT("%*sinner: ", indent + 4, "");
+    __indent_dump_debug_Manager(&item->inner, dst, indent + 4);
+    BK_FMT("%*s(ulong) salary: %lu\n", indent + 4, "", item->salary);
+    BK_FMT("%*s}\n", indent, "");
+}
+void dump_debug_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst) {
+    __indent_dump_debug_ManagerWithSalary(item, dst, 0);
+}
+
+#endif // BK_DISABLE_ManagerWithSalary_debug_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_ManagerWithSalary_DUMP
+
+#endif // BK_DISABLE_ManagerWithSalary
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_ManagerWithSalary
+
+#ifndef BK_DISABLE_ManagerWithSalary_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_ManagerWithSalary_json
+
+#ifndef BK_DISABLE_ManagerWithSalary_json_PARSE
+BkJSON_Result parse_cjson_ManagerWithSalary(cJSON* src, ManagerWithSalary* dst) {
+    BkJSON_Result _res = 0; (void)_res;
+    cJSON* ManagerWithSalary_inner = cJSON_GetObjectItemCaseSensitive(src, "inner");
+    if (!ManagerWithSalary_inner) return BKJSON_FIELD_NOT_FOUND;
+    _res = parse_cjson_Manager(ManagerWithSalary_inner, &dst->inner);
+    if (_res) return _res;
+    cJSON* ManagerWithSalary_salary = cJSON_GetObjectItemCaseSensitive(src, "salary");
+    if (!ManagerWithSalary_salary) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(ManagerWithSalary_salary)) {
+        dst->salary = ManagerWithSalary_salary->valuedouble;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    return BKJSON_OK;
+}
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_ManagerWithSalary(const char* src, unsigned long len, ManagerWithSalary* dst) {
+    cJSON* json = cJSON_ParseWithLength(src, len);
+    if (!json) return BKJSON_cJSON_ERROR;
+    BkJSON_Result res = parse_cjson_ManagerWithSalary(json, dst);
+    cJSON_Delete(json);
+    return res;
+}
+
+#endif // BK_DISABLE_ManagerWithSalary_json_PARSE
+
+#endif // BK_DISABLE_ManagerWithSalary_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_ManagerWithSalary_PARSE
+
+#endif // BK_DISABLE_ManagerWithSalary
+
+#endif // BK_DISABLE_PARSE
+
+#define ___BK_INCLUDE_TYPE_ManagerWithSalary
+
+#endif // BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_ManagerWithSalary
+
+#ifndef BK_DISABLE_dynamic
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_DUMP
+
+void dump_dynamic_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_ManagerWithSalary_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+
+#ifdef BK_IMPLEMENTATION
+
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_ManagerWithSalary_DUMP
+
+void dump_dynamic_ManagerWithSalary(ManagerWithSalary* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = 0; (void)offset;
+    BK_FMT("inner: ");dump_dynamic_Manager(&item->inner, dst);BK_FMT("\n");BK_FMT("salary: ");BK_FMT("\n");
+}
+
+#endif // BK_DISABLE_ManagerWithSalary_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+#endif // BK_IMPLEMENTATION
+
+
+#endif // BK_DISABLE_dynamic
+
+#endif // BK_DISABLE_ManagerWithSalary
+
+#endif // __BK_9210620181337319195_0_H__
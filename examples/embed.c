@@ -0,0 +1,31 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "../gen/bk_ext.h"
+
+// Generates code for a header that only exists in memory, without running `bk`
+int main(void) {
+    const char* source =
+        "typedef struct {\n"
+        "    int id;\n"
+        "    const char* name; tag(\"Name\")\n"
+        "} Item derive_debug();\n";
+
+    BkContext* bk = bk_create();
+    bk->conf.silent = true;
+
+    CCompounds types = {0};
+    String out = {0};
+    if (bk_analyze(bk, "item.h", source, strlen(source), &types)) {
+        bk_generate_derives(bk, &out);
+        bk_generate(bk, &types, &out);
+    }
+    fwrite(out.items, 1, out.len, stdout);
+
+    free(out.items);
+    bk_free_types(&types);
+    bk_destroy(bk);
+    return 0;
+}
@@ -0,0 +1,560 @@
+#ifndef __BK_9885729134677584619_1_H__ // Generated from: ./examples/people.h
+#define __BK_9885729134677584619_1_H__
+#ifndef BK_FMT_DST_t
+#define BK_FMT_DST_t FILE*
+#endif // BK_FMT_DST_t
+#ifndef BK_FMT
+#define BK_FMT(...) offset += fprintf(dst, __VA_ARGS__)
+#endif // BK_FMT
+#ifndef BK_OFFSET_t
+#define BK_OFFSET_t size_t
+#endif // BK_OFFSET_t
+#ifndef ___BK_PRELUDE_json___
+#define ___BK_PRELUDE_json___
+typedef enum {
+    BKJSON_OK = 0,
+    BKJSON_cJSON_ERROR,
+    BKJSON_FIELD_NOT_FOUND,
+    BKJSON_MISMATCHED_FIELD_TYPE,
+} BkJSON_Result;
+#endif // ___BK_PRELUDE_json___
+#ifndef ___BK_PRELUDE_debug___
+#define ___BK_PRELUDE_debug___
+#endif // ___BK_PRELUDE_debug___
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Person
+
+#ifndef BK_DISABLE_Person_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Person_json
+
+#ifndef BK_DISABLE_Person_json_DUMP
+void dump_json_Person(Person* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Person_json_DUMP
+
+#endif // BK_DISABLE_Person_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Person_debug
+
+#ifndef BK_DISABLE_Person_debug_DUMP
+void __indent_dump_debug_Person(Person* item, BK_FMT_DST_t dst, int indent);
+void dump_debug_Person(Person* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Person_debug_DUMP
+
+#endif // BK_DISABLE_Person_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Person_DUMP
+
+#endif // BK_DISABLE_Person
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Person
+
+#ifndef BK_DISABLE_Person_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Person_json
+
+#ifndef BK_DISABLE_Person_json_PARSE
+BkJSON_Result parse_cjson_Person(cJSON* src, Person* dst);
+
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Person(const char* src, unsigned long len, Person* dst);
+
+#endif // BK_DISABLE_Person_json_PARSE
+
+#endif // BK_DISABLE_Person_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Person_PARSE
+
+#endif // BK_DISABLE_Person
+
+#endif // BK_DISABLE_PARSE
+#ifndef ___BK_PRELUDE_json___
+#define ___BK_PRELUDE_json___
+typedef enum {
+    BKJSON_OK = 0,
+    BKJSON_cJSON_ERROR,
+    BKJSON_FIELD_NOT_FOUND,
+    BKJSON_MISMATCHED_FIELD_TYPE,
+} BkJSON_Result;
+#endif // ___BK_PRELUDE_json___
+#ifndef ___BK_PRELUDE_debug___
+#define ___BK_PRELUDE_debug___
+#endif // ___BK_PRELUDE_debug___
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Manager
+
+#ifndef BK_DISABLE_Manager_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Manager_json
+
+#ifndef BK_DISABLE_Manager_json_DUMP
+void dump_json_Manager(Manager* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Manager_json_DUMP
+
+#endif // BK_DISABLE_Manager_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Manager_debug
+
+#ifndef BK_DISABLE_Manager_debug_DUMP
+void __indent_dump_debug_Manager(Manager* item, BK_FMT_DST_t dst, int indent);
+void dump_debug_Manager(Manager* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Manager_debug_DUMP
+
+#endif // BK_DISABLE_Manager_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Manager_DUMP
+
+#endif // BK_DISABLE_Manager
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Manager
+
+#ifndef BK_DISABLE_Manager_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Manager_json
+
+#ifndef BK_DISABLE_Manager_json_PARSE
+BkJSON_Result parse_cjson_Manager(cJSON* src, Manager* dst);
+
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Manager(const char* src, unsigned long len, Manager* dst);
+
+#endif // BK_DISABLE_Manager_json_PARSE
+
+#endif // BK_DISABLE_Manager_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Manager_PARSE
+
+#endif // BK_DISABLE_Manager
+
+#endif // BK_DISABLE_PARSE
+
+#ifdef BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Person
+
+#ifndef BK_DISABLE_Person_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Person_json
+
+#ifndef BK_DISABLE_Person_json_DUMP
+void dump_json_Person(Person* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("{");
+    BK_FMT("\"name\":\"%s\"", item->name);
+    BK_FMT(",");
+    BK_FMT("\"age\":%d", item->age);
+    BK_FMT(",");
+    BK_FMT("\"married\":%s", item->married ? "true" : "false");
+    BK_FMT("}");
+}
+
+#endif // BK_DISABLE_Person_json_DUMP
+
+#endif // BK_DISABLE_Person_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Person_debug
+
+#ifndef BK_DISABLE_Person_debug_DUMP
+void __indent_dump_debug_Person(Person* item, BK_FMT_DST_t dst, int indent) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("Person {\n");
+    BK_FMT("%*s(string) name: %s\n", indent + 4, "", item->name);
+    BK_FMT("%*s(int) age: %d\n", indent + 4, "", item->age);
+    BK_FMT("%*s(bool) married: %s\n", indent + 4, "", item->married ? "true" : "false");
+    BK_FMT("%*s}\n", indent, "");
+}
+void dump_debug_Person(Person* item, BK_FMT_DST_t dst) {
+    __indent_dump_debug_Person(item, dst, 0);
+}
+
+#endif // BK_DISABLE_Person_debug_DUMP
+
+#endif // BK_DISABLE_Person_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Person_DUMP
+
+#endif // BK_DISABLE_Person
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Person
+
+#ifndef BK_DISABLE_Person_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Person_json
+
+#ifndef BK_DISABLE_Person_json_PARSE
+BkJSON_Result parse_cjson_Person(cJSON* src, Person* dst) {
+    BkJSON_Result _res = 0; (void)_res;
+    cJSON* Person_name = cJSON_GetObjectItemCaseSensitive(src, "name");
+    if (!Person_name) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsString(Person_name)) {
+        if (!Person_name->valuestring) { return 1; };
+        dst->name = strdup(Person_name->valuestring);
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    cJSON* Person_age = cJSON_GetObjectItemCaseSensitive(src, "age");
+    if (!Person_age) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(Person_age)) {
+        dst->age = Person_age->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    cJSON* Person_married = cJSON_GetObjectItemCaseSensitive(src, "married");
+    if (!Person_married) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsBool(Person_married)) {
+        dst->married = Person_married->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    return BKJSON_OK;
+}
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Person(const char* src, unsigned long len, Person* dst) {
+    cJSON* json = cJSON_ParseWithLength(src, len);
+    if (!json) return BKJSON_cJSON_ERROR;
+    BkJSON_Result res = parse_cjson_Person(json, dst);
+    cJSON_Delete(json);
+    return res;
+}
+
+#endif // BK_DISABLE_Person_json_PARSE
+
+#endif // BK_DISABLE_Person_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Person_PARSE
+
+#endif // BK_DISABLE_Person
+
+#endif // BK_DISABLE_PARSE
+
+#define ___BK_INCLUDE_TYPE_Person
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Manager
+
+#ifndef BK_DISABLE_Manager_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Manager_json
+
+#ifndef BK_DISABLE_Manager_json_DUMP
+void dump_json_Manager(Manager* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("{");
+    BK_FMT("\"PersonalInfo\":");
+    dump_json_Person(&item->personal_info, dst);
+    BK_FMT(",");
+    BK_FMT("\"Title\":\"%s\"", item->title);
+    BK_FMT(",");
+    BK_FMT("\"Rating\":%f", item->rating);
+    BK_FMT(",");
+    BK_FMT("\"Fired\":%s", item->fired ? "true" : "false");
+    BK_FMT(",");
+    BK_FMT("\"OfficeFloor\":%d", item->office_floor);
+    BK_FMT("}");
+}
+
+#endif // BK_DISABLE_Manager_json_DUMP
+
+#endif // BK_DISABLE_Manager_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Manager_debug
+
+#ifndef BK_DISABLE_Manager_debug_DUMP
+void __indent_dump_debug_Manager(Manager* item, BK_FMT_DST_t dst, int indent) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("Manager {\n");
+    BK_FMT("%*spersonal_info: ", indent + 4, "");
+    __indent_dump_debug_Person(&item->personal_info, dst, indent + 4);
+    BK_FMT("%*s(string) title: %s\n", indent + 4, "", item->title);
+    BK_FMT("%*s(float) rating: %f\n", indent + 4, "", item->rating);
+    BK_FMT("%*s(bool) fired: %s\n", indent + 4, "", item->fired ? "true" : "false");
+    BK_FMT("%*s(int) office_floor: %d\n", indent + 4, "", item->office_floor);
+    BK_FMT("%*s}\n", indent, "");
+}
+void dump_debug_Manager(Manager* item, BK_FMT_DST_t dst) {
+    __indent_dump_debug_Manager(item, dst, 0);
+}
+
+#endif // BK_DISABLE_Manager_debug_DUMP
+
+#endif // BK_DISABLE_Manager_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Manager_DUMP
+
+#endif // BK_DISABLE_Manager
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Manager
+
+#ifndef BK_DISABLE_Manager_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Manager_json
+
+#ifndef BK_DISABLE_Manager_json_PARSE
+BkJSON_Result parse_cjson_Manager(cJSON* src, Manager* dst) {
+    BkJSON_Result _res = 0; (void)_res;
+    cJSON* Manager_personal_info = cJSON_GetObjectItemCaseSensitive(src, "PersonalInfo");
+    if (!Manager_personal_info) return BKJSON_FIELD_NOT_FOUND;
+    _res = parse_cjson_Person(Manager_personal_info, &dst->personal_info);
+    if (_res) return _res;
+    cJSON* Manager_title = cJSON_GetObjectItemCaseSensitive(src, "Title");
+    if (!Manager_title) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsString(Manager_title)) {
+        if (!Manager_title->valuestring) { return 1; };
+        dst->title = strdup(Manager_title->valuestring);
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    cJSON* Manager_rating = cJSON_GetObjectItemCaseSensitive(src, "Rating");
+    if (!Manager_rating) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(Manager_rating)) {
+        dst->rating = Manager_rating->valuedouble;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    cJSON* Manager_fired = cJSON_GetObjectItemCaseSensitive(src, "Fired");
+    if (!Manager_fired) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsBool(Manager_fired)) {
+        dst->fired = Manager_fired->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    cJSON* Manager_office_floor = cJSON_GetObjectItemCaseSensitive(src, "OfficeFloor");
+    if (!Manager_office_floor) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(Manager_office_floor)) {
+        dst->office_floor = Manager_office_floor->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    return BKJSON_OK;
+}
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Manager(const char* src, unsigned long len, Manager* dst) {
+    cJSON* json = cJSON_ParseWithLength(src, len);
+    if (!json) return BKJSON_cJSON_ERROR;
+    BkJSON_Result res = parse_cjson_Manager(json, dst);
+    cJSON_Delete(json);
+    return res;
+}
+
+#endif // BK_DISABLE_Manager_json_PARSE
+
+#endif // BK_DISABLE_Manager_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Manager_PARSE
+
+#endif // BK_DISABLE_Manager
+
+#endif // BK_DISABLE_PARSE
+
+#define ___BK_INCLUDE_TYPE_Manager
+
+#endif // BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_Person
+
+#ifndef BK_DISABLE_dynamic
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Person_DUMP
+
+void dump_dynamic_Person(Person* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Person_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+
+#ifdef BK_IMPLEMENTATION
+
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Person_DUMP
+
+void dump_dynamic_Person(Person* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = 0; (void)offset;
+    BK_FMT("name: ");BK_FMT("%s", item->name);BK_FMT("\n");BK_FMT("age: ");BK_FMT("%d", item->age);BK_FMT("\n");BK_FMT("married: ");BK_FMT("%s", item->married? "true" : "false");BK_FMT("\n");
+}
+
+#endif // BK_DISABLE_Person_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+#endif // BK_IMPLEMENTATION
+
+
+#endif // BK_DISABLE_dynamic
+
+#endif // BK_DISABLE_Person
+
+#ifndef BK_DISABLE_Manager
+
+#ifndef BK_DISABLE_dynamic
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Manager_DUMP
+
+void dump_dynamic_Manager(Manager* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Manager_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+
+#ifdef BK_IMPLEMENTATION
+
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Manager_DUMP
+
+void dump_dynamic_Manager(Manager* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = 0; (void)offset;
+    BK_FMT("PersonalInfo: ");dump_dynamic_Person(&item->personal_info, dst);BK_FMT("\n");BK_FMT("Title: ");BK_FMT("%s", item->title);BK_FMT("\n");BK_FMT("Rating: ");BK_FMT("\n");BK_FMT("Fired: ");BK_FMT("%s", item->fired? "true" : "false");BK_FMT("\n");BK_FMT("OfficeFloor: ");BK_FMT("%d", item->office_floor);BK_FMT("\n");
+}
+
+#endif // BK_DISABLE_Manager_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+#endif // BK_IMPLEMENTATION
+
+
+#endif // BK_DISABLE_dynamic
+
+#endif // BK_DISABLE_Manager
+
+#endif // __BK_9885729134677584619_1_H__
@@ -0,0 +1,267 @@
+#ifndef __BK_9243443465971576286_2_H__ // Generated from: ./examples/quick.c
+#define __BK_9243443465971576286_2_H__
+#ifndef BK_FMT_DST_t
+#define BK_FMT_DST_t FILE*
+#endif // BK_FMT_DST_t
+#ifndef BK_FMT
+#define BK_FMT(...) offset += fprintf(dst, __VA_ARGS__)
+#endif // BK_FMT
+#ifndef BK_OFFSET_t
+#define BK_OFFSET_t size_t
+#endif // BK_OFFSET_t
+#ifndef ___BK_PRELUDE_json___
+#define ___BK_PRELUDE_json___
+typedef enum {
+    BKJSON_OK = 0,
+    BKJSON_cJSON_ERROR,
+    BKJSON_FIELD_NOT_FOUND,
+    BKJSON_MISMATCHED_FIELD_TYPE,
+} BkJSON_Result;
+#endif // ___BK_PRELUDE_json___
+#ifndef ___BK_PRELUDE_debug___
+#define ___BK_PRELUDE_debug___
+#endif // ___BK_PRELUDE_debug___
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Friend
+
+#ifndef BK_DISABLE_Friend_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Friend_json
+
+#ifndef BK_DISABLE_Friend_json_DUMP
+void dump_json_Friend(Friend* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Friend_json_DUMP
+
+#endif // BK_DISABLE_Friend_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Friend_debug
+
+#ifndef BK_DISABLE_Friend_debug_DUMP
+void __indent_dump_debug_Friend(Friend* item, BK_FMT_DST_t dst, int indent);
+void dump_debug_Friend(Friend* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Friend_debug_DUMP
+
+#endif // BK_DISABLE_Friend_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Friend_DUMP
+
+#endif // BK_DISABLE_Friend
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Friend
+
+#ifndef BK_DISABLE_Friend_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Friend_json
+
+#ifndef BK_DISABLE_Friend_json_PARSE
+BkJSON_Result parse_cjson_Friend(cJSON* src, Friend* dst);
+
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Friend(const char* src, unsigned long len, Friend* dst);
+
+#endif // BK_DISABLE_Friend_json_PARSE
+
+#endif // BK_DISABLE_Friend_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Friend_PARSE
+
+#endif // BK_DISABLE_Friend
+
+#endif // BK_DISABLE_PARSE
+
+#ifdef BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Friend
+
+#ifndef BK_DISABLE_Friend_DUMP
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_DUMP
+
+#ifndef BK_DISABLE_Friend_json
+
+#ifndef BK_DISABLE_Friend_json_DUMP
+void dump_json_Friend(Friend* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("{");
+    BK_FMT("\"info\":");
+    dump_json_Person(&item->friend_info, dst);
+    BK_FMT(",");
+    BK_FMT("\"years_known\":%d", item->years_known);
+    BK_FMT("}");
+}
+
+#endif // BK_DISABLE_Friend_json_DUMP
+
+#endif // BK_DISABLE_Friend_json
+
+#endif // BK_DISABLE_json_DUMP
+
+#endif // BK_DISABLE_json
+
+#ifndef BK_DISABLE_debug
+
+#ifndef BK_DISABLE_debug_DUMP
+
+#ifndef BK_DISABLE_Friend_debug
+
+#ifndef BK_DISABLE_Friend_debug_DUMP
+void __indent_dump_debug_Friend(Friend* item, BK_FMT_DST_t dst, int indent) {
+    BK_OFFSET_t offset = {0};
+    (void)offset; // suppress warnings
+    BK_FMT("Friend {\n");
+    BK_FMT("%*sfriend_info: ", indent + 4, "");
+    __indent_dump_debug_Person(&item->friend_info, dst, indent + 4);
+    BK_FMT("%*s(int) years_known: %d\n", indent + 4, "", item->years_known);
+    BK_FMT("%*s}\n", indent, "");
+}
+void dump_debug_Friend(Friend* item, BK_FMT_DST_t dst) {
+    __indent_dump_debug_Friend(item, dst, 0);
+}
+
+#endif // BK_DISABLE_Friend_debug_DUMP
+
+#endif // BK_DISABLE_Friend_debug
+
+#endif // BK_DISABLE_debug_DUMP
+
+#endif // BK_DISABLE_debug
+
+#endif // BK_DISABLE_Friend_DUMP
+
+#endif // BK_DISABLE_Friend
+
+#endif // BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_PARSE
+
+#ifndef BK_DISABLE_Friend
+
+#ifndef BK_DISABLE_Friend_PARSE
+
+#ifndef BK_DISABLE_json
+
+#ifndef BK_DISABLE_json_PARSE
+
+#ifndef BK_DISABLE_Friend_json
+
+#ifndef BK_DISABLE_Friend_json_PARSE
+BkJSON_Result parse_cjson_Friend(cJSON* src, Friend* dst) {
+    BkJSON_Result _res = 0; (void)_res;
+    cJSON* Friend_friend_info = cJSON_GetObjectItemCaseSensitive(src, "info");
+    if (!Friend_friend_info) return BKJSON_FIELD_NOT_FOUND;
+    _res = parse_cjson_Person(Friend_friend_info, &dst->friend_info);
+    if (_res) return _res;
+    cJSON* Friend_years_known = cJSON_GetObjectItemCaseSensitive(src, "years_known");
+    if (!Friend_years_known) return BKJSON_FIELD_NOT_FOUND;
+    if (cJSON_IsNumber(Friend_years_known)) {
+        dst->years_known = Friend_years_known->valueint;
+    } else {
+        return BKJSON_MISMATCHED_FIELD_TYPE;
+    }
+    return BKJSON_OK;
+}
+/// WARN: Immediately returns on error, so `dst` might be partially filled.
+BkJSON_Result parse_json_Friend(const char* src, unsigned long len, Friend* dst) {
+    cJSON* json = cJSON_ParseWithLength(src, len);
+    if (!json) return BKJSON_cJSON_ERROR;
+    BkJSON_Result res = parse_cjson_Friend(json, dst);
+    cJSON_Delete(json);
+    return res;
+}
+
+#endif // BK_DISABLE_Friend_json_PARSE
+
+#endif // BK_DISABLE_Friend_json
+
+#endif // BK_DISABLE_json_PARSE
+
+#endif // BK_DISABLE_json
+
+#endif // BK_DISABLE_Friend_PARSE
+
+#endif // BK_DISABLE_Friend
+
+#endif // BK_DISABLE_PARSE
+
+#define ___BK_INCLUDE_TYPE_Friend
+
+#endif // BK_IMPLEMENTATION
+
+#ifndef BK_DISABLE_Friend
+
+#ifndef BK_DISABLE_dynamic
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Friend_DUMP
+
+void dump_dynamic_Friend(Friend* item, BK_FMT_DST_t dst);
+
+#endif // BK_DISABLE_Friend_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+
+#ifdef BK_IMPLEMENTATION
+
+
+#ifndef BK_DISABLE_DUMP
+
+#ifndef BK_DISABLE_Friend_DUMP
+
+void dump_dynamic_Friend(Friend* item, BK_FMT_DST_t dst) {
+    BK_OFFSET_t offset = 0; (void)offset;
+    BK_FMT("info: ");dump_dynamic_Person(&item->friend_info, dst);BK_FMT("\n");BK_FMT("years_known: ");BK_FMT("%d", item->years_known);BK_FMT("\n");
+}
+
+#endif // BK_DISABLE_Friend_DUMP
+
+#endif // BK_DISABLE_DUMP
+
+
+#endif // BK_IMPLEMENTATION
+
+
+#endif // BK_DISABLE_dynamic
+
+#endif // BK_DISABLE_Friend
+
+#endif // __BK_9243443465971576286_2_H__
@@ -0,0 +1,1156 @@
+/*
+Copyright (c) 2025 Serdar Çoruhlu <serdar.coruhlu@hotmail.com>
+
+Permission is hereby granted, free of charge, to any
+person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the
+Software without restriction, including without
+limitation the rights to use, copy, modify, merge,
+publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software
+is furnished to do so, subject to the following
+conditions:
+
+The above copyright notice and this permission notice
+shall be included in all copies or substantial portions
+of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+DEALINGS IN THE SOFTWARE.
+*/
+#ifndef __BK_GEN_EXT_DEFINITIONS
+#define __BK_GEN_EXT_DEFINITIONS
+
+// This would typically be in drives.h, but the single file limitation strikes again
+/** @cond */
+#define derive_bkconf(...)
+/** @endcond */
+
+/**
+ * @brief The general config of `bookkeeper`. Can be configured via command line arguments or configuration files.
+*/
+typedef struct {
+    /**
+     * @brief Is expected to be either "mirror" or "dir". ("mirror" by default)
+     *
+     * The program will exit with a nonzero exit code if this string is something else.
+     *
+     * "mirror" mode puts files that were generated from the user source code
+     * next to its source file, "mirror"ing the original file structure.
+     *
+     * "dir" mode puts all generated files inside the specified `BkConfig::output_dir`.
+    */
+    char* output_mode;
+
+    /**
+     * @brief Enables the experimental generated generic macro API. (false by default)
+     *
+     * This API is still very experimental and isn't stabilized.
+    */
+    bool generics;
+
+    /** @brief Disables all program output. (true by default) */
+    bool silent;
+
+    /**
+     * @brief Enables verbose output. (false by default)
+     *
+     * When disabled, @link LogLevel `LogLevel::LOG_ERROR`@endlink and
+     * @link LogLevel `LogLevel::LOG_WARN`@endlink level logs will be displayed without
+     * the file location.
+     *
+     * When enabled, logs of all levels are displayed and they all contain file
+     * location information.
+    */
+    bool verbose;
+
+    /**
+     * @brief Enables the warning that is emitted when an unknown attribute is found inside
+     *        analyzed source code. (true by default)
+    */
+    bool warn_unknown_attr;
+
+    /** @brief Enables the warning that is emitted when no files were included (false by default) */
+    bool warn_no_include;
+
+    /** @brief Enables the warning that is emitted when no `output_directory` was specified (true by default) */
+    bool warn_no_output;
+
+    /**
+     * @brief Enables the persistent analysis cache. (true by default)
+     *
+     * When enabled, `bookkeeper` keeps a manifest file named '.bk.cache' inside `BkConfig::output_dir` that contains
+     * the content hash and the analyzed types of every input file. Input files that didn't change since the last run
+     * aren't analyzed again and their generated files aren't regenerated.
+    */
+    bool cache;
+
+    /**
+     * @brief Enables Make/Ninja style depfiles for generated files. (false by default)
+     *
+     * When enabled, every generated file gets a depfile next to it (with the '.d' extension appended to its name)
+     * that lists the source file it was generated from, every dynamic schema file and the config file.
+    */
+    bool depfiles;
+
+    /**
+     * @brief Path of a single depfile that contains a rule for every generated file. (NULL by default)
+     *
+     * Useful for build systems that expect a single depfile per build step (e.g. Ninja's `depfile` variable).
+    */
+    char* depfile;
+
+    /** @brief Disables the generation of "dump" functions during code generation (false by default) */
+    bool disable_dump;
+
+    /** @brief Disables the generation of "parse" functions during code generation (false by default) */
+    bool disable_parse;
+
+    /**
+     * @brief Enables the experimental "disabled by default" API for generated code. (false by default)
+     *
+     * When enabled, all features in the generated code are disabled and users
+     * are expected to pick and choose the features they want to enable
+     * and enable them with BK_ENABLE_* macros.
+     *
+     * Since this mode introduces a lot of additional complexity for users,
+     * it may also be called "advanced mode".
+     *
+     * This mode might be temporarily removed for the first release of `bookkeeper`.
+     *
+     * This API is still very experimental and isn't stabilized.
+    */
+    bool disabled_by_default;
+
+    /** @brief Enables watch mode that "watches" your source files and auto-generates code automatically (false by default) */
+    bool watch_mode;
+
+    /**
+     * Simple hack to prevent watch mode from hogging resources. The tool waits `BkConfig::watch_delay` seconds before checking
+     * if any source files were modified to regenerate code (5 by default)
+     *
+     * Only used on platforms where the event based watch backend (inotify) isn't available.
+    */
+    long watch_delay;
+
+    /**
+     * @brief The time window (in milliseconds) that watch mode waits for further file events after receiving one
+     *        before regenerating code. (50 by default)
+     *
+     * Editors usually produce a burst of events for a single save, this window coalesces them into a single regeneration.
+     * It is also the latency between a save and the regeneration, set it to 0 to regenerate as soon as the first event
+     * arrives. Only used by the event based watch backend (inotify).
+    */
+    long watch_debounce;
+
+    /**
+     * @brief The number of threads that read, analyze and generate code for input files. (1 by default)
+     *
+     * When set to 0, the number of online processors is used. Generated files don't depend on this setting.
+    */
+    long jobs;
+
+    /**
+     * @brief Files inside include directories that are larger than this many bytes are skipped. (0 by default)
+     *
+     * When set to 0, files of any size are included. Empty files are always skipped.
+    */
+    long max_file_size;
+
+    /**
+     * @brief The macro that is used inside generated "dump" functions to output into the provided "dst" buffer.
+     *        ("BK_FMT" by default)
+    */
+    char* gen_fmt_macro;
+
+    /**
+     * @brief The macro that is used inside generated code to include implementation in stb-style.
+     *        ("BK_IMPLEMENTATION" by default)
+    */
+    char* gen_implementation_macro;
+
+    /**
+     * @brief The macro that is used inside generated "dump" functions to denote the type of the "dst" parameter.
+     *        ("BK_FMT_DST_t" by default)
+    */
+    char* gen_fmt_dst_macro;
+
+    /**
+     * @brief The macro that is used inside generated "dump" functions to denote the type of the "offset" local
+     *        variable that is used inside the function. ("BK_OFFSET_t" by default)
+    */
+    char* offset_type_macro;
+
+    /**
+     * @brief The prefix that is used to generate macros that disable specific parts of generated code
+     *        ("BK_DISABLE_" by default)
+     *
+     * These generated macros can be:
+     *  - $prefix$DUMP: Disables dump functionality.
+     *  - $prefix$PARSE: Disables parse functionality.
+     *  - $prefix$$type$: Disables all functionality that belongs to $type$.
+     *  - $prefix$$type$_DUMP: Disables dump functionality that belongs to $type$.
+     *  - $prefix$$type$_PARSE: Disables parse functionality that belongs to $type$.
+     *  - $prefix$$type$_$schema$: Disables all functionality that works on $schema$ and belongs to $type$.
+     *  - $prefix$$type$_$schema$_DUMP: Disables dump functionality that works on $schema$ and belongs to $type$.
+     *  - $prefix$$type$_$schema$_PARSE: Disables parse functionality that works on $schema$ and belongs to $type$.
+     *  - $prefix$$schema$: Disables all functionality that works on $schema$.
+     *  - $prefix$$schema$_DUMP: Disables dump functionality that works on $schema$.
+     *  - $prefix$$schema$_PARSE: Disables parse functionality that works on $schema$.
+    */
+    char* disable_macro_prefix;
+
+    /**
+     * @brief The prefix that is used to generate enable macros for the "disabled by default" API.
+     *        ("BK_ENABLE_" by default)
+     *
+     * This API is still very experimental and isn't stabilized.
+    */
+    char* enable_macro_prefix;
+
+    /**
+     * @brief Derives all possible schemas for every struct that is analyzed. (false by default)
+     *
+     * Mainly used for debugging issues regarding generated code.
+    */
+    bool derive_all;
+
+    /**
+     * @brief Denotes the directories (as a comma seperated list) that will be searched recursively for '.c' or '.h' files to analyze.
+     *
+     * Set to NULL if no include directory was specified. Directories supplied on the command line replace this list,
+     * see `BkContext::include_dirs`.
+    */
+    char* include_dir;
+
+    /**
+     * @brief Only used when reading input files as a comma seperated list from configuration files.
+     *
+     * Set to NULL if no config file was loaded, or this field wasn't set inside the loaded config file.
+    */
+    char* include_files;
+
+    /**
+     * @brief Only used when reading dynamic schema files as a comma seperated list from configuration files.
+     *
+     * Set to NULL if no config file was loaded, or this field wasn't set inside the loaded config file.
+    */
+    char* schema_files;
+
+    /**
+     * @brief Denotes the directory that will be used to output most(*) generated files.
+     *
+     * Only used for 'derives.h' and 'generics.h' when `BkConfig::output_mode` is "mirror".
+     *
+     * (*): The 'out' file specified inside the '--gen-ext' flag isn't placed inside this directory
+     *      and that path is directly passed to `fopen`.
+    */
+    char* output_dir;
+} BkConfig derive_bkconf();
+
+/**
+ * @brief Sized dynamic string. Just a dynamic array of characters.
+ *
+ * Its memory is dynamically allocated by macros like @link push_da `push_da`@endlink
+ * and @link print_string `print_string`@endlink.
+ *
+ * You are expected to `free` that memory yourself.
+*/
+typedef struct {
+    char* items;
+    size_t len;
+    size_t cap;
+} String;
+
+/** @brief Dynamic array of `String`. */
+typedef struct {
+    String* items;
+    size_t len;
+    size_t cap;
+} Strings;
+
+/** @cond */
+
+// String_View stuff
+typedef struct {
+    const char* items;
+    size_t len;
+} String_View;
+
+// NOTE: Perhaps we could also generate macros like this for dumping?
+#define SV_FMT "%.*s"
+#define SV_ARG(sv) (int)(sv).len, (sv).items
+#define SV_ARG_N(sv, n) (int)((n <= (sv).len) ? n : (sv).len), (sv).items
+
+String_View sv(const char* cstr);
+String_View sv_from_parts(const char* items, size_t len);
+String_View sv_from_str(String* str);
+char* sv_to_cstr(String_View sv);
+bool sv_starts_with(String_View sv, String_View prefix);
+String_View sv_chop(String_View sv, size_t n);
+bool sv_chop_if_prefix(String_View* sv, String_View prefix);
+String_View sv_chop_line(String_View sv, size_t n);
+void sv_chop2(String_View* sv, size_t n);
+String_View sv_trim_start(String_View sv, char c);
+String_View sv_trim2_start(String_View sv, String_View cs);
+String_View sv_trim_whitespace_start(String_View sv);
+String_View sv_trim_whitespace_end(String_View sv);
+String_View sv_trim_whitespace(String_View sv);
+String_View sv_find(String_View sv, char c);
+bool sv_contains(String_View sv, String_View needle);
+String_View sv_substr(String_View sv, size_t start, size_t len);
+void sv_loc(String_View file, String_View cursor, int* line, int* offset);
+
+/** @endcond */
+
+/** @brief Kind tag for `CType` */
+typedef enum {
+    CPRIMITIVE,
+    CEXTERNAL
+} CType_Kind;
+
+/** @brief A single block of memory of an `Arena`. */
+typedef struct ArenaBlock {
+    /** @brief The next block, blocks after `Arena::current` are free and reused after a reset. */
+    struct ArenaBlock* next;
+    /** @brief Number of bytes in use. */
+    size_t len;
+    /** @brief Number of bytes that fit into `ArenaBlock::data`. */
+    size_t cap;
+    /** @brief Memory of the block. */
+    char data[];
+} ArenaBlock;
+
+/**
+ * @brief Bump allocator, everything that was allocated from it is released at once.
+ *
+ * See @link arena_alloc `arena_alloc`@endlink.
+*/
+typedef struct {
+    /** @brief First block of the arena, NULL if nothing was allocated yet. */
+    ArenaBlock* first;
+    /** @brief Block that allocations are currently served from. */
+    ArenaBlock* current;
+} Arena;
+
+/**
+ * @brief Interned strings, equal strings always get the same id so they can be compared as integers.
+ *
+ * Interned strings are never moved, pointers to them stay valid until the interner is reset or free'd.
+ * See @link intern `intern`@endlink.
+*/
+typedef struct {
+    /** @brief Owns the contents of all interned strings. */
+    Arena arena;
+    /** @brief Every interned string, indexed by id. */
+    struct {
+        const char** items;
+        size_t len;
+        size_t cap;
+    } strings;
+    /** @brief Open addressing hash table that maps strings to their id + 1, `0` marks an empty slot. */
+    unsigned* table;
+    /** @brief Number of slots in `Interner::table`, always a power of two. */
+    size_t table_cap;
+} Interner;
+
+/** @brief Defines different primitive C types. */
+typedef enum {
+    CINT = 1,
+    CUINT,
+    CLONG,
+    CULONG,
+    CCHAR,
+    CFLOAT,
+    CBOOL,
+    CSTRING
+} CPrimitive;
+
+/**
+ * @brief Defines a C type. Acts like a tagged union with the `CType::kind` tag.
+ *
+ * This struct isn't a tagged union to keep its size predictable (Mainly for use in dynamic arrays).
+*/
+typedef struct {
+    /** @brief Tag that denotes which variant the current instance of this type belongs to. */
+    CType_Kind kind;
+
+    /**
+     * @brief Denotes the name of the external type.
+     *
+     * %Field of variant @link CType_Kind `CType_Kind::CEXTERNAL`. @endlink
+    */
+    const char* name;
+
+    /**
+     * @brief Used to identify the primitive type of this type.
+     *
+     * %Field of variant @link CType_Kind `CType_Kind::CPRIMITIVE`. @endlink
+    */
+    CPrimitive type;
+} CType;
+
+/** @brief Dynamic array of `CType` */
+typedef struct {
+    CType* items;
+    size_t len;
+    size_t cap;
+} CTypes;
+
+/**
+ * @brief Defines a field stored inside `CCompound` types.
+*/
+typedef struct {
+    /** @brief The identifier that was used to declare this field inside the analyzed source file. */
+    const char* name;
+
+    /**
+     * @brief Optionally declared inside the source file with the 'tag' attribute.
+     *
+     * If it was declared inside the source file, it is set to the string specified inside the attribute invocation. If
+     * a special tag was not declared inside the source file, `Field::tag` is set to NULL and code generation uses the `Field::name`
+     * field for serialization.
+    */
+    const char* tag;
+
+    /** @brief The @link CType type@endlink of this field. */
+    CType type;
+} Field;
+
+/** @brief Dynamic array of `Field` */
+typedef struct {
+    Field* items;
+    size_t len;
+    size_t cap;
+} Fields;
+
+/**
+ * @brief Set of schemas, stored as a bitset over their indices.
+ *
+ * Static schemas use their index inside `BkContext::schemas`, dynamic schemas follow right after them,
+ * see @link schema_index `schema_index`@endlink. The set grows as needed, so there is no limit on the amount of schemas.
+*/
+typedef struct {
+    /** @brief Bits of the set, 64 schemas per word. The last word is never zero. */
+    unsigned long long* items;
+    size_t len;
+    size_t cap;
+} DeriveSet;
+
+/**
+ * @brief Evaluates to non-zero if the schema with the provided index is part of `set`.
+ *
+ * @param set Assumed to be of type `DeriveSet`.
+ * @param index Index of the schema, see @link schema_index `schema_index`@endlink.
+*/
+#define derive_set_has(set, index) ((index) / 64 < (set).len && (((set).items[(index) / 64] >> ((index) % 64)) & 1))
+
+/** @brief Value returned by @link derive_set_next `derive_set_next`@endlink when there are no more schemas in a set. */
+#define DERIVE_SET_END ((size_t)-1)
+
+/**
+ * @brief Defines a compund C type with fields.
+*/
+typedef struct {
+    /** @brief Schemas derived by this type. */
+    DeriveSet derived_schemas;
+    Fields fields;
+    const char* name;
+} CCompound;
+
+/** @brief Dynamic array of `CCompound` */
+typedef struct {
+    CCompound* items;
+    size_t len;
+    size_t cap;
+
+    /**
+     * @brief Owns the fields and all strings of the types, equal names share the same string.
+     *
+     * Fields are allocated from `Interner::arena` once a type is complete, so they can't grow afterwards.
+    */
+    Interner names;
+} CCompounds;
+
+typedef struct BkContext BkContext;
+typedef struct BkStats BkStats;
+
+/** @brief Defines a static schema. */
+typedef struct {
+    /**
+     * @brief (Nullable) Pointer to function that will be called to generate 'prelude' code that will be generated once at the
+     *                   top of each generated file.
+     *
+     * Schema authors may use this section for generating common type definitions (such as return enumerations) or for
+     * utility functions to be used in generated code.
+     *
+     * The code inside generated inside function is automatically protected by extra header guards
+     * to avoid redefinition/redeclaration errors.
+     *
+     * @param bk The context that generates code.
+     * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
+    */
+    void (*gen_prelude)(BkContext* bk, String* book_buf);
+
+    /**
+     * @brief (Nullable) Pointer to function that will be used to generate the declarations of "dump"
+     *        functions for the specified type.
+     *
+     * The convention for the signatures of generated functions here is `void dump_$schema.name$_$type$($type$* item, $dst_type$ dst)`
+     *
+     * @param bk The context that generates code.
+     * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
+     *        macro available to both this source file and extension authors can be used to output into this buffer.
+     * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
+     * @param dst_type The type of the 'dst' parameter that is meant to be used for generated "dump" functions.
+     * @return Should return the total amount of declarations.
+    */
+    size_t (*gen_dump_decl)(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type);
+
+    /**
+     * @brief (Nullable) Pointer to function that will be used to generate the declarations of "parse"
+     *        functions for the specified type.
+     *
+     * The convention for the signatures of generated functions here is `int|$enum$ parse_$schema$_$type$(char* src, unsigned long len, $type$* dst)`
+     *
+     * Schemas may also define enumerations inside their `StaticSchema::gen_prelude` functions to return error codes. Even if schema
+     * authors make use of such error codes, return value '0' should always mean OK.
+     *
+     *
+     * @param bk The context that generates code.
+     * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
+     *        macro available to both this source file and extension authors can be used to output into this buffer.
+     * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
+     * @return Should return the total amount of declarations.
+    */
+    size_t (*gen_parse_decl)(BkContext* bk, String* book_buf, CCompound* ty);
+
+    /**
+     * @brief (Nullable) Pointer to function that will be used to generate the implementations of "dump"
+     *        functions for the specified type.
+     *
+     * The convention for the signatures of generated functions here is `void dump_$schema.name$_$type$($type$* item, $dst_type$ dst)`
+     *
+     * @param bk The context that generates code.
+     * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
+     *        macro available to both this source file and extension authors can be used to output into this buffer.
+     * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
+     * @param dst_type The type of the 'dst' parameter that is meant to be used for generated "dump" functions.
+     * @param fmt_macro The name of the macro that is meant to be used **inside generated code** to output into the 'dst' buffer.
+    */
+    void (*gen_dump_impl)(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro);
+
+    /**
+     * @brief (Nullable) Pointer to function that will be used to generate the implementations of "parse"
+     *        functions for the specified type.
+     *
+     * The convention for the signatures of generated functions here is `int|$enum$ parse_$schema$_$type$(char* src, unsigned long len, $type$* dst)`
+     *
+     * Schemas may also define enumerations inside their `StaticSchema::gen_prelude` functions to return error codes. Even if schema
+     * authors make use of such error codes, return value '0' should always mean OK.
+     *
+     * @param bk The context that generates code.
+     * @param book_buf The string buffer that is used to store generated code. The @link print_string `print_string` @endlink
+     *        macro available to both this source file and extension authors can be used to output into this buffer.
+     * @param ty The type that this function is meant to generate code for, contains all necessary info for code generation.
+    */
+    void (*gen_parse_impl)(BkContext* bk, String* book_buf, CCompound* ty);
+
+    /**
+     * @brief Defines the name of the 'attribute macro' that will be generated inside 'derives.h'
+     *        for users to derive functionality for this schema.
+    */
+    const char* derive_attr;
+
+    /**
+     * @brief Defines the unique name for this schema.
+    */
+    const char* name;
+} StaticSchema;
+
+/** @brief Dynamic array for `StaticSchema`. */
+typedef struct {
+    StaticSchema* items;
+    size_t len;
+    size_t cap;
+} StaticSchemas;
+
+/** @brief Kind tag for `SchemaOp`, see @link compile_dynamic_schema `compile_dynamic_schema`@endlink. */
+typedef enum {
+    /** @brief Outputs `SchemaOp::text`. */
+    SOP_TEXT,
+    /** @brief Outputs the name of the type, `$ty$`. */
+    SOP_TY,
+    /** @brief Outputs the `fmt_macro` of the generator, `$fmt$`. */
+    SOP_FMT,
+    /** @brief Outputs the `dst_type` of the generator, `$dst$`. */
+    SOP_DST,
+    /** @brief Outputs `BkConfig::offset_type_macro`, `$offset$`. */
+    SOP_OFFSET,
+    SOP_IMPLGUARD,
+    SOP_ENDIMPLGUARD,
+    SOP_DUMPGUARD,
+    SOP_ENDDUMPGUARD,
+    SOP_PARSEGUARD,
+    SOP_ENDPARSEGUARD,
+    /** @brief Runs the `SchemaOp::value` operations that follow it once for every field of the type. */
+    SOP_FOR,
+    /** @brief Outputs a newline and `SchemaOp::text`, the text after the last directive of the schema. */
+    SOP_TAIL,
+    /** @brief Outputs the name of the current field, `$it$`. Only appears inside of loop bodies. */
+    SOP_FIELD,
+    /** @brief Outputs the tag (or name) of the current field, `$tag$`. Only appears inside of loop bodies. */
+    SOP_TAG,
+    /** @brief Outputs the type name of the current `CEXTERNAL` field, `$it.type$`. Only appears inside of loop bodies. */
+    SOP_TYPE,
+    /** @brief Starts an if whose condition is true when the bit of the field's type is set in `SchemaOp::value`. */
+    SOP_IF_TYPE,
+    /** @brief Starts an if whose condition is true when the index of the field is `SchemaOp::value`. */
+    SOP_IF_INDEX_EQ,
+    /** @brief Starts an if whose condition is true when the index of the field isn't `SchemaOp::value`. */
+    SOP_IF_INDEX_NE,
+    SOP_ENDIF,
+} SchemaOpKind;
+
+/** @brief The output of a loop body operation starts a segment that is trimmed once it ends. */
+#define SOP_SEGMENT_START 1
+/** @brief The output of a loop body operation ends a trimmed segment. */
+#define SOP_SEGMENT_END 2
+/** @brief The output of a loop body operation isn't conditional on the current if. */
+#define SOP_ALWAYS 4
+
+/** @brief A single instruction of a compiled dynamic schema. */
+typedef struct {
+    /** @brief Tag that denotes what the instruction does. */
+    SchemaOpKind kind;
+    /** @brief Combination of `SOP_SEGMENT_START`, `SOP_SEGMENT_END` and `SOP_ALWAYS`. */
+    unsigned flags;
+    /** @brief Text of `SOP_TEXT` and `SOP_TAIL`, points into `DynamicSchema::source`. */
+    String_View text;
+    /** @brief Body length of `SOP_FOR`, type mask of `SOP_IF_TYPE` or index of `SOP_IF_INDEX_EQ` and `SOP_IF_INDEX_NE`. */
+    size_t value;
+} SchemaOp;
+
+/** @brief Dynamic array for `SchemaOp`. */
+typedef struct {
+    SchemaOp* items;
+    size_t len;
+    size_t cap;
+} SchemaOps;
+
+/** @brief Defines a dynamic schema object. */
+typedef struct {    
+    /**
+     * @brief String view that contains a view into the source code of the dynamic schema in the .schema format.
+     *
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
+    */
+    String_View source;
+
+    /**
+     * @brief Defines the name of the 'attribute macro' that will be generated inside 'derives.h'
+     *        for users to derive functionality for this dynamic schema.
+     *
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
+    */
+    String_View derive_attr;
+
+    /**
+     * @brief Defines the unique name for this dynamic schema.
+     *
+     * The memory that is pointed to by this view is managed by the `BkContext` that loaded this schema.
+    */
+    String_View name;
+
+    /**
+     * @brief The path that was used to load this dynamic schema. Used for reloading the schema in watch mode.
+     *
+     * This string is owned by the `BkContext` that loaded this schema.
+    */
+    char* file_name;
+
+    /**
+     * @brief The instructions that `DynamicSchema::source` was compiled to when it was loaded.
+     *
+     * Owned by the `BkContext` that loaded this schema.
+    */
+    SchemaOps ops;
+} DynamicSchema;
+
+/** @brief Dynamic array for `DynamicSchema`. */
+typedef struct {
+    DynamicSchema* items;
+    size_t len;
+    size_t cap;
+} DynamicSchemas;
+
+/** @brief A shared object that static schemas were loaded from, see @link load_plugin `load_plugin`@endlink. */
+typedef struct {
+    /** @brief Handle returned by `dlopen`, closed after everything else is cleaned up. */
+    void* handle;
+    /** @brief The path that was used to load the plugin. Owned by the `BkContext` that loaded the plugin. */
+    char* file_name;
+} Plugin;
+
+/** @brief Dynamic array for `Plugin`. */
+typedef struct {
+    Plugin* items;
+    size_t len;
+    size_t cap;
+} Plugins;
+
+/** @brief Meaning of an identifier to the analyzer, see @link init_analysis_symbols `init_analysis_symbols`@endlink. */
+typedef struct {
+    /** @brief Primitive type the identifier names when it's used as a field type on its own, `0` if none. */
+    CPrimitive primitive;
+    /** @brief Index + 1 of the schema the identifier derives when it's used as an attribute, `0` if it isn't a derive attribute. */
+    size_t schema;
+} AnalysisSymbol;
+
+/** @brief Dynamic array of `AnalysisSymbol` */
+typedef struct {
+    AnalysisSymbol* items;
+    size_t len;
+    size_t cap;
+} AnalysisSymbols;
+
+/** @brief Enumeration that defines all supported schema types. */
+typedef enum {
+    SCHEMA_STATIC,
+    SCHEMA_DYNAMIC,
+} SchemaType;
+
+/**
+ * @brief Defines a source file meant to be analyzed.
+ *
+ * The contents of `Entry::full` and `Entry::name` aren't validated in any way and are expected to be
+ * assigned correctly.
+*/
+typedef struct {
+    /**
+     * @brief The canonical path to the entry file.
+     *
+     * Used during logging and generating unique hashes for generated files.
+    */
+    char* full;
+    /**
+     * @brief The short display name for the entry file.
+     *
+     * Used for logging and human readable generated code.
+     * Ideally would be the last part of a path string.
+    */
+    char* name;
+    /**
+     * @brief The modification time (in seconds) of the entry file in the file system.
+     *
+     * When using `stat` on POSIX, this field is equivalent to `file_stat.st_mtim.tv_sec`.
+    */
+    time_t sys_modif;
+    /**
+     * Assigned to the time elapsed since the UNIX epoch (in seconds)
+     * whenever this file is analyzed (even if the analysis fails).
+    */
+    time_t last_analyzed;
+    /** @brief Set whenever a file was generated from this entry during its last analysis. */
+    bool has_output;
+    /**
+     * @brief The index that is used inside the header guard of the file generated from this entry.
+     *
+     * Only valid if `Entry::has_output` is set. Entries keep their index when they are analyzed again (in watch or daemon mode)
+     * so regenerating a file doesn't change it unless its contents changed.
+    */
+    size_t file_idx;
+} Entry;
+
+/** @brief Dynamic array for `Entry`. */
+typedef struct {
+    Entry* items;
+    size_t len;
+    size_t cap;
+} Entries;
+
+/** @brief Dynamic array of C strings */
+typedef struct {
+    char** items;
+    size_t len;
+    size_t cap;
+} CStrings;
+
+/**
+ * @brief General state of a single `bookkeeper` instance.
+ *
+ * Everything `bookkeeper` does happens through a context that is passed around explicitly (usually as a parameter named `bk`,
+ * which the logging and formatting macros expect to be in scope), so independent instances can run in the same process.
+ * A context shouldn't be used by multiple threads at the same time unless they only read it and don't use `BkContext::tmp_str`.
+*/
+struct BkContext {
+    /** @brief The current configuration for `bookkeeper`. */
+    BkConfig conf;
+
+    /** @brief Dynamic array of all input files that were discovered or supplied. */
+    Entries entries;
+
+    /** @brief Root directories that are searched for input files, without trailing slashes. Owns its strings. */
+    CStrings include_dirs;
+
+    /** @brief Dynamic array of all static schemas that were defined. */
+    StaticSchemas schemas;
+
+    /** @brief Dynamic array of all static schemas that were defined. */
+    DynamicSchemas dynamic_schemas;
+
+    /** @brief Dynamic string buffer that is used to store all dynamic schema sources. */
+    Strings dynamic_source;
+
+    /** @brief Shared objects that static schemas were loaded from. */
+    Plugins plugins;
+
+    /** @brief Set of all schemas that were derived globally */
+    DeriveSet derive_schemas;
+
+    /** @brief Identifiers the analyzer looks for, interned once after all schemas are loaded. */
+    Interner symbols;
+
+    /** @brief Meaning of every string in `BkContext::symbols`, indexed by id. */
+    AnalysisSymbols symbol_info;
+
+    /** @brief Path of the config file that was loaded, NULL if no config file was loaded. */
+    const char* config_file;
+
+    /** @brief Path of the config file that `main` loads, "./.bk.conf" unless `--config-path` was used. */
+    const char* config_path;
+
+    /** @brief Unix domain socket the context listens on as a daemon (see `--daemon`), NULL if it isn't a daemon. */
+    const char* daemon_socket;
+
+    /** @brief Socket of the daemon that `--client` sends its request to, NULL if the context isn't a client. */
+    const char* client_socket;
+
+    /** @brief Manifest that is run instead of a single config (see `--manifest`), NULL if there is none. */
+    const char* manifest_path;
+
+    /** @brief File that the spans of the run are written to (see `--trace`), NULL if no trace is written. */
+    const char* trace_path;
+
+    /** @brief Prints `BkContext::stats` after the run (see `--stats`). */
+    bool show_stats;
+
+    /** @brief Prints the statistics as CSV instead of a table (see `--stats-csv`). */
+    bool stats_csv;
+
+    /** @brief Statistics of the run (see `--stats` and `--trace`), NULL if they aren't collected. Shared with every copy of the context. */
+    BkStats* stats;
+
+    /** @brief Temporary string buffer of this context, see @link tfmt `tfmt`@endlink. */
+    char tmp_str[4096];
+};
+
+/** @brief Version of the plugin interface, changes whenever the meaning of the types in the extension header changes. */
+#define BK_PLUGIN_ABI_VERSION 1
+
+/**
+ * @brief Describes the interface a plugin was built against, plugins export it as `bk_plugin_abi`.
+ *
+ * Use @link BK_DEFINE_PLUGIN_ABI `BK_DEFINE_PLUGIN_ABI`@endlink to define it, see @link load_plugin `load_plugin`@endlink.
+*/
+typedef struct {
+    /** @brief `BK_PLUGIN_ABI_VERSION` of the extension header the plugin was built with. */
+    unsigned version;
+    /** @brief Size of `BkContext`. */
+    size_t context_size;
+    /** @brief Size of `CCompound`. */
+    size_t compound_size;
+    /** @brief Size of `StaticSchema`. */
+    size_t schema_size;
+} BkPluginAbi;
+
+/**
+ * @brief Registration function that plugins export as `bk_plugin_register`.
+ *
+ * @param count Out parameter that is assigned to the number of returned schemas.
+ * @return The schemas of the plugin, the memory has to stay valid while the plugin is loaded.
+*/
+typedef const StaticSchema* (*BkPluginRegister)(size_t* count);
+
+/** @brief Defines the `bk_plugin_abi` symbol of a plugin, must be used exactly once in a plugin. */
+#define BK_DEFINE_PLUGIN_ABI \
+const BkPluginAbi bk_plugin_abi = {BK_PLUGIN_ABI_VERSION, sizeof(BkContext), sizeof(CCompound), sizeof(StaticSchema)}
+
+/**
+ * @brief Uses the `BkContext::tmp_str` buffer of the `BkContext* bk` in scope with `sprintf` to quickly format a string.
+ *
+ * The `tmp_str` gets constantly overwritten with every call to this macro or other functions that use the buffer
+ * so this macro shouldn't be used to generate strings that are meant to be stored. Functions that write files never
+ * use the buffer themselves, so their paths can be formatted with this macro.
+ *
+ * @return Returns the pointer to the `tmp_str` buffer so this macro can easily be used inside expressions.
+*/
+#define tfmt(...) (sprintf(bk->tmp_str, __VA_ARGS__), bk->tmp_str)
+
+/**
+ * @brief Internally uses the @link tfmt `tfmt`@endlink macro to format a string, but this macro also duplicates that string for safe storage.
+ *
+ * Has to be manually free'd with `free`.
+*/
+#define fmt(...) strdup(tfmt(__VA_ARGS__))
+
+/**
+ * @brief Logging system of `bookkeeper`. Uses the configuration of the `BkContext* bk` in scope.
+ *
+ * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
+ * @param source The path to the source file name that will be used while logging.
+ * @param line The line number that will be used while logging.
+ * @param ... `printf` style format arguments
+*/
+#define bk_log_loc(level, source, line, ...) do {\
+    if (!bk->conf.silent) {\
+        switch ((level)) {\
+        case LOG_INFO: {\
+            if (bk->conf.verbose) {\
+                fprintf(stderr, "%s:%d: [INFO] ", (source), (line));\
+                fprintf(stderr, __VA_ARGS__);\
+            }\
+        } break;\
+        case LOG_WARN: {\
+            if (bk->conf.verbose) {\
+                fprintf(stderr, "%s:%d: [WARN] ", (source), (line));\
+            } else {\
+                fprintf(stderr, "WARNING: ");\
+            }\
+            fprintf(stderr, __VA_ARGS__);\
+        } break;\
+        case LOG_ERROR: {\
+            if (bk->conf.verbose) {\
+                fprintf(stderr, "%s:%d: [ERROR] ", (source), (line));\
+            } else {\
+                fprintf(stderr, "ERROR: ");\
+            }\
+            fprintf(stderr, __VA_ARGS__);\
+        } break;\
+        default: abort();\
+        }\
+    }\
+} while(0)
+
+/**
+ * @brief Wrapper around @link bk_log_loc `bk_log_loc`,@endlink used for internal logging.
+ *
+ * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
+ * @param ... `printf` style format arguments
+*/
+#define bk_log(level, ...) bk_log_loc(level, __FILE__, __LINE__, __VA_ARGS__)
+
+/**
+ * @brief Diagnostics system of `bookkeeper`.
+ *
+ * This macro is purely for use in @link analyze_file `analyze_file`@endlink since it implicitly uses
+ * its `file_name` parameter and its `tape` of tokens.
+ *
+ * See @link bk_diag_loc `bk_diag_loc`@endlink for a generic version that accepts those as parameters.
+ *
+ * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
+ * @param token_index Index of the token in `tape` that the diagnostic is about.
+ * @param ... `printf` style format arguments
+*/
+#define bk_diag(level, token_index, ...) do {\
+int diag_line, diag_offset;\
+tape_location(&tape, (token_index), &diag_line, &diag_offset);\
+bk_diag_loc(level, file_name, diag_line, diag_offset, __VA_ARGS__);\
+} while(0)
+
+/**
+ * @brief Inner `loc` implementation of @link bk_diag `bk_diag`@endlink.
+ *
+ * @param level Level of logging meant to be used for this call. Should be a member of `LogLevel`.
+ * @param source Short name of the source file that the diagnostic originated from.
+ * @param line The line number the diagnostic originated at.
+ * @param offset The line offset the diagnostic originated at.
+ * @param ... `printf` style format arguments
+*/
+#define bk_diag_loc(level, source, line, offset, ...) do {\
+    switch ((level)) {\
+    case LOG_INFO: {\
+        if (bk->conf.verbose) {\
+            fprintf(stderr, "%s:%d:%d: ", (source), (line), (offset));\
+            fprintf(stderr, __VA_ARGS__);\
+        }\
+    } break;\
+    case LOG_WARN: {\
+        fprintf(stderr, "%s:%d:%d: WARNING: ", (source), (line), (offset));\
+        fprintf(stderr, __VA_ARGS__);\
+    } break;\
+    case LOG_ERROR: {\
+        fprintf(stderr, "%s:%d:%d: ERROR: ", (source), (line), (offset));\
+        fprintf(stderr, __VA_ARGS__);\
+    } break;\
+    default: abort();\
+    }\
+} while(0)
+
+/** @brief Enumeration for different logging levels that are used in @link bk_log_loc `bk_log_loc`@endlink and @link bk_log `bk_log`@endlink. */
+typedef enum {
+    LOG_INFO,
+    LOG_WARN,
+    LOG_ERROR,
+} LogLevel;
+
+/**
+ * @brief Macro that can push elements into arbitrary dynamic arrays.
+ *
+ * @param arr Pointer to a struct with `items`, `len` and `cap` fields.
+ *            `*arr` can be zero initialized but `items` must be a valid pointer
+ *            and must be able to be reallocated with `realloc` if it is non NULL.
+ *            `items` is automatically allocated if it is NULL.
+ *
+ * @param item Assumed to be the same type as `*arr->items`.
+*/
+#define push_da(arr, item) do {                                                     \
+    if ((arr)->len + 1 >= (arr)->cap) {                                             \
+        if ((arr)->cap > 0) {                                                       \
+            (arr)->cap = (arr)->cap * 2;                                            \
+        } else {                                                                    \
+            (arr)->cap = 2;                                                         \
+        }                                                                           \
+        if ((arr)->items) {                                                         \
+            (arr)->items = realloc((arr)->items, (arr)->cap * sizeof *(arr)->items);\
+        } else {                                                                    \
+            (arr)->items = malloc((arr)->cap * sizeof *(arr)->items);               \
+        }                                                                           \
+    }                                                                               \
+    (arr)->items[(arr)->len++] = (item);                                            \
+} while(0)
+
+/**
+ * @brief Macro that makes sure `str` has room for `extra` more characters and a null terminator.
+ *
+ * The capacity at least doubles whenever `str` has to grow, so appending to a `String` is amortized linear.
+ *
+ * @param str Assumed to be of type `String*`.
+ * @param extra Number of characters that are about to be appended.
+*/
+#define reserve_string(str, extra) do {                                             \
+    size_t needed = (str)->len + (extra) + 1;                                       \
+    if (needed > (str)->cap) {                                                      \
+        (str)->cap = (str)->cap * 2 > needed ? (str)->cap * 2 : needed;             \
+        if ((str)->items) {                                                         \
+            (str)->items = realloc((str)->items, (str)->cap * sizeof *(str)->items);\
+        } else {                                                                    \
+            (str)->items = malloc((str)->cap * sizeof *(str)->items);               \
+        }                                                                           \
+    }                                                                               \
+} while(0)
+
+/**
+ * @brief Macro that appends `n` characters starting at `data` to `str` without any formatting.
+ *
+ * Like @link print_string `print_string`@endlink it keeps `str` null terminated.
+ *
+ * @param str Assumed to be of type `String*`.
+ * @param data Assumed to be of type `const char*`, must not point into `str`.
+ * @param n Number of characters to append.
+*/
+#define append_string(str, data, n) do {                                            \
+    size_t append_len = (n);                                                        \
+    reserve_string(str, append_len);                                                \
+    memcpy((str)->items + (str)->len, (data), append_len);                          \
+    (str)->len += append_len;                                                       \
+    (str)->items[(str)->len] = '\0';                                                \
+} while(0)
+
+/**
+ * @brief Fast path of @link print_string `print_string`@endlink for string literals that don't need any formatting.
+ *
+ * The length of the literal is known at compile time, so this is a single `memcpy`.
+ * Unlike with `print_string`, `%` characters are copied as is.
+ *
+ * @param str Assumed to be of type `String*`.
+ * @param lit A string literal.
+*/
+#define print_lit(str, lit) append_string(str, "" lit, sizeof(lit) - 1)
+
+/**
+ * @brief Appends the contents of a `String_View` to `str` without any formatting.
+ *
+ * @param str Assumed to be of type `String*`.
+ * @param sv Assumed to be of type `String_View`.
+*/
+#define print_sv(str, sv) do {                                                      \
+    String_View print_sv_view = (sv);                                               \
+    append_string(str, print_sv_view.items, print_sv_view.len);                     \
+} while(0)
+
+/**
+ * @brief Macro that can be used like `fprintf` but with `String`s.
+ *
+ * Formats directly into the spare capacity of `str` and doesn't use any shared buffers, so it can be used by
+ * multiple threads at the same time as long as they write into different strings.
+ * The format arguments are evaluated a second time if `str` has to grow.
+ * Prefer @link print_lit `print_lit`@endlink for literals without format arguments.
+ *
+ * @param str Assumed to be of type `String*`.
+ * @param ... `printf` style format arguments.
+*/
+#define print_string(str, ...) do {                                                 \
+    size_t avail = (str)->cap - (str)->len;                                         \
+    int len = snprintf((str)->items ? (str)->items + (str)->len : NULL, avail, __VA_ARGS__);\
+    if ((size_t)len >= avail) {                                                     \
+        reserve_string(str, (size_t)len);                                           \
+        snprintf((str)->items + (str)->len, len + 1, __VA_ARGS__);                  \
+    }                                                                               \
+    (str)->len += len;                                                              \
+} while(0)
+
+/**
+ * @defgroup libbk Library API
+ * @brief Functions for generating code in-process, link with 'build/libbk.a' and include the extension header.
+ *
+ * None of these functions touch the filesystem. A context can analyze and generate from multiple threads at once
+ * as long as no schemas are registered in the meantime.
+ * @{
+*/
+/** @brief Allocates a context with the default configuration and the built-in static schemas, free it with `bk_destroy`. */
+BkContext* bk_create(void);
+/** @brief free's a context that was created with `bk_create`. */
+void bk_destroy(BkContext* bk);
+/**
+ * @brief Registers a static schema, its strings and functions have to stay valid while the context is used.
+ *
+ * @return Returns `false` if a schema with the same name was already registered.
+*/
+bool bk_register_schema(BkContext* bk, const StaticSchema* schema);
+/**
+ * @brief Registers a dynamic schema from the `.schema` source inside `source`, which is copied.
+ *
+ * @param name Name of the schema source that is used in diagnostics.
+ * @return Returns `false` if the schema has errors.
+*/
+bool bk_register_dynamic_schema(BkContext* bk, const char* name, const char* source, size_t len);
+/**
+ * @brief Analyzes the C source inside `source` and appends the types it defines to `out`.
+ *
+ * `out` has to be zero initialized before its first use and free'd with `bk_free_types`.
+ *
+ * @param name Name of the source that is used in diagnostics.
+ * @return Returns `true` if any types were found.
+*/
+bool bk_analyze(BkContext* bk, const char* name, const char* source, size_t len, CCompounds* out);
+/**
+ * @brief Appends the code that is generated for `types` to `out`, without the header guard of generated files.
+ *
+ * `out` is kept null terminated.
+ * @return Returns `false` if nothing was generated for `types`.
+*/
+bool bk_generate(BkContext* bk, CCompounds* types, String* out);
+/** @brief Appends the contents of 'derives.h' for the registered schemas to `out`. */
+void bk_generate_derives(BkContext* bk, String* out);
+/** @brief free's types that were analyzed with `bk_analyze`. */
+void bk_free_types(CCompounds* types);
+/** @} */
+#endif // __BK_GEN_EXT_DEFINITIO
\ No newline at end of file
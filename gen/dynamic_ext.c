@@ -0,0 +1,88 @@
+// Generated by `bk --compile-schema` from './examples/dynamic.schema', do not edit.
+// Add the schema to `bookkeeper` by including this file and defining
+// `#define BK_ADD_SCHEMAS(s) push_da(&s, dynamic_schema);` before including "bk.c".
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "bk_ext.h"
+
+static size_t gen_dynamic_dump_decl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type) {
+    (void)bk;
+    (void)dst_type;
+    print_lit(book_buf, "\n"
+        "void dump_dynamic_");
+    append_string(book_buf, ty->name, strlen(ty->name));
+    print_lit(book_buf, "(");
+    append_string(book_buf, ty->name, strlen(ty->name));
+    print_lit(book_buf, "* item, ");
+    append_string(book_buf, dst_type, strlen(dst_type));
+    print_lit(book_buf, " dst);\n");
+    return 1;
+}
+
+static void gen_dynamic_dump_impl(BkContext* bk, String* book_buf, CCompound* ty, const char* dst_type, const char* fmt_macro) {
+    (void)bk;
+    (void)dst_type;
+    (void)fmt_macro;
+    print_lit(book_buf, "\n"
+        "void dump_dynamic_");
+    append_string(book_buf, ty->name, strlen(ty->name));
+    print_lit(book_buf, "(");
+    append_string(book_buf, ty->name, strlen(ty->name));
+    print_lit(book_buf, "* item, ");
+    append_string(book_buf, dst_type, strlen(dst_type));
+    print_lit(book_buf, " dst) {\n"
+        "    ");
+    append_string(book_buf, bk->conf.offset_type_macro, strlen(bk->conf.offset_type_macro));
+    print_lit(book_buf, " offset = 0; (void)offset;\n"
+        "    ");
+    for (size_t i = 0; i < ty->fields.len; ++i) {
+        Field* field = ty->fields.items + i;
+        (void)field;
+        append_string(book_buf, fmt_macro, strlen(fmt_macro));
+        print_lit(book_buf, "(\"");
+        append_string(book_buf, field->tag ? field->tag : field->name, strlen(field->tag ? field->tag : field->name));
+        print_lit(book_buf, ": \");");
+        if ((field->type.kind == CPRIMITIVE && field->type.type == CINT)) {
+            append_string(book_buf, fmt_macro, strlen(fmt_macro));
+            print_lit(book_buf, "(\"%d\", item->");
+            append_string(book_buf, field->name, strlen(field->name));
+            print_lit(book_buf, ");");
+        }
+        if ((field->type.kind == CPRIMITIVE && field->type.type == CSTRING)) {
+            append_string(book_buf, fmt_macro, strlen(fmt_macro));
+            print_lit(book_buf, "(\"%s\", item->");
+            append_string(book_buf, field->name, strlen(field->name));
+            print_lit(book_buf, ");");
+        }
+        if ((field->type.kind == CPRIMITIVE && field->type.type == CBOOL)) {
+            append_string(book_buf, fmt_macro, strlen(fmt_macro));
+            print_lit(book_buf, "(\"%s\", item->");
+            append_string(book_buf, field->name, strlen(field->name));
+            print_lit(book_buf, "? \"true\" : \"false\");");
+        }
+        if (field->type.kind == CEXTERNAL) {
+            print_lit(book_buf, "dump_dynamic_");
+            append_string(book_buf, field->type.name, strlen(field->type.name));
+            print_lit(book_buf, "(&item->");
+            append_string(book_buf, field->name, strlen(field->name));
+            print_lit(book_buf, ", dst);");
+        }
+        append_string(book_buf, fmt_macro, strlen(fmt_macro));
+        print_lit(book_buf, "(\"\\n\");");
+    }
+    print_lit(book_buf, "\n"
+        "}\n");
+}
+
+static StaticSchema dynamic_schema = {
+    .gen_prelude = NULL,
+    .gen_dump_decl = gen_dynamic_dump_decl,
+    .gen_dump_impl = gen_dynamic_dump_impl,
+    .gen_parse_decl = NULL,
+    .gen_parse_impl = NULL,
+    .derive_attr = "derive_dynamic",
+    .name = "dynamic"
+};
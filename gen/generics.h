@@ -0,0 +1,124 @@
+#ifdef ___BK_IF_TYPE_ManagerWithSalary
+#undef ___BK_IF_TYPE_ManagerWithSalary
+#endif // ___BK_IF_TYPE_ManagerWithSalary
+#ifdef ___BK_INCLUDE_TYPE_ManagerWithSalary
+#define ___BK_IF_TYPE_ManagerWithSalary(x) x,
+#else // ___BK_INCLUDE_TYPE_ManagerWithSalary
+#define ___BK_IF_TYPE_ManagerWithSalary(x)
+#endif // ___BK_INCLUDE_TYPE_ManagerWithSalary
+#ifdef ___BK_IF_TYPE_Person
+#undef ___BK_IF_TYPE_Person
+#endif // ___BK_IF_TYPE_Person
+#ifdef ___BK_INCLUDE_TYPE_Person
+#define ___BK_IF_TYPE_Person(x) x,
+#else // ___BK_INCLUDE_TYPE_Person
+#define ___BK_IF_TYPE_Person(x)
+#endif // ___BK_INCLUDE_TYPE_Person
+#ifdef ___BK_IF_TYPE_Manager
+#undef ___BK_IF_TYPE_Manager
+#endif // ___BK_IF_TYPE_Manager
+#ifdef ___BK_INCLUDE_TYPE_Manager
+#define ___BK_IF_TYPE_Manager(x) x,
+#else // ___BK_INCLUDE_TYPE_Manager
+#define ___BK_IF_TYPE_Manager(x)
+#endif // ___BK_INCLUDE_TYPE_Manager
+#ifdef ___BK_IF_TYPE_Friend
+#undef ___BK_IF_TYPE_Friend
+#endif // ___BK_IF_TYPE_Friend
+#ifdef ___BK_INCLUDE_TYPE_Friend
+#define ___BK_IF_TYPE_Friend(x) x,
+#else // ___BK_INCLUDE_TYPE_Friend
+#define ___BK_IF_TYPE_Friend(x)
+#endif // ___BK_INCLUDE_TYPE_Friend
+#ifndef BK_DISABLE_DUMP
+#ifndef BK_DISABLE_json
+#ifndef BK_DISABLE_json_DUMP
+#ifdef ___BK_GENERIC_DUMP_json_CASES
+#undef ___BK_GENERIC_DUMP_json_CASES
+#endif // ___BK_GENERIC_DUMP_json_CASES
+#define ___BK_GENERIC_DUMP_json_CASES\
+    ___BK_IF_TYPE_ManagerWithSalary(ManagerWithSalary*: dump_json_ManagerWithSalary)\
+    ___BK_IF_TYPE_Person(Person*: dump_json_Person)\
+    ___BK_IF_TYPE_Manager(Manager*: dump_json_Manager)\
+    ___BK_IF_TYPE_Friend(Friend*: dump_json_Friend)\
+
+#ifdef dump_json
+
+#undef dump_json
+
+#endif // dump_json
+
+#define dump_json(item, dst)\
+_Generic((item), ___BK_GENERIC_DUMP_json_CASES default: NULL)((item), (dst))
+#endif // BK_DISABLE_json_DUMP
+#endif // BK_DISABLE_json
+#endif // BK_DISABLE_DUMP
+#ifndef BK_DISABLE_PARSE
+#ifndef BK_DISABLE_json
+#ifndef BK_DISABLE_json_PARSE
+#ifdef ___BK_GENERIC_PARSE_json_CASES
+#undef ___BK_GENERIC_PARSE_json_CASES
+#endif // ___BK_GENERIC_PARSE_json_CASES
+#define ___BK_GENERIC_PARSE_json_CASES\
+    ___BK_IF_TYPE_ManagerWithSalary(ManagerWithSalary*: parse_json_ManagerWithSalary)\
+    ___BK_IF_TYPE_Person(Person*: parse_json_Person)\
+    ___BK_IF_TYPE_Manager(Manager*: parse_json_Manager)\
+    ___BK_IF_TYPE_Friend(Friend*: parse_json_Friend)\
+
+#ifdef parse_json
+
+#undef parse_json
+
+#endif // parse_json
+
+#define parse_json(src, len, dst)\
+_Generic((dst), ___BK_GENERIC_PARSE_json_CASES default: NULL)((src), (len), (dst))
+#endif // BK_DISABLE_json_PARSE
+#endif // BK_DISABLE_json
+#endif // BK_DISABLE_PARSE
+#ifndef BK_DISABLE_DUMP
+#ifndef BK_DISABLE_debug
+#ifndef BK_DISABLE_debug_DUMP
+#ifdef ___BK_GENERIC_DUMP_debug_CASES
+#undef ___BK_GENERIC_DUMP_debug_CASES
+#endif // ___BK_GENERIC_DUMP_debug_CASES
+#define ___BK_GENERIC_DUMP_debug_CASES\
+    ___BK_IF_TYPE_ManagerWithSalary(ManagerWithSalary*: dump_debug_ManagerWithSalary)\
+    ___BK_IF_TYPE_Person(Person*: dump_debug_Person)\
+    ___BK_IF_TYPE_Manager(Manager*: dump_debug_Manager)\
+    ___BK_IF_TYPE_Friend(Friend*: dump_debug_Friend)\
+
+#ifdef dump_debug
+
+#undef dump_debug
+
+#endif // dump_debug
+
+#define dump_debug(item, dst)\
+_Generic((item), ___BK_GENERIC_DUMP_debug_CASES default: NULL)((item), (dst))
+#endif // BK_DISABLE_debug_DUMP
+#endif // BK_DISABLE_debug
+#endif // BK_DISABLE_DUMP
+#ifndef BK_DISABLE_PARSE
+#ifndef BK_DISABLE_debug
+#ifndef BK_DISABLE_debug_PARSE
+#ifdef ___BK_GENERIC_PARSE_debug_CASES
+#undef ___BK_GENERIC_PARSE_debug_CASES
+#endif // ___BK_GENERIC_PARSE_debug_CASES
+#define ___BK_GENERIC_PARSE_debug_CASES\
+    ___BK_IF_TYPE_ManagerWithSalary(ManagerWithSalary*: parse_debug_ManagerWithSalary)\
+    ___BK_IF_TYPE_Person(Person*: parse_debug_Person)\
+    ___BK_IF_TYPE_Manager(Manager*: parse_debug_Manager)\
+    ___BK_IF_TYPE_Friend(Friend*: parse_debug_Friend)\
+
+#ifdef parse_debug
+
+#undef parse_debug
+
+#endif // parse_debug
+
+#define parse_debug(src, len, dst)\
+_Generic((dst), ___BK_GENERIC_PARSE_debug_CASES default: NULL)((src), (len), (dst))
+#endif // BK_DISABLE_debug_PARSE
+#endif // BK_DISABLE_debug
+#endif // BK_DISABLE_PARSE